@@ -4,10 +4,14 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -147,4 +151,52 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateSortSortedMultipleGroupBy)(b
   }
 }
 
+/**
+ * Measures AggregateHash for a growing number of groups, single-threaded (range(1) == 0) and with the
+ * NodeQueueScheduler (range(1) == 1). With few groups, the thread-local pre-aggregation tables of the parallel
+ * aggregation stay small. With many groups, they overflow and most of the work is done when merging the radix
+ * partitions.
+ */
+static void BM_AggregateHashGroupCount(benchmark::State& state) {  // NOLINT
+  const auto group_count = static_cast<int32_t>(state.range(0));
+  const auto multi_threaded = state.range(1) == 1;
+  constexpr auto ROW_COUNT = 4'000'000;
+
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Double, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE);
+  for (auto row_id = 0; row_id < ROW_COUNT; ++row_id) {
+    // Multiplying with a prime scatters the groups over the chunks
+    table->append({static_cast<int32_t>((static_cast<int64_t>(row_id) * 7919) % group_count), row_id % 1000,
+                   static_cast<double>(row_id % 97)});
+  }
+  table->last_chunk()->finalize();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::Double, false, "c");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      min_(b), sum_(b), avg_(c), standard_deviation_sample_(c),
+      count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0} /* "a" */};
+
+  if (multi_threaded) Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto warm_up = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+BENCHMARK(BM_AggregateHashGroupCount)
+    ->ArgsProduct({{4, 10'000, 1'000'000}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace opossum
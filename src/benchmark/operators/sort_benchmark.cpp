@@ -33,7 +33,8 @@ static std::shared_ptr<Table> generate_custom_table(const size_t row_count, cons
 
 static void BM_Sort(benchmark::State& state, const size_t row_count = 40'000, const DataType data_type = DataType::Int,
                     const float null_ratio = 0.0f, const bool multi_column_sort = true,
-                    const bool use_reference_segment = false) {
+                    const bool use_reference_segment = false,
+                    const Sort::Strategy strategy = Sort::Strategy::ColumnByColumn) {
   micro_benchmark_clear_cache();
 
   const auto input_table = generate_custom_table(row_count, data_type, null_ratio);
@@ -54,7 +55,8 @@ static void BM_Sort(benchmark::State& state, const size_t row_count = 40'000, co
   }
 
   for (auto _ : state) {
-    auto sort = std::make_shared<Sort>(input_operator, sort_definitions);
+    auto sort = std::make_shared<Sort>(input_operator, sort_definitions, Chunk::DEFAULT_SIZE,
+                                       Sort::ForceMaterialization::No, strategy);
     sort->execute();
   }
 }
@@ -89,11 +91,41 @@ static void BM_SortWithStrings(benchmark::State& state) {
   BM_Sort(state, row_count, DataType::String);
 }
 
+static void BM_SortNormalizedKeys(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.0f, false, false, Sort::Strategy::NormalizedKeys);
+}
+
+static void BM_SortTwoColumnsNormalizedKeys(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.0f, true, false, Sort::Strategy::NormalizedKeys);
+}
+
+static void BM_SortWithNullValuesNormalizedKeys(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.2f, true, false, Sort::Strategy::NormalizedKeys);
+}
+
+static void BM_SortWithReferenceSegmentsTwoColumnsNormalizedKeys(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.0f, true, true, Sort::Strategy::NormalizedKeys);
+}
+
+static void BM_SortWithStringsNormalizedKeys(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::String, 0.0f, true, false, Sort::Strategy::NormalizedKeys);
+}
+
 BENCHMARK(BM_Sort)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortTwoColumns)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithNullValues)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegments)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegmentsTwoColumns)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithStrings)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortNormalizedKeys)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortTwoColumnsNormalizedKeys)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortWithNullValuesNormalizedKeys)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortWithReferenceSegmentsTwoColumnsNormalizedKeys)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortWithStringsNormalizedKeys)->RangeMultiplier(100)->Range(100, 1'000'000);
 
 }  // namespace opossum
@@ -4,8 +4,13 @@
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_scan/simd_scan_kernels.hpp"
 #include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -57,6 +62,115 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+namespace {
+
+// Creates a table with ten chunks of 200'000 rows and a single column. Each chunk contains the values
+// [0, distinct_value_count) in a shuffled order.
+std::shared_ptr<Table> create_single_column_table(const DataType data_type, const int32_t distinct_value_count) {
+  constexpr auto CHUNK_SIZE = ChunkOffset{200'000};
+  constexpr auto CHUNK_COUNT = 10;
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", data_type, false}}, TableType::Data);
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < CHUNK_COUNT; ++chunk_id) {
+        auto values = pmr_vector<ColumnDataType>(CHUNK_SIZE);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < CHUNK_SIZE; ++chunk_offset) {
+          values[chunk_offset] = static_cast<ColumnDataType>((chunk_offset * 7919) % distinct_value_count);
+        }
+        table->append_chunk({std::make_shared<ValueSegment<ColumnDataType>>(std::move(values))});
+        table->last_chunk()->finalize();
+      }
+    } else {
+      Fail("Only arithmetic types are supported");
+    }
+  });
+  return table;
+}
+
+}  // namespace
+
+/**
+ * Compares the SIMD scan kernels of ColumnVsValueTableScanImpl. The first argument is the kernel (see SimdScanKernel),
+ * the second one the data layout:
+ *
+ *  0-2: Dictionary-encoded int column with 100, 10'000, and 100'000 distinct values per chunk, which results in
+ *       attribute vectors with 1, 2, and 4 bytes per value
+ *  3-4: Unencoded int and float columns
+ *
+ * The predicate matches half of the rows.
+ */
+static void BM_TableScanSimdKernel(benchmark::State& state) {  // NOLINT
+  const auto kernel = static_cast<SimdScanKernel>(state.range(0));
+  const auto layout = state.range(1);
+  if (!simd_scan_kernel_supported(kernel)) {
+    state.SkipWithError("Kernel is not supported by this CPU");
+    return;
+  }
+
+  const auto distinct_value_counts = std::vector<int32_t>{100, 10'000, 100'000, 100'000, 100'000};
+  const auto distinct_value_count = distinct_value_counts[layout];
+  const auto data_type = layout == 4 ? DataType::Float : DataType::Int;
+  const auto table = create_single_column_table(data_type, distinct_value_count);
+  if (layout <= 2) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary,
+                                                               VectorCompressionType::FixedSizeByteAligned});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto search_value = data_type == DataType::Float ? AllTypeVariant{static_cast<float>(distinct_value_count / 2)}
+                                                         : AllTypeVariant{distinct_value_count / 2};
+
+  const auto previous_kernel = simd_scan_kernel();
+  set_simd_scan_kernel(kernel);
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan, search_value);
+  set_simd_scan_kernel(previous_kernel);
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table->row_count()));
+}
+
+BENCHMARK(BM_TableScanSimdKernel)
+    ->ArgsProduct({{static_cast<int64_t>(SimdScanKernel::Scalar), static_cast<int64_t>(SimdScanKernel::AVX2),
+                    static_cast<int64_t>(SimdScanKernel::AVX512)},
+                   {0, 1, 2, 3, 4}});
+
+/**
+ * Compares scans on dictionary segments whose attribute vectors are compressed with FixedSizeByteAligned (first
+ * argument 0) and SIMD-BP128 (1). The second argument is the number of distinct values per chunk. The third argument
+ * selects the predicate: 0 for a column-vs-value scan (<), 1 for a between scan. Both match half of the rows.
+ */
+static void BM_TableScanVectorCompression(benchmark::State& state) {  // NOLINT
+  const auto vector_compression_type =
+      state.range(0) == 0 ? VectorCompressionType::FixedSizeByteAligned : VectorCompressionType::SimdBp128;
+  const auto distinct_value_count = static_cast<int32_t>(state.range(1));
+
+  const auto table = create_single_column_table(DataType::Int, distinct_value_count);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary, vector_compression_type});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  if (state.range(2) == 0) {
+    benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan,
+                             distinct_value_count / 2);
+  } else {
+    const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "");
+    const auto predicate =
+        between_inclusive_(column, value_(distinct_value_count / 4), value_(distinct_value_count * 3 / 4 - 1));
+    for (auto _ : state) {
+      const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+      table_scan->execute();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table->row_count()));
+}
+
+BENCHMARK(BM_TableScanVectorCompression)->ArgsProduct({{0, 1}, {100, 10'000, 100'000}, {0, 1}});
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -0,0 +1,69 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the task throughput of the NodeQueueScheduler for 1..N workers. Similar to JoinHash or AggregateHash, a
+ * root task spawns many small JobTasks and waits for them. The first argument is the number of workers, the second
+ * one the number of tasks spawned by each of the (number of workers) root tasks.
+ */
+static void BM_SchedulerTaskThroughput(benchmark::State& state, const NodeQueueScheduler::Mode mode) {  // NOLINT
+  const auto num_workers = static_cast<uint32_t>(state.range(0));
+  const auto tasks_per_root_task = static_cast<size_t>(state.range(1));
+
+  Hyrise::get().topology.use_non_numa_topology(num_workers);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(mode));
+
+  auto counter = std::atomic<size_t>{0};
+
+  for (auto _ : state) {
+    auto root_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    root_tasks.reserve(num_workers);
+    for (auto root_task_id = uint32_t{0}; root_task_id < num_workers; ++root_task_id) {
+      root_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        jobs.reserve(tasks_per_root_task);
+        for (auto task_id = size_t{0}; task_id < tasks_per_root_task; ++task_id) {
+          jobs.emplace_back(std::make_shared<JobTask>([&]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        // Do not use schedule_and_wait_for_tasks, as the grouping of tasks would limit the parallelism
+        AbstractScheduler::schedule_tasks(jobs);
+        AbstractScheduler::wait_for_tasks(jobs);
+      }));
+    }
+    AbstractScheduler::schedule_tasks(root_tasks);
+    AbstractScheduler::wait_for_tasks(root_tasks);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(counter.load()));
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+static void SchedulerBenchmarkArguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_num_workers = static_cast<int>(std::thread::hardware_concurrency());
+  auto num_workers = 1;
+  for (; num_workers < max_num_workers; num_workers *= 2) {
+    benchmark->Args({num_workers, 10'000});
+  }
+  benchmark->Args({max_num_workers, 10'000});
+  benchmark->UseRealTime();
+}
+
+BENCHMARK_CAPTURE(BM_SchedulerTaskThroughput, NodeQueues, NodeQueueScheduler::Mode::NodeQueues)
+    ->Apply(SchedulerBenchmarkArguments);
+BENCHMARK_CAPTURE(BM_SchedulerTaskThroughput, WorkStealingDeques, NodeQueueScheduler::Mode::WorkStealingDeques)
+    ->Apply(SchedulerBenchmarkArguments);
+
+}  // namespace opossum
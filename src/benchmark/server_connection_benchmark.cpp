@@ -0,0 +1,133 @@
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "server/server.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Minimal PostgreSQL client without SSL and authentication. It only sends simple queries and discards the results.
+class BenchmarkClient {
+ public:
+  BenchmarkClient(boost::asio::io_service& io_service, const boost::asio::ip::tcp::endpoint& endpoint)
+      : _socket(io_service) {
+    _socket.connect(endpoint);
+    _socket.set_option(boost::asio::ip::tcp::no_delay(true));
+
+    // Startup message: length, protocol version 3.0, and an empty list of parameters
+    _send(std::string{'\0', '\0', '\0', '\x09', '\0', '\x03', '\0', '\0', '\0'});
+    _read_until_ready_for_query();
+  }
+
+  ~BenchmarkClient() { _send(std::string{'X', '\0', '\0', '\0', '\x04'}); }
+
+  void query(const std::string& sql) {
+    auto message = std::string{'Q'};
+    const auto length = htonl(static_cast<uint32_t>(sizeof(uint32_t) + sql.size() + 1));
+    message.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    message.append(sql);
+    message.push_back('\0');
+    _send(message);
+    _read_until_ready_for_query();
+  }
+
+ private:
+  void _send(const std::string& message) { boost::asio::write(_socket, boost::asio::buffer(message)); }
+
+  void _read_until_ready_for_query() {
+    auto header = std::array<char, sizeof(char) + sizeof(uint32_t)>{};
+    auto body = std::vector<char>{};
+    while (true) {
+      boost::asio::read(_socket, boost::asio::buffer(header));
+      auto length = uint32_t{};
+      std::memcpy(&length, header.data() + 1, sizeof(length));
+      body.resize(ntohl(length) - sizeof(uint32_t));
+      boost::asio::read(_socket, boost::asio::buffer(body));
+
+      if (header[0] == 'E') {
+        const auto error_message = std::string{body.begin(), body.end()};
+        Fail("Query failed: " + error_message);
+      }
+      if (header[0] == 'Z') return;
+    }
+  }
+
+  boost::asio::ip::tcp::socket _socket;
+};
+
+}  // namespace
+
+/**
+ * Measures the query throughput of the server for a growing number of open connections. All connections stay open
+ * during the measurement, but only (number of client threads) of them have a query in flight at a time: the client
+ * threads send simple queries round-robin over their connections. Ideally, the throughput does not depend on the
+ * number of connections. Note that each connection requires two file descriptors in this process, so the limit of
+ * open files (ulimit -n) might have to be raised for the larger configurations.
+ */
+static void BM_ServerConnectionScaling(benchmark::State& state) {  // NOLINT
+  const auto connection_count = static_cast<size_t>(state.range(0));
+  const auto client_thread_count = std::min(connection_count, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+  const auto address = boost::asio::ip::make_address("127.0.0.1");
+  auto server = Server{address, 0, SendExecutionInfo::No};
+  auto server_thread = std::thread{[&]() { server.run(); }};
+  while (!server.is_initialized()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  auto io_service = boost::asio::io_service{};
+  const auto endpoint = boost::asio::ip::tcp::endpoint{address, server.server_port()};
+  auto clients = std::vector<std::unique_ptr<BenchmarkClient>>{};
+  clients.reserve(connection_count);
+  for (auto client_id = size_t{0}; client_id < connection_count; ++client_id) {
+    clients.emplace_back(std::make_unique<BenchmarkClient>(io_service, endpoint));
+  }
+
+  auto query_count = std::atomic<size_t>{0};
+
+  for (auto _ : state) {
+    auto client_threads = std::vector<std::thread>{};
+    client_threads.reserve(client_thread_count);
+    for (auto thread_id = size_t{0}; thread_id < client_thread_count; ++thread_id) {
+      client_threads.emplace_back([&, thread_id]() {
+        for (auto client_id = thread_id; client_id < connection_count; client_id += client_thread_count) {
+          clients[client_id]->query("SELECT 1;");
+          query_count.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+    }
+    for (auto& client_thread : client_threads) {
+      client_thread.join();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(query_count.load()));
+
+  // Disconnect all clients so that the server can shut down
+  clients.clear();
+  server.shutdown();
+  server_thread.join();
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+BENCHMARK(BM_ServerConnectionScaling)->RangeMultiplier(8)->Range(1, 4096)->UseRealTime();
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -19,7 +20,7 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Logging is optional (--write_ahead_log) and the durability tests are not executed
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,7 +42,8 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("write_ahead_log", "Log committed transactions to this file. If it exists, the transactions of the previous run are replayed into the generated tables first, which requires the same scale factor and chunk size. Disabled if empty", cxxopts::value<std::string>()->default_value("")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
@@ -55,6 +57,7 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  const auto write_ahead_log_path = cli_parse_result["write_ahead_log"].as<std::string>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -68,12 +71,34 @@ int main(int argc, char* argv[]) {
 
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("write_ahead_log", !write_ahead_log_path.empty());
 
-  // Run the benchmark
+  // Generate the tables
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
-  BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
-                  context)
-      .run();
+  auto benchmark_runner = BenchmarkRunner(
+      *config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config), context);
+
+  if (!write_ahead_log_path.empty()) {
+    // The table generation is deterministic, so the rows logged by a previous run are at the same positions
+    const auto recovered_transactions = WriteAheadLog::recover_and_enable(write_ahead_log_path);
+    std::cout << "- Recovered " << recovered_transactions << " transactions from " << write_ahead_log_path
+              << ", logging committed transactions to it" << std::endl;
+    // SQLite was loaded with the generated tables
+    Assert(!config->verify || recovered_transactions == 0, "Cannot run verification after recovering transactions");
+  }
+
+  // Run the benchmark
+  benchmark_runner.run();
+
+  if (const auto& write_ahead_log = Hyrise::get().write_ahead_log) {
+    const auto statistics = write_ahead_log->statistics();
+    const auto transactions = std::max(statistics.logged_transactions, uint64_t{1});
+    std::cout << "- Write-ahead log: " << statistics.logged_transactions << " transactions in " << statistics.flushes
+              << " flushes (" << statistics.written_bytes << " bytes), average commit latency "
+              << std::chrono::duration_cast<std::chrono::microseconds>(statistics.total_commit_latency).count() /
+                     transactions
+              << " µs" << std::endl;
+  }
 
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
@@ -7,6 +7,7 @@
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
@@ -15,8 +16,13 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "optimizer/strategy/dips_pruning_rule.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/table.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "types.hpp"
 
@@ -102,6 +108,57 @@ class TPCHDataMicroBenchmarkFixture : public MicroBenchmarkBasicFixture {
     return wrapper_map;
   }
 
+  // Joins orders and lineitem on the order key with a selective predicate on o_orderkey. The ChunkPruningRule prunes
+  // the chunks of orders. If dips_pruning is set, the DipsPruningRule prunes the chunks of lineitem that have no join
+  // partner in the remaining chunks of orders. As each table of the data set consists of a single chunk, copies of
+  // orders and lineitem with a chunk size of 5,000 are used.
+  void join_with_chunk_pruning(::benchmark::State& state, const bool dips_pruning) {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    for (const auto& table_name : {std::string{"orders"}, std::string{"lineitem"}}) {
+      if (storage_manager.has_table(table_name + "_chunked")) continue;
+
+      const auto table = storage_manager.get_table(table_name);
+      const auto chunked_table =
+          std::make_shared<Table>(table->column_definitions(), TableType::Data, ChunkOffset{5'000}, UseMvcc::Yes);
+      for (const auto& row : table->get_rows()) {
+        chunked_table->append(row);
+      }
+      chunked_table->last_chunk()->finalize();
+      ChunkEncoder::encode_all_chunks(chunked_table, SegmentEncodingSpec{EncodingType::Dictionary});
+      storage_manager.add_table(table_name + "_chunked", chunked_table);
+    }
+
+    const auto orders_node = StoredTableNode::make("orders_chunked");
+    const auto lineitem_node = StoredTableNode::make("lineitem_chunked");
+    const auto orders_orderkey = orders_node->get_column("o_orderkey");
+
+    // clang-format off
+    const auto lqp =
+    JoinNode::make(JoinMode::Inner, equals_(orders_orderkey, lineitem_node->get_column("l_orderkey")),
+      PredicateNode::make(less_than_(orders_orderkey, 6'000),
+        orders_node),
+      lineitem_node);
+    // clang-format on
+
+    auto optimizer = Optimizer{};
+    optimizer.add_rule(std::make_unique<ChunkPruningRule>());
+    if (dips_pruning) optimizer.add_rule(std::make_unique<DipsPruningRule>());
+
+    visit_lqp(optimizer.optimize(lqp->deep_copy()), [&](const auto& node) {
+      if (const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node)) {
+        state.counters[stored_table_node->table_name + "_pruned_chunks"] =
+            static_cast<double>(stored_table_node->pruned_chunk_ids().size());
+      }
+      return LQPVisitation::VisitInputs;
+    });
+
+    for (auto _ : state) {
+      const auto pqp = LQPTranslator{}.translate_node(optimizer.optimize(lqp->deep_copy()));
+      const auto tasks = OperatorTask::make_tasks_from_operator(pqp);
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+    }
+  }
+
   inline static bool _tpch_data_generated = false;
 
   std::map<std::string, std::shared_ptr<TableWrapper>> _table_wrapper_map;
@@ -303,4 +360,12 @@ BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_HashSemiProbeRelationLarger)(bench
   }
 }
 
+BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_JoinWithChunkPruning)(benchmark::State& state) {
+  join_with_chunk_pruning(state, false);
+}
+
+BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_JoinWithDipsPruning)(benchmark::State& state) {
+  join_with_chunk_pruning(state, true);
+}
+
 }  // namespace opossum
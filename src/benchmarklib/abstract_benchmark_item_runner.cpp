@@ -65,6 +65,7 @@ std::tuple<bool, std::vector<SQLPipelineMetrics>, bool> AbstractBenchmarkItemRun
   }
 
   BenchmarkSQLExecutor sql_executor(_sqlite_wrapper, visualize_prefix);
+  sql_executor.memory_budget = _config->memory_budget;
   auto success = _on_execute_item(item_id, sql_executor);
   return {success, std::move(sql_executor.metrics), sql_executor.any_verification_failed};
 }
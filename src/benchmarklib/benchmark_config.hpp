@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include "encoding_config.hpp"
 #include "storage/chunk.hpp"
@@ -23,7 +24,8 @@ class BenchmarkConfig {
                   const Duration& max_duration, const Duration& warmup_duration,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables, const bool metrics);
+                  const bool cache_binary_tables, const bool metrics, const bool pipelining,
+                  const std::optional<size_t>& memory_budget);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +44,8 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool metrics = false;
+  bool pipelining = false;
+  std::optional<size_t> memory_budget = std::nullopt;  // Per-query budget in bytes, see BudgetedMemoryResource
 
  private:
   BenchmarkConfig() = default;
@@ -30,6 +30,7 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
       _context(context) {
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  Hyrise::get().enable_pipelining = config.pipelining;
 
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
@@ -447,6 +448,14 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     report["segments"] = _sql_to_json("SELECT * FROM benchmark_segments_log");
   }
 
+  if (const auto& write_ahead_log = Hyrise::get().write_ahead_log) {
+    const auto statistics = write_ahead_log->statistics();
+    report["write_ahead_log"] = nlohmann::json{{"logged_transactions", statistics.logged_transactions},
+                                               {"flushes", statistics.flushes},
+                                               {"written_bytes", statistics.written_bytes},
+                                               {"total_commit_latency", statistics.total_commit_latency.count()}};
+  }
+
   stream << std::setw(2) << report << std::endl;
 }
 
@@ -487,7 +496,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value(default_dont_cache_binary_tables)) // NOLINT
-    ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("pipelining", "Execute chains of TableScans and Validates as pipelines instead of materializing each operator's output", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("memory_budget", "Memory budget per query in MB (0 = unlimited). Queries that exceed it spill intermediate data to disk", cxxopts::value<size_t>()->default_value("0")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -526,6 +537,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"pipelining", config.pipelining},
+      {"memory_budget", config.memory_budget.value_or(0)},
       {"time_unit", "ns"},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
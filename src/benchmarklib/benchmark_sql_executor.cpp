@@ -1,5 +1,6 @@
 #include "benchmark_sql_executor.hpp"
 
+#include "memory/budgeted_memory_resource.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "utils/check_table_equal.hpp"
 #include "utils/timer.hpp"
@@ -25,7 +26,13 @@ std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> BenchmarkSQLExecutor:
 
   auto pipeline = pipeline_builder.create_pipeline();
 
-  const auto [pipeline_status, result_table] = pipeline.get_result_table();
+  auto memory_resource = std::shared_ptr<BudgetedMemoryResource>{};
+  if (memory_budget) memory_resource = BudgetedMemoryResource::create(*memory_budget);
+
+  const auto [pipeline_status, result_table] = [&]() {
+    const auto memory_resource_scope = MemoryResourceScope{memory_resource};
+    return pipeline.get_result_table();
+  }();
 
   if (pipeline_status == SQLPipelineStatus::Failure) {
     return {pipeline_status, nullptr};
@@ -37,6 +37,10 @@ class BenchmarkSQLExecutor {
   // Can optionally be set by the caller. Otherwise, pipelines are auto-committed
   std::shared_ptr<TransactionContext> transaction_context = nullptr;
 
+  // Can optionally be set by the caller. If set, each SQL query is executed with its own BudgetedMemoryResource, so
+  // that memory-intensive operators spill to disk once they would exceed the budget (in bytes).
+  std::optional<size_t> memory_budget;
+
  private:
   void _compare_tables(const std::shared_ptr<const Table>& actual_result_table,
                        const std::shared_ptr<const Table>& expected_result_table,
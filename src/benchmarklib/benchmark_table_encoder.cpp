@@ -55,11 +55,9 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
 
 namespace opossum {
 
-bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                                   const EncodingConfig& encoding_config) {
-  /**
-   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
-   */
+ChunkEncodingSpec BenchmarkTableEncoder::chunk_encoding_spec(const std::string& table_name,
+                                                             const std::shared_ptr<Table>& table,
+                                                             const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -91,15 +89,34 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
 
     // No column-specific or type-specific encoding was specified.
-    // Use default if it is compatible with the column type or leave column Unencoded if it is not.
+    // Use default if it is compatible with the column type or leave column Unencoded if it is not (reported by
+    // encode()).
     if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
+      chunk_encoding_spec.emplace_back(EncodingType::Unencoded);
+    }
+  }
+
+  return chunk_encoding_spec;
+}
+
+bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                   const EncodingConfig& encoding_config) {
+  /**
+   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
+   */
+  const auto chunk_encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, table, encoding_config);
+
+  const auto default_encoding_type = encoding_config.default_encoding_spec.encoding_type;
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto column_data_type = table->column_data_type(column_id);
+    if (chunk_encoding_spec[column_id].encoding_type == EncodingType::Unencoded &&
+        !encoding_supports_data_type(default_encoding_type, column_data_type)) {
       std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
       std::cout << column_data_type << " cannot be encoded as ";
-      std::cout << encoding_config.default_encoding_spec.encoding_type << " and is ";
+      std::cout << default_encoding_type << " and is ";
       std::cout << "left Unencoded." << std::endl;
-      chunk_encoding_spec.emplace_back(EncodingType::Unencoded);
     }
   }
 
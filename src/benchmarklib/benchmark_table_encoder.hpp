@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "storage/encoding_type.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -10,6 +12,11 @@ class Table;
 
 class BenchmarkTableEncoder {
  public:
+  // @return      The encoding of the columns of @param table as required by @param encoding_config. Columns whose data
+  //              type does not support the requested encoding are left unencoded.
+  static ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                               const EncodingConfig& encoding_config);
+
   // @param out   stream for logging info
   // @return      true, if any encoding operation was performed.
   //              false, if the @param table was already encoded as required by @param encoding_config
@@ -131,10 +131,23 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
+  const auto pipelining = parse_result["pipelining"].as<bool>();
+  if (pipelining) {
+    std::cout << "- Executing chains of TableScans and Validates as pipelines" << std::endl;
+  }
+
+  auto memory_budget = std::optional<size_t>{};
+  const auto memory_budget_mb = parse_result["memory_budget"].as<size_t>();
+  if (memory_budget_mb > 0) {
+    memory_budget = memory_budget_mb * 1'000'000;
+    std::cout << "- Limiting the memory of each query to " << memory_budget_mb
+              << " MB, spilling JoinHash, AggregateHash, and Sort to disk if necessary" << std::endl;
+  }
+
   return BenchmarkConfig{
-      benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
-      warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
-      verify,          cache_binary_tables, metrics};
+      benchmark_mode,  chunk_size,          *encoding_config, indexes,    max_runs,     timeout_duration,
+      warmup_duration, output_file_path,    enable_scheduler, cores,      clients,      enable_visualization,
+      verify,          cache_binary_tables, metrics,          pipelining, memory_budget};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
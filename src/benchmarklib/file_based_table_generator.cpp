@@ -5,6 +5,7 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/csv/csv_meta.hpp"
 #include "import_export/csv/csv_parser.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/list_directory.hpp"
@@ -92,7 +93,12 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
       if (extension == ".tbl") {
         table_info.table = load_table(*table_info.text_file_path, _benchmark_config->chunk_size);
       } else if (extension == ".csv") {
-        table_info.table = CsvParser::parse(*table_info.text_file_path, _benchmark_config->chunk_size);
+        // Encode the chunks while they are parsed, so that the encoding step of generate_and_store() has nothing to do
+        const auto csv_file_path = table_info.text_file_path->string();
+        const auto csv_meta = process_csv_meta_file(csv_file_path + CsvMeta::META_FILE_EXTENSION);
+        const auto encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(
+            table_name, CsvParser::create_table_from_meta(csv_meta), _benchmark_config->encoding_config);
+        table_info.table = CsvParser::parse(csv_file_path, _benchmark_config->chunk_size, csv_meta, encoding_spec);
       } else {
         Fail("Unknown textual file format. This should have been caught earlier.");
       }
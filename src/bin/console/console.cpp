@@ -24,6 +24,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/checkpoint.hpp"
 #include "import_export/file_type.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/export.hpp"
@@ -40,7 +41,7 @@
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
-#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -48,6 +49,7 @@
 #include "utils/load_table.hpp"
 #include "utils/meta_table_manager.hpp"
 #include "utils/string_utils.hpp"
+#include "utils/timer.hpp"
 #include "visualization/join_graph_visualizer.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
@@ -146,6 +148,9 @@ Console::Console()
   register_command("generate_tpcds", std::bind(&Console::_generate_tpcds, this, std::placeholders::_1));
   register_command("load", std::bind(&Console::_load_table, this, std::placeholders::_1));
   register_command("export", std::bind(&Console::_export_table, this, std::placeholders::_1));
+  register_command("checkpoint", std::bind(&Console::_write_checkpoint, this, std::placeholders::_1));
+  register_command("load_checkpoint", std::bind(&Console::_load_checkpoint, this, std::placeholders::_1));
+  register_command("write_ahead_log", std::bind(&Console::_recover_write_ahead_log, this, std::placeholders::_1));
   register_command("script", std::bind(&Console::_exec_script, this, std::placeholders::_1));
   register_command("print", std::bind(&Console::_print_table, this, std::placeholders::_1));
   register_command("visualize", std::bind(&Console::_visualize, this, std::placeholders::_1));
@@ -433,6 +438,10 @@ int Console::_help(const std::string&) {
   out("  export TABLENAME FILEPATH               - Export table named TABLENAME from storage manager to filepath FILEPATH\n");  // NOLINT
   out("                                               The export type is chosen by the type of FILEPATH.\n");
   out("                                                 Supported types: '.bin', '.csv'\n");
+  out("  checkpoint FILEPATH                     - Write all tables (including MVCC data) to the checkpoint FILEPATH\n");  // NOLINT
+  out("  load_checkpoint FILEPATH                - Load all tables from the checkpoint FILEPATH\n");
+  out("  write_ahead_log FILEPATH                - Replay the write-ahead log FILEPATH into the loaded tables and log\n");  // NOLINT
+  out("                                               committed transactions to it\n");
   out("  script SCRIPTFILE                       - Execute script specified by SCRIPTFILE\n");
   out("  print TABLENAME                         - Fully print the given table (including MVCC data)\n");
   out("  visualize [options] [SQL]               - Visualize a SQL query\n");
@@ -544,50 +553,45 @@ int Console::_load_table(const std::string& args) {
   const auto filepath = std::filesystem::path{arguments.at(0)};
   const auto tablename = arguments.size() >= 2 ? arguments.at(1) : std::string{filepath.stem()};
 
+  const std::string encoding = arguments.size() == 3 ? arguments.at(2) : "Unencoded";
+
+  const auto encoding_type = encoding_type_to_string.right.find(encoding);
+  if (encoding_type == encoding_type_to_string.right.end()) {
+    const auto encoding_options = boost::algorithm::join(
+        encoding_type_to_string.right | boost::adaptors::transformed([](auto it) { return it.first; }), ", ");
+    out("Error: Invalid encoding type: '" + encoding + "', try one of these: " + encoding_options + "\n");
+    return ReturnCode::Error;
+  }
+
   out("Loading " + std::string(filepath) + " into table \"" + tablename + "\"\n");
 
   if (Hyrise::get().storage_manager.has_table(tablename)) {
     out("Table \"" + tablename + "\" already existed. Replacing it.\n");
   }
 
+  // The Import encodes the chunks while loading them
+  auto target_encoding = std::optional<EncodingType>{};
+  if (encoding_type->second != EncodingType::Unencoded) {
+    out("Encoding \"" + tablename + "\" using " + encoding + "\n");
+    target_encoding = encoding_type->second;
+  }
+
   try {
-    auto importer = std::make_shared<Import>(filepath, tablename, Chunk::DEFAULT_SIZE);
+    auto importer = std::make_shared<Import>(filepath, tablename, Chunk::DEFAULT_SIZE, FileType::Auto, std::nullopt,
+                                             target_encoding);
     importer->execute();
   } catch (const std::exception& exception) {
     out("Error: Exception thrown while importing table:\n  " + std::string(exception.what()) + "\n");
     return ReturnCode::Error;
   }
 
-  const std::string encoding = arguments.size() == 3 ? arguments.at(2) : "Unencoded";
-
-  const auto encoding_type = encoding_type_to_string.right.find(encoding);
-  if (encoding_type == encoding_type_to_string.right.end()) {
-    const auto encoding_options = boost::algorithm::join(
-        encoding_type_to_string.right | boost::adaptors::transformed([](auto it) { return it.first; }), ", ");
-    out("Error: Invalid encoding type: '" + encoding + "', try one of these: " + encoding_options + "\n");
-    return ReturnCode::Error;
-  }
-
-  // Check if the specified encoding can be used
+  // Report the columns that the Import left unencoded
   const auto& table = Hyrise::get().storage_manager.get_table(tablename);
-  bool supported = true;
   for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
     if (!encoding_supports_data_type(encoding_type->second, table->column_data_type(column_id))) {
       out("Encoding \"" + encoding + "\" not supported for column \"" + table->column_name(column_id) +
-          "\", table left unencoded\n");
-      supported = false;
-    }
-  }
-
-  if (supported) {
-    out("Encoding \"" + tablename + "\" using " + encoding + "\n");
-    std::vector<ChunkID> immutable_chunks;
-    for (ChunkID chunk_id(0); chunk_id < table->chunk_count(); ++chunk_id) {
-      if (!table->get_chunk(chunk_id)->is_mutable()) {
-        immutable_chunks.emplace_back(chunk_id);
-      }
+          "\", column left unencoded\n");
     }
-    ChunkEncoder::encode_chunks(table, immutable_chunks, SegmentEncodingSpec{encoding_type->second});
   }
 
   return ReturnCode::Ok;
@@ -637,6 +641,80 @@ int Console::_export_table(const std::string& args) {
   return ReturnCode::Ok;
 }
 
+int Console::_write_checkpoint(const std::string& args) {
+  const auto arguments = trim_and_split(args);
+
+  if (arguments.size() != 1) {
+    out("Usage:\n");
+    out("  checkpoint FILEPATH\n");
+    return ReturnCode::Error;
+  }
+
+  const auto& filepath = arguments.at(0);
+  out("Writing checkpoint to \"" + filepath + "\" ...\n");
+
+  try {
+    auto timer = Timer{};
+    Checkpoint::write(filepath);
+    out("Done in " + timer.lap_formatted() + "\n");
+  } catch (const std::exception& exception) {
+    out("Error: Exception thrown while writing the checkpoint:\n  " + std::string(exception.what()) + "\n");
+    return ReturnCode::Error;
+  }
+
+  return ReturnCode::Ok;
+}
+
+int Console::_load_checkpoint(const std::string& args) {
+  const auto arguments = trim_and_split(args);
+
+  if (arguments.size() != 1) {
+    out("Usage:\n");
+    out("  load_checkpoint FILEPATH\n");
+    return ReturnCode::Error;
+  }
+
+  const auto& filepath = arguments.at(0);
+  out("Loading checkpoint from \"" + filepath + "\" ...\n");
+
+  try {
+    auto timer = Timer{};
+    Checkpoint::load(filepath);
+    out("Done in " + timer.lap_formatted() + "\n");
+  } catch (const std::exception& exception) {
+    out("Error: Exception thrown while loading the checkpoint:\n  " + std::string(exception.what()) + "\n");
+    return ReturnCode::Error;
+  }
+
+  return ReturnCode::Ok;
+}
+
+int Console::_recover_write_ahead_log(const std::string& args) {
+  const auto arguments = trim_and_split(args);
+
+  if (arguments.size() != 1) {
+    out("Usage:\n");
+    out("  write_ahead_log FILEPATH\n");
+    return ReturnCode::Error;
+  }
+
+  const auto& filepath = arguments.at(0);
+  out("Recovering from write-ahead log \"" + filepath + "\" ...\n");
+
+  try {
+    auto timer = Timer{};
+    const auto recovered_transactions = WriteAheadLog::recover_and_enable(filepath);
+    out("Recovered " + std::to_string(recovered_transactions) + " transactions in " + timer.lap_formatted() + "\n");
+    out("Committed transactions are logged to \"" + filepath + "\"\n");
+  } catch (const std::exception& exception) {
+    out("Error: Exception thrown while recovering from the write-ahead log:\n  " + std::string(exception.what()) +
+        "\n");
+    return ReturnCode::Error;
+  }
+
+  return ReturnCode::Ok;
+}
+
 int Console::_print_table(const std::string& args) {
   std::vector<std::string> arguments = trim_and_split(args);
 
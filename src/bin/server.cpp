@@ -1,5 +1,7 @@
 #include "cxxopts.hpp"
 
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint.hpp"
 #include "server/server.hpp"
 
 cxxopts::Options get_server_cli_options() {
@@ -11,6 +13,11 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("io_threads", "Number of threads that accept connections and wait for requests. Queries are executed by the scheduler's workers", cxxopts::value<uint32_t>()->default_value(std::to_string(opossum::Server::DEFAULT_IO_THREAD_COUNT))) // NOLINT
+    ("memory_budget", "Memory budget in MB for all running queries (0 = unlimited). New queries are queued while it is nearly exhausted", cxxopts::value<size_t>()->default_value("0")) // NOLINT
+    ("query_memory_budget", "Memory budget in MB per query (0 = unlimited). Queries that exceed it spill intermediate data to disk", cxxopts::value<size_t>()->default_value("0")) // NOLINT
+    ("checkpoint", "Load the base tables from this checkpoint before accepting connections", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("write_ahead_log", "Log committed transactions to this file. If it exists, it is replayed into the base tables first, so it has to belong to the same checkpoint. Disabled if empty", cxxopts::value<std::string>()->default_value("")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -29,13 +36,36 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
+
+  // Queries are admitted and spill to disk depending on their memory (see AdmissionController)
+  auto& admission_controller = *opossum::Hyrise::get().admission_controller;
+  const auto memory_budget_mb = parsed_options["memory_budget"].as<size_t>();
+  if (memory_budget_mb > 0) admission_controller.set_global_budget(memory_budget_mb * 1'000'000);
+  const auto query_memory_budget_mb = parsed_options["query_memory_budget"].as<size_t>();
+  if (query_memory_budget_mb > 0) admission_controller.set_query_budget(query_memory_budget_mb * 1'000'000);
+
+  // Restore the state of the previous run: the base tables from the checkpoint and the transactions committed since
+  const auto checkpoint_path = parsed_options["checkpoint"].as<std::string>();
+  if (!checkpoint_path.empty()) {
+    opossum::Checkpoint::load(checkpoint_path);
+    std::cout << "Loaded checkpoint " << checkpoint_path << std::endl;
+  }
+
+  const auto write_ahead_log_path = parsed_options["write_ahead_log"].as<std::string>();
+  if (!write_ahead_log_path.empty()) {
+    const auto recovered_transactions = opossum::WriteAheadLog::recover_and_enable(write_ahead_log_path);
+    std::cout << "Recovered " << recovered_transactions << " transactions, logging committed transactions to "
+              << write_ahead_log_path << std::endl;
+  }
 
   boost::system::error_code error;
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  auto server =
+      opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info), io_thread_count};
   server.run();
 
   return 0;
@@ -93,6 +93,23 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log) {
+    auto record_writer = WriteAheadLog::RecordWriter{commit_id()};
+    for (const auto& op : _read_write_operators) {
+      op->log_records(record_writer);
+    }
+
+    if (!record_writer.empty()) {
+      // The transaction must not become visible before its records are durable. The log's flushing thread marks it as
+      // pending once the group that contains the records has been synced.
+      write_ahead_log->append(record_writer.finish(), [context = shared_from_this(), callback]() {
+        context->_mark_as_pending_and_try_commit(callback);
+      });
+      return;
+    }
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
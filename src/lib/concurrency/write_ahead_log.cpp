@@ -0,0 +1,424 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include <boost/crc.hpp>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Payload size and checksum
+constexpr auto ENTRY_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+
+uint32_t compute_checksum(const char* data, const size_t size) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data, size);
+  return crc.checksum();
+}
+
+// Reads values from a log entry and fails if the entry is shorter than expected
+class EntryReader {
+ public:
+  EntryReader(const char* begin, const char* end) : _position(begin), _end(end) {}
+
+  template <typename T>
+  T read() {
+    Assert(_position + sizeof(T) <= _end, "Malformed write-ahead log entry");
+    auto value = T{};
+    std::memcpy(&value, _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    Assert(_position + length <= _end, "Malformed write-ahead log entry");
+    auto value = std::string{_position, length};
+    _position += length;
+    return value;
+  }
+
+  bool at_end() const { return _position == _end; }
+
+ private:
+  const char* _position;
+  const char* const _end;
+};
+
+template <>
+pmr_string EntryReader::read<pmr_string>() {
+  const auto value = read_string();
+  return pmr_string{value.begin(), value.end()};
+}
+
+struct InsertRecord {
+  ChunkID chunk_id;
+  ChunkOffset begin_chunk_offset;
+  ChunkOffset end_chunk_offset;
+  // Values of the inserted rows, row by row
+  std::vector<std::vector<AllTypeVariant>> rows;
+};
+
+struct RecoveredTableChanges {
+  std::vector<InsertRecord> inserts;
+  std::vector<RowID> deletes;
+};
+
+InsertRecord read_insert_record(EntryReader& reader, const Table& table) {
+  auto record = InsertRecord{};
+  record.chunk_id = reader.read<ChunkID>();
+  record.begin_chunk_offset = reader.read<ChunkOffset>();
+  record.end_chunk_offset = reader.read<ChunkOffset>();
+  Assert(record.begin_chunk_offset <= record.end_chunk_offset, "Malformed insert record");
+
+  const auto row_count = record.end_chunk_offset - record.begin_chunk_offset;
+  const auto column_count = table.column_count();
+  record.rows.resize(row_count, std::vector<AllTypeVariant>(column_count));
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto nullable = table.column_is_nullable(column_id);
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (auto& row : record.rows) {
+        if (nullable && reader.read<uint8_t>()) {
+          row[column_id] = NULL_VALUE;
+        } else {
+          row[column_id] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  return record;
+}
+
+// Appends a row that is invisible for all transactions, as Insert::_on_rollback_records leaves it behind.
+void append_invisible_row(const Table& table, Chunk& chunk) {
+  auto values = std::vector<AllTypeVariant>(table.column_count());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    if (table.column_is_nullable(column_id)) {
+      values[column_id] = NULL_VALUE;
+      continue;
+    }
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      values[column_id] = ColumnDataType{};
+    });
+  }
+
+  const auto chunk_offset = chunk.size();
+  chunk.append(values);
+  chunk.mvcc_data()->set_end_cid(chunk_offset, CommitID{0});
+  chunk.increase_invalid_row_count(1);
+}
+
+void apply_inserts(Table& table, std::vector<InsertRecord>& inserts) {
+  // Records are logged in commit order, but rows were allocated in execution order
+  std::sort(inserts.begin(), inserts.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.chunk_id, lhs.begin_chunk_offset) < std::tie(rhs.chunk_id, rhs.begin_chunk_offset);
+  });
+
+  for (const auto& insert : inserts) {
+    while (table.chunk_count() <= insert.chunk_id) {
+      // Fill up the previous chunk, if it is mutable, so that the RowIDs match the original ones
+      if (table.chunk_count() > 0) {
+        const auto last_chunk = table.last_chunk();
+        while (last_chunk->is_mutable() && last_chunk->size() < table.target_chunk_size()) {
+          append_invisible_row(table, *last_chunk);
+        }
+      }
+      table.append_mutable_chunk();
+    }
+
+    const auto chunk = table.get_chunk(insert.chunk_id);
+    Assert(chunk && chunk->is_mutable(), "Cannot recover inserts into an immutable chunk");
+    Assert(chunk->size() <= insert.begin_chunk_offset,
+           "Table already contains recovered rows. Was recover() called on a table that has been modified?");
+
+    while (chunk->size() < insert.begin_chunk_offset) {
+      append_invisible_row(table, *chunk);
+    }
+
+    for (const auto& row : insert.rows) {
+      // Chunk::append makes the row visible for everybody (begin_cid 0)
+      chunk->append(row);
+    }
+  }
+}
+
+void apply_deletes(const Table& table, const std::vector<RowID>& deletes) {
+  for (const auto& row_id : deletes) {
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    Assert(chunk && row_id.chunk_offset < chunk->size(), "Deleted row does not exist");
+
+    // Recovered rows were committed "at the beginning of time" (see Chunk::append), the same goes for the deletes
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, CommitID{0});
+    chunk->increase_invalid_row_count(1);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+WriteAheadLog::RecordWriter::RecordWriter(const CommitID commit_id) {
+  // Reserve space for the entry header, which is written in finish()
+  _buffer.resize(ENTRY_HEADER_SIZE);
+  _write(commit_id);
+  _write(uint32_t{0});  // Placeholder for the record count
+}
+
+void WriteAheadLog::RecordWriter::log_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                             const ChunkOffset begin_chunk_offset,
+                                             const ChunkOffset end_chunk_offset) {
+  _write(RecordType::Insert);
+  _write(table_name);
+  _write(chunk_id);
+  _write(begin_chunk_offset);
+  _write(end_chunk_offset);
+
+  const auto chunk = table.get_chunk(chunk_id);
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto nullable = table.column_is_nullable(column_id);
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto segment_accessor = create_segment_accessor<ColumnDataType>(chunk->get_segment(column_id));
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto value = segment_accessor->access(chunk_offset);
+        if (nullable) _write(static_cast<uint8_t>(!value));
+        if (!value) continue;
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          _write(std::string{value->begin(), value->end()});
+        } else {
+          _write(*value);
+        }
+      }
+    });
+  }
+
+  ++_record_count;
+}
+
+void WriteAheadLog::RecordWriter::log_delete(const std::string& table_name, const std::vector<RowID>& row_ids) {
+  if (row_ids.empty()) return;
+
+  _write(RecordType::Delete);
+  _write(table_name);
+  _write(static_cast<uint32_t>(row_ids.size()));
+  for (const auto& row_id : row_ids) {
+    _write(row_id.chunk_id);
+    _write(row_id.chunk_offset);
+  }
+
+  ++_record_count;
+}
+
+bool WriteAheadLog::RecordWriter::empty() const { return _record_count == 0; }
+
+std::vector<char> WriteAheadLog::RecordWriter::finish() {
+  const auto payload_size = static_cast<uint32_t>(_buffer.size() - ENTRY_HEADER_SIZE);
+  std::memcpy(_buffer.data() + ENTRY_HEADER_SIZE + sizeof(CommitID), &_record_count, sizeof(uint32_t));
+
+  const auto checksum = compute_checksum(_buffer.data() + ENTRY_HEADER_SIZE, payload_size);
+  std::memcpy(_buffer.data(), &payload_size, sizeof(uint32_t));
+  std::memcpy(_buffer.data() + sizeof(uint32_t), &checksum, sizeof(uint32_t));
+
+  return std::move(_buffer);
+}
+
+template <typename T>
+void WriteAheadLog::RecordWriter::_write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+  const auto* const data = reinterpret_cast<const char*>(&value);
+  _buffer.insert(_buffer.end(), data, data + sizeof(T));
+}
+
+void WriteAheadLog::RecordWriter::_write(const std::string& value) {
+  _write(static_cast<uint32_t>(value.size()));
+  _buffer.insert(_buffer.end(), value.begin(), value.end());
+}
+
+WriteAheadLog::WriteAheadLog(const std::filesystem::path& path) : _path(path) {
+  _file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open write-ahead log " + path.string() + ": " + std::strerror(errno));
+
+  _flush_thread = std::thread(&WriteAheadLog::_flush_loop, this);
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _entries_appended.notify_one();
+  _flush_thread.join();
+
+  ::close(_file_descriptor);
+}
+
+void WriteAheadLog::append(std::vector<char>&& entry, std::function<void()>&& on_durable) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(!_shutdown, "Cannot append to a write-ahead log that is being shut down");
+    _pending_buffer.insert(_pending_buffer.end(), entry.begin(), entry.end());
+    _pending_entries.emplace_back(PendingEntry{std::move(on_durable), std::chrono::steady_clock::now()});
+  }
+  _entries_appended.notify_one();
+}
+
+WriteAheadLog::Statistics WriteAheadLog::statistics() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _statistics;
+}
+
+const std::filesystem::path& WriteAheadLog::path() const { return _path; }
+
+void WriteAheadLog::_flush_loop() {
+  auto buffer = std::vector<char>{};
+  auto entries = std::vector<PendingEntry>{};
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _entries_appended.wait(lock, [&]() { return _shutdown || !_pending_entries.empty(); });
+      if (_pending_entries.empty()) return;  // Shut down and nothing left to flush
+
+      // Take everything that has been appended so far. Transactions that commit while we write and sync this group
+      // form the next group.
+      std::swap(buffer, _pending_buffer);
+      std::swap(entries, _pending_entries);
+    }
+
+    auto written_bytes = size_t{0};
+    while (written_bytes < buffer.size()) {
+      const auto result = ::write(_file_descriptor, buffer.data() + written_bytes, buffer.size() - written_bytes);
+      if (result < 0 && errno == EINTR) continue;
+      Assert(result >= 0, std::string{"Could not write to write-ahead log: "} + std::strerror(errno));
+      written_bytes += static_cast<size_t>(result);
+    }
+
+#ifdef __APPLE__
+    const auto sync_result = ::fsync(_file_descriptor);
+#else
+    const auto sync_result = ::fdatasync(_file_descriptor);
+#endif
+    Assert(sync_result == 0, std::string{"Could not sync write-ahead log: "} + std::strerror(errno));
+
+    const auto durable_time = std::chrono::steady_clock::now();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      ++_statistics.flushes;
+      _statistics.logged_transactions += entries.size();
+      _statistics.written_bytes += buffer.size();
+      for (const auto& entry : entries) {
+        _statistics.total_commit_latency += durable_time - entry.append_time;
+      }
+    }
+
+    // The callbacks make the transactions visible. As commit IDs are handed out before the records are appended,
+    // the callbacks do not need to be called in commit order - the TransactionManager takes care of that.
+    for (auto& entry : entries) {
+      entry.on_durable();
+    }
+
+    buffer.clear();
+    entries.clear();
+  }
+}
+
+size_t WriteAheadLog::recover(const std::filesystem::path& path) {
+  if (!std::filesystem::exists(path)) return 0;
+
+  auto file = std::ifstream{path, std::ios::binary};
+  Assert(file.is_open(), "Could not open write-ahead log " + path.string());
+  const auto content = std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  file.close();
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto changes_by_table = std::map<std::string, RecoveredTableChanges>{};
+
+  auto recovered_transactions = size_t{0};
+  auto valid_size = size_t{0};
+  while (valid_size + ENTRY_HEADER_SIZE <= content.size()) {
+    auto payload_size = uint32_t{0};
+    auto checksum = uint32_t{0};
+    std::memcpy(&payload_size, content.data() + valid_size, sizeof(uint32_t));
+    std::memcpy(&checksum, content.data() + valid_size + sizeof(uint32_t), sizeof(uint32_t));
+
+    const auto* const payload_begin = content.data() + valid_size + ENTRY_HEADER_SIZE;
+    if (valid_size + ENTRY_HEADER_SIZE + payload_size > content.size()) break;
+    if (compute_checksum(payload_begin, payload_size) != checksum) break;
+
+    auto reader = EntryReader{payload_begin, payload_begin + payload_size};
+    reader.read<CommitID>();
+    const auto record_count = reader.read<uint32_t>();
+    for (auto record_id = uint32_t{0}; record_id < record_count; ++record_id) {
+      const auto record_type = reader.read<RecordType>();
+      const auto table_name = reader.read_string();
+      Assert(storage_manager.has_table(table_name),
+             "Table '" + table_name + "' from the write-ahead log has to be loaded before the recovery");
+      auto& changes = changes_by_table[table_name];
+
+      if (record_type == RecordType::Insert) {
+        changes.inserts.emplace_back(read_insert_record(reader, *storage_manager.get_table(table_name)));
+      } else {
+        Assert(record_type == RecordType::Delete, "Unknown record type in write-ahead log");
+        const auto row_count = reader.read<uint32_t>();
+        for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+          const auto chunk_id = reader.read<ChunkID>();
+          const auto chunk_offset = reader.read<ChunkOffset>();
+          changes.deletes.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+    Assert(reader.at_end(), "Malformed write-ahead log entry");
+
+    valid_size += ENTRY_HEADER_SIZE + payload_size;
+    ++recovered_transactions;
+  }
+
+  // Deleted rows might have been inserted by logged transactions, so all inserts are applied first
+  for (auto& [table_name, changes] : changes_by_table) {
+    const auto table = storage_manager.get_table(table_name);
+    apply_inserts(*table, changes.inserts);
+    apply_deletes(*table, changes.deletes);
+  }
+
+  // Remove an incomplete entry, e.g., from a crash during a write. Otherwise, it would hide the entries appended
+  // after the recovery.
+  if (valid_size < content.size()) {
+    std::filesystem::resize_file(path, valid_size);
+  }
+
+  return recovered_transactions;
+}
+
+size_t WriteAheadLog::recover_and_enable(const std::filesystem::path& path) {
+  Assert(!Hyrise::get().write_ahead_log, "Cannot recover while a write-ahead log is enabled");
+
+  const auto recovered_transactions = recover(path);
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(path);
+  return recovered_transactions;
+}
+
+}  // namespace opossum
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Redo log for committed transactions.
+ *
+ * When a transaction commits while a WriteAheadLog is set in Hyrise::get().write_ahead_log, the TransactionContext asks
+ * its read-write operators to serialize their modifications (see AbstractReadWriteOperator::log_records) and hands
+ * the resulting record to append(). The transaction is only marked as pending (and thus becomes visible to others and
+ * is reported as committed) once its record has been written and fsync'ed.
+ *
+ * Group commit: A background thread writes all records that were appended while the previous flush was in progress
+ * with a single write and a single fsync. Thus, under load, the number of fsyncs per transaction drops well below one
+ * without an artificial delay.
+ *
+ * Inserted rows are logged with their position (RowID) in the target table, deleted rows only with their RowID.
+ * Update is covered by the Insert and Delete operators that it uses internally. As Insert allocates rows before the
+ * commit order is known, recovery places the rows at their logged positions and fills the gaps left by rolled back
+ * inserts with invisible rows. Therefore, the log is only valid for the state of the tables when logging was first
+ * enabled. recover() must be called after these tables have been loaded and before any new transaction modifies them.
+ *
+ * File format (native byte order, one entry per committed transaction):
+ *
+ * Description            | Type        | Size in bytes
+ * -----------------------------------------------------
+ * Payload size           | uint32_t    | 4
+ * CRC32 of payload       | uint32_t    | 4
+ * Commit ID              | CommitID    | 4
+ * Number of records      | uint32_t    | 4
+ * Records                | see below   | variable
+ *
+ * Every record starts with its type (uint8_t) and the table name (uint32_t length, characters). An insert record
+ * continues with the ChunkID, the first and the end ChunkOffset, followed by the values column by column. Each value
+ * is preceded by a NULL flag (uint8_t) if the column is nullable, strings are stored as length (uint32_t) and
+ * characters. A delete record continues with the number of rows (uint32_t) and their RowIDs.
+ *
+ * A log entry with a wrong size or checksum (e.g., because the system crashed during a write) ends the recovery and
+ * is truncated from the file.
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  enum class RecordType : uint8_t { Insert, Delete };
+
+  /**
+   * Collects the records of a single committing transaction.
+   */
+  class RecordWriter {
+   public:
+    explicit RecordWriter(const CommitID commit_id);
+
+    void log_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                    const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+    void log_delete(const std::string& table_name, const std::vector<RowID>& row_ids);
+
+    bool empty() const;
+
+    // Returns the complete log entry, including the header.
+    std::vector<char> finish();
+
+   private:
+    template <typename T>
+    void _write(const T& value);
+    void _write(const std::string& value);
+
+    std::vector<char> _buffer;
+    uint32_t _record_count{0};
+  };
+
+  struct Statistics {
+    uint64_t logged_transactions{0};
+    uint64_t flushes{0};
+    uint64_t written_bytes{0};
+    // Time between append() and the end of the fsync that made the entry durable, summed up over all transactions
+    std::chrono::nanoseconds total_commit_latency{0};
+  };
+
+  /**
+   * Opens the log file (creating it if it does not exist) and appends to it.
+   */
+  explicit WriteAheadLog(const std::filesystem::path& path);
+
+  /**
+   * Flushes all appended entries and runs their callbacks.
+   */
+  ~WriteAheadLog();
+
+  /**
+   * Appends a log entry created by RecordWriter::finish(). on_durable is called from the flushing thread once the
+   * entry has been fsync'ed.
+   */
+  void append(std::vector<char>&& entry, std::function<void()>&& on_durable);
+
+  Statistics statistics() const;
+
+  const std::filesystem::path& path() const;
+
+  /**
+   * Replays the log into the tables of the StorageManager. Returns the number of recovered transactions. Incomplete
+   * entries at the end of the file are removed.
+   */
+  static size_t recover(const std::filesystem::path& path);
+
+  /**
+   * Startup path of hyriseServer, the console, and the TPC-C benchmark: Replays the log at @param path (if it exists)
+   * and sets Hyrise::get().write_ahead_log to a WriteAheadLog that continues it. Has to be called once the base tables
+   * have been loaded. Returns the number of recovered transactions.
+   */
+  static size_t recover_and_enable(const std::filesystem::path& path);
+
+ private:
+  struct PendingEntry {
+    std::function<void()> on_durable;
+    std::chrono::steady_clock::time_point append_time;
+  };
+
+  void _flush_loop();
+
+  const std::filesystem::path _path;
+  int _file_descriptor{-1};
+
+  mutable std::mutex _mutex;
+  std::condition_variable _entries_appended;
+  std::vector<char> _pending_buffer;
+  std::vector<PendingEntry> _pending_entries;
+  bool _shutdown{false};
+  Statistics _statistics;
+
+  std::thread _flush_thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,750 @@
+#include "compiled_expression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/unary_minus_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "expression_evaluator.hpp"
+#include "expression_functors.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class AbstractCompiledKernel {
+ public:
+  AbstractCompiledKernel(const DataType init_data_type, const bool init_nullable)
+      : data_type(init_data_type), nullable(init_nullable) {}
+  virtual ~AbstractCompiledKernel() = default;
+
+  const DataType data_type;
+  const bool nullable;
+};
+
+struct CompiledProgram {
+  struct Column {
+    ColumnID column_id;
+    DataType data_type;
+    bool nullable;
+  };
+
+  std::shared_ptr<const AbstractCompiledKernel> root;
+
+  // The columns accessed by the kernels, which address them by their index in this vector
+  std::vector<Column> columns;
+};
+
+}  // namespace opossum
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Bool = ExpressionEvaluator::Bool;
+
+// Number of rows that the kernels evaluate at a time. Small enough for the buffers of a few nested kernels to fit into
+// the L1 cache, large enough to amortize the virtual call per kernel and block.
+constexpr auto BLOCK_SIZE = size_t{512};
+
+// Maximum nesting depth of compiled expressions. Each kernel keeps the block buffers of its arguments on the stack
+// (up to about 14 KB for a CASE on doubles), so the depth is limited to keep the stack usage of an evaluation below
+// 0.5 MB. Deeper expressions are left to the ExpressionEvaluator.
+constexpr auto MAX_KERNEL_DEPTH = size_t{32};
+
+// Number of programs after which the cache is cleared so that ad-hoc queries cannot let it grow without bounds
+constexpr auto CACHE_CAPACITY = size_t{1024};
+
+// Type-level version of expression_common_type() for numeric types
+template <typename A, typename B>
+using CommonDataType = std::conditional_t<
+    std::is_same_v<A, double> || std::is_same_v<B, double>, double,
+    std::conditional_t<std::is_same_v<A, int64_t> || std::is_same_v<B, int64_t>,
+                       std::conditional_t<std::is_floating_point_v<A> || std::is_floating_point_v<B>, double, int64_t>,
+                       std::conditional_t<std::is_same_v<A, float> || std::is_same_v<B, float>, float, int32_t>>>;
+
+bool is_numeric_data_type(const DataType data_type) {
+  return data_type == DataType::Int || data_type == DataType::Long || data_type == DataType::Float ||
+         data_type == DataType::Double;
+}
+
+template <typename Functor>
+void resolve_numeric_data_type(const DataType data_type, const Functor& functor) {
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      functor(data_type_t);
+    } else {
+      Fail("Compiled expressions only support numeric data types");
+    }
+  });
+}
+
+struct AbstractMaterializedColumn {
+  virtual ~AbstractMaterializedColumn() = default;
+};
+
+// The values of a column in the evaluated chunk. ValueSegments are accessed directly, all other segments are
+// materialized once per chunk, as the ExpressionEvaluator does.
+template <typename T>
+struct MaterializedColumn : AbstractMaterializedColumn {
+  const pmr_vector<T>* values{nullptr};
+  const pmr_vector<bool>* nulls{nullptr};
+
+  pmr_vector<T> materialized_values;
+  pmr_vector<bool> materialized_nulls;
+};
+
+struct EvaluationContext {
+  std::vector<std::unique_ptr<AbstractMaterializedColumn>> columns;
+  const std::vector<AllTypeVariant>& constants;
+
+  // The rows of the current block
+  size_t begin{0};
+  size_t size{0};
+};
+
+template <typename T>
+class CompiledKernel : public AbstractCompiledKernel {
+ public:
+  explicit CompiledKernel(const bool init_nullable) : AbstractCompiledKernel(data_type_from_type<T>(), init_nullable) {}
+
+  // Writes the results for the rows [context.begin, context.begin + context.size) to @param values and, if the kernel
+  // is nullable, to @param nulls
+  virtual void evaluate(const EvaluationContext& context, T* values, bool* nulls) const = 0;
+};
+
+template <typename T>
+using CompiledKernelPtr = std::shared_ptr<const CompiledKernel<T>>;
+
+// Evaluates @param kernel and sets all @param nulls to false if the kernel is not nullable
+template <typename T>
+void evaluate_with_nulls(const CompiledKernel<T>& kernel, const EvaluationContext& context, T* values, bool* nulls) {
+  kernel.evaluate(context, values, nulls);
+  if (!kernel.nullable) std::fill_n(nulls, context.size, false);
+}
+
+template <typename T>
+class ColumnKernel : public CompiledKernel<T> {
+ public:
+  ColumnKernel(const size_t column_index, const bool init_nullable)
+      : CompiledKernel<T>(init_nullable), _column_index(column_index) {}
+
+  void evaluate(const EvaluationContext& context, T* values, bool* nulls) const override {
+    const auto& column = static_cast<const MaterializedColumn<T>&>(*context.columns[_column_index]);
+    std::copy_n(column.values->cbegin() + context.begin, context.size, values);
+    if (this->nullable) std::copy_n(column.nulls->cbegin() + context.begin, context.size, nulls);
+  }
+
+ private:
+  const size_t _column_index;
+};
+
+// Literals and parameters
+template <typename T>
+class ConstantKernel : public CompiledKernel<T> {
+ public:
+  explicit ConstantKernel(const size_t constant_index) : CompiledKernel<T>(false), _constant_index(constant_index) {}
+
+  void evaluate(const EvaluationContext& context, T* values, bool* nulls) const override {
+    std::fill_n(values, context.size, boost::get<T>(context.constants[_constant_index]));
+  }
+
+ private:
+  const size_t _constant_index;
+};
+
+// Binary operation whose result is NULL if either argument is NULL (see
+// ExpressionEvaluator::_evaluate_binary_with_default_null_logic)
+template <typename Result, typename Left, typename Right, typename Functor>
+class DefaultNullLogicKernel : public CompiledKernel<Result> {
+ public:
+  DefaultNullLogicKernel(const CompiledKernelPtr<Left>& left, const CompiledKernelPtr<Right>& right)
+      : CompiledKernel<Result>(left->nullable || right->nullable), _left(left), _right(right) {}
+
+  void evaluate(const EvaluationContext& context, Result* values, bool* nulls) const override {
+    auto left_values = std::array<Left, BLOCK_SIZE>{};
+    auto left_nulls = std::array<bool, BLOCK_SIZE>{};
+    auto right_values = std::array<Right, BLOCK_SIZE>{};
+    auto right_nulls = std::array<bool, BLOCK_SIZE>{};
+    _left->evaluate(context, left_values.data(), left_nulls.data());
+    _right->evaluate(context, right_values.data(), right_nulls.data());
+
+    for (auto row = size_t{0}; row < context.size; ++row) {
+      Functor{}(values[row], left_values[row], right_values[row]);
+    }
+
+    if (!_right->nullable) {
+      if (_left->nullable) std::copy_n(left_nulls.cbegin(), context.size, nulls);
+    } else if (!_left->nullable) {
+      std::copy_n(right_nulls.cbegin(), context.size, nulls);
+    } else {
+      for (auto row = size_t{0}; row < context.size; ++row) {
+        nulls[row] = left_nulls[row] || right_nulls[row];
+      }
+    }
+  }
+
+ private:
+  const CompiledKernelPtr<Left> _left;
+  const CompiledKernelPtr<Right> _right;
+};
+
+// Binary operation whose functor determines the NULLs, e.g., division or the ternary AND/OR (see
+// ExpressionEvaluator::_evaluate_binary_with_functor_based_null_logic)
+template <typename Result, typename Left, typename Right, typename Functor>
+class FunctorNullLogicKernel : public CompiledKernel<Result> {
+ public:
+  FunctorNullLogicKernel(const CompiledKernelPtr<Left>& left, const CompiledKernelPtr<Right>& right)
+      : CompiledKernel<Result>(true), _left(left), _right(right) {}
+
+  void evaluate(const EvaluationContext& context, Result* values, bool* nulls) const override {
+    auto left_values = std::array<Left, BLOCK_SIZE>{};
+    auto left_nulls = std::array<bool, BLOCK_SIZE>{};
+    auto right_values = std::array<Right, BLOCK_SIZE>{};
+    auto right_nulls = std::array<bool, BLOCK_SIZE>{};
+    evaluate_with_nulls(*_left, context, left_values.data(), left_nulls.data());
+    evaluate_with_nulls(*_right, context, right_values.data(), right_nulls.data());
+
+    for (auto row = size_t{0}; row < context.size; ++row) {
+      Functor{}(values[row], nulls[row], left_values[row], left_nulls[row], right_values[row], right_nulls[row]);
+    }
+  }
+
+ private:
+  const CompiledKernelPtr<Left> _left;
+  const CompiledKernelPtr<Right> _right;
+};
+
+template <typename T>
+class UnaryMinusKernel : public CompiledKernel<T> {
+ public:
+  explicit UnaryMinusKernel(const CompiledKernelPtr<T>& argument)
+      : CompiledKernel<T>(argument->nullable), _argument(argument) {}
+
+  void evaluate(const EvaluationContext& context, T* values, bool* nulls) const override {
+    _argument->evaluate(context, values, nulls);
+    for (auto row = size_t{0}; row < context.size; ++row) {
+      values[row] = -values[row];
+    }
+  }
+
+ private:
+  const CompiledKernelPtr<T> _argument;
+};
+
+template <typename Argument>
+class IsNullKernel : public CompiledKernel<Bool> {
+ public:
+  IsNullKernel(const CompiledKernelPtr<Argument>& argument, const bool is_null)
+      : CompiledKernel<Bool>(false), _argument(argument), _is_null(is_null) {}
+
+  void evaluate(const EvaluationContext& context, Bool* values, bool* nulls) const override {
+    if (!_argument->nullable) {
+      std::fill_n(values, context.size, _is_null ? 0 : 1);
+      return;
+    }
+
+    auto argument_values = std::array<Argument, BLOCK_SIZE>{};
+    auto argument_nulls = std::array<bool, BLOCK_SIZE>{};
+    _argument->evaluate(context, argument_values.data(), argument_nulls.data());
+
+    for (auto row = size_t{0}; row < context.size; ++row) {
+      values[row] = argument_nulls[row] == _is_null;
+    }
+  }
+
+ private:
+  const CompiledKernelPtr<Argument> _argument;
+  const bool _is_null;
+};
+
+template <typename Result, typename Then, typename Else>
+class CaseKernel : public CompiledKernel<Result> {
+ public:
+  CaseKernel(const CompiledKernelPtr<Bool>& when, const CompiledKernelPtr<Then>& then,
+             const CompiledKernelPtr<Else>& otherwise)
+      : CompiledKernel<Result>(true), _when(when), _then(then), _otherwise(otherwise) {}
+
+  void evaluate(const EvaluationContext& context, Result* values, bool* nulls) const override {
+    auto when_values = std::array<Bool, BLOCK_SIZE>{};
+    auto when_nulls = std::array<bool, BLOCK_SIZE>{};
+    auto then_values = std::array<Then, BLOCK_SIZE>{};
+    auto then_nulls = std::array<bool, BLOCK_SIZE>{};
+    auto else_values = std::array<Else, BLOCK_SIZE>{};
+    auto else_nulls = std::array<bool, BLOCK_SIZE>{};
+    evaluate_with_nulls(*_when, context, when_values.data(), when_nulls.data());
+    evaluate_with_nulls(*_then, context, then_values.data(), then_nulls.data());
+    evaluate_with_nulls(*_otherwise, context, else_values.data(), else_nulls.data());
+
+    for (auto row = size_t{0}; row < context.size; ++row) {
+      const auto take_then = when_values[row] && !when_nulls[row];
+      values[row] = take_then ? static_cast<Result>(then_values[row]) : static_cast<Result>(else_values[row]);
+      nulls[row] = take_then ? then_nulls[row] : else_nulls[row];
+    }
+  }
+
+ private:
+  const CompiledKernelPtr<Bool> _when;
+  const CompiledKernelPtr<Then> _then;
+  const CompiledKernelPtr<Else> _otherwise;
+};
+
+template <typename T>
+CompiledKernelPtr<T> kernel_cast(const std::shared_ptr<const AbstractCompiledKernel>& kernel) {
+  DebugAssert(kernel->data_type == data_type_from_type<T>(), "Unexpected data type of kernel");
+  return std::static_pointer_cast<const CompiledKernel<T>>(kernel);
+}
+
+// Instantiates the Kernel for the data types of @param left and @param right. Arithmetics return the common type of
+// their arguments, predicates return Bools.
+template <template <typename, typename, typename, typename> typename Kernel, typename Functor, bool returns_bool>
+std::shared_ptr<const AbstractCompiledKernel> make_binary_kernel(
+    const std::shared_ptr<const AbstractCompiledKernel>& left,
+    const std::shared_ptr<const AbstractCompiledKernel>& right) {
+  auto kernel = std::shared_ptr<const AbstractCompiledKernel>{};
+
+  resolve_numeric_data_type(left->data_type, [&](const auto left_data_type_t) {
+    using Left = typename decltype(left_data_type_t)::type;
+
+    resolve_numeric_data_type(right->data_type, [&](const auto right_data_type_t) {
+      using Right = typename decltype(right_data_type_t)::type;
+      using Result = std::conditional_t<returns_bool, Bool, CommonDataType<Left, Right>>;
+
+      kernel =
+          std::make_shared<Kernel<Result, Left, Right, Functor>>(kernel_cast<Left>(left), kernel_cast<Right>(right));
+    });
+  });
+
+  return kernel;
+}
+
+bool is_supported_constant(const AllTypeVariant& value, const DataType data_type) {
+  return is_numeric_data_type(data_type) && data_type_from_all_type_variant(value) == data_type;
+}
+
+/**
+ * Appends the structure of @param expression to @param signature. Values of literals and parameters are not part of
+ * the signature, they are appended to @param constants instead. The accessed columns are added to @param columns.
+ * @param depth is the nesting depth of the expression. Returns false if the expression cannot be compiled.
+ */
+bool collect_signature(const AbstractExpression& expression, const Table& table, std::string& signature,
+                       std::vector<AllTypeVariant>& constants, std::vector<CompiledProgram::Column>& columns,
+                       const size_t depth) {
+  if (depth > MAX_KERNEL_DEPTH) return false;
+
+  const auto data_type = expression.data_type();
+  if (!is_numeric_data_type(data_type)) return false;
+
+  const auto collect_arguments = [&]() {
+    signature += '(';
+    for (const auto& argument : expression.arguments) {
+      if (!collect_signature(*argument, table, signature, constants, columns, depth + 1)) return false;
+      signature += ',';
+    }
+    signature += ')';
+    return true;
+  };
+
+  switch (expression.type) {
+    case ExpressionType::PQPColumn: {
+      const auto column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      const auto nullable = table.column_is_nullable(column_id);
+      if (table.column_data_type(column_id) != data_type) return false;
+
+      const auto column_iter = std::find_if(columns.cbegin(), columns.cend(),
+                                            [&](const auto& column) { return column.column_id == column_id; });
+      if (column_iter == columns.cend()) columns.emplace_back(CompiledProgram::Column{column_id, data_type, nullable});
+
+      signature += 'C' + std::to_string(column_id) + ':' + std::to_string(static_cast<int>(data_type)) +
+                   (nullable ? "n" : "");
+      return true;
+    }
+
+    case ExpressionType::Value: {
+      const auto& value = static_cast<const ValueExpression&>(expression).value;
+      if (!is_supported_constant(value, data_type)) return false;
+
+      constants.emplace_back(value);
+      signature += 'K' + std::to_string(static_cast<int>(data_type));
+      return true;
+    }
+
+    case ExpressionType::CorrelatedParameter: {
+      const auto& value = static_cast<const CorrelatedParameterExpression&>(expression).value();
+      if (!value || !is_supported_constant(*value, data_type)) return false;
+
+      constants.emplace_back(*value);
+      signature += 'K' + std::to_string(static_cast<int>(data_type));
+      return true;
+    }
+
+    case ExpressionType::Arithmetic:
+      signature += 'A' + std::to_string(static_cast<int>(
+                             static_cast<const ArithmeticExpression&>(expression).arithmetic_operator));
+      return collect_arguments();
+
+    case ExpressionType::UnaryMinus:
+      signature += 'M';
+      return collect_arguments();
+
+    case ExpressionType::Predicate: {
+      const auto predicate_condition = static_cast<const AbstractPredicateExpression&>(expression).predicate_condition;
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+        case PredicateCondition::NotEquals:
+        case PredicateCondition::LessThan:
+        case PredicateCondition::LessThanEquals:
+        case PredicateCondition::GreaterThan:
+        case PredicateCondition::GreaterThanEquals:
+        case PredicateCondition::IsNull:
+        case PredicateCondition::IsNotNull:
+          signature += 'P' + std::to_string(static_cast<int>(predicate_condition));
+          return collect_arguments();
+
+        default:
+          return false;
+      }
+    }
+
+    case ExpressionType::Logical: {
+      const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
+      if (logical_expression.left_operand()->data_type() != DataType::Int ||
+          logical_expression.right_operand()->data_type() != DataType::Int) {
+        return false;
+      }
+
+      signature += 'L' + std::to_string(static_cast<int>(logical_expression.logical_operator));
+      return collect_arguments();
+    }
+
+    case ExpressionType::Case:
+      if (static_cast<const CaseExpression&>(expression).when()->data_type() != DataType::Int) return false;
+
+      signature += 'W';
+      return collect_arguments();
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * Builds the kernel for @param expression, which has been accepted by collect_signature(). @param constant_index is
+ * the index of the next literal or parameter, which are visited in the same order as by collect_signature().
+ */
+std::shared_ptr<const AbstractCompiledKernel> build_kernel(const AbstractExpression& expression,
+                                                           const std::vector<CompiledProgram::Column>& columns,
+                                                           size_t& constant_index) {
+  auto kernel = std::shared_ptr<const AbstractCompiledKernel>{};
+
+  switch (expression.type) {
+    case ExpressionType::PQPColumn: {
+      const auto column_id = static_cast<const PQPColumnExpression&>(expression).column_id;
+      const auto column_iter = std::find_if(columns.cbegin(), columns.cend(),
+                                            [&](const auto& column) { return column.column_id == column_id; });
+      DebugAssert(column_iter != columns.cend(), "Column should have been collected");
+
+      resolve_numeric_data_type(column_iter->data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        kernel = std::make_shared<ColumnKernel<ColumnDataType>>(std::distance(columns.cbegin(), column_iter),
+                                                                column_iter->nullable);
+      });
+    } break;
+
+    case ExpressionType::Value:
+    case ExpressionType::CorrelatedParameter:
+      resolve_numeric_data_type(expression.data_type(), [&](const auto data_type_t) {
+        using ConstantDataType = typename decltype(data_type_t)::type;
+        kernel = std::make_shared<ConstantKernel<ConstantDataType>>(constant_index++);
+      });
+      break;
+
+    case ExpressionType::Arithmetic: {
+      const auto left = build_kernel(*expression.arguments[0], columns, constant_index);
+      const auto right = build_kernel(*expression.arguments[1], columns, constant_index);
+
+      // clang-format off
+      switch (static_cast<const ArithmeticExpression&>(expression).arithmetic_operator) {
+        case ArithmeticOperator::Addition:       kernel = make_binary_kernel<DefaultNullLogicKernel, AdditionEvaluator, false>(left, right); break;  // NOLINT
+        case ArithmeticOperator::Subtraction:    kernel = make_binary_kernel<DefaultNullLogicKernel, SubtractionEvaluator, false>(left, right); break;  // NOLINT
+        case ArithmeticOperator::Multiplication: kernel = make_binary_kernel<DefaultNullLogicKernel, MultiplicationEvaluator, false>(left, right); break;  // NOLINT
+        case ArithmeticOperator::Division:       kernel = make_binary_kernel<FunctorNullLogicKernel, DivisionEvaluator, false>(left, right); break;  // NOLINT
+        case ArithmeticOperator::Modulo:         kernel = make_binary_kernel<FunctorNullLogicKernel, ModuloEvaluator, false>(left, right); break;  // NOLINT
+      }
+      // clang-format on
+    } break;
+
+    case ExpressionType::UnaryMinus: {
+      const auto argument = build_kernel(*expression.arguments[0], columns, constant_index);
+      resolve_numeric_data_type(argument->data_type, [&](const auto data_type_t) {
+        using ArgumentDataType = typename decltype(data_type_t)::type;
+        kernel = std::make_shared<UnaryMinusKernel<ArgumentDataType>>(kernel_cast<ArgumentDataType>(argument));
+      });
+    } break;
+
+    case ExpressionType::Predicate: {
+      const auto predicate_condition = static_cast<const AbstractPredicateExpression&>(expression).predicate_condition;
+
+      if (predicate_condition == PredicateCondition::IsNull || predicate_condition == PredicateCondition::IsNotNull) {
+        const auto argument = build_kernel(*expression.arguments[0], columns, constant_index);
+        resolve_numeric_data_type(argument->data_type, [&](const auto data_type_t) {
+          using ArgumentDataType = typename decltype(data_type_t)::type;
+          kernel = std::make_shared<IsNullKernel<ArgumentDataType>>(kernel_cast<ArgumentDataType>(argument),
+                                                                    predicate_condition == PredicateCondition::IsNull);
+        });
+        break;
+      }
+
+      auto left = build_kernel(*expression.arguments[0], columns, constant_index);
+      auto right = build_kernel(*expression.arguments[1], columns, constant_index);
+
+      // As in the ExpressionEvaluator, > and >= are flipped to < and <= to reduce the number of template instantiations
+      // clang-format off
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:            kernel = make_binary_kernel<DefaultNullLogicKernel, EqualsEvaluator, true>(left, right); break;  // NOLINT
+        case PredicateCondition::NotEquals:         kernel = make_binary_kernel<DefaultNullLogicKernel, NotEqualsEvaluator, true>(left, right); break;  // NOLINT
+        case PredicateCondition::LessThan:          kernel = make_binary_kernel<DefaultNullLogicKernel, LessThanEvaluator, true>(left, right); break;  // NOLINT
+        case PredicateCondition::LessThanEquals:    kernel = make_binary_kernel<DefaultNullLogicKernel, LessThanEqualsEvaluator, true>(left, right); break;  // NOLINT
+        case PredicateCondition::GreaterThan:       kernel = make_binary_kernel<DefaultNullLogicKernel, LessThanEvaluator, true>(right, left); break;  // NOLINT
+        case PredicateCondition::GreaterThanEquals: kernel = make_binary_kernel<DefaultNullLogicKernel, LessThanEqualsEvaluator, true>(right, left); break;  // NOLINT
+        default: Fail("Unsupported PredicateCondition should have been rejected");
+      }
+      // clang-format on
+    } break;
+
+    case ExpressionType::Logical: {
+      const auto left = kernel_cast<Bool>(build_kernel(*expression.arguments[0], columns, constant_index));
+      const auto right = kernel_cast<Bool>(build_kernel(*expression.arguments[1], columns, constant_index));
+
+      switch (static_cast<const LogicalExpression&>(expression).logical_operator) {
+        case LogicalOperator::And:
+          kernel = std::make_shared<FunctorNullLogicKernel<Bool, Bool, Bool, TernaryAndEvaluator>>(left, right);
+          break;
+        case LogicalOperator::Or:
+          kernel = std::make_shared<FunctorNullLogicKernel<Bool, Bool, Bool, TernaryOrEvaluator>>(left, right);
+          break;
+      }
+    } break;
+
+    case ExpressionType::Case: {
+      const auto when = kernel_cast<Bool>(build_kernel(*expression.arguments[0], columns, constant_index));
+      const auto then = build_kernel(*expression.arguments[1], columns, constant_index);
+      const auto otherwise = build_kernel(*expression.arguments[2], columns, constant_index);
+
+      resolve_numeric_data_type(then->data_type, [&](const auto then_data_type_t) {
+        using Then = typename decltype(then_data_type_t)::type;
+
+        resolve_numeric_data_type(otherwise->data_type, [&](const auto else_data_type_t) {
+          using Else = typename decltype(else_data_type_t)::type;
+
+          kernel = std::make_shared<CaseKernel<CommonDataType<Then, Else>, Then, Else>>(when, kernel_cast<Then>(then),
+                                                                                       kernel_cast<Else>(otherwise));
+        });
+      });
+    } break;
+
+    default:
+      Fail("Unsupported expression should have been rejected");
+  }
+
+  DebugAssert(kernel->data_type == expression.data_type(), "Kernel does not return the type of its expression");
+  return kernel;
+}
+
+std::vector<std::unique_ptr<AbstractMaterializedColumn>> materialize_columns(const CompiledProgram& program,
+                                                                             const Chunk& chunk) {
+  auto materialized_columns = std::vector<std::unique_ptr<AbstractMaterializedColumn>>{};
+  materialized_columns.reserve(program.columns.size());
+
+  for (const auto& column : program.columns) {
+    resolve_numeric_data_type(column.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto materialized_column = std::make_unique<MaterializedColumn<ColumnDataType>>();
+      const auto& segment = *chunk.get_segment(column.column_id);
+
+      if (const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+        // Shortcut
+        materialized_column->values = &value_segment->values();
+        if (column.nullable) {
+          if (value_segment->is_nullable()) {
+            materialized_column->nulls = &value_segment->null_values();
+          } else {
+            materialized_column->materialized_nulls.resize(segment.size());
+            materialized_column->nulls = &materialized_column->materialized_nulls;
+          }
+        }
+      } else {
+        auto& values = materialized_column->materialized_values;
+        auto& nulls = materialized_column->materialized_nulls;
+        values.resize(segment.size());
+        if (column.nullable) nulls.resize(segment.size());
+
+        auto chunk_offset = ChunkOffset{0};
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          if (position.is_null()) {
+            DebugAssert(column.nullable, "Encountered NULL value in non-nullable column");
+            nulls[chunk_offset] = true;
+          } else {
+            values[chunk_offset] = position.value();
+          }
+          ++chunk_offset;
+        });
+
+        materialized_column->values = &values;
+        materialized_column->nulls = &nulls;
+      }
+
+      materialized_columns.emplace_back(std::move(materialized_column));
+    });
+  }
+
+  return materialized_columns;
+}
+
+// Evaluates @param program block by block and passes the results of each block to @param consumer
+template <typename Result, typename Consumer>
+void evaluate_blocks(const CompiledProgram& program, const std::vector<AllTypeVariant>& constants, const Chunk& chunk,
+                     const Consumer& consumer) {
+  auto context = EvaluationContext{materialize_columns(program, chunk), constants};
+  const auto& kernel = static_cast<const CompiledKernel<Result>&>(*program.root);
+
+  auto values = std::array<Result, BLOCK_SIZE>{};
+  auto nulls = std::array<bool, BLOCK_SIZE>{};
+
+  const auto row_count = static_cast<size_t>(chunk.size());
+  for (context.begin = 0; context.begin < row_count; context.begin += BLOCK_SIZE) {
+    context.size = std::min(BLOCK_SIZE, row_count - context.begin);
+    kernel.evaluate(context, values.data(), nulls.data());
+    consumer(context.begin, context.size, values, nulls);
+  }
+}
+
+struct CompiledProgramCache {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::shared_ptr<const CompiledProgram>> programs;
+};
+
+CompiledProgramCache& compiled_program_cache() {
+  static auto cache = CompiledProgramCache{};
+  return cache;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<const CompiledExpression> CompiledExpression::compile(const AbstractExpression& expression,
+                                                                      const Table& table) {
+  auto signature = std::string{};
+  auto constants = std::vector<AllTypeVariant>{};
+  auto columns = std::vector<CompiledProgram::Column>{};
+  if (!collect_signature(expression, table, signature, constants, columns, 1)) return nullptr;
+
+  auto& cache = compiled_program_cache();
+  {
+    const auto lock = std::lock_guard<std::mutex>{cache.mutex};
+    const auto program_iter = cache.programs.find(signature);
+    if (program_iter != cache.programs.end()) {
+      return std::make_shared<CompiledExpression>(program_iter->second, std::move(constants));
+    }
+  }
+
+  auto program = std::make_shared<CompiledProgram>();
+  program->columns = std::move(columns);
+  auto constant_index = size_t{0};
+  program->root = build_kernel(expression, program->columns, constant_index);
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{cache.mutex};
+    if (cache.programs.size() >= CACHE_CAPACITY) cache.programs.clear();
+    cache.programs.emplace(signature, program);
+  }
+
+  return std::make_shared<CompiledExpression>(program, std::move(constants));
+}
+
+CompiledExpression::CompiledExpression(const std::shared_ptr<const CompiledProgram>& program,
+                                       std::vector<AllTypeVariant> constants)
+    : _program(program), _constants(std::move(constants)) {}
+
+DataType CompiledExpression::data_type() const { return _program->root->data_type; }
+
+bool CompiledExpression::is_nullable() const { return _program->root->nullable; }
+
+std::shared_ptr<BaseValueSegment> CompiledExpression::evaluate_to_segment(const Chunk& chunk) const {
+  auto segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_numeric_data_type(data_type(), [&](const auto data_type_t) {
+    using Result = typename decltype(data_type_t)::type;
+
+    const auto nullable = is_nullable();
+    auto values = pmr_vector<Result>(chunk.size());
+    auto nulls = pmr_vector<bool>(nullable ? chunk.size() : 0);
+
+    evaluate_blocks<Result>(*_program, _constants, chunk,
+                            [&](const auto begin, const auto size, const auto& block_values, const auto& block_nulls) {
+                              std::copy_n(block_values.cbegin(), size, values.begin() + begin);
+                              if (nullable) std::copy_n(block_nulls.cbegin(), size, nulls.begin() + begin);
+                            });
+
+    if (nullable) {
+      segment = std::make_shared<ValueSegment<Result>>(std::move(values), std::move(nulls));
+    } else {
+      segment = std::make_shared<ValueSegment<Result>>(std::move(values));
+    }
+  });
+
+  return segment;
+}
+
+RowIDPosList CompiledExpression::evaluate_to_pos_list(const Chunk& chunk, const ChunkID chunk_id) const {
+  Assert(data_type() == ExpressionEvaluator::DataTypeBool, "Only expressions returning Bools can be evaluated to a "
+                                                           "PosList");
+
+  auto pos_list = RowIDPosList{};
+  const auto nullable = is_nullable();
+
+  evaluate_blocks<Bool>(*_program, _constants, chunk,
+                        [&](const auto begin, const auto size, const auto& block_values, const auto& block_nulls) {
+                          for (auto row = size_t{0}; row < size; ++row) {
+                            if (block_values[row] != 0 && !(nullable && block_nulls[row])) {
+                              pos_list.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(begin + row)});
+                            }
+                          }
+                        });
+
+  return pos_list;
+}
+
+size_t CompiledExpression::cache_size() {
+  auto& cache = compiled_program_cache();
+  const auto lock = std::lock_guard<std::mutex>{cache.mutex};
+  return cache.programs.size();
+}
+
+void CompiledExpression::clear_cache() {
+  auto& cache = compiled_program_cache();
+  const auto lock = std::lock_guard<std::mutex>{cache.mutex};
+  cache.programs.clear();
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class BaseValueSegment;
+class Chunk;
+class Table;
+struct CompiledProgram;
+
+/**
+ * Compiled tier of the expression evaluation, used by the Projection and the ExpressionEvaluatorTableScanImpl for
+ * numeric expressions. The ExpressionEvaluator evaluates an expression tree operator by operator and materializes the
+ * result of every sub-expression for the entire chunk. For an expression like `a * (1 - b) + c < 10`, this allocates
+ * and writes five chunk-sized intermediate vectors.
+ *
+ * A CompiledExpression fuses the expression tree into a tree of kernels. Each kernel is a template specialized for the
+ * data types and the operator of its sub-expression and evaluates a block of rows at a time. The intermediate results
+ * only exist in block-sized buffers on the stack, which stay in the L1 cache, and the per-row loops are free of type
+ * dispatch and virtual calls, so that the compiler can vectorize them.
+ *
+ * Supported are columns, literals, and correlated parameters of the types Int, Long, Float, and Double, as well as
+ * arithmetics, unary minus, binary comparisons, AND/OR, IS [NOT] NULL, and CASE on them. The results (including their
+ * nullability) are identical to those of the ExpressionEvaluator. For all other expressions (e.g., strings, LIKE, IN,
+ * subqueries, functions, or NULL literals) and for deeply nested expressions, whose block buffers would not fit on the
+ * stack, compile() returns nullptr and the caller falls back to the ExpressionEvaluator.
+ *
+ * Compiled kernels are cached by the structure of the expression, with literals and parameter values lifted out. Thus,
+ * prepared statements and correlated subqueries that are executed with different values reuse the same kernels.
+ */
+class CompiledExpression {
+ public:
+  // Returns nullptr if the expression cannot be compiled. The columns of the expression refer to @param table.
+  static std::shared_ptr<const CompiledExpression> compile(const AbstractExpression& expression, const Table& table);
+
+  CompiledExpression(const std::shared_ptr<const CompiledProgram>& program, std::vector<AllTypeVariant> constants);
+
+  DataType data_type() const;
+  bool is_nullable() const;
+
+  std::shared_ptr<BaseValueSegment> evaluate_to_segment(const Chunk& chunk) const;
+
+  // Only for expressions returning Bools: the rows of @param chunk for which the expression is true
+  RowIDPosList evaluate_to_pos_list(const Chunk& chunk, const ChunkID chunk_id) const;
+
+  // Number of cached programs, used for testing
+  static size_t cache_size();
+  static void clear_cache();
+
+ private:
+  std::shared_ptr<const CompiledProgram> _program;
+
+  // Values of the literals and parameters, in the order in which they appear in the expression
+  std::vector<AllTypeVariant> _constants;
+};
+
+}  // namespace opossum
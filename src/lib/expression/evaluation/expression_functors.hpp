@@ -15,8 +15,8 @@ template <typename T>
 constexpr bool is_logical_operand = std::is_same_v<int32_t, T> || std::is_same_v<NullValue, T>;
 
 // Turn a bool into itself and a NULL into false
-bool to_bool(const bool value) { return value; }
-bool to_bool(const NullValue& value) { return false; }
+inline bool to_bool(const bool value) { return value; }
+inline bool to_bool(const NullValue& value) { return false; }
 
 // Cast a value/NULL into another type
 template <typename T, typename V>
@@ -20,6 +20,7 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  admission_controller = std::make_shared<AdmissionController>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
@@ -2,9 +2,12 @@
 
 #include "boost/container/pmr/memory_resource.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/meta_table_manager.hpp"
@@ -42,6 +45,9 @@ class Hyrise : public Singleton<Hyrise> {
   StorageManager storage_manager;
   PluginManager plugin_manager;
   TransactionManager transaction_manager;
+  // Committed transactions are only logged if a WriteAheadLog is set. It has to be destroyed before the
+  // TransactionManager, as destroying it flushes pending entries and thereby commits their transactions.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
   LogManager log_manager;
@@ -52,6 +58,19 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // If set, chains of TableScans and Validates, including the Projections that consume them, are executed as pipelines
+  // instead of one operator after another (see AbstractChunkwiseOperator). Only applies to operators executed via
+  // OperatorTasks.
+  bool enable_pipelining{false};
+
+  // Used by TableStatistics::from_table(table), e.g., when tables are added to the StorageManager. By default, the
+  // histograms are built from all values. Set sample_size_per_chunk to build them from samples for large tables.
+  StatisticsGenerationConfig statistics_generation_config;
+
+  // Admits SQL statements depending on the memory used by the running ones and tracks their memory. Not a plain member
+  // as it holds a mutex, which cannot be moved by reset().
+  std::shared_ptr<AdmissionController> admission_controller;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
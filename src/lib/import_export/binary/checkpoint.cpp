@@ -0,0 +1,767 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "constant_mappings.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/oversized_types.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto MAGIC_NUMBER = std::array<char, 8>{'H', 'Y', 'R', 'I', 'S', 'E', 'C', 'P'};
+constexpr auto FORMAT_VERSION = uint32_t{2};
+
+constexpr auto PAGE_SIZE = size_t{4096};
+// Largest alignment required by an array element (uint128_t of SimdBp128Vector)
+constexpr auto MIN_ARRAY_ALIGNMENT = size_t{16};
+
+size_t array_alignment(const size_t byte_count) { return byte_count >= PAGE_SIZE ? PAGE_SIZE : MIN_ARRAY_ALIGNMENT; }
+
+size_t align(const size_t position, const size_t alignment) {
+  return (position + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Memory resource for the arrays that are loaded from a checkpoint without being copied. Allocations of at least one
+ * page are served by anonymous mappings, so that MappedFileReader can replace their pages with a private mapping of
+ * the checkpoint file (see there). The file pages are then read lazily when they are first accessed, and each array
+ * owns its own mapping, which is released when the array is deallocated. Smaller allocations (e.g., when a vector is
+ * copied into this resource) are forwarded to the default resource.
+ */
+class MappedArrayResource : public boost::container::pmr::memory_resource {
+ public:
+  static MappedArrayResource& get() {
+    static auto resource = MappedArrayResource{};
+    return resource;
+  }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (bytes < PAGE_SIZE) return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+
+    auto* const address =
+        mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (address == MAP_FAILED) throw std::bad_alloc{};
+    return address;
+  }
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+    if (bytes < PAGE_SIZE) {
+      boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+      return;
+    }
+    munmap(pointer, bytes);
+  }
+
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override {
+    return &other == this;
+  }
+};
+
+class CheckpointWriter {
+ public:
+  explicit CheckpointWriter(const std::string& filename) {
+    _stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    _stream.open(filename, std::ios::binary | std::ios::trunc);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+    _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    _position += sizeof(T);
+  }
+
+  void write(const std::string& value) {
+    write(static_cast<uint32_t>(value.size()));
+    _stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    _position += value.size();
+  }
+
+  template <typename T>
+  void write_array(const T* values, const size_t count) {
+    write(static_cast<uint64_t>(count));
+
+    const auto byte_count = count * sizeof(T);
+    _pad(align(_position, array_alignment(byte_count)) - _position);
+    _stream.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(byte_count));
+    _position += byte_count;
+  }
+
+  template <typename T, typename Alloc>
+  void write_array(const std::vector<T, Alloc>& values) {
+    write_array(values.data(), values.size());
+  }
+
+  template <typename Alloc>
+  void write_array(const std::vector<bool, Alloc>& values) {
+    write_array(pmr_vector<BoolAsByteType>(values.begin(), values.end()));
+  }
+
+  // Strings are written as an array of their lengths, followed by an array of all characters
+  void write_array(const pmr_vector<pmr_string>& values) {
+    auto lengths = pmr_vector<uint32_t>(values.size());
+    auto total_length = size_t{0};
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      lengths[index] = static_cast<uint32_t>(values[index].size());
+      total_length += values[index].size();
+    }
+
+    auto characters = pmr_vector<char>{};
+    characters.reserve(total_length);
+    for (const auto& value : values) {
+      characters.insert(characters.end(), value.begin(), value.end());
+    }
+
+    write_array(lengths);
+    write_array(characters);
+  }
+
+  size_t position() const { return _position; }
+
+  // Writes value at a previous position, e.g., for sizes that are only known after the data has been written
+  template <typename T>
+  void overwrite(const size_t position, const T& value) {
+    _stream.seekp(static_cast<std::streamoff>(position));
+    _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    _stream.seekp(static_cast<std::streamoff>(_position));
+  }
+
+ private:
+  void _pad(const size_t byte_count) {
+    static constexpr auto zeros = std::array<char, PAGE_SIZE>{};
+    _stream.write(zeros.data(), static_cast<std::streamsize>(byte_count));
+    _position += byte_count;
+  }
+
+  std::ofstream _stream;
+  size_t _position{0};
+};
+
+// Reads from a memory-mapped checkpoint. Positions are relative to the begin of the file, which is page-aligned.
+class MappedFileReader {
+ public:
+  MappedFileReader(const int file_descriptor, const char* data, const size_t begin, const size_t end)
+      : _file_descriptor(file_descriptor), _data(data), _position(begin), _end(end) {}
+
+  template <typename T>
+  T read() {
+    Assert(_position + sizeof(T) <= _end, "Unexpected end of checkpoint");
+    auto value = T{};
+    std::memcpy(&value, _data + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    Assert(_position + length <= _end, "Unexpected end of checkpoint");
+    auto value = std::string{_data + _position, length};
+    _position += length;
+    return value;
+  }
+
+  // Arrays that span at least one page start on a page boundary in the file. They are not copied: The vector is
+  // allocated by the MappedArrayResource and its pages are then replaced by a private mapping of the array in the file.
+  // Only the value-initialization of the vector touches its (anonymous) pages, the file itself is paged in lazily. As
+  // the mapping is private, writes (e.g., inserts into the capacity of a mutable chunk) never reach the file. Smaller
+  // arrays are copied from the mapping of the entire file. @param capacity reserves space for further values.
+  template <typename T>
+  pmr_vector<T> read_array(const std::optional<size_t> capacity = std::nullopt) {
+    const auto count = read<uint64_t>();
+    const auto byte_count = count * sizeof(T);
+    _position = align(_position, array_alignment(byte_count));
+    Assert(_position + byte_count <= _end, "Unexpected end of checkpoint");
+
+    const auto file_offset = _position;
+    _position += byte_count;
+
+    if (byte_count < PAGE_SIZE) {
+      const auto* const begin = reinterpret_cast<const T*>(_data + file_offset);
+      auto values = pmr_vector<T>(begin, begin + count);
+      if (capacity) values.reserve(*capacity);
+      return values;
+    }
+
+    auto values = pmr_vector<T>{PolymorphicAllocator<T>{&MappedArrayResource::get()}};
+    values.reserve(std::max(count, capacity.value_or(0)));
+    values.resize(count);
+    auto* const address = mmap(values.data(), byte_count, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                               _file_descriptor, static_cast<off_t>(file_offset));
+    Assert(address == values.data(), std::string{"Could not map array from checkpoint: "} + std::strerror(errno));
+    return values;
+  }
+
+  // Returns the begin and end of an array in the mapping of the entire file, for arrays that are converted anyway
+  template <typename T>
+  std::pair<const T*, const T*> read_array_range() {
+    const auto count = read<uint64_t>();
+    const auto byte_count = count * sizeof(T);
+    _position = align(_position, array_alignment(byte_count));
+    Assert(_position + byte_count <= _end, "Unexpected end of checkpoint");
+
+    const auto* const begin = reinterpret_cast<const T*>(_data + _position);
+    _position += byte_count;
+    return {begin, begin + count};
+  }
+
+  void skip(const size_t byte_count) {
+    Assert(_position + byte_count <= _end, "Unexpected end of checkpoint");
+    _position += byte_count;
+  }
+
+  size_t position() const { return _position; }
+
+ private:
+  const int _file_descriptor;
+  const char* const _data;
+  size_t _position;
+  const size_t _end;
+};
+
+// NULL flags and strings do not have the same representation in memory as in the file and are therefore converted
+template <>
+pmr_vector<bool> MappedFileReader::read_array<bool>(const std::optional<size_t> capacity) {
+  const auto [begin, end] = read_array_range<BoolAsByteType>();
+  auto values = pmr_vector<bool>(begin, end);
+  if (capacity) values.reserve(*capacity);
+  return values;
+}
+
+template <>
+pmr_vector<pmr_string> MappedFileReader::read_array<pmr_string>(const std::optional<size_t> capacity) {
+  const auto [lengths_begin, lengths_end] = read_array_range<uint32_t>();
+  const auto [characters_begin, characters_end] = read_array_range<char>();
+  const auto string_count = static_cast<size_t>(lengths_end - lengths_begin);
+  const auto character_count = static_cast<size_t>(characters_end - characters_begin);
+
+  auto values = pmr_vector<pmr_string>(string_count);
+  if (capacity) values.reserve(*capacity);
+  auto offset = size_t{0};
+  for (auto index = size_t{0}; index < string_count; ++index) {
+    Assert(offset + lengths_begin[index] <= character_count, "Malformed string array in checkpoint");
+    values[index] = pmr_string{characters_begin + offset, lengths_begin[index]};
+    offset += lengths_begin[index];
+  }
+  return values;
+}
+
+/**
+ * Writing of segments and compressed vectors
+ */
+
+void write_compressed_vector(CheckpointWriter& writer, const BaseCompressedVector& compressed_vector) {
+  writer.write(compressed_vector.type());
+  switch (compressed_vector.type()) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      writer.write_array(dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      return;
+    case CompressedVectorType::FixedSize2ByteAligned:
+      writer.write_array(dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      return;
+    case CompressedVectorType::FixedSize1ByteAligned:
+      writer.write_array(dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      return;
+    case CompressedVectorType::SimdBp128:
+      writer.write(static_cast<uint64_t>(compressed_vector.size()));
+      writer.write_array(dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      return;
+  }
+  Fail("Unknown CompressedVectorType");
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const ValueSegment<T>& segment) {
+  writer.write(EncodingType::Unencoded);
+  writer.write(static_cast<BoolAsByteType>(segment.is_nullable()));
+  if (segment.is_nullable()) {
+    writer.write_array(segment.null_values());
+  }
+  writer.write_array(segment.values());
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const DictionarySegment<T>& segment) {
+  writer.write(EncodingType::Dictionary);
+  writer.write_array(*segment.dictionary());
+  write_compressed_vector(writer, *segment.attribute_vector());
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const FixedStringDictionarySegment<T>& segment) {
+  const auto& dictionary = *segment.fixed_string_dictionary();
+  writer.write(EncodingType::FixedStringDictionary);
+  writer.write(static_cast<uint32_t>(dictionary.string_length()));
+  writer.write(static_cast<uint64_t>(dictionary.size()));
+  writer.write_array(dictionary.data(), dictionary.string_length() * dictionary.size());
+  write_compressed_vector(writer, *segment.attribute_vector());
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const RunLengthSegment<T>& segment) {
+  writer.write(EncodingType::RunLength);
+  writer.write_array(*segment.values());
+  writer.write_array(*segment.null_values());
+  writer.write_array(*segment.end_positions());
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const FrameOfReferenceSegment<T>& segment) {
+  writer.write(EncodingType::FrameOfReference);
+  writer.write_array(segment.block_minima());
+  writer.write(static_cast<BoolAsByteType>(segment.null_values().has_value()));
+  if (segment.null_values()) {
+    writer.write_array(*segment.null_values());
+  }
+  write_compressed_vector(writer, segment.offset_values());
+}
+
+template <typename T>
+void write_segment(CheckpointWriter& writer, const LZ4Segment<T>& segment) {
+  writer.write(EncodingType::LZ4);
+  writer.write(static_cast<uint64_t>(segment.size()));
+  writer.write(static_cast<uint64_t>(segment.block_size()));
+  writer.write(static_cast<uint64_t>(segment.last_block_size()));
+
+  writer.write(static_cast<uint32_t>(segment.lz4_blocks().size()));
+  for (const auto& lz4_block : segment.lz4_blocks()) {
+    writer.write_array(lz4_block);
+  }
+
+  writer.write(static_cast<BoolAsByteType>(segment.null_values().has_value()));
+  if (segment.null_values()) {
+    writer.write_array(*segment.null_values());
+  }
+
+  writer.write_array(segment.dictionary());
+
+  writer.write(static_cast<BoolAsByteType>(segment.string_offsets() != nullptr));
+  if (segment.string_offsets()) {
+    write_compressed_vector(writer, *segment.string_offsets());
+  }
+}
+
+void write_segment(CheckpointWriter& writer, const ReferenceSegment& segment) {
+  Fail("Tables in the StorageManager are not expected to contain ReferenceSegments");
+}
+
+void write_chunk(CheckpointWriter& writer, const Chunk& chunk, const CommitID last_commit_id) {
+  const auto row_count = chunk.size();
+  writer.write(static_cast<ChunkOffset>(row_count));
+  writer.write(static_cast<BoolAsByteType>(chunk.is_mutable()));
+
+  const auto& sorted_by = chunk.individually_sorted_by();
+  writer.write(static_cast<uint32_t>(sorted_by.size()));
+  for (const auto& sort_definition : sorted_by) {
+    writer.write(sort_definition.column);
+    writer.write(sort_definition.sort_mode);
+  }
+
+  // Rows that are not visible as of the checkpoint's last commit ID were either deleted or not yet committed. Only
+  // their offsets are stored, so that loading a chunk does not have to read per-row MVCC data.
+  const auto mvcc_data = chunk.mvcc_data();
+  Assert(mvcc_data, "Tables in the StorageManager are expected to have MVCC data");
+  auto invalid_chunk_offsets = pmr_vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) > last_commit_id ||
+        mvcc_data->get_end_cid(chunk_offset) <= last_commit_id) {
+      invalid_chunk_offsets.emplace_back(chunk_offset);
+    }
+  }
+  writer.write_array(invalid_chunk_offsets);
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_and_segment_type(*chunk.get_segment(column_id), [&](const auto data_type_t, const auto& segment) {
+      write_segment(writer, segment);
+    });
+  }
+}
+
+void write_table(CheckpointWriter& writer, const std::string& table_name, const Table& table,
+                 const CommitID last_commit_id) {
+  writer.write(table_name);
+  writer.write(static_cast<ChunkOffset>(table.target_chunk_size()));
+
+  writer.write(static_cast<ColumnID::base_type>(table.column_count()));
+  for (const auto& column_definition : table.column_definitions()) {
+    writer.write(column_definition.name);
+    writer.write(data_type_to_string.left.at(column_definition.data_type));
+    writer.write(static_cast<BoolAsByteType>(column_definition.nullable));
+  }
+
+  const auto& key_constraints = table.soft_key_constraints();
+  writer.write(static_cast<uint32_t>(key_constraints.size()));
+  for (const auto& key_constraint : key_constraints) {
+    writer.write(key_constraint.key_type());
+    auto column_ids = std::vector<ColumnID>(key_constraint.columns().begin(), key_constraint.columns().end());
+    std::sort(column_ids.begin(), column_ids.end());
+    writer.write_array(column_ids);
+  }
+
+  // Physically deleted chunks are skipped
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (const auto chunk = table.get_chunk(chunk_id)) {
+      chunks.emplace_back(chunk);
+    }
+  }
+
+  writer.write(static_cast<uint32_t>(chunks.size()));
+  for (const auto& chunk : chunks) {
+    const auto size_position = writer.position();
+    writer.write(uint64_t{0});
+    write_chunk(writer, *chunk, last_commit_id);
+    writer.overwrite(size_position, static_cast<uint64_t>(writer.position() - size_position - sizeof(uint64_t)));
+  }
+}
+
+/**
+ * Reading of segments and compressed vectors
+ */
+
+std::unique_ptr<const BaseCompressedVector> read_compressed_vector(MappedFileReader& reader) {
+  const auto type = reader.read<CompressedVectorType>();
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(reader.read_array<uint32_t>());
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(reader.read_array<uint16_t>());
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(reader.read_array<uint8_t>());
+    case CompressedVectorType::SimdBp128: {
+      const auto size = reader.read<uint64_t>();
+      return std::make_unique<SimdBp128Vector>(reader.read_array<uint128_t>(), size);
+    }
+  }
+  Fail("Unknown CompressedVectorType in checkpoint");
+}
+
+// For mutable chunks, capacity is the target chunk size, so that inserts into the chunk do not need to reallocate.
+template <typename T>
+std::shared_ptr<AbstractSegment> read_segment(MappedFileReader& reader, const std::optional<ChunkOffset> capacity) {
+  const auto encoding_type = reader.read<EncodingType>();
+
+  switch (encoding_type) {
+    case EncodingType::Unencoded: {
+      const auto nullable = reader.read<BoolAsByteType>();
+      auto null_values = nullable ? reader.read_array<bool>(capacity) : pmr_vector<bool>{};
+      auto values = reader.read_array<T>(capacity);
+
+      if (nullable) return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+      return std::make_shared<ValueSegment<T>>(std::move(values));
+    }
+
+    case EncodingType::Dictionary: {
+      const auto dictionary = std::make_shared<pmr_vector<T>>(reader.read_array<T>());
+      const auto attribute_vector = std::shared_ptr<const BaseCompressedVector>{read_compressed_vector(reader)};
+      return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
+    }
+
+    case EncodingType::FixedStringDictionary:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FixedStringDictionary>,
+                                                hana::type_c<T>)) {
+        const auto string_length = reader.read<uint32_t>();
+        const auto dictionary_size = reader.read<uint64_t>();
+        auto characters = reader.read_array<char>();
+
+        // FixedStringVector cannot be constructed from an empty character vector, see its iterator constructor
+        auto dictionary = std::shared_ptr<FixedStringVector>{};
+        if (string_length == 0) {
+          const auto empty_strings = pmr_vector<pmr_string>(dictionary_size);
+          dictionary = std::make_shared<FixedStringVector>(empty_strings.begin(), empty_strings.end(), 0);
+        } else {
+          dictionary = std::make_shared<FixedStringVector>(std::move(characters), string_length);
+        }
+
+        const auto attribute_vector = std::shared_ptr<const BaseCompressedVector>{read_compressed_vector(reader)};
+        return std::make_shared<FixedStringDictionarySegment<T>>(dictionary, attribute_vector);
+      } else {
+        Fail("Unsupported data type for FixedStringDictionary encoding");
+      }
+
+    case EncodingType::RunLength: {
+      const auto values = std::make_shared<pmr_vector<T>>(reader.read_array<T>());
+      const auto null_values = std::make_shared<pmr_vector<bool>>(reader.read_array<bool>());
+      const auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(reader.read_array<ChunkOffset>());
+      return std::make_shared<RunLengthSegment<T>>(values, null_values, end_positions);
+    }
+
+    case EncodingType::FrameOfReference:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                hana::type_c<T>)) {
+        auto block_minima = reader.read_array<T>();
+        auto null_values = std::optional<pmr_vector<bool>>{};
+        if (reader.read<BoolAsByteType>()) {
+          null_values = reader.read_array<bool>();
+        }
+        auto offset_values = read_compressed_vector(reader);
+        return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
+                                                            std::move(offset_values));
+      } else {
+        Fail("Unsupported data type for FrameOfReference encoding");
+      }
+
+    case EncodingType::LZ4: {
+      const auto num_elements = reader.read<uint64_t>();
+      const auto block_size = reader.read<uint64_t>();
+      const auto last_block_size = reader.read<uint64_t>();
+
+      // The blocks are constructed with the allocator of the outer vector. Using the MappedArrayResource for it makes
+      // the allocators equal, so that the mapped blocks are moved instead of copied.
+      const auto block_count = reader.read<uint32_t>();
+      auto lz4_blocks =
+          pmr_vector<pmr_vector<char>>{PolymorphicAllocator<pmr_vector<char>>{&MappedArrayResource::get()}};
+      lz4_blocks.reserve(block_count);
+      auto compressed_size = size_t{0};
+      for (auto block_id = uint32_t{0}; block_id < block_count; ++block_id) {
+        lz4_blocks.emplace_back(reader.read_array<char>());
+        compressed_size += lz4_blocks.back().size();
+      }
+
+      auto null_values = std::optional<pmr_vector<bool>>{};
+      if (reader.read<BoolAsByteType>()) {
+        null_values = reader.read_array<bool>();
+      }
+
+      auto dictionary = reader.read_array<char>();
+
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        auto string_offsets = std::unique_ptr<const BaseCompressedVector>{};
+        if (reader.read<BoolAsByteType>()) {
+          string_offsets = read_compressed_vector(reader);
+        }
+        return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
+                                               std::move(string_offsets), block_size, last_block_size,
+                                               compressed_size, num_elements);
+      } else {
+        Assert(!reader.read<BoolAsByteType>(), "Unexpected string offsets for non-string LZ4Segment");
+        return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
+                                               block_size, last_block_size, compressed_size, num_elements);
+      }
+    }
+  }
+
+  Fail("Unknown EncodingType in checkpoint");
+}
+
+struct LoadedChunk {
+  Segments segments;
+  std::shared_ptr<MvccData> mvcc_data;
+  ChunkOffset invalid_row_count{0};
+  bool is_mutable{false};
+  std::vector<SortColumnDefinition> sorted_by;
+};
+
+LoadedChunk read_chunk(MappedFileReader& reader, const Table& table) {
+  auto loaded_chunk = LoadedChunk{};
+
+  const auto row_count = reader.read<ChunkOffset>();
+  loaded_chunk.is_mutable = reader.read<BoolAsByteType>();
+
+  const auto sorted_column_count = reader.read<uint32_t>();
+  for (auto index = uint32_t{0}; index < sorted_column_count; ++index) {
+    const auto column_id = reader.read<ColumnID>();
+    const auto sort_mode = reader.read<SortMode>();
+    loaded_chunk.sorted_by.emplace_back(SortColumnDefinition{column_id, sort_mode});
+  }
+
+  // Rows that were visible as of the checkpoint's last commit ID stay visible (begin CID 0, end CID MAX_COMMIT_ID).
+  // All other rows are invalidated (end CID 0). As in Table::append_mutable_chunk, the unused capacity of mutable
+  // chunks keeps the begin CID MAX_COMMIT_ID until rows are inserted there.
+  const auto capacity = loaded_chunk.is_mutable ? std::optional<ChunkOffset>{table.target_chunk_size()} : std::nullopt;
+  loaded_chunk.mvcc_data = std::make_shared<MvccData>(capacity.value_or(row_count), MvccData::MAX_COMMIT_ID);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    loaded_chunk.mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+  }
+
+  const auto [invalid_chunk_offsets_begin, invalid_chunk_offsets_end] = reader.read_array_range<ChunkOffset>();
+  for (auto iter = invalid_chunk_offsets_begin; iter != invalid_chunk_offsets_end; ++iter) {
+    Assert(*iter < row_count, "Malformed MVCC data in checkpoint");
+    loaded_chunk.mvcc_data->set_end_cid(*iter, CommitID{0});
+  }
+  loaded_chunk.invalid_row_count = static_cast<ChunkOffset>(invalid_chunk_offsets_end - invalid_chunk_offsets_begin);
+
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      loaded_chunk.segments.emplace_back(read_segment<ColumnDataType>(reader, capacity));
+    });
+  }
+
+  return loaded_chunk;
+}
+
+struct LoadedTable {
+  std::string name;
+  std::shared_ptr<Table> table;
+  std::vector<LoadedChunk> chunks;
+};
+
+}  // namespace
+
+namespace opossum {
+
+void Checkpoint::write(const std::string& filename) {
+  auto tables = std::vector<std::pair<std::string, std::shared_ptr<Table>>>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    tables.emplace_back(table_name, table);
+  }
+  std::sort(tables.begin(), tables.end());
+
+  // Loaded tables keep mappings of the checkpoint that they were loaded from. Truncating that file would invalidate
+  // their pages, so the checkpoint is written to a temporary file that then replaces the previous one.
+  const auto temporary_filename = filename + ".tmp";
+  {
+    auto writer = CheckpointWriter{temporary_filename};
+    writer.write(MAGIC_NUMBER);
+    writer.write(FORMAT_VERSION);
+    const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+    writer.write(last_commit_id);
+
+    writer.write(static_cast<uint32_t>(tables.size()));
+    for (const auto& [table_name, table] : tables) {
+      write_table(writer, table_name, *table, last_commit_id);
+    }
+  }
+
+  const auto rename_result = std::rename(temporary_filename.c_str(), filename.c_str());
+  Assert(rename_result == 0, "Could not replace checkpoint " + filename + ": " + std::strerror(errno));
+}
+
+void Checkpoint::load(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open checkpoint " + filename + ": " + std::strerror(errno));
+
+  // The file descriptor is needed to map the arrays of the segments (see MappedFileReader::read_array). These mappings
+  // keep the file alive on their own, so the descriptor is closed once all tables have been created (or an Assert
+  // fails).
+  struct FileDescriptorCloser {
+    ~FileDescriptorCloser() { close(file_descriptor); }
+    const int file_descriptor;
+  };
+  const auto file_descriptor_closer = FileDescriptorCloser{file_descriptor};
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  Assert(stat_result == 0, "Could not determine the size of checkpoint " + filename);
+  const auto file_size = static_cast<size_t>(file_status.st_size);
+  Assert(file_size >= sizeof(MAGIC_NUMBER), "Checkpoint " + filename + " is too small");
+
+  auto* mapped_address = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  Assert(mapped_address != MAP_FAILED, "Could not map checkpoint " + filename + ": " + std::strerror(errno));
+
+  // The mapping of the entire file is only used to read the table and chunk headers and small arrays. It is unmapped
+  // once all tables have been created (or an Assert fails). No read-ahead is requested, as the pages of the segments
+  // are only read when they are accessed.
+  const auto mapping = std::unique_ptr<void, std::function<void(void*)>>{
+      mapped_address, [file_size](void* address) { munmap(address, file_size); }};
+
+  const auto* data = static_cast<const char*>(mapped_address);
+  auto reader = MappedFileReader{file_descriptor, data, 0, file_size};
+
+  const auto magic_number = reader.read<std::remove_const_t<decltype(MAGIC_NUMBER)>>();
+  Assert(magic_number == MAGIC_NUMBER, filename + " is not a checkpoint");
+  Assert(reader.read<uint32_t>() == FORMAT_VERSION, "Unsupported version of checkpoint " + filename);
+  // The visibility as of the last commit ID has already been applied by the writer
+  reader.skip(sizeof(CommitID));
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  const auto table_count = reader.read<uint32_t>();
+  auto loaded_tables = std::vector<LoadedTable>(table_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (auto& loaded_table : loaded_tables) {
+    loaded_table.name = reader.read_string();
+    Assert(!storage_manager.has_table(loaded_table.name),
+           "Cannot load table " + loaded_table.name + " from checkpoint - a table with the same name already exists");
+    const auto target_chunk_size = reader.read<ChunkOffset>();
+
+    const auto column_count = reader.read<ColumnID::base_type>();
+    auto column_definitions = TableColumnDefinitions{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto name = reader.read_string();
+      const auto data_type = data_type_to_string.right.at(reader.read_string());
+      const auto nullable = static_cast<bool>(reader.read<BoolAsByteType>());
+      column_definitions.emplace_back(std::move(name), data_type, nullable);
+    }
+
+    loaded_table.table =
+        std::make_shared<Table>(column_definitions, TableType::Data, target_chunk_size, UseMvcc::Yes);
+
+    const auto key_constraint_count = reader.read<uint32_t>();
+    for (auto index = uint32_t{0}; index < key_constraint_count; ++index) {
+      const auto key_type = reader.read<KeyConstraintType>();
+      const auto column_ids = reader.read_array<ColumnID>();
+      loaded_table.table->add_soft_key_constraint(
+          TableKeyConstraint{{column_ids.begin(), column_ids.end()}, key_type});
+    }
+
+    // Only the chunk boundaries are determined here, the chunks themselves are read in parallel
+    const auto chunk_count = reader.read<uint32_t>();
+    loaded_table.chunks.resize(chunk_count);
+    for (auto& loaded_chunk : loaded_table.chunks) {
+      const auto chunk_size = reader.read<uint64_t>();
+      const auto chunk_begin = reader.position();
+      reader.skip(chunk_size);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_begin, chunk_size, table = loaded_table.table]() {
+        auto chunk_reader = MappedFileReader{file_descriptor, data, chunk_begin, chunk_begin + chunk_size};
+        loaded_chunk = read_chunk(chunk_reader, *table);
+        Assert(chunk_reader.position() == chunk_begin + chunk_size, "Malformed chunk in checkpoint");
+      }));
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto& loaded_table : loaded_tables) {
+    auto& table = *loaded_table.table;
+    for (auto& loaded_chunk : loaded_table.chunks) {
+      table.append_chunk(loaded_chunk.segments, loaded_chunk.mvcc_data);
+      const auto& chunk = table.last_chunk();
+      if (loaded_chunk.invalid_row_count > 0) chunk->increase_invalid_row_count(loaded_chunk.invalid_row_count);
+      if (!loaded_chunk.sorted_by.empty()) chunk->set_individually_sorted_by(loaded_chunk.sorted_by);
+      if (!loaded_chunk.is_mutable) chunk->finalize();
+    }
+
+    Hyrise::get().storage_manager.add_table(loaded_table.name, loaded_table.table);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Checkpoints store all tables of the StorageManager, including their encoded segments, MVCC data, sort information,
+ * and soft key constraints. Other than the binary format of BinaryWriter/BinaryParser, which stores a single table
+ * and is read through an ifstream, a checkpoint is written so that it can be loaded from a memory-mapped file:
+ *
+ *  - Every payload array (values, dictionaries, attribute vectors, NULL flags, MVCC commit IDs, ...) is preceded by
+ *    its element count and starts on a page boundary if it spans at least one page (on a 16-byte boundary otherwise).
+ *  - Every chunk is preceded by its size in bytes, so that the loader can find all chunks of a table without parsing
+ *    them and then import them in parallel.
+ *
+ * Segments are neither decoded nor re-encoded, and the page-aligned arrays are not copied either: Their vectors are
+ * backed by private mappings of the respective part of the file, which the kernel pages in lazily once the data is
+ * accessed (see MappedFileReader::read_array in checkpoint.cpp). Each of these mappings is owned by its vector and
+ * released with it. Only small arrays, NULL flags (vector<bool>), and string dictionaries are copied, as they are
+ * stored differently in memory. Checkpoint::write replaces the file instead of overwriting it, so that tables loaded
+ * from a previous checkpoint keep their pages.
+ *
+ * File format (native byte order):
+ *
+ * Description                 | Type                                | Size in bytes
+ * --------------------------------------------------------------------------------------------------------
+ * Magic number                | char array                          | 8
+ * Format version              | uint32_t                            | 4
+ * Last commit ID              | CommitID                            | 4
+ * Table count                 | uint32_t                            | 4
+ * Tables                      | see below                           | variable
+ *
+ * Table: name, target chunk size, column count, the column definitions (name, data type name, nullable), the key
+ * constraints (type, column count, ColumnIDs), the chunk count, and the chunks. Strings are stored as their length
+ * (uint32_t) and characters.
+ *
+ * Chunk: size in bytes of the following data (uint64_t), row count, mutable flag, sort definitions, the offsets of
+ * the rows that are invisible as of the last commit ID, and one segment per column. A segment starts with its
+ * EncodingType and stores the same components as the segment's constructor takes (see write_segment in
+ * checkpoint.cpp).
+ *
+ * Visibility: A checkpoint can be taken while the database is idle (i.e., no transactions are in flight). As no
+ * snapshot older than the checkpoint exists after a restart, only the state as of the checkpoint's last commit ID is
+ * stored: rows that were inserted and not deleted until then are visible to all transactions after loading, the
+ * offsets of all other rows are stored so that the loader invalidates them without reading per-row MVCC data.
+ *
+ * Physically deleted chunks are not written. Therefore, ChunkIDs may change when such chunks exist.
+ */
+class Checkpoint {
+ public:
+  // Writes all tables of the StorageManager to filename. Views and prepared plans are not included.
+  static void write(const std::string& filename);
+
+  // Adds all tables stored in filename to the StorageManager. None of the tables may exist yet.
+  static void load(const std::string& filename);
+};
+
+}  // namespace opossum
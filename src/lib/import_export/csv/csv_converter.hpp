@@ -1,10 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <charconv>
 #include <cstdlib>
-#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
@@ -18,8 +19,8 @@
 namespace opossum {
 
 /*
- * CsvConverter is a helper class that creates a ValueSegment by converting the given null terminated strings and placing
- * them at the given position.
+ * CsvConverter is a helper class that creates a ValueSegment by converting the given fields and placing them at the
+ * given position. The fields are views on the CSV content and are only copied if they need to be unescaped.
  * The base class BaseCsvConverter allows us to handle different types of columns uniformly.
  */
 
@@ -28,7 +29,7 @@ class BaseCsvConverter {
   virtual ~BaseCsvConverter() = default;
 
   // Converts value to the underlying data type and saves it at the given position.
-  virtual void insert(std::string& value, ChunkOffset position) = 0;
+  virtual void insert(std::string_view value, ChunkOffset position) = 0;
 
   // Returns the segment that contains the previously converted values.
   // After the call of finish, no other operation should be called.
@@ -49,13 +50,13 @@ class CsvConverter : public BaseCsvConverter {
   explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
       : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
 
-  void insert(std::string& value, ChunkOffset position) override {
+  void insert(std::string_view value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
       _null_values[position] = true;
       return;
     }
 
-    if (boost::to_lower_copy(value) == ParseConfig::NULL_STRING) {
+    if (value.length() == 4 && boost::iequals(value, ParseConfig::NULL_STRING)) {
       Assert(_config.null_handling != NullHandling::RejectNullStrings,
              "Unquoted null found in CSV file. Quote it for string literal \"null\", leave field empty for null "
              "value, or set 'null_handling' to the appropriate strategy in parse config.");
@@ -65,20 +66,20 @@ class CsvConverter : public BaseCsvConverter {
       }
     }
 
-    // clang-format off
-    if constexpr(std::is_same_v<T, pmr_string>) {
-      unescape(value, _config);
-    } else {  // NOLINT
-      // clang-format on
-      if (_config.reject_quoted_nonstrings) {
-        Assert(value == unescape_copy(value, _config),
-               "Unexpected quoted string " + value + " encountered in non-string column");
-      } else {
-        unescape(value, _config);
-      }
+    // Only quoted fields contain escaping, all others are converted straight from the CSV content
+    if (value.empty() || value.front() != _config.quote) {
+      _parsed_values[position] = _convert(value);
+      return;
     }
 
-    _parsed_values[position] = _get_conversion_function()(value);
+    if constexpr (!std::is_same_v<T, pmr_string>) {
+      Assert(!_config.reject_quoted_nonstrings,
+             "Unexpected quoted string " + std::string{value} + " encountered in non-string column");
+    }
+
+    auto unescaped_value = std::string{value};
+    unescape(unescaped_value, _config);
+    _parsed_values[position] = _convert(unescaped_value);
   }
 
   std::unique_ptr<AbstractSegment> finish() override {
@@ -91,12 +92,12 @@ class CsvConverter : public BaseCsvConverter {
 
  private:
   /*
-   * Returns a conversion function that converts from a string to type T.
-   * This function is defined for each type that can be stored in a ValueSegment.
+   * Converts a string to type T. This function is defined for each type that can be stored in a ValueSegment.
    * The assumption is that only csv fields of type string must be unescaped because other types cannot contain special
    * csv characters.
    */
-  std::function<T(const std::string&)> _get_conversion_function();
+  static T _convert(std::string_view value);
+
   pmr_vector<T> _parsed_values;
   pmr_vector<bool> _null_values;
   const bool _is_nullable;
@@ -104,48 +105,46 @@ class CsvConverter : public BaseCsvConverter {
 };
 
 template <>
-inline std::function<int32_t(const std::string&)> CsvConverter<int32_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stoi(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to int: " + str);
-    return converted;
-  };
+inline int32_t CsvConverter<int32_t>::_convert(std::string_view value) {
+  auto converted = int32_t{};
+  const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), converted);
+  Assert(error == std::errc{} && end == value.data() + value.size(),
+         "Unprocessed characters found while converting to int: " + std::string{value});
+  return converted;
 }
 
 template <>
-inline std::function<int64_t(const std::string&)> CsvConverter<int64_t>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = static_cast<int64_t>(std::stoll(str, &pos));
-    Assert(pos == str.size(), "Unprocessed characters found while converting to long: " + str);
-    return converted;
-  };
+inline int64_t CsvConverter<int64_t>::_convert(std::string_view value) {
+  auto converted = int64_t{};
+  const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), converted);
+  Assert(error == std::errc{} && end == value.data() + value.size(),
+         "Unprocessed characters found while converting to long: " + std::string{value});
+  return converted;
 }
 
+// std::from_chars for floating point types is not supported by all of our compilers yet. The short copies made for
+// std::stof/std::stod fit into the small string buffer and do not allocate.
 template <>
-inline std::function<float(const std::string&)> CsvConverter<float>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stof(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to float: " + str);
-    return converted;
-  };
+inline float CsvConverter<float>::_convert(std::string_view value) {
+  const auto str = std::string{value};
+  size_t pos;
+  auto converted = std::stof(str, &pos);
+  Assert(pos == str.size(), "Unprocessed characters found while converting to float: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<double(const std::string&)> CsvConverter<double>::_get_conversion_function() {
-  return [](const std::string& str) {
-    size_t pos;
-    auto converted = std::stod(str, &pos);
-    Assert(pos == str.size(), "Unprocessed characters found while converting to double: " + str);
-    return converted;
-  };
+inline double CsvConverter<double>::_convert(std::string_view value) {
+  const auto str = std::string{value};
+  size_t pos;
+  auto converted = std::stod(str, &pos);
+  Assert(pos == str.size(), "Unprocessed characters found while converting to double: " + str);
+  return converted;
 }
 
 template <>
-inline std::function<pmr_string(const std::string&)> CsvConverter<pmr_string>::_get_conversion_function() {
-  return [](const std::string& str) { return pmr_string{str}; };
+inline pmr_string CsvConverter<pmr_string>::_convert(std::string_view value) {
+  return pmr_string{value};
 }
 
 }  // namespace opossum
@@ -1,7 +1,19 @@
 #include "csv_parser.hpp"
 
-#include <fstream>
-#include <list>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CSV_PARSER_X86 1
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -15,14 +27,136 @@
 #include "import_export/csv/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The csv content is scanned in blocks of 64 bytes, so that the positions of the structural characters (separators,
+// delimiters, and quotes) within a block can be represented as one bitmask each.
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// Size of the ranges of the csv content that are scanned in parallel when searching for the chunk ends. A multiple of
+// BLOCK_SIZE.
+constexpr auto SCAN_RANGE_SIZE = size_t{4'000'000} / BLOCK_SIZE * BLOCK_SIZE;
+
+// Bit i refers to the i-th byte of the block
+struct CharacterMasks {
+  uint64_t separators{0};
+  uint64_t delimiters{0};
+  uint64_t quotes{0};
+  uint64_t escapes{0};
+};
+
+struct FieldEndMasks {
+  // Separators and delimiters that are not quoted
+  uint64_t field_ends{0};
+  // Delimiters that are not quoted
+  uint64_t row_ends{0};
+  // All delimiters, including quoted ones
+  uint64_t delimiters{0};
+};
+
+CharacterMasks find_characters_scalar(const char* block, const size_t size, const ParseConfig& config) {
+  auto masks = CharacterMasks{};
+  for (auto index = size_t{0}; index < size; ++index) {
+    const auto character = block[index];
+    masks.separators |= static_cast<uint64_t>(character == config.separator) << index;
+    masks.delimiters |= static_cast<uint64_t>(character == config.delimiter) << index;
+    masks.quotes |= static_cast<uint64_t>(character == config.quote) << index;
+    masks.escapes |= static_cast<uint64_t>(character == config.escape) << index;
+  }
+  return masks;
+}
+
+#ifdef CSV_PARSER_X86
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+AVX2_TARGET uint64_t find_character_avx2(const __m256i low, const __m256i high, const char character) {
+  const auto broadcast = _mm256_set1_epi8(character);
+  const auto low_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, broadcast)));
+  const auto high_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, broadcast)));
+  return static_cast<uint64_t>(low_mask) | (static_cast<uint64_t>(high_mask) << 32);
+}
+
+// Only used for complete blocks of BLOCK_SIZE bytes
+AVX2_TARGET CharacterMasks find_characters_avx2(const char* block, const ParseConfig& config) {
+  const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+  const auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+
+  auto masks = CharacterMasks{};
+  masks.separators = find_character_avx2(low, high, config.separator);
+  masks.delimiters = find_character_avx2(low, high, config.delimiter);
+  masks.quotes = find_character_avx2(low, high, config.quote);
+  masks.escapes = find_character_avx2(low, high, config.escape);
+  return masks;
+}
+
+#endif
+
+CharacterMasks find_characters(const char* block, const size_t size, const ParseConfig& config) {
+#ifdef CSV_PARSER_X86
+  static const auto avx2_supported = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+  }();
+
+  if (avx2_supported && size == BLOCK_SIZE) return find_characters_avx2(block, config);
+#endif
+
+  return find_characters_scalar(block, size, config);
+}
+
+// Sets bit i iff an odd number of bits in [0, i] is set in mask, i.e., iff the i-th byte is quoted
+uint64_t prefix_xor(uint64_t mask) {
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+}
+
+/**
+ * Finds the ends of the fields and rows in the block of csv_content starting at block_begin. in_quotes is the quoting
+ * state before the block and is updated to the state after it. As in RFC 4180, quotes are escaped by doubling them,
+ * which toggles the quoting state twice. If a different escape character is used, quotes that follow it are ignored.
+ */
+FieldEndMasks find_field_ends(std::string_view csv_content, const size_t block_begin, bool& in_quotes,
+                              const ParseConfig& config) {
+  const auto size = std::min(BLOCK_SIZE, csv_content.size() - block_begin);
+  const auto masks = find_characters(csv_content.data() + block_begin, size, config);
+
+  auto quotes = masks.quotes;
+  if (config.escape != config.quote) {
+    const auto follows_escape = block_begin > 0 && csv_content[block_begin - 1] == config.escape;
+    quotes &= ~((masks.escapes << 1) | static_cast<uint64_t>(follows_escape));
+  }
+
+  const auto quoted = prefix_xor(quotes) ^ (in_quotes ? ~uint64_t{0} : uint64_t{0});
+  in_quotes ^= static_cast<bool>(__builtin_popcountll(quotes) & 1);
+
+  auto field_end_masks = FieldEndMasks{};
+  field_end_masks.field_ends = (masks.separators | masks.delimiters) & ~quoted;
+  field_end_masks.row_ends = masks.delimiters & ~quoted;
+  field_end_masks.delimiters = masks.delimiters;
+  return field_end_masks;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<ChunkEncodingSpec>& encoding_spec) {
   // If no meta info is given as a parameter, look for a json file
   CsvMeta meta;
   if (csv_meta == std::nullopt) {
@@ -33,55 +167,65 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
 
   auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
 
-  auto table = _create_table_from_meta(chunk_size, meta);
+  auto table = create_table_from_meta(meta, chunk_size);
+  Assert(!encoding_spec || encoding_spec->size() == static_cast<size_t>(table->column_count()),
+         "Number of column encoding specs must match the table's column count.");
+
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open CSV file " + filename + ": " + std::strerror(errno));
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  const auto file_size = static_cast<size_t>(file_status.st_size);
+
+  // Empty files cannot be mapped
+  if (stat_result != 0 || file_size == 0) {
+    close(file_descriptor);
+    Assert(stat_result == 0, "Could not determine the size of CSV file " + filename);
+    return table;
+  }
+
+  auto* mapped_address = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  close(file_descriptor);
+  Assert(mapped_address != MAP_FAILED, "Could not map CSV file " + filename + ": " + std::strerror(errno));
+
+  // Unmapped once all chunks have been parsed (or an Assert fails). As the content is only read, the kernel can evict
+  // the pages of the mapping whenever it needs to, so that files larger than the main memory can be imported.
+  const auto mapping = std::unique_ptr<void, std::function<void(void*)>>{
+      mapped_address, [file_size](void* address) { munmap(address, file_size); }};
+
+  // The content is scanned front to back by each task, so we ask the kernel to read ahead aggressively
+  madvise(mapped_address, file_size, MADV_SEQUENTIAL);
 
-  std::ifstream csvfile{filename};
+  const auto csv_content = std::string_view{static_cast<const char*>(mapped_address), file_size};
 
   // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
+  if (csv_content.front() == '\r' || csv_content.front() == '\n') return table;
 
   {
-    std::string line;
-    std::getline(csvfile, line);
-    Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
+    const auto first_line = csv_content.substr(0, csv_content.find('\n'));
+    Assert(first_line.find('\r') == std::string_view::npos, "Windows encoding is not supported, use dos2unix");
   }
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
-  std::vector<size_t> field_ends;
-  std::mutex append_chunk_mutex;
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+  auto row_count = size_t{0};
+  const auto chunk_ends = _find_chunk_ends(csv_content, table->target_chunk_size(), meta, row_count);
+  const auto chunk_count = chunk_ends.size();
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+  // Create and start one parsing task per chunk
+  auto segments_by_chunks = std::vector<Segments>(chunk_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_count);
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    const auto chunk_begin = chunk_index == 0 ? size_t{0} : chunk_ends[chunk_index - 1] + 1;
+    const auto first_row = chunk_index * table->target_chunk_size();
+    const auto chunk_row_count = std::min(row_count - first_row, static_cast<size_t>(table->target_chunk_size()));
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+    // Only pass the part of the string that is actually needed to the parsing task
+    const auto csv_chunk = csv_content.substr(chunk_begin, chunk_ends[chunk_index] - chunk_begin);
 
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+    tasks.emplace_back(std::make_shared<JobTask>([&, chunk_index, csv_chunk, chunk_row_count, first_row]() {
+      segments_by_chunks[chunk_index] = _parse_into_chunk(csv_chunk, chunk_row_count, first_row, *table, meta,
+                                                          escaped_linebreak, encoding_spec);
     }));
     tasks.back()->schedule();
   }
@@ -92,7 +236,12 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
     const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
     table->append_chunk(segments, mvcc_data);
-    table->last_chunk()->finalize();
+    const auto chunk = table->last_chunk();
+    chunk->finalize();
+
+    // ChunkEncoder::encode_chunk would generate the pruning statistics as well, which we have to do ourselves as the
+    // segments were encoded before the chunk was created.
+    if (encoding_spec) generate_chunk_pruning_statistics(chunk);
   }
 
   return table;
@@ -101,10 +250,10 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
 std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
                                                               const ChunkOffset chunk_size) {
   const auto meta = process_csv_meta_file(filename);
-  return _create_table_from_meta(chunk_size, meta);
+  return create_table_from_meta(meta, chunk_size);
 }
 
-std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta) {
+std::shared_ptr<Table> CsvParser::create_table_from_meta(const CsvMeta& meta, const ChunkOffset chunk_size) {
   TableColumnDefinitions column_definitions;
   for (const auto& column_meta : meta.columns) {
     auto column_name = column_meta.name;
@@ -121,65 +270,105 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
-bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
-                                      const CsvMeta& meta) {
-  field_ends.clear();
-  if (csv_content.empty()) {
-    return false;
+std::vector<size_t> CsvParser::_find_chunk_ends(std::string_view csv_content, const ChunkOffset chunk_size,
+                                                const CsvMeta& meta, size_t& row_count) {
+  const auto range_count = (csv_content.size() + SCAN_RANGE_SIZE - 1) / SCAN_RANGE_SIZE;
+
+  // First pass: Scan each range as if it began outside of quotes. If it actually begins within quotes, the quoting
+  // state is inverted for the entire range and the quoted delimiters are the ones that end the rows.
+  struct RangeInfo {
+    size_t row_ends_if_unquoted{0};
+    size_t delimiters{0};
+    bool toggles_quotes{false};
+
+    // Computed after the first pass
+    bool begins_in_quotes{false};
+    size_t first_row{0};
+  };
+  auto range_infos = std::vector<RangeInfo>(range_count);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(range_count);
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, range_index]() {
+      const auto range_begin = range_index * SCAN_RANGE_SIZE;
+      const auto range_end = std::min(range_begin + SCAN_RANGE_SIZE, csv_content.size());
+      auto& range_info = range_infos[range_index];
+
+      auto in_quotes = false;
+      for (auto block_begin = range_begin; block_begin < range_end; block_begin += BLOCK_SIZE) {
+        const auto masks = find_field_ends(csv_content, block_begin, in_quotes, meta.config);
+        range_info.row_ends_if_unquoted += __builtin_popcountll(masks.row_ends);
+        range_info.delimiters += __builtin_popcountll(masks.delimiters);
+      }
+      range_info.toggles_quotes = in_quotes;
+    }));
+    tasks.back()->schedule();
   }
+  Hyrise::get().scheduler()->wait_for_tasks(tasks);
 
-  std::string search_for{meta.config.separator, meta.config.delimiter, meta.config.quote};
-
-  size_t from = 0;
-  unsigned int rows = 0;
-  unsigned int field_count = 1;
-  bool in_quotes = false;
-  while (rows < table.target_chunk_size()) {
-    // Find either of row separator, column delimiter, quote identifier
-    auto pos = csv_content.find_first_of(search_for, from);
-    if (std::string::npos == pos) {
-      break;
-    }
-    from = pos + 1;
-    const char elem = csv_content[pos];
-
-    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
-    if (elem == meta.config.quote) {
-      bool quote_is_escaped = false;
-      if (meta.config.quote != meta.config.escape) {
-        quote_is_escaped = pos != 0 && csv_content[pos - 1] == meta.config.escape;
-      }
-      if (!quote_is_escaped) {
-        in_quotes = !in_quotes;
+  auto in_quotes = false;
+  row_count = 0;
+  for (auto& range_info : range_infos) {
+    range_info.begins_in_quotes = in_quotes;
+    range_info.first_row = row_count;
+    row_count += in_quotes ? range_info.delimiters - range_info.row_ends_if_unquoted : range_info.row_ends_if_unquoted;
+    in_quotes ^= range_info.toggles_quotes;
+  }
+  Assert(!in_quotes, "CSV file ends within a quoted field");
+
+  // The last row does not need to end with a delimiter
+  const auto last_row_is_terminated = csv_content.back() == meta.config.delimiter;
+  if (!last_row_is_terminated) ++row_count;
+
+  const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+  auto chunk_ends = std::vector<size_t>(chunk_count);
+  chunk_ends.back() = last_row_is_terminated ? csv_content.size() - 1 : csv_content.size();
+
+  // Second pass: Find the delimiters that end every chunk_size-th row. Each range writes to distinct chunk_ends.
+  tasks.clear();
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, range_index]() {
+      const auto range_begin = range_index * SCAN_RANGE_SIZE;
+      const auto range_end = std::min(range_begin + SCAN_RANGE_SIZE, csv_content.size());
+      const auto& range_info = range_infos[range_index];
+
+      // Index of the next row that ends a chunk
+      auto next_chunk_end_row = (range_info.first_row / chunk_size + 1) * chunk_size - 1;
+      auto block_first_row = range_info.first_row;
+      auto in_quotes = range_info.begins_in_quotes;
+      for (auto block_begin = range_begin; block_begin < range_end; block_begin += BLOCK_SIZE) {
+        auto row_ends = find_field_ends(csv_content, block_begin, in_quotes, meta.config).row_ends;
+        const auto block_end_row = block_first_row + __builtin_popcountll(row_ends);
+
+        // row is the index of the row that is ended by the lowest bit of row_ends
+        auto row = block_first_row;
+        while (next_chunk_end_row < block_end_row) {
+          for (; row < next_chunk_end_row; ++row) {
+            row_ends &= row_ends - 1;
+          }
+
+          const auto chunk_index = next_chunk_end_row / chunk_size;
+          if (chunk_index < chunk_count - 1) {
+            chunk_ends[chunk_index] = block_begin + __builtin_ctzll(row_ends);
+          }
+          next_chunk_end_row += chunk_size;
+        }
+        block_first_row = block_end_row;
       }
-    }
-
-    // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == meta.config.delimiter && !in_quotes) {
-      DebugAssert(field_count == static_cast<size_t>(table.column_count()),
-                  "Number of CSV fields does not match number of columns.");
-      ++rows;
-      field_count = 0;
-    }
-
-    // Determine if separator marks end of field or is part of the (string) value
-    if (in_quotes || elem == meta.config.quote) {
-      continue;
-    }
-
-    ++field_count;
-    field_ends.push_back(pos);
+    }));
+    tasks.back()->schedule();
   }
+  Hyrise::get().scheduler()->wait_for_tasks(tasks);
 
-  return true;
+  return chunk_ends;
 }
 
-size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
-                                    const Table& table, Segments& segments, const CsvMeta& meta,
-                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
+Segments CsvParser::_parse_into_chunk(std::string_view csv_chunk, const size_t row_count, const size_t first_row,
+                                      const Table& table, const CsvMeta& meta, const std::string& escaped_linebreak,
+                                      const std::optional<ChunkEncodingSpec>& encoding_spec) {
   // For each csv column, create a CsvConverter which builds up a ValueSegment
   const auto column_count = table.column_count();
-  const auto row_count = field_ends.size() / column_count;
   std::vector<std::unique_ptr<BaseCsvConverter>> converters;
 
   for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
@@ -193,42 +382,72 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
     });
   }
 
-  Assert(field_ends.size() == row_count * column_count, "Unexpected number of fields");
-
   size_t start = 0;
   size_t row_id = 0;
-  size_t field_idx = 0;
   ColumnID column_id{0};
 
+  // The fields are passed to the converters as views on the csv content. Only fields that contain escaped linebreaks
+  // (which do not follow RFC 4180) are copied to be sanitized.
+  const auto insert_field = [&](const size_t end) {
+    Assert(column_id < column_count, "Number of CSV fields does not match number of columns.");
+    DebugAssert(row_id < row_count, "More rows than found by _find_chunk_ends");
+    const auto field = csv_chunk.substr(start, end - start);
+    start = end + 1;
+
+    if (!meta.config.rfc_mode && field.find(escaped_linebreak) != std::string_view::npos) {
+      auto sanitized_field = std::string{field};
+      _sanitize_field(sanitized_field, meta, escaped_linebreak);
+      converters[column_id]->insert(sanitized_field, static_cast<ChunkOffset>(row_id));
+    } else {
+      converters[column_id]->insert(field, static_cast<ChunkOffset>(row_id));
+    }
+  };
+
+  const auto end_row = [&]() {
+    Assert(column_id == column_count - 1, "Number of CSV fields does not match number of columns.");
+    ++row_id;
+    column_id = ColumnID{0};
+  };
+
   try {
-    for (; row_id < row_count; ++row_id) {
-      for (column_id = ColumnID{0}; column_id < column_count; ++column_id, ++field_idx) {
-        const auto end = field_ends[field_idx];
-        auto field = std::string{csv_chunk.substr(start, end - start)};
-        start = end + 1;
-
-        if (!meta.config.rfc_mode) {
-          // CSV fields not following RFC 4810 might need some preprocessing
-          _sanitize_field(field, meta, escaped_linebreak);
+    // The chunk begins with a row and thus outside of quotes
+    auto in_quotes = false;
+    for (auto block_begin = size_t{0}; block_begin < csv_chunk.size(); block_begin += BLOCK_SIZE) {
+      const auto masks = find_field_ends(csv_chunk, block_begin, in_quotes, meta.config);
+
+      for (auto field_ends = masks.field_ends; field_ends != 0; field_ends &= field_ends - 1) {
+        const auto offset = __builtin_ctzll(field_ends);
+        insert_field(block_begin + offset);
+
+        if (masks.row_ends & (uint64_t{1} << offset)) {
+          end_row();
+        } else {
+          ++column_id;
         }
-
-        converters[column_id]->insert(field, static_cast<ChunkOffset>(row_id));
       }
     }
+
+    // The delimiter of the last row is not part of csv_chunk
+    insert_field(csv_chunk.size());
+    end_row();
   } catch (const std::exception& exception) {
-    throw std::logic_error("Exception while parsing CSV, row " + std::to_string(row_id) + ", column " +
+    throw std::logic_error("Exception while parsing CSV, row " + std::to_string(first_row + row_id) + ", column " +
                            std::to_string(column_id) + ":\n" + exception.what());
   }
 
-  // Transform the field_offsets to segments and add segments to chunk.
-  {
-    std::lock_guard<std::mutex> lock(append_chunk_mutex);
-    for (auto& converter : converters) {
-      segments.push_back(converter->finish());
+  Assert(row_id == row_count, "Unexpected number of rows");
+
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto segment = std::shared_ptr<AbstractSegment>{converters[column_id]->finish()};
+    if (encoding_spec) {
+      segment = ChunkEncoder::encode_segment(segment, table.column_data_type(column_id), (*encoding_spec)[column_id]);
     }
+    segments.emplace_back(std::move(segment));
   }
 
-  return row_count;
+  return segments;
 }
 
 void CsvParser::_sanitize_field(std::string& field, const CsvMeta& meta, const std::string& escaped_linebreak) {
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
@@ -21,48 +22,58 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * The csv file is mapped into memory instead of being read into a buffer, so that importing a file does not require
+ * additional memory for its content. The rows that end the chunks are found in two parallel passes over the mapping
+ * (see _find_chunk_ends). Afterwards, each chunk is parsed by its own task directly from the mapping into typed
+ * ValueSegments and, if an encoding is given, encoded by that task as well. In the end all chunks are combined to the
+ * final table.
  */
 class CsvParser {
  public:
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If set, the chunks are encoded with the given encoding per column while they are imported.
    * @returns             The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
- protected:
   /*
-   * Use the meta information stored in _meta to create a new table with according column description.
+   * Use the meta information stored in meta to create a new, empty table with according column description.
    */
-  static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
+  static std::shared_ptr<Table> create_table_from_meta(const CsvMeta& meta,
+                                                       const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+ protected:
   /*
-   * @param      csv_content String_view on the remaining content of the CSV.
-   * @param      table       Empty table created by _process_meta_file.
-   * @param[out] field_ends  Empty vector, to be filled with positions of the field ends for one chunk found in \p
-   * csv_content.
-   * @returns                False if \p csv_content is empty or chunk_size set to 0, True otherwise.
+   * The chunk ends are found in two passes, each of which processes ranges of the csv content in parallel. The first
+   * pass determines the number of rows and whether the quotes are balanced in each range. From that, the quoting state
+   * and the index of the first row at the beginning of each range follow. The second pass then collects the positions
+   * of the delimiters that end every chunk_size-th row.
+   *
+   * @param      csv_content String_view on the entire content of the CSV.
+   * @param[out] row_count   The number of rows in \p csv_content.
+   * @returns                The positions of the delimiters that end the chunks. The last chunk ends at the size of
+   *                         \p csv_content if it does not end with a delimiter.
    */
-  static bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
-                                    const CsvMeta& meta);
+  static std::vector<size_t> _find_chunk_ends(std::string_view csv_content, const ChunkOffset chunk_size,
+                                              const CsvMeta& meta, size_t& row_count);
 
   /*
-   * @param      csv_chunk  String_view on one chunk of the CSV.
-   * @param      field_ends Positions of the field ends of the given \p csv_chunk.
-   * @param      table      Empty table created by _process_meta_file.
-   * @param[out] segments   The segments of the chunk, to be populated with data
-   * @returns               The number of rows in the chunk
+   * @param      csv_chunk     String_view on the rows of one chunk of the CSV, without the delimiter of the last row.
+   * @param      row_count     The number of rows in \p csv_chunk.
+   * @param      first_row     The index of the first row of \p csv_chunk in the CSV, used for error messages.
+   * @param      table         Empty table created by create_table_from_meta.
+   * @param      encoding_spec If set, the encoding of the returned segments.
+   * @returns                  The segments of the chunk
    */
-  static size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
-                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak,
-                                  std::mutex& append_chunk_mutex);
+  static Segments _parse_into_chunk(std::string_view csv_chunk, const size_t row_count, const size_t first_row,
+                                    const Table& table, const CsvMeta& meta, const std::string& escaped_linebreak,
+                                    const std::optional<ChunkEncodingSpec>& encoding_spec);
 
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
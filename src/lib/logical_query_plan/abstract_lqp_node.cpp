@@ -65,6 +65,9 @@ AbstractLQPNode::~AbstractLQPNode() {
   Assert(_outputs.empty(),
          "There are outputs that should still reference this node. Thus this node shouldn't get deleted");
 
+  // Detached inputs do not know about this node
+  if (_has_detached_inputs) return;
+
   // We're in the destructor, thus we must make sure we're not calling any virtual methods - so we're doing the removal
   // directly instead of calling set_left_input/right_input(nullptr)
   if (_inputs[0]) _inputs[0]->_remove_output_pointer(*this);
@@ -118,6 +121,7 @@ void AbstractLQPNode::set_input(LQPInputSide side, const std::shared_ptr<Abstrac
                   type == LQPNodeType::Union || type == LQPNodeType::Update || type == LQPNodeType::Intersect ||
                   type == LQPNodeType::Except || type == LQPNodeType::ChangeMetaTable,
               "This node type does not accept a right input");
+  DebugAssert(!_has_detached_inputs, "Cannot change detached inputs, call attach_inputs() first");
 
   // We need a reference to _inputs[input_idx], so not calling this->input(side)
   auto& current_input = _inputs[static_cast<int>(side)];
@@ -140,6 +144,30 @@ void AbstractLQPNode::set_input(LQPInputSide side, const std::shared_ptr<Abstrac
   }
 }
 
+void AbstractLQPNode::set_detached_inputs(const std::shared_ptr<AbstractLQPNode>& left,
+                                          const std::shared_ptr<AbstractLQPNode>& right) {
+  DebugAssert(input_count() == 0, "Detached inputs can only be set on a node without inputs");
+  DebugAssert(right == nullptr || type == LQPNodeType::Join || type == LQPNodeType::Union ||
+                  type == LQPNodeType::Intersect || type == LQPNodeType::Except,
+              "This node type does not accept a right input");
+  DebugAssert((!left || !left->_has_detached_inputs) && (!right || !right->_has_detached_inputs),
+              "Detached inputs cannot have detached inputs themselves");
+
+  _inputs = {left, right};
+  _has_detached_inputs = true;
+}
+
+void AbstractLQPNode::attach_inputs() {
+  DebugAssert(_has_detached_inputs, "Node has no detached inputs");
+
+  _has_detached_inputs = false;
+  for (const auto& input : _inputs) {
+    if (input) input->_add_output_pointer(shared_from_this());
+  }
+}
+
+bool AbstractLQPNode::has_detached_inputs() const { return _has_detached_inputs; }
+
 size_t AbstractLQPNode::input_count() const {
   /**
    * Testing the shared_ptrs for null in _inputs to determine input count
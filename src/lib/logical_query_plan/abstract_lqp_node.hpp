@@ -113,6 +113,25 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
   size_t output_count() const;
   /** @} */
 
+  /**
+   * @defgroup Detached inputs
+   *
+   * set_input() registers this node as an output of its input and thus modifies the input. Join ordering algorithms
+   * (see DpCcp) cost candidate plans on top of shared subplans from multiple threads. A candidate node with detached
+   * inputs references its inputs without being registered as their output, so that the shared subplans are only read.
+   * Once a candidate has been chosen, attach_inputs() registers it as an output of its inputs. Discarded candidates
+   * can simply be released.
+   *
+   * A node with detached inputs must not be used as an input of a node with detached inputs itself, nor may its inputs
+   * be changed via set_input() before attach_inputs() is called.
+   * @{
+   */
+  void set_detached_inputs(const std::shared_ptr<AbstractLQPNode>& left,
+                           const std::shared_ptr<AbstractLQPNode>& right = nullptr);
+  void attach_inputs();
+  bool has_detached_inputs() const;
+  /** @} */
+
   /**
    * @param input_node_mapping     If the LQP contains external expressions, a mapping for the nodes used by them needs
    *                               to be provided.
@@ -258,6 +277,7 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
 
   std::vector<std::weak_ptr<AbstractLQPNode>> _outputs;
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
+  bool _has_detached_inputs{false};
 };
 
 std::ostream& operator<<(std::ostream& stream, const AbstractLQPNode& node);
@@ -33,6 +33,9 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossy_cast.hpp"
+#include "lqp_utils.hpp"
+#include "mock_node.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -58,6 +61,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -65,6 +69,7 @@
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "static_table_node.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
@@ -72,6 +77,13 @@
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+// For larger row counts, keeping one heap of candidates per chunk is not cheaper than sorting the entire input
+constexpr auto MAX_TOP_K_ROW_COUNT = int64_t{10'000};
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -286,10 +298,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
   std::shared_ptr<AbstractOperator> current_pqp = input_operator;
+  current_pqp = std::make_shared<Sort>(current_pqp, _translate_sort_column_definitions(node));
+
+  return current_pqp;
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
@@ -305,9 +324,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *sort_mode_iter});
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -362,9 +380,55 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   });
   Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
 
+  if (const auto join_hash = std::dynamic_pointer_cast<JoinHash>(join_operator)) {
+    join_hash->runtime_filter_source = _runtime_filter_source(*join_node);
+  }
+
   return join_operator;
 }
 
+std::optional<RuntimeFilterSource> LQPTranslator::_runtime_filter_source(const JoinNode& join_node) const {
+  // Runtime filters are only valid if the unmatched rows of the target input are discarded
+  if (join_node.join_mode != JoinMode::Inner && join_node.join_mode != JoinMode::Semi) return std::nullopt;
+
+  // The filter compares hashes of the source and the target values, which requires equal data types
+  const auto& primary_predicate = join_node.join_predicates().front();
+  if (primary_predicate->arguments[0]->data_type() != primary_predicate->arguments[1]->data_type()) {
+    return std::nullopt;
+  }
+
+  // Without statistics (e.g., for StaticTableNodes of temporary tables), the input sizes cannot be estimated
+  auto statistics_available = true;
+  for (const auto& input : {join_node.left_input(), join_node.right_input()}) {
+    visit_lqp(input, [&](const auto& node) {
+      if (node->type == LQPNodeType::StaticTable &&
+          !std::static_pointer_cast<StaticTableNode>(node)->table->table_statistics()) {
+        statistics_available = false;
+      }
+      if (node->type == LQPNodeType::Mock && !std::static_pointer_cast<MockNode>(node)->table_statistics()) {
+        statistics_available = false;
+      }
+      return statistics_available ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+  }
+  if (!statistics_available) return std::nullopt;
+
+  if (!_cardinality_estimator) {
+    _cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    _cardinality_estimator->guarantee_bottom_up_construction();
+  }
+
+  // The target input waits for the source input to be executed. This only pays off if the source is the smaller input.
+  const auto left_cardinality = _cardinality_estimator->estimate_cardinality(join_node.left_input());
+  const auto right_cardinality = _cardinality_estimator->estimate_cardinality(join_node.right_input());
+  if (right_cardinality < left_cardinality) return RuntimeFilterSource::RightInput;
+  if (join_node.join_mode == JoinMode::Inner && left_cardinality < right_cardinality) {
+    return RuntimeFilterSource::LeftInput;
+  }
+
+  return std::nullopt;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
@@ -406,10 +470,27 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto& input_node = node->left_input();
+
+  // A Limit with a small, constant row count on top of a Sort that is not used elsewhere only needs the first rows of
+  // the sorted input. Instead of sorting the entire input, we fuse both nodes into a TopK operator.
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+    const auto row_count = value_expression && (value_expression->data_type() == DataType::Int ||
+                                                value_expression->data_type() == DataType::Long)
+                               ? lossy_variant_cast<int64_t>(value_expression->value)
+                               : std::nullopt;
+    if (row_count && *row_count >= 0 && *row_count <= MAX_TOP_K_ROW_COUNT) {
+      return std::make_shared<TopK>(translate_node(input_node->left_input()),
+                                    _translate_sort_column_definitions(input_node),
+                                    _translate_expressions({limit_node->num_rows_expression()}, input_node).front());
+    }
+  }
+
+  const auto input_operator = translate_node(input_node);
+  return std::make_shared<Limit>(input_operator,
+                                 _translate_expressions({limit_node->num_rows_expression()}, input_node).front());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
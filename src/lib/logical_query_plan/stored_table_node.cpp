@@ -55,7 +55,9 @@ std::string StoredTableNode::description(const DescriptionMode mode) const {
 
   std::ostringstream stream;
   stream << "[StoredTable] Name: '" << table_name << "' pruned: ";
-  stream << _pruned_chunk_ids.size() << "/" << stored_table->chunk_count() << " chunk(s), ";
+  stream << _pruned_chunk_ids.size() << "/" << stored_table->chunk_count() << " chunk(s)";
+  if (join_pruned_chunk_count > 0) stream << " (" << join_pruned_chunk_count << " without join partners)";
+  stream << ", ";
   stream << _pruned_column_ids.size() << "/" << stored_table->column_count() << " column(s)";
 
   return stream.str();
@@ -175,6 +177,7 @@ std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMappin
   const auto copy = make(table_name);
   copy->set_pruned_chunk_ids(_pruned_chunk_ids);
   copy->set_pruned_column_ids(_pruned_column_ids);
+  copy->join_pruned_chunk_count = join_pruned_chunk_count;
   return copy;
 }
 
@@ -52,6 +52,10 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
   // statistics if they have changed from the original table, e.g., as the result of chunk pruning.
   std::shared_ptr<TableStatistics> table_statistics;
 
+  // Number of the pruned chunks that were pruned by the DipsPruningRule as they cannot contain join partners. Only
+  // used for the description, e.g., in the LQPVisualizer.
+  size_t join_pruned_chunk_count{0};
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
@@ -0,0 +1,110 @@
+#include "budgeted_memory_resource.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+thread_local opossum::BudgetedMemoryResource* current_resource = nullptr;  // NOLINT
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<BudgetedMemoryResource> BudgetedMemoryResource::create(
+    const size_t budget_bytes, const std::shared_ptr<BudgetedMemoryResource>& parent) {
+  // The owners hold a single reference, which is dropped when the last shared_ptr is destroyed
+  return std::shared_ptr<BudgetedMemoryResource>(new BudgetedMemoryResource(budget_bytes, parent),
+                                                 [](BudgetedMemoryResource* resource) {
+                                                   resource->_release_reference();
+                                                 });
+}
+
+BudgetedMemoryResource::BudgetedMemoryResource(const size_t budget_bytes,
+                                               const std::shared_ptr<BudgetedMemoryResource>& parent)
+    : _budget(budget_bytes), _parent(parent), _upstream(boost::container::pmr::new_delete_resource()) {}
+
+BudgetedMemoryResource* BudgetedMemoryResource::current() { return current_resource; }
+
+size_t BudgetedMemoryResource::budget() const { return _budget; }
+
+const std::shared_ptr<BudgetedMemoryResource>& BudgetedMemoryResource::parent() const { return _parent; }
+
+size_t BudgetedMemoryResource::allocated_bytes() const { return _allocated_bytes.load(std::memory_order_relaxed); }
+
+size_t BudgetedMemoryResource::peak_allocated_bytes() const {
+  return _peak_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+size_t BudgetedMemoryResource::available_bytes() const {
+  const auto allocated_bytes = this->allocated_bytes();
+  const auto available_bytes = allocated_bytes < _budget ? _budget - allocated_bytes : 0;
+  return _parent ? std::min(available_bytes, _parent->available_bytes()) : available_bytes;
+}
+
+bool BudgetedMemoryResource::fits(const size_t additional_bytes) const {
+  return additional_bytes <= available_bytes();
+}
+
+void BudgetedMemoryResource::add_spilled_bytes(const size_t bytes) {
+  _spilled_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  if (_parent) _parent->add_spilled_bytes(bytes);
+}
+
+size_t BudgetedMemoryResource::spilled_bytes() const { return _spilled_bytes.load(std::memory_order_relaxed); }
+
+void* BudgetedMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  auto* const pointer = _upstream->allocate(bytes, alignment);
+  _reference_count.fetch_add(1, std::memory_order_relaxed);
+  _add_allocated_bytes(bytes);
+  return pointer;
+}
+
+void BudgetedMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  _upstream->deallocate(pointer, bytes, alignment);
+  _subtract_allocated_bytes(bytes);
+  _release_reference();
+}
+
+bool BudgetedMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+void BudgetedMemoryResource::_add_allocated_bytes(const size_t bytes) {
+  // Relaxed ordering suffices, as the counters are only used for statistics and for the decision to spill
+  const auto allocated_bytes = _allocated_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak_allocated_bytes = _peak_allocated_bytes.load(std::memory_order_relaxed);
+  while (allocated_bytes > peak_allocated_bytes &&
+         !_peak_allocated_bytes.compare_exchange_weak(peak_allocated_bytes, allocated_bytes,
+                                                      std::memory_order_relaxed)) {
+  }
+
+  if (_parent) _parent->_add_allocated_bytes(bytes);
+}
+
+void BudgetedMemoryResource::_subtract_allocated_bytes(const size_t bytes) {
+  _allocated_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+  if (_parent) _parent->_subtract_allocated_bytes(bytes);
+}
+
+void BudgetedMemoryResource::_release_reference() {
+  if (_reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+MemoryResourceScope::MemoryResourceScope(const std::shared_ptr<BudgetedMemoryResource>& resource)
+    : _resource(resource), _previous_resource(current_resource) {
+  current_resource = _resource.get();
+}
+
+MemoryResourceScope::~MemoryResourceScope() {
+  DebugAssert(current_resource == _resource.get(), "MemoryResourceScopes have to be left in reverse order");
+  current_resource = _previous_resource;
+}
+
+}  // namespace opossum
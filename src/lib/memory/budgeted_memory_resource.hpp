@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that tracks the memory allocated for a query and compares it to the query's memory budget. While a
+ * MemoryResourceScope is active, it is the default memory resource of the current thread, i.e., it is used by all
+ * pmr containers (segments, PosLists, strings, ...) that are created without an explicit allocator. Tasks that are
+ * created within a scope are executed within the same scope, so that the jobs of operators are tracked as well.
+ *
+ * The budget is not enforced when memory is allocated. Instead, the memory-intensive operators (JoinHash,
+ * AggregateHash, and Sort) check whether their intermediate data fits into the remaining budget and spill it to disk
+ * (see SpillFile) if it does not.
+ *
+ * Resources can have a parent resource (e.g., the resource of a benchmark client for the resources of its statements).
+ * Allocations and spilled bytes are accounted to the parent as well, and the budget of the parent also limits the
+ * budget available to the child.
+ *
+ * Allocations may outlive both the scope and the owner of the resource, e.g., if the result table of a query is used
+ * after the query has been executed. Thus, the resource is only deleted once all shared_ptrs returned by create() are
+ * gone AND all of its allocations have been freed.
+ */
+class BudgetedMemoryResource : public boost::container::pmr::memory_resource,
+                               public std::enable_shared_from_this<BudgetedMemoryResource>,
+                               private Noncopyable {
+ public:
+  static std::shared_ptr<BudgetedMemoryResource> create(
+      const size_t budget_bytes, const std::shared_ptr<BudgetedMemoryResource>& parent = nullptr);
+
+  // Returns the resource of the innermost MemoryResourceScope of the current thread, or nullptr if there is none
+  static BudgetedMemoryResource* current();
+
+  size_t budget() const;
+  const std::shared_ptr<BudgetedMemoryResource>& parent() const;
+  size_t allocated_bytes() const;
+  size_t peak_allocated_bytes() const;
+
+  // Returns the number of bytes that can be allocated before the budget of this resource or of one of its ancestors is
+  // exceeded
+  size_t available_bytes() const;
+
+  // Returns true if @param additional_bytes can be allocated without exceeding the budget
+  bool fits(const size_t additional_bytes) const;
+
+  // Operators report the number of bytes they wrote to disk because their data did not fit into the budget
+  void add_spilled_bytes(const size_t bytes);
+  size_t spilled_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  BudgetedMemoryResource(const size_t budget_bytes, const std::shared_ptr<BudgetedMemoryResource>& parent);
+  ~BudgetedMemoryResource() override = default;
+
+  // Updates the counters of this resource and its ancestors
+  void _add_allocated_bytes(const size_t bytes);
+  void _subtract_allocated_bytes(const size_t bytes);
+
+  // Drops one reference (an allocation or the owners) and deletes the resource if it was the last one
+  void _release_reference();
+
+  const size_t _budget;
+  const std::shared_ptr<BudgetedMemoryResource> _parent;
+  boost::container::pmr::memory_resource* const _upstream;
+
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _peak_allocated_bytes{0};
+  std::atomic<size_t> _spilled_bytes{0};
+
+  // One reference per live allocation plus one for the shared_ptrs returned by create()
+  std::atomic<size_t> _reference_count{1};
+};
+
+/**
+ * Makes @param resource the default memory resource of the current thread until the scope is left. Scopes can be
+ * nested. Passing nullptr restores the global default memory resource within the scope.
+ */
+class MemoryResourceScope : private Noncopyable {
+ public:
+  explicit MemoryResourceScope(const std::shared_ptr<BudgetedMemoryResource>& resource);
+  ~MemoryResourceScope();
+
+ private:
+  const std::shared_ptr<BudgetedMemoryResource> _resource;
+  BudgetedMemoryResource* const _previous_resource;
+};
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "spill_file.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile() {
+  auto path = (std::filesystem::temp_directory_path() / "hyrise_spill_XXXXXX").string();
+  _file_descriptor = mkstemp(path.data());
+  Assert(_file_descriptor >= 0, "Could not create spill file " + path + ": " + std::strerror(errno));
+
+  // The file stays accessible through the file descriptor until it is closed
+  ::unlink(path.c_str());
+
+  _write_buffer.reserve(WRITE_BUFFER_SIZE);
+}
+
+SpillFile::~SpillFile() { ::close(_file_descriptor); }
+
+size_t SpillFile::append(const void* data, const size_t size) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto offset = _size;
+  _size += size;
+
+  if (_write_buffer.size() + size > WRITE_BUFFER_SIZE) _flush();
+
+  const auto* const bytes = static_cast<const char*>(data);
+  if (size >= WRITE_BUFFER_SIZE) {
+    // Large blocks are written directly instead of being copied into the write buffer first
+    _write(bytes, size);
+    _flushed_size += size;
+  } else {
+    _write_buffer.insert(_write_buffer.end(), bytes, bytes + size);
+  }
+
+  return offset;
+}
+
+void SpillFile::read(const size_t offset, const size_t size, void* destination) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(offset + size <= _size, "Cannot read beyond the end of the spill file");
+    if (offset + size > _flushed_size) _flush();
+  }
+
+  auto* bytes = static_cast<char*>(destination);
+  auto position = static_cast<off_t>(offset);
+  auto remaining_size = size;
+  while (remaining_size > 0) {
+    const auto read_size = ::pread(_file_descriptor, bytes, remaining_size, position);
+    if (read_size < 0 && errno == EINTR) continue;
+    Assert(read_size > 0, std::string{"Could not read from spill file: "} + std::strerror(errno));
+
+    bytes += read_size;
+    position += read_size;
+    remaining_size -= static_cast<size_t>(read_size);
+  }
+}
+
+size_t SpillFile::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _size;
+}
+
+void SpillFile::_flush() {
+  _write(_write_buffer.data(), _write_buffer.size());
+  _flushed_size += _write_buffer.size();
+  _write_buffer.clear();
+}
+
+void SpillFile::_write(const char* data, size_t size) {
+  while (size > 0) {
+    const auto written_size = ::write(_file_descriptor, data, size);
+    if (written_size < 0 && errno == EINTR) continue;
+    Assert(written_size > 0, std::string{"Could not write to spill file: "} + std::strerror(errno));
+
+    data += written_size;
+    size -= static_cast<size_t>(written_size);
+  }
+}
+
+}  // namespace opossum
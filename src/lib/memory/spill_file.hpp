@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file to which operators write intermediate data that does not fit into their memory budget (see
+ * BudgetedMemoryResource). Appended data is collected in a write buffer and written in large sequential blocks. Reading
+ * uses pread and can be done concurrently.
+ *
+ * The file is created in the system's temporary directory (i.e., $TMPDIR or /tmp) and unlinked right away, so that it
+ * does not outlive the process even if the process crashes. It is deleted when the SpillFile is destroyed.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  // Appends @param size bytes and returns the offset at which they are stored. Can be called concurrently.
+  size_t append(const void* data, const size_t size);
+
+  template <typename Container>
+  size_t append(const Container& values) {
+    static_assert(std::is_trivially_copyable_v<typename Container::value_type>,
+                  "Only trivially copyable values can be spilled");
+    return append(values.data(), values.size() * sizeof(typename Container::value_type));
+  }
+
+  // Reads @param size bytes starting at @param offset into @param destination
+  void read(const size_t offset, const size_t size, void* destination);
+
+  // Number of bytes appended so far
+  size_t size() const;
+
+ private:
+  // Writes the write buffer to the file. _mutex has to be held.
+  void _flush();
+
+  void _write(const char* data, size_t size);
+
+  static constexpr auto WRITE_BUFFER_SIZE = size_t{1} << 20;
+
+  int _file_descriptor;
+
+  mutable std::mutex _mutex;
+  std::vector<char> _write_buffer;
+  size_t _size{0};
+  size_t _flushed_size{0};
+};
+
+}  // namespace opossum
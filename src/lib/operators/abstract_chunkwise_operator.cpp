@@ -0,0 +1,146 @@
+#include "abstract_chunkwise_operator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> AbstractChunkwiseOperator::make_pipeline_output_table() {
+  const auto in_table = _pipeline_stages().front()->left_input_table();
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References,
+                                 std::vector<std::shared_ptr<Chunk>>(in_table->chunk_count()));
+}
+
+void AbstractChunkwiseOperator::execute_as_pipeline(const std::shared_ptr<Table>& pipeline_output_table,
+                                                    const std::function<void(const ChunkID chunk_id)>& consume_chunk) {
+  DebugAssert(is_pipelined, "Operator is not pipelined into its consumer");
+  DebugAssert(!performance_data->executed, "Pipelined operator has already been executed");
+
+  _execute_stages(_pipeline_stages(), [&](const ChunkID chunk_id, std::shared_ptr<Chunk> chunk) {
+    pipeline_output_table->set_chunk(chunk_id, std::move(chunk));
+    consume_chunk(chunk_id);
+    pipeline_output_table->set_chunk(chunk_id, nullptr);
+  });
+}
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_on_execute() {
+  const auto stages = _pipeline_stages();
+  const auto in_table = stages.front()->left_input_table();
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(in_table->chunk_count());
+  _execute_stages(stages, [&](const ChunkID chunk_id, std::shared_ptr<Chunk> chunk) {
+    output_chunks[chunk_id] = std::move(chunk);
+  });
+
+  output_chunks.erase(std::remove(output_chunks.begin(), output_chunks.end(), nullptr), output_chunks.end());
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+std::vector<AbstractChunkwiseOperator*> AbstractChunkwiseOperator::_pipeline_stages() {
+  auto stages = std::vector<AbstractChunkwiseOperator*>{this};
+  while (true) {
+    auto* const input = dynamic_cast<AbstractChunkwiseOperator*>(stages.back()->mutable_left_input().get());
+    if (!input || !input->is_pipelined) break;
+    DebugAssert(!input->performance_data->executed, "Pipelined operator has already been executed");
+    stages.emplace_back(input);
+  }
+  std::reverse(stages.begin(), stages.end());
+  return stages;
+}
+
+void AbstractChunkwiseOperator::_execute_stages(
+    const std::vector<AbstractChunkwiseOperator*>& stages,
+    const std::function<void(const ChunkID, std::shared_ptr<Chunk>)>& sink) {
+  const auto stage_count = stages.size();
+
+  const auto in_table = stages.front()->left_input_table();
+  const auto chunk_count = in_table->chunk_count();
+
+  // All stages but the first read their input from a table whose chunk slots are set by the job that processes the
+  // respective chunk. As reference segments never reference other reference segments, the output chunks of the stages
+  // do not reference these tables, and their chunks can be released as soon as the next stage is done.
+  auto stage_input_tables = std::vector<std::shared_ptr<Table>>(stage_count);
+  for (auto stage_id = size_t{0}; stage_id < stage_count; ++stage_id) {
+    if (stage_id > 0) {
+      stage_input_tables[stage_id] = std::make_shared<Table>(
+          in_table->column_definitions(), TableType::References, std::vector<std::shared_ptr<Chunk>>(chunk_count));
+    }
+    stages[stage_id]->_on_prepare_chunks(stage_id == 0 ? in_table : stage_input_tables[stage_id]);
+  }
+
+  auto stage_output_row_counts = std::vector<std::atomic<uint64_t>>(stage_count);
+  auto stage_output_chunk_counts = std::vector<std::atomic<uint32_t>>(stage_count);
+
+  const auto process_chunks = [&](const ChunkID chunk_id_start, const ChunkID chunk_id_end) {
+    for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end; ++chunk_id) {
+      auto chunk = stages[0]->_on_process_chunk(in_table, chunk_id);
+
+      for (auto stage_id = size_t{0}; chunk; ++stage_id) {
+        stage_output_row_counts[stage_id] += chunk->size();
+        ++stage_output_chunk_counts[stage_id];
+        if (stage_id + 1 == stage_count) break;
+
+        const auto& next_input_table = stage_input_tables[stage_id + 1];
+        next_input_table->set_chunk(chunk_id, std::move(chunk));
+        chunk = stages[stage_id + 1]->_on_process_chunk(next_input_table, chunk_id);
+        next_input_table->set_chunk(chunk_id, nullptr);
+      }
+
+      if (chunk) sink(chunk_id, std::move(chunk));
+    }
+  };
+
+  // Small chunks are bundled together to avoid unnecessary scheduling overhead. Therefore, we count the number of rows
+  // to ensure a minimum of rows per job (default chunk size).
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto job_start_chunk_id = ChunkID{0};
+  auto job_row_count = uint64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = in_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    job_row_count += chunk->size();
+    if (job_row_count < Chunk::DEFAULT_SIZE && chunk_id + 1 < chunk_count) continue;
+
+    if (job_start_chunk_id == 0 && chunk_id + 1 == chunk_count) {
+      // Single jobs are executed directly instead of being scheduled
+      process_chunks(job_start_chunk_id, chunk_id);
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_start_chunk_id, chunk_id]() {
+        process_chunks(job_start_chunk_id, chunk_id);
+      }));
+    }
+
+    job_start_chunk_id = chunk_id + 1;
+    job_row_count = 0;
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // The pipelined stages are done. Their walltime is part of the walltime of the pipeline's sink.
+  for (auto stage_id = size_t{0}; stage_id < stage_count; ++stage_id) {
+    auto& stage = *stages[stage_id];
+    stage._on_finish_chunks();
+    if (!stage.is_pipelined) break;
+
+    stage._on_cleanup();
+    stage.performance_data->has_output = true;
+    stage.performance_data->output_row_count = stage_output_row_counts[stage_id];
+    stage.performance_data->output_chunk_count = stage_output_chunk_counts[stage_id];
+    stage.performance_data->executed = true;
+  }
+}
+
+void AbstractChunkwiseOperator::_on_finish_chunks() {}
+
+}  // namespace opossum
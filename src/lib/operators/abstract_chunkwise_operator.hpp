@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * AbstractChunkwiseOperator is the superclass for operators whose output chunks each depend on a single input chunk
+ * and that keep the columns of their input, i.e., TableScan and Validate. Their output is a reference table.
+ *
+ * Chains of these operators can be executed as a pipeline: Each chunk (morsel) of the input of the first operator
+ * passes through all operators of the chain in the same job, and only the output of the last operator (the sink) is
+ * materialized. Compared to executing the operators one after another, the intermediate reference tables are never
+ * built and the chunks are processed while their position lists are still in the cache. Pipelines end at operators
+ * that are not chunkwise (e.g., joins or aggregates) and at operators with more than one consumer. A Projection can
+ * be the sink of a pipeline as well: It evaluates its expressions on each chunk in the job that produced the chunk (see
+ * execute_as_pipeline). OperatorTask::make_tasks_from_operator sets up the pipelines if Hyrise::get().enable_pipelining
+ * is set.
+ *
+ * Subclasses implement the processing of a single chunk, which is used by both the pipelined and the regular
+ * execution.
+ */
+class AbstractChunkwiseOperator : public AbstractReadOnlyOperator {
+ public:
+  using AbstractReadOnlyOperator::AbstractReadOnlyOperator;
+
+  // If set, this operator is not executed on its own but as a stage of the pipeline of its only consumer, which is a
+  // chunkwise operator as well. Its output is never materialized.
+  bool is_pipelined{false};
+
+  // For sinks of pipelines that are not chunkwise themselves (i.e., Projection): Returns an empty reference table with
+  // the columns of this operator's output and one chunk slot per chunk of the pipeline's input. Pass it to
+  // execute_as_pipeline().
+  std::shared_ptr<Table> make_pipeline_output_table();
+
+  // Executes this operator, which has to be pipelined into its consumer, together with the operators pipelined into it.
+  // For every chunk that passes all stages, @param consume_chunk is called with the ID of the chunk in the pipeline's
+  // input, in the job that processed the chunk. During this call, the chunk is set in @param pipeline_output_table.
+  void execute_as_pipeline(const std::shared_ptr<Table>& pipeline_output_table,
+                           const std::function<void(const ChunkID chunk_id)>& consume_chunk);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Called once before the chunks of @param input_table are processed. If this operator is not the first stage of a
+  // pipeline, the input table only holds the chunks that are currently being processed.
+  virtual void _on_prepare_chunks(const std::shared_ptr<const Table>& input_table) = 0;
+
+  // Returns the output chunk for the chunk @param chunk_id of @param input_table, or nullptr if no row of that chunk
+  // qualifies. Called concurrently for different chunks.
+  virtual std::shared_ptr<Chunk> _on_process_chunk(const std::shared_ptr<const Table>& input_table,
+                                                   const ChunkID chunk_id) = 0;
+
+  // Called once after all chunks have been processed, e.g., to fill the performance data
+  virtual void _on_finish_chunks();
+
+ private:
+  // Returns the operators that are pipelined into this operator and this operator, starting with the first stage
+  std::vector<AbstractChunkwiseOperator*> _pipeline_stages();
+
+  // Runs every chunk of the first stage's input through all @param stages and hands the output chunks of the last
+  // stage to @param sink, in the job that processed the chunk. Marks the pipelined stages as executed.
+  static void _execute_stages(const std::vector<AbstractChunkwiseOperator*>& stages,
+                              const std::function<void(const ChunkID, std::shared_ptr<Chunk>)>& sink);
+};
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "abstract_chunkwise_operator.hpp"
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/abstract_non_query_node.hpp"
@@ -21,6 +22,16 @@
 
 namespace opossum {
 
+namespace {
+
+// Operators that are pipelined into their consumer are executed as part of it and do not have an output
+bool input_is_available(const AbstractOperator& input) {
+  const auto* const chunkwise_input = dynamic_cast<const AbstractChunkwiseOperator*>(&input);
+  return input.get_output() || (chunkwise_input && chunkwise_input->is_pipelined);
+}
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
                                    const std::shared_ptr<const AbstractOperator>& right,
                                    std::unique_ptr<AbstractOperatorPerformanceData> init_performance_data)
@@ -30,7 +41,7 @@ OperatorType AbstractOperator::type() const { return _type; }
 
 void AbstractOperator::execute() {
   DTRACE_PROBE1(HYRISE, OPERATOR_STARTED, name().c_str());
-  DebugAssert(!_left_input || _left_input->get_output(), "Left input has not yet been executed");
+  DebugAssert(!_left_input || input_is_available(*_left_input), "Left input has not yet been executed");
   DebugAssert(!_right_input || _right_input->get_output(), "Right input has not yet been executed");
   DebugAssert(!performance_data->executed, "Operator has already been executed");
 
@@ -51,6 +51,14 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(WriteAheadLog::RecordWriter& record_writer) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Only committed operators can be logged.");
+
+  _on_log_records(record_writer);
+}
+
+void AbstractReadWriteOperator::_on_log_records(WriteAheadLog::RecordWriter& record_writer) const {}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Conflicted || _state == ReadWriteOperatorState::RolledBack;
 }
@@ -7,6 +7,7 @@
 #include "abstract_operator.hpp"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
@@ -48,6 +49,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds redo records for the committed modifications to the write-ahead log entry of the transaction.
+   */
+  void log_records(WriteAheadLog::RecordWriter& record_writer) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -80,6 +86,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that do not modify tables themselves (e.g., Update, which uses Insert and Delete)
+   * do not need to log anything.
+   */
+  virtual void _on_log_records(WriteAheadLog::RecordWriter& record_writer) const;
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -1,9 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -14,6 +17,9 @@
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "memory/spill_file.hpp"
+#include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -74,6 +80,142 @@ const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<Aggreg
   }
 }
 
+// Estimated size of the aggregate results per group and per GROUP BY column or aggregate. As the number of groups is
+// not known before aggregating, the estimate assumes that every input row forms its own group.
+constexpr auto ESTIMATED_BYTES_PER_GROUP_VALUE = size_t{32};
+
+// Upper bound for the number of partitions into which the partial aggregates are split when spilling
+constexpr auto MAX_SPILL_PARTITION_COUNT = size_t{1024};
+
+// Location of a column of partial aggregates that has been written to a SpillFile. Strings are stored as their lengths
+// followed by their concatenated characters.
+struct SpilledColumn {
+  size_t values_offset{0};
+  std::optional<size_t> string_lengths_offset;
+  std::optional<size_t> null_values_offset;
+};
+
+// The partial aggregates of one batch of input chunks that belong to the same partition
+struct SpilledBlock {
+  size_t row_count{0};
+  std::vector<SpilledColumn> columns;
+};
+
+template <typename T>
+SpilledColumn spill_values(const ValueSegment<T>& segment, const std::vector<ChunkOffset>& chunk_offsets,
+                           SpillFile& spill_file) {
+  auto spilled_column = SpilledColumn{};
+  const auto& values = segment.values();
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto string_lengths = std::vector<uint32_t>{};
+    string_lengths.reserve(chunk_offsets.size());
+    auto characters = std::string{};
+    for (const auto chunk_offset : chunk_offsets) {
+      string_lengths.emplace_back(static_cast<uint32_t>(values[chunk_offset].size()));
+      characters.append(values[chunk_offset]);
+    }
+    spilled_column.string_lengths_offset = spill_file.append(string_lengths);
+    spilled_column.values_offset = spill_file.append(characters);
+  } else {
+    auto selected_values = std::vector<T>{};
+    selected_values.reserve(chunk_offsets.size());
+    for (const auto chunk_offset : chunk_offsets) {
+      selected_values.emplace_back(values[chunk_offset]);
+    }
+    spilled_column.values_offset = spill_file.append(selected_values);
+  }
+
+  if (segment.is_nullable()) {
+    const auto& null_values = segment.null_values();
+    auto selected_null_values = std::vector<char>{};
+    selected_null_values.reserve(chunk_offsets.size());
+    for (const auto chunk_offset : chunk_offsets) {
+      selected_null_values.emplace_back(null_values[chunk_offset]);
+    }
+    spilled_column.null_values_offset = spill_file.append(selected_null_values);
+  }
+
+  return spilled_column;
+}
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> load_values(const SpilledColumn& spilled_column, const size_t row_count,
+                                             const bool nullable, SpillFile& spill_file) {
+  auto values = pmr_vector<T>(row_count);
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto string_lengths = std::vector<uint32_t>(row_count);
+    spill_file.read(*spilled_column.string_lengths_offset, row_count * sizeof(uint32_t), string_lengths.data());
+    auto characters = std::string(std::accumulate(string_lengths.begin(), string_lengths.end(), size_t{0}), '\0');
+    spill_file.read(spilled_column.values_offset, characters.size(), characters.data());
+
+    auto character_offset = size_t{0};
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      values[row_idx] = pmr_string{characters.data() + character_offset, string_lengths[row_idx]};
+      character_offset += string_lengths[row_idx];
+    }
+  } else {
+    spill_file.read(spilled_column.values_offset, row_count * sizeof(T), values.data());
+  }
+
+  if (!nullable) return std::make_shared<ValueSegment<T>>(std::move(values));
+
+  auto null_values = std::vector<char>(row_count);
+  spill_file.read(*spilled_column.null_values_offset, row_count, null_values.data());
+  return std::make_shared<ValueSegment<T>>(std::move(values), pmr_vector<bool>{null_values.begin(), null_values.end()});
+}
+
+// Computes the averages of the combined partial aggregates of AVG. The average of a group without any non-NULL value
+// (i.e., with a count of zero) is NULL.
+std::shared_ptr<AbstractSegment> divide_sums_by_counts(const DataType sum_data_type, const AbstractSegment& sums,
+                                                       const ValueSegment<int64_t>& counts) {
+  const auto row_count = counts.size();
+  auto averages = pmr_vector<double>(row_count);
+  auto null_values = pmr_vector<bool>(row_count);
+
+  resolve_data_type(sum_data_type, [&](auto type) {
+    using SumDataType = typename decltype(type)::type;
+    if constexpr (std::is_arithmetic_v<SumDataType>) {
+      const auto& sum_values = static_cast<const ValueSegment<SumDataType>&>(sums).values();
+      const auto& count_values = counts.values();
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        if (count_values[row_idx] == 0) {
+          null_values[row_idx] = true;
+        } else {
+          averages[row_idx] = static_cast<double>(sum_values[row_idx]) / static_cast<double>(count_values[row_idx]);
+        }
+      }
+    } else {
+      Fail("Expected a numeric sum");
+    }
+  });
+
+  return std::make_shared<ValueSegment<double>>(std::move(averages), std::move(null_values));
+}
+
+// Combines the hashes of the GROUP BY values of each row of chunk into hashes. This is used to partition the partial
+// aggregates before they are spilled, so that all partial aggregates of a group end up in the same partition.
+void hash_groupby_values(const Table& table, const Chunk& chunk, const std::vector<ColumnID>& groupby_column_ids,
+                         std::vector<size_t>& hashes) {
+  for (const auto column_id : groupby_column_ids) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(*chunk.get_segment(column_id), [&](const auto& position) {
+        auto value_hash = size_t{0};
+        if (!position.is_null()) {
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            value_hash = std::hash<std::string_view>{}(std::string_view{position.value().data(),
+                                                                        position.value().size()});
+          } else {
+            value_hash = std::hash<ColumnDataType>{}(position.value());
+          }
+        }
+        boost::hash_combine(hashes[position.chunk_offset()], value_hash);
+      });
+    });
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -132,6 +274,216 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
   std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
 };
 
+/*
+Data structures of the parallel aggregation (see _aggregate_in_parallel). Other than the AggregateContext, which maps
+AggregateKeys to results itself, the PartialAggregateResults only hold the results of one aggregate function for the
+groups of a thread-local table or a radix partition. The group ids are assigned by the caller, so that the same ids
+can be used for all aggregate functions and the AggregateKey type does not need to be known here.
+*/
+class BasePartialAggregateResults {
+ public:
+  virtual ~BasePartialAggregateResults() = default;
+
+  virtual std::unique_ptr<BasePartialAggregateResults> create_empty() const = 0;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  virtual void clear() = 0;
+
+  // Aggregates the values of segment, where the value at chunk offset i belongs to the group group_ids[i]. If segment
+  // is nullptr (COUNT(*)), the rows are counted.
+  virtual void aggregate(const AbstractSegment* segment, const std::vector<AggregateResultId>& group_ids) = 0;
+
+  // Moves the results of the groups source_ids of source to the end of this object
+  virtual void append(BasePartialAggregateResults& source, const std::vector<AggregateResultId>& source_ids) = 0;
+
+  // Combines the result of group i of source with the result of group target_ids[i] of this object
+  virtual void merge(BasePartialAggregateResults& source, const std::vector<AggregateResultId>& target_ids) = 0;
+
+  // Moves all results to the end of the results of context, which has to be of the matching AggregateResultContext
+  // type, and assigns row_ids[i] to result i
+  virtual void move_to(SegmentVisitorContext& context, const std::vector<RowID>& row_ids) = 0;
+};
+
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+class PartialAggregateResults : public BasePartialAggregateResults {
+ public:
+  using Result = AggregateResult<ColumnDataType, aggregate_function>;
+
+  std::unique_ptr<BasePartialAggregateResults> create_empty() const final {
+    return std::make_unique<PartialAggregateResults>();
+  }
+
+  void resize(const size_t group_count) final { _results.resize(group_count); }
+
+  void clear() final { _results.clear(); }
+
+  __attribute__((hot)) void aggregate(const AbstractSegment* segment,
+                                      const std::vector<AggregateResultId>& group_ids) final {
+    if constexpr (aggregate_function == AggregateFunction::Count) {
+      if (!segment) {
+        for (const auto group_id : group_ids) {
+          ++_results[group_id].aggregate_count;
+        }
+        return;
+      }
+    }
+
+    using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
+    auto aggregator =
+        AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
+
+    const auto row_count = group_ids.size();
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      // Rows that were appended to a mutable chunk after the keys were computed are ignored
+      if (chunk_offset < row_count && !position.is_null()) {
+        auto& result = _results[group_ids[chunk_offset]];
+        if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+          result.accumulator.emplace(position.value());
+        } else {
+          aggregator(position.value(), result.aggregate_count, result.accumulator);
+        }
+
+        ++result.aggregate_count;
+      }
+
+      ++chunk_offset;
+    });
+  }
+
+  void append(BasePartialAggregateResults& source, const std::vector<AggregateResultId>& source_ids) final {
+    auto& source_results = static_cast<PartialAggregateResults&>(source)._results;
+    _results.reserve(_results.size() + source_ids.size());
+    for (const auto source_id : source_ids) {
+      _results.emplace_back(std::move(source_results[source_id]));
+    }
+  }
+
+  void merge(BasePartialAggregateResults& source, const std::vector<AggregateResultId>& target_ids) final {
+    auto& source_results = static_cast<PartialAggregateResults&>(source)._results;
+    const auto source_result_count = source_results.size();
+    for (auto source_id = AggregateResultId{0}; source_id < source_result_count; ++source_id) {
+      _combine(_results[target_ids[source_id]], source_results[source_id]);
+    }
+  }
+
+  void move_to(SegmentVisitorContext& context, const std::vector<RowID>& row_ids) final {
+    auto& results = static_cast<AggregateResultContext<ColumnDataType, aggregate_function>&>(context).results;
+    const auto result_count = _results.size();
+    results.reserve(results.size() + result_count);
+    for (auto result_id = AggregateResultId{0}; result_id < result_count; ++result_id) {
+      auto& result = results.emplace_back(std::move(_results[result_id]));
+      result.row_id = row_ids[result_id];
+    }
+    _results.clear();
+  }
+
+ private:
+  // Combines two partial aggregates of the same group, both of which were computed with the AggregateFunctionBuilder
+  static void _combine(Result& target, Result& source) {
+    if (source.aggregate_count == 0) return;
+
+    if (target.aggregate_count == 0) {
+      target = std::move(source);
+      return;
+    }
+
+    if constexpr (aggregate_function == AggregateFunction::Min) {
+      if (value_smaller(source.accumulator, target.accumulator)) target.accumulator = std::move(source.accumulator);
+    } else if constexpr (aggregate_function == AggregateFunction::Max) {
+      if (value_greater(source.accumulator, target.accumulator)) target.accumulator = std::move(source.accumulator);
+    } else if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+      // AVG keeps the sum in its accumulator and divides it by aggregate_count when the output is written
+      target.accumulator += source.accumulator;
+    } else if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+      target.accumulator.insert(source.accumulator.begin(), source.accumulator.end());
+    } else if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
+      // Combines the count, mean, and squared distance from the mean of two partitions of the values as described in
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      auto& count = target.accumulator[0];
+      auto& mean = target.accumulator[1];
+      auto& squared_distance_from_mean = target.accumulator[2];
+      auto& result = target.accumulator[3];
+
+      const auto source_count = source.accumulator[0];
+      const auto combined_count = count + source_count;
+      const auto delta = source.accumulator[1] - mean;
+      mean += delta * source_count / combined_count;
+      squared_distance_from_mean += source.accumulator[2] + delta * delta * count * source_count / combined_count;
+      count = combined_count;
+
+      if (count > 1) {
+        result = std::sqrt(squared_distance_from_mean / (count - 1));
+      }
+    }
+    // COUNT only uses aggregate_count, ANY has no partial results.
+
+    target.aggregate_count += source.aggregate_count;
+  }
+
+  std::vector<Result> _results;
+};
+
+// Groups of a thread-local pre-aggregation table or of one of its radix partitions
+template <typename AggregateKey>
+struct PartialAggregates {
+  std::vector<AggregateKey> keys;
+  std::vector<RowID> row_ids;
+  // One entry per aggregate, nullptr for ANY
+  std::vector<std::unique_ptr<BasePartialAggregateResults>> results_per_aggregate;
+
+  explicit PartialAggregates(const std::vector<std::unique_ptr<BasePartialAggregateResults>>& prototypes) {
+    results_per_aggregate.reserve(prototypes.size());
+    for (const auto& prototype : prototypes) {
+      results_per_aggregate.emplace_back(prototype ? prototype->create_empty() : nullptr);
+    }
+  }
+
+  size_t size() const { return keys.size(); }
+};
+
+namespace {
+
+std::unique_ptr<BasePartialAggregateResults> create_partial_aggregate_results(
+    const DataType data_type, const AggregateFunction aggregate_function) {
+  auto partial_results = std::unique_ptr<BasePartialAggregateResults>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    switch (aggregate_function) {
+      case AggregateFunction::Min:
+        partial_results = std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::Min>>();
+        break;
+      case AggregateFunction::Max:
+        partial_results = std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::Max>>();
+        break;
+      case AggregateFunction::Sum:
+        partial_results = std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::Sum>>();
+        break;
+      case AggregateFunction::Avg:
+        partial_results = std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::Avg>>();
+        break;
+      case AggregateFunction::Count:
+        partial_results = std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::Count>>();
+        break;
+      case AggregateFunction::CountDistinct:
+        partial_results =
+            std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::CountDistinct>>();
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        partial_results =
+            std::make_unique<PartialAggregateResults<ColumnDataType, AggregateFunction::StandardDeviationSample>>();
+        break;
+      case AggregateFunction::Any:
+        // ANY is a pseudo-function and is handled by _write_groupby_output
+        break;
+    }
+  });
+  return partial_results;
+}
+
+}  // namespace
+
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
 __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
                                                             const AbstractSegment& abstract_segment,
@@ -459,6 +811,12 @@ void AggregateHash::_aggregate() {
 
   // Process Chunks and perform aggregations
   const auto chunk_count = input_table->chunk_count();
+  if (Hyrise::get().is_multi_threaded() && chunk_count > 1) {
+    _aggregate_in_parallel<AggregateKey>(keys_per_chunk);
+    step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+    return;
+  }
+
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     if (!chunk_in) continue;
@@ -584,7 +942,250 @@ void AggregateHash::_aggregate() {
   step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
 }  // NOLINT(readability/fn_size)
 
+/**
+ * Parallel version of the aggregation step, used if a multi-threaded scheduler is active. It works in two phases:
+ *
+ * (1) Each task pre-aggregates a contiguous range of chunks into a thread-local table. Its size is bounded by
+ *     THREAD_LOCAL_GROUP_CAPACITY so that it stays cache-resident. If the table overflows (and at the end), its groups
+ *     are spilled into thread-local radix partitions, based on the hash of their AggregateKeys. For few groups (e.g.,
+ *     TPC-H Q1), each task spills only once.
+ * (2) Each task merges one radix partition of all phase (1) tasks. As the partitions are disjoint, no synchronization
+ *     is needed. Finally, the partitions are concatenated into the AggregateContexts, so that the output is written
+ *     in the same way as for the single-threaded aggregation.
+ */
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  constexpr auto THREAD_LOCAL_GROUP_CAPACITY = size_t{16'384};
+  constexpr auto RADIX_BITS = std::is_same_v<AggregateKey, EmptyAggregateKey> ? size_t{0} : size_t{6};
+  constexpr auto PARTITION_COUNT = size_t{1} << RADIX_BITS;
+
+  const auto& input_table = left_input_table();
+  const auto chunk_count = static_cast<size_t>(input_table->chunk_count());
+  const auto worker_count = std::max(Hyrise::get().scheduler()->workers().size(), size_t{1});
+  const auto task_count = std::min(chunk_count, worker_count);
+
+  // The input column of each aggregate and an empty instance of its partial results, nullptr for ANY. For COUNT(*),
+  // the input column is INVALID_COLUMN_ID.
+  auto input_column_ids = std::vector<ColumnID>{};
+  auto prototypes = std::vector<std::unique_ptr<BasePartialAggregateResults>>{};
+  if (_has_aggregate_functions) {
+    for (const auto& aggregate : _aggregates) {
+      const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+      input_column_ids.emplace_back(input_column_id);
+      if (input_column_id == INVALID_COLUMN_ID) {
+        prototypes.emplace_back(std::make_unique<PartialAggregateResults<CountColumnType, AggregateFunction::Count>>());
+      } else {
+        prototypes.emplace_back(create_partial_aggregate_results(input_table->column_data_type(input_column_id),
+                                                                 aggregate->aggregate_function));
+      }
+    }
+  }
+  const auto aggregate_count = prototypes.size();
+
+  const auto partition_of = [](const AggregateKey& key) {
+    if constexpr (RADIX_BITS == 0) {
+      return size_t{0};
+    } else {
+      // Fibonacci hashing spreads keys whose hashes only differ in the lower bits (e.g., dictionary-encoded values)
+      return static_cast<size_t>((std::hash<AggregateKey>{}(key) * 0x9E3779B97F4A7C15ull) >> (64 - RADIX_BITS));
+    }
+  };
+
+  /**
+   * PHASE 1: Thread-local pre-aggregation
+   */
+  auto partitions_per_task = std::vector<std::vector<PartialAggregates<AggregateKey>>>(task_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, task_id]() {
+      auto& partitions = partitions_per_task[task_id];
+      partitions.reserve(PARTITION_COUNT);
+      for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+        partitions.emplace_back(prototypes);
+      }
+
+      auto local_groups = PartialAggregates<AggregateKey>{prototypes};
+      auto local_group_ids = AggregateResultIdMap<AggregateKey>{};
+      local_group_ids.reserve(THREAD_LOCAL_GROUP_CAPACITY);
+
+      auto group_ids_by_partition = std::vector<std::vector<AggregateResultId>>(PARTITION_COUNT);
+      const auto spill_to_partitions = [&]() {
+        for (auto& group_ids : group_ids_by_partition) {
+          group_ids.clear();
+        }
+        for (auto group_id = AggregateResultId{0}; group_id < local_groups.size(); ++group_id) {
+          const auto partition_id = partition_of(local_groups.keys[group_id]);
+          group_ids_by_partition[partition_id].emplace_back(group_id);
+
+          auto& partition = partitions[partition_id];
+          partition.keys.emplace_back(std::move(local_groups.keys[group_id]));
+          partition.row_ids.emplace_back(local_groups.row_ids[group_id]);
+        }
+
+        for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+          auto& local_results = local_groups.results_per_aggregate[aggregate_idx];
+          if (!local_results) continue;
+
+          for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+            partitions[partition_id].results_per_aggregate[aggregate_idx]->append(
+                *local_results, group_ids_by_partition[partition_id]);
+          }
+          local_results->clear();
+        }
+
+        local_groups.keys.clear();
+        local_groups.row_ids.clear();
+        local_group_ids.clear();
+      };
+
+      const auto chunk_id_begin = ChunkID{static_cast<ChunkID::base_type>(chunk_count * task_id / task_count)};
+      const auto chunk_id_end = ChunkID{static_cast<ChunkID::base_type>(chunk_count * (task_id + 1) / task_count)};
+      auto group_ids = std::vector<AggregateResultId>{};
+      for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+        const auto chunk_in = input_table->get_chunk(chunk_id);
+        if (!chunk_in) continue;
+
+        // The keys determine the number of rows, as rows might have been appended to a mutable chunk since
+        auto input_chunk_size = static_cast<size_t>(chunk_in->size());
+        if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          input_chunk_size = keys_per_chunk[chunk_id].size();
+        }
+
+        // Map the rows to their thread-local groups
+        group_ids.resize(input_chunk_size);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+          const auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset);
+          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+            if (local_groups.keys.empty()) {
+              local_groups.keys.emplace_back(key);
+              local_groups.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+            }
+            group_ids[chunk_offset] = 0;
+          } else {
+            const auto [it, inserted] = local_group_ids.try_emplace(key, local_groups.size());
+            if (inserted) {
+              local_groups.keys.emplace_back(key);
+              local_groups.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+            }
+            group_ids[chunk_offset] = it->second;
+          }
+        }
+
+        for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+          auto& local_results = local_groups.results_per_aggregate[aggregate_idx];
+          if (!local_results) continue;
+
+          local_results->resize(local_groups.size());
+          const auto input_column_id = input_column_ids[aggregate_idx];
+          const auto segment =
+              input_column_id == INVALID_COLUMN_ID ? nullptr : chunk_in->get_segment(input_column_id).get();
+          local_results->aggregate(segment, group_ids);
+        }
+
+        if (local_groups.size() >= THREAD_LOCAL_GROUP_CAPACITY) spill_to_partitions();
+      }
+      spill_to_partitions();
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * PHASE 2: Merge the radix partitions
+   */
+  auto merged_partitions = std::vector<PartialAggregates<AggregateKey>>{};
+  merged_partitions.reserve(PARTITION_COUNT);
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    merged_partitions.emplace_back(prototypes);
+  }
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& merged_partition = merged_partitions[partition_id];
+      auto merged_group_ids = AggregateResultIdMap<AggregateKey>{};
+      auto target_ids = std::vector<AggregateResultId>{};
+
+      for (auto& partitions : partitions_per_task) {
+        auto& partition = partitions[partition_id];
+        const auto group_count = partition.size();
+
+        target_ids.resize(group_count);
+        for (auto group_id = AggregateResultId{0}; group_id < group_count; ++group_id) {
+          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+            if (merged_partition.keys.empty()) {
+              merged_partition.keys.emplace_back();
+              merged_partition.row_ids.emplace_back(partition.row_ids[group_id]);
+            }
+            target_ids[group_id] = 0;
+          } else {
+            const auto [it, inserted] =
+                merged_group_ids.try_emplace(partition.keys[group_id], merged_partition.size());
+            if (inserted) {
+              merged_partition.keys.emplace_back(std::move(partition.keys[group_id]));
+              merged_partition.row_ids.emplace_back(partition.row_ids[group_id]);
+            }
+            target_ids[group_id] = it->second;
+          }
+        }
+
+        for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+          auto& merged_results = merged_partition.results_per_aggregate[aggregate_idx];
+          if (!merged_results) continue;
+
+          merged_results->resize(merged_partition.size());
+          merged_results->merge(*partition.results_per_aggregate[aggregate_idx], target_ids);
+        }
+
+        // Release the memory of the partition, it is not needed anymore
+        partition.keys = std::vector<AggregateKey>{};
+        partition.row_ids = std::vector<RowID>{};
+        partition.results_per_aggregate.clear();
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * Concatenate the partitions into the AggregateContexts
+   */
+  if (!_has_aggregate_functions) {
+    // See the DISTINCT implementation in _aggregate
+    auto& results =
+        static_cast<AggregateResultContext<DistinctColumnType, AggregateFunction::Min>&>(*_contexts_per_column[0])
+            .results;
+    for (const auto& merged_partition : merged_partitions) {
+      for (const auto& row_id : merged_partition.row_ids) {
+        results.emplace_back().row_id = row_id;
+      }
+    }
+    return;
+  }
+
+  for (auto& merged_partition : merged_partitions) {
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+      auto& merged_results = merged_partition.results_per_aggregate[aggregate_idx];
+      if (!merged_results) continue;
+
+      merged_results->move_to(*_contexts_per_column[aggregate_idx], merged_partition.row_ids);
+    }
+  }
+}  // NOLINT(readability/fn_size)
+
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
+  // If the aggregate results might not fit into the memory budget of the query (see BudgetedMemoryResource), the
+  // input is partitioned by its GROUP BY values and spilled to disk. Without GROUP BY columns, there is only a single
+  // group, which always fits.
+  auto* const memory_resource = BudgetedMemoryResource::current();
+  if (memory_resource && _spilling_allowed && !_groupby_column_ids.empty()) {
+    const auto estimated_bytes = left_input_table()->row_count() *
+                                 (_groupby_column_ids.size() + _aggregates.size()) * ESTIMATED_BYTES_PER_GROUP_VALUE;
+    if (!memory_resource->fits(estimated_bytes)) {
+      const auto output = _aggregate_spilled(*memory_resource, estimated_bytes);
+      if (output) return output;
+    }
+  }
+
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // However, more specializations mean more compile time. We now have specializations for 0, 1, 2, and >2 GROUP BY
   // columns.
@@ -661,6 +1262,215 @@ std::shared_ptr<const Table> AggregateHash::_on_execute() {
   return output;
 }
 
+std::shared_ptr<const Table> AggregateHash::_aggregate_spilled(BudgetedMemoryResource& memory_resource,
+                                                               const size_t estimated_bytes) {
+  // COUNT(DISTINCT) and STDDEV_SAMP cannot be computed from the partial aggregates of disjoint parts of a group
+  for (const auto& aggregate : _aggregates) {
+    if (aggregate->aggregate_function == AggregateFunction::CountDistinct ||
+        aggregate->aggregate_function == AggregateFunction::StandardDeviationSample) {
+      return nullptr;
+    }
+  }
+
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  const auto column_count = input_table->column_count();
+  const auto groupby_column_count = _groupby_column_ids.size();
+
+  const auto aggregate_nested = [](const std::shared_ptr<const Table>& table,
+                                   const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                   const std::vector<ColumnID>& groupby_column_ids) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    const auto aggregate_hash = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate_hash->_spilling_allowed = false;
+    aggregate_hash->execute();
+    return aggregate_hash->get_output();
+  };
+
+  /**
+   * The partial aggregates contain the GROUP BY columns followed by one column per aggregate, except for AVG, which is
+   * split into a SUM and a COUNT. partial_column_ids holds the (first) partial aggregate column of each aggregate.
+   */
+  auto partial_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  auto partial_column_ids = std::vector<ColumnID>{};
+  for (const auto& aggregate : _aggregates) {
+    partial_column_ids.emplace_back(
+        ColumnID{static_cast<ColumnID::base_type>(groupby_column_count + partial_aggregates.size())});
+    if (aggregate->aggregate_function == AggregateFunction::Avg) {
+      partial_aggregates.emplace_back(
+          std::make_shared<AggregateExpression>(AggregateFunction::Sum, aggregate->argument()));
+      partial_aggregates.emplace_back(
+          std::make_shared<AggregateExpression>(AggregateFunction::Count, aggregate->argument()));
+    } else {
+      partial_aggregates.emplace_back(aggregate);
+    }
+  }
+
+  auto partial_groupby_column_ids = std::vector<ColumnID>(groupby_column_count);
+  std::iota(partial_groupby_column_ids.begin(), partial_groupby_column_ids.end(), ColumnID{0});
+
+  const auto partition_budget = std::max(memory_resource.available_bytes() / 2, size_t{1});
+  const auto partition_count =
+      std::clamp((estimated_bytes + partition_budget - 1) / partition_budget, size_t{2}, MAX_SPILL_PARTITION_COUNT);
+  const auto bytes_per_row = (groupby_column_count + _aggregates.size()) * ESTIMATED_BYTES_PER_GROUP_VALUE;
+  const auto batch_row_budget = std::max(partition_budget / bytes_per_row, size_t{1});
+
+  /**
+   * 1. Aggregate the input in batches of chunks whose aggregates fit into the budget. The partial aggregates of each
+   *    batch are partitioned by the hash of their GROUP BY values and spilled, so that only the hash table of a single
+   *    batch is held in memory. Each partition of a batch is written as a single block.
+   */
+  auto spill_file = SpillFile{};
+  auto blocks_per_partition = std::vector<std::vector<SpilledBlock>>(partition_count);
+  auto partial_column_definitions = TableColumnDefinitions{};
+
+  auto chunk_id = ChunkID{0};
+  while (chunk_id < chunk_count) {
+    // Each batch contains at least one chunk. The batch tables share the segments of the input table.
+    const auto batch_table = std::make_shared<Table>(input_table->column_definitions(), input_table->type());
+    auto batch_row_count = size_t{0};
+    for (; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      if (!chunk || chunk->size() == 0) continue;
+      if (batch_row_count > 0 && batch_row_count + chunk->size() > batch_row_budget) break;
+
+      auto segments = Segments{};
+      segments.reserve(column_count);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+      batch_table->append_chunk(segments);
+      batch_row_count += chunk->size();
+    }
+    if (batch_row_count == 0) continue;
+
+    const auto partial_table = aggregate_nested(batch_table, partial_aggregates, _groupby_column_ids);
+    partial_column_definitions = partial_table->column_definitions();
+    DebugAssert(partial_table->chunk_count() == 1, "Expected the partial aggregates of a batch in a single chunk");
+    const auto partial_chunk = partial_table->get_chunk(ChunkID{0});
+
+    auto hashes = std::vector<size_t>(partial_chunk->size());
+    hash_groupby_values(*partial_table, *partial_chunk, partial_groupby_column_ids, hashes);
+    auto chunk_offsets_by_partition = std::vector<std::vector<ChunkOffset>>(partition_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < partial_chunk->size(); ++chunk_offset) {
+      chunk_offsets_by_partition[hashes[chunk_offset] % partition_count].emplace_back(chunk_offset);
+    }
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      if (chunk_offsets_by_partition[partition_id].empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        const auto& chunk_offsets = chunk_offsets_by_partition[partition_id];
+        auto block = SpilledBlock{chunk_offsets.size(), {}};
+        for (auto column_id = ColumnID{0}; column_id < partial_chunk->column_count(); ++column_id) {
+          resolve_data_type(partial_table->column_data_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            const auto& segment = static_cast<const ValueSegment<ColumnDataType>&>(
+                *partial_chunk->get_segment(column_id));
+            block.columns.emplace_back(spill_values(segment, chunk_offsets, spill_file));
+          });
+        }
+        blocks_per_partition[partition_id].emplace_back(std::move(block));
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+  memory_resource.add_spilled_bytes(spill_file.size());
+
+  /**
+   * 2. Combine the partial aggregates partition by partition. MIN, MAX, and ANY are applied to the partial aggregates
+   *    again, SUMs and COUNTs are summed up. As all partial aggregates of a group are in the same partition, the
+   *    results of the partitions can simply be concatenated.
+   */
+  auto combining_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (auto partial_aggregate_idx = size_t{0}; partial_aggregate_idx < partial_aggregates.size();
+       ++partial_aggregate_idx) {
+    const auto partial_aggregate_function = partial_aggregates[partial_aggregate_idx]->aggregate_function;
+    const auto combining_function =
+        partial_aggregate_function == AggregateFunction::Count ? AggregateFunction::Sum : partial_aggregate_function;
+
+    const auto partial_column_id =
+        ColumnID{static_cast<ColumnID::base_type>(groupby_column_count + partial_aggregate_idx)};
+    const auto& partial_column_definition = partial_column_definitions[partial_column_id];
+    combining_aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        combining_function,
+        std::make_shared<PQPColumnExpression>(partial_column_id, partial_column_definition.data_type,
+                                              partial_column_definition.nullable, partial_column_definition.name)));
+  }
+
+  auto output = std::shared_ptr<Table>{};
+  for (const auto& blocks : blocks_per_partition) {
+    if (blocks.empty()) continue;
+
+    const auto partition_table = std::make_shared<Table>(partial_column_definitions, TableType::Data);
+    for (const auto& block : blocks) {
+      auto segments = Segments{};
+      segments.reserve(partial_column_definitions.size());
+      for (auto column_id = ColumnID{0}; column_id < partial_column_definitions.size(); ++column_id) {
+        resolve_data_type(partial_column_definitions[column_id].data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          segments.emplace_back(load_values<ColumnDataType>(block.columns[column_id], block.row_count,
+                                                            partial_column_definitions[column_id].nullable,
+                                                            spill_file));
+        });
+      }
+      partition_table->append_chunk(segments);
+    }
+
+    const auto combined_table = aggregate_nested(partition_table, combining_aggregates, partial_groupby_column_ids);
+    const auto combined_chunk = combined_table->get_chunk(ChunkID{0});
+
+    auto segments = Segments{};
+    segments.reserve(groupby_column_count + _aggregates.size());
+    for (auto column_id = ColumnID{0}; column_id < groupby_column_count; ++column_id) {
+      segments.emplace_back(combined_chunk->get_segment(column_id));
+    }
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+      const auto combined_column_id = partial_column_ids[aggregate_idx];
+      const auto& combined_segment = combined_chunk->get_segment(combined_column_id);
+      switch (_aggregates[aggregate_idx]->aggregate_function) {
+        case AggregateFunction::Avg: {
+          const auto& counts = static_cast<const ValueSegment<CountAggregateType>&>(
+              *combined_chunk->get_segment(ColumnID{static_cast<ColumnID::base_type>(combined_column_id + 1)}));
+          segments.emplace_back(
+              divide_sums_by_counts(combined_table->column_data_type(combined_column_id), *combined_segment, counts));
+          break;
+        }
+        case AggregateFunction::Count: {
+          // The summed up counts are never NULL, but SUM returns a nullable column
+          const auto& counts = static_cast<const ValueSegment<CountAggregateType>&>(*combined_segment);
+          segments.emplace_back(std::make_shared<ValueSegment<CountAggregateType>>(
+              pmr_vector<CountAggregateType>{counts.values().begin(), counts.values().end()}));
+          break;
+        }
+        default:
+          segments.emplace_back(combined_segment);
+      }
+    }
+
+    if (!output) {
+      auto output_column_definitions = TableColumnDefinitions{};
+      for (auto column_id = ColumnID{0}; column_id < groupby_column_count; ++column_id) {
+        output_column_definitions.emplace_back(combined_table->column_definitions()[column_id]);
+      }
+      for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+        const auto& aggregate = _aggregates[aggregate_idx];
+        const auto nullable = aggregate->aggregate_function != AggregateFunction::Count &&
+                              combined_table->column_is_nullable(partial_column_ids[aggregate_idx]);
+        output_column_definitions.emplace_back(aggregate->as_column_name(),
+                                               segments[groupby_column_count + aggregate_idx]->data_type(), nullable);
+      }
+      output = std::make_shared<Table>(output_column_definitions, TableType::Data);
+    }
+    output->append_chunk(segments);
+  }
+
+  Assert(output, "Expected at least one non-empty partition");
+  return output;
+}
+
 /*
 The following template functions write the aggregated values for the different aggregate functions.
 They are separate and templated to avoid compiler errors for invalid type/function combinations.
@@ -38,6 +38,8 @@ class SegmentVisitorContext {};
 template <typename AggregateKey>
 struct GroupByContext;
 
+class BudgetedMemoryResource;
+
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, count and stddev_samp. The output is a table
  with value segments. As with most operators we do not guarantee a stable operation with regards to positions -
@@ -152,12 +154,24 @@ class AggregateHash : public AbstractAggregateOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  // Aggregates the input in two phases if the aggregate results do not fit into the memory budget of the query. First,
+  // nested AggregateHash operators compute partial aggregates for batches of input chunks. These are partitioned by
+  // the hash of their GROUP BY values and spilled to disk (see SpillFile). Then, the partial aggregates of each
+  // partition are combined by another nested AggregateHash. Thus, only the hash table of a single batch or partition
+  // is held in memory. Returns nullptr if an aggregate cannot be combined from partial aggregates (COUNT(DISTINCT)
+  // and STDDEV_SAMP), in which case the input is aggregated in memory.
+  std::shared_ptr<const Table> _aggregate_spilled(BudgetedMemoryResource& memory_resource,
+                                                  const size_t estimated_bytes);
+
   template <typename AggregateKey>
   KeysPerChunk<AggregateKey> _partition_by_groupby_keys() const;
 
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -183,6 +197,9 @@ class AggregateHash : public AbstractAggregateOperator {
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
   bool _has_aggregate_functions;
+
+  // Disabled for the nested operators that aggregate the spilled partitions
+  bool _spilling_allowed{true};
 };
 
 }  // namespace opossum
@@ -1,7 +1,11 @@
 #include "aggregate_sort.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <optional>
+#include <queue>
+#include <utility>
 #include <vector>
 
 #include "aggregate/aggregate_traits.hpp"
@@ -10,6 +14,7 @@
 #include "expression/pqp_column_expression.hpp"
 #include "operators/sort.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "table_wrapper.hpp"
 #include "types.hpp"
@@ -36,6 +41,16 @@ std::shared_ptr<const Table> sort_table_by_column_ids(const std::shared_ptr<cons
   return sort->get_output();
 }
 
+// Returns the sort mode of @param chunk for @param column_id if the chunk is sorted by that column
+std::optional<SortMode> chunk_sort_mode(const Chunk& chunk, const ColumnID column_id) {
+  const auto& chunk_sorted_by = chunk.individually_sorted_by();
+  const auto sort_definition_iter =
+      std::find_if(chunk_sorted_by.cbegin(), chunk_sorted_by.cend(),
+                   [&](const auto& sort_definition) { return sort_definition.column == column_id; });
+  if (sort_definition_iter == chunk_sorted_by.cend()) return std::nullopt;
+  return sort_definition_iter->sort_mode;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -313,17 +328,12 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
     const auto chunk = input_table->get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    const auto& chunk_sorted_by = input_table->get_chunk(chunk_id)->individually_sorted_by();
-
     // We can skip sorting the chunk only if we group by a single column and the chunk is sorted by that column. We do
     // not store information about cascadingly sorted chunks, which we would need for skipping the sort step with
     // multiple group by columns. The sort mode can be neglected as the aggregate only requires consecutiveness of
     // values.
     const auto single_column_group_by = groupby_column_ids.size() == 1;
-    const auto chunk_sorted_by_first_group_by_column =
-        std::find_if(chunk_sorted_by.cbegin(), chunk_sorted_by.cend(), [&](const auto& sort_definition) {
-          return groupby_column_ids[0] == sort_definition.column;
-        }) != chunk_sorted_by.cend();
+    const auto chunk_sorted_by_first_group_by_column = chunk_sort_mode(*chunk, groupby_column_ids[0]).has_value();
 
     if (single_column_group_by && chunk_sorted_by_first_group_by_column) {
       if (input_table->type() == TableType::Data) {
@@ -362,6 +372,139 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
   return output_table;
 }
 
+std::shared_ptr<Table> AggregateSort::_merge_sorted_chunks(const std::shared_ptr<const Table>& input_table,
+                                                           const ColumnID groupby_column_id) {
+  const auto chunk_count = input_table->chunk_count();
+  const auto column_count = input_table->column_count();
+
+  // The output references the tables that the input references. This requires all segments of a column to reference
+  // the same table, which is the case for the outputs of most operators.
+  auto referenced_tables = std::vector<std::shared_ptr<const Table>>(column_count, input_table);
+  auto referenced_column_ids = std::vector<ColumnID>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    referenced_column_ids[column_id] = column_id;
+    if (input_table->type() == TableType::Data) continue;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& reference_segment =
+          static_cast<const ReferenceSegment&>(*input_table->get_chunk(chunk_id)->get_segment(column_id));
+      if (chunk_id == ChunkID{0}) {
+        referenced_tables[column_id] = reference_segment.referenced_table();
+        referenced_column_ids[column_id] = reference_segment.referenced_column_id();
+      } else if (reference_segment.referenced_table() != referenced_tables[column_id] ||
+                 reference_segment.referenced_column_id() != referenced_column_ids[column_id]) {
+        return nullptr;
+      }
+    }
+  }
+
+  /**
+   * Each chunk holds runs of rows with the same group by value, sorted by that value. A k-way merge of the chunks
+   * moves the runs of the same group next to each other. The merge takes whole runs at a time, so it only costs a heap
+   * operation per run and chunk, instead of sorting all rows of the table. NULLs form a group of their own, which is
+   * appended at the end, as the position of NULLs within sorted chunks is not specified.
+   */
+  auto merged_row_ids = RowIDPosList{};
+  merged_row_ids.reserve(input_table->row_count());
+  auto null_row_ids = RowIDPosList{};
+
+  resolve_data_type(input_table->column_data_type(groupby_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // The non-NULL values of each chunk, in ascending order
+    auto sorted_runs = std::vector<std::vector<std::pair<ColumnDataType, ChunkOffset>>>(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      auto& sorted_run = sorted_runs[chunk_id];
+      sorted_run.reserve(chunk->size());
+      segment_iterate<ColumnDataType>(*chunk->get_segment(groupby_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          null_row_ids.emplace_back(RowID{chunk_id, position.chunk_offset()});
+        } else {
+          sorted_run.emplace_back(position.value(), position.chunk_offset());
+        }
+      });
+
+      if (chunk_sort_mode(*chunk, groupby_column_id) == SortMode::Descending) {
+        std::reverse(sorted_run.begin(), sorted_run.end());
+      }
+      DebugAssert(std::is_sorted(sorted_run.cbegin(), sorted_run.cend(),
+                                 [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+                  "Chunk is not sorted by the group by column as indicated");
+    }
+
+    // The heap holds the next position of each run that is not exhausted yet, the smallest value on top
+    using RunPosition = std::pair<ChunkID, size_t>;
+    const auto greater_value = [&](const RunPosition& lhs, const RunPosition& rhs) {
+      return sorted_runs[lhs.first][lhs.second].first > sorted_runs[rhs.first][rhs.second].first;
+    };
+    auto heap = std::priority_queue<RunPosition, std::vector<RunPosition>, decltype(greater_value)>{greater_value};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (!sorted_runs[chunk_id].empty()) heap.emplace(chunk_id, 0);
+    }
+
+    while (!heap.empty()) {
+      auto [chunk_id, run_offset] = heap.top();
+      heap.pop();
+
+      const auto& sorted_run = sorted_runs[chunk_id];
+      const auto& value = sorted_run[run_offset].first;
+      do {
+        merged_row_ids.emplace_back(RowID{chunk_id, sorted_run[run_offset].second});
+        ++run_offset;
+      } while (run_offset < sorted_run.size() && sorted_run[run_offset].first == value);
+
+      if (run_offset < sorted_run.size()) heap.emplace(chunk_id, run_offset);
+    }
+  });
+
+  merged_row_ids.insert(merged_row_ids.end(), null_row_ids.cbegin(), null_row_ids.cend());
+
+  // Write the output in chunks of the default size. For reference tables, the positions are resolved to the
+  // referenced tables. Columns that share their position lists in the input share them in the output as well.
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  const auto row_count = merged_row_ids.size();
+  for (auto begin = size_t{0}; begin < row_count; begin += Chunk::DEFAULT_SIZE) {
+    const auto end = std::min(begin + Chunk::DEFAULT_SIZE, row_count);
+    auto output_pos_lists = std::map<std::vector<std::shared_ptr<const AbstractPosList>>,
+                                     std::shared_ptr<const AbstractPosList>>{};
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto input_pos_lists = std::vector<std::shared_ptr<const AbstractPosList>>{};
+      if (input_table->type() == TableType::References) {
+        input_pos_lists.reserve(chunk_count);
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto& segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+          input_pos_lists.emplace_back(static_cast<const ReferenceSegment&>(*segment).pos_list());
+        }
+      }
+
+      auto& output_pos_list = output_pos_lists[input_pos_lists];
+      if (!output_pos_list) {
+        auto pos_list = std::make_shared<RowIDPosList>(merged_row_ids.cbegin() + begin, merged_row_ids.cbegin() + end);
+        if (!input_pos_lists.empty()) {
+          for (auto& row_id : *pos_list) {
+            row_id = (*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset];
+          }
+        }
+        output_pos_list = std::move(pos_list);
+      }
+
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(referenced_tables[column_id],
+                                                                      referenced_column_ids[column_id],
+                                                                      output_pos_list));
+    }
+
+    output_table->append_chunk(output_segments);
+  }
+
+  return output_table;
+}
+
 /**
  * Executes the sort-based aggregation.
  *
@@ -372,6 +515,8 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
  * 3. Sort the input table by group by columns using the sort operator.
  *    - depending on characteristics of the input table, sorting can either be skipped (input already sorted by group
  *      by column) or sorting can be limited to chunks instead of sorting the whole table (input table is clustered)
+ *    - if the table is not clustered, but each chunk is sorted by the (single) group by column, the sorted chunks are
+ *      merged instead of sorting the whole table
  * 4. Find the group boundaries.
  *    - The unit of aggregation (either chunks or the whole table, depending on the table's value clustering) is now
  *      sorted by all group by columns.
@@ -453,8 +598,10 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
     return result_table;
   }
 
-  std::shared_ptr<const Table> sorted_table = input_table;
-  if (!_groupby_column_ids.empty()) {
+  std::shared_ptr<const Table> sorted_table;
+  if (_groupby_column_ids.empty()) {
+    sorted_table = input_table;
+  } else {
     /**
     * If there is a value clustering for a column, it means that all tuples with the same value in that column are in
     * the same chunk. Therefore, if one of the value clustering columns is part of the group by vector, we can skip
@@ -477,12 +624,29 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       }
     }
 
+    /**
+    * Otherwise, if we group by a single column and each chunk is already sorted by it, e.g., because the table is
+    * sorted or clustered by a date that we group by, the sorted chunks are merged instead of sorting the whole table.
+    */
+    const auto chunks_sorted_by_groupby_column = [&]() {
+      if (_groupby_column_ids.size() != 1) return false;
+
+      const auto chunk_count = input_table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (!chunk || !chunk_sort_mode(*chunk, _groupby_column_ids[0])) return false;
+      }
+      return true;
+    };
+
     if (is_value_clustered_by_groupby_column) {
       // Sort input table chunk-wise as the group by values are clustered.
       sorted_table = _sort_table_chunk_wise(input_table, _groupby_column_ids);
-    } else {
-      sorted_table = sort_table_by_column_ids(input_table, _groupby_column_ids);
+    } else if (chunks_sorted_by_groupby_column()) {
+      sorted_table = _merge_sorted_chunks(input_table, _groupby_column_ids[0]);
     }
+
+    if (!sorted_table) sorted_table = sort_table_by_column_ids(input_table, _groupby_column_ids);
   }
 
   _output_segments.resize(_aggregates.size() + _groupby_column_ids.size());
@@ -43,7 +43,8 @@ namespace opossum {
  * While most of this page refers to the hash-based aggregate, it also explains common features like aggregate traits.
  *
  * Some notes regarding future optimization:
- * Currently, we always sort the input table by the group by columns.
+ * Unless the table is value-clustered by a group by column or its chunks are individually sorted by the (single) group
+ * by column, we sort the whole input table by the group by columns.
  * In some cases this might be unnecessary, as the table could already be sorted.
  * There is an issue that discusses how such information as sortedness should be propagated:
  *  https://github.com/hyrise/hyrise/issues/1519
@@ -125,6 +126,14 @@ class AggregateSort : public AbstractAggregateOperator {
   static std::shared_ptr<Table> _sort_table_chunk_wise(const std::shared_ptr<const Table>& input_table,
                                                        const std::vector<ColumnID>& groupby_column_ids);
 
+  /**
+   * Merge the chunks of the input table, which are each sorted by the group by column, into a reference table in which
+   * all rows of a group are consecutive. Returns nullptr if the input is a reference table whose segments of a column
+   * reference different tables.
+   */
+  static std::shared_ptr<Table> _merge_sorted_chunks(const std::shared_ptr<const Table>& input_table,
+                                                     const ColumnID groupby_column_id);
+
   static Segments _get_segments_of_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id);
 };
 
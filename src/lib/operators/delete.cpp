@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
@@ -130,6 +131,29 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_log_records(WriteAheadLog::RecordWriter& record_writer) const {
+  // The referenced tables are only known by pointer, so we look up their names in the StorageManager
+  auto row_ids_by_table = std::unordered_map<std::shared_ptr<const Table>, std::vector<RowID>>{};
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    auto& row_ids = row_ids_by_table[referencing_segment->referenced_table()];
+    row_ids.insert(row_ids.end(), referencing_segment->pos_list()->begin(), referencing_segment->pos_list()->end());
+  }
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto row_ids_iter = row_ids_by_table.find(table);
+    if (row_ids_iter == row_ids_by_table.end()) continue;
+
+    record_writer.log_delete(table_name, row_ids_iter->second);
+    row_ids_by_table.erase(row_ids_iter);
+  }
+
+  Assert(row_ids_by_table.empty(), "Deleted rows from a table that is not registered in the StorageManager");
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
@@ -50,6 +50,11 @@ std::string GetTable::description(DescriptionMode description_mode) const {
   stream << _pruned_chunk_ids.size() << "/" << stored_table->chunk_count() << " chunk(s)";
   if (description_mode == DescriptionMode::SingleLine) stream << ",";
   stream << separator << _pruned_column_ids.size() << "/" << stored_table->column_count() << " column(s)";
+  if (runtime_filter) {
+    stream << separator << runtime_filter->description();
+  } else if (!_runtime_filter_description.empty()) {
+    stream << separator << _runtime_filter_description;
+  }
 
   return stream.str();
 }
@@ -94,6 +99,16 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
 
+  // The target column of the runtime filter refers to the output of GetTable, which omits the pruned columns
+  auto runtime_filter_column_id = INVALID_COLUMN_ID;
+  if (runtime_filter) {
+    runtime_filter->build();
+    runtime_filter_column_id = runtime_filter->target_column_id();
+    for (const auto pruned_column_id : _pruned_column_ids) {
+      if (pruned_column_id <= runtime_filter_column_id) ++runtime_filter_column_id;
+    }
+  }
+
   auto excluded_chunk_ids = std::vector<ChunkID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
@@ -124,6 +139,12 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       continue;
     }
+
+    // Check whether no row of the Chunk can find a join partner
+    if (runtime_filter && runtime_filter->can_prune(*chunk, runtime_filter_column_id)) {
+      excluded_chunk_ids.emplace_back(stored_chunk_id);
+      continue;
+    }
   }
 
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
@@ -216,10 +237,32 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       *output_chunks_iter = std::make_shared<Chunk>(std::move(output_segments), stored_chunk->mvcc_data(),
                                                     stored_chunk->get_allocator(), std::move(output_indexes));
 
-      if (output_chunk_sorted_by) {
-        // Finalizing the output chunk here is safe because this path is only taken for
-        // a sorted chunk. Chunks should never be sorted when they are still mutable
+      // Finalizing the output chunk is safe if the stored chunk is immutable. Chunks should never be sorted when they
+      // are still mutable.
+      if (!stored_chunk->is_mutable()) {
         (*output_chunks_iter)->finalize();
+
+        // Forward the pruning statistics of the remaining columns so that subsequent operators can prune chunks for
+        // values that are only known at execution time (see TableScan::_on_prepare_chunks).
+        const auto& stored_pruning_statistics = stored_chunk->pruning_statistics();
+        if (stored_pruning_statistics) {
+          auto output_pruning_statistics = ChunkPruningStatistics{};
+          output_pruning_statistics.reserve(stored_table->column_count() - _pruned_column_ids.size());
+          pruned_column_ids_iter = _pruned_column_ids.begin();
+          for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count();
+               ++stored_column_id) {
+            if (pruned_column_ids_iter != _pruned_column_ids.end() && stored_column_id == *pruned_column_ids_iter) {
+              ++pruned_column_ids_iter;
+              continue;
+            }
+            output_pruning_statistics.emplace_back((*stored_pruning_statistics)[stored_column_id]);
+          }
+          (*output_chunks_iter)->set_pruning_statistics(output_pruning_statistics);
+        }
+      }
+
+      if (output_chunk_sorted_by) {
+        DebugAssert(!stored_chunk->is_mutable(), "Sorted chunks should be immutable");
         (*output_chunks_iter)->set_individually_sorted_by(*output_chunk_sorted_by);
       }
 
@@ -235,4 +278,10 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
                                  stored_table->uses_mvcc());
 }
 
+void GetTable::_on_cleanup() {
+  if (!runtime_filter) return;
+  _runtime_filter_description = runtime_filter->description();
+  runtime_filter.reset();
+}
+
 }  // namespace opossum
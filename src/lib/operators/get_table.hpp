@@ -6,6 +6,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "runtime_filter.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -34,6 +35,11 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // If set, chunks that cannot contain a join partner of a subsequent join are pruned. The filter is set when the
+  // OperatorTasks are created, see RuntimeFilter. It is not copied by deep_copy() and reset after the execution, so
+  // that cached PQPs do not keep the Bloom filter alive.
+  std::shared_ptr<RuntimeFilter> runtime_filter;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -41,10 +47,14 @@ class GetTable : public AbstractReadOnlyOperator {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+  void _on_cleanup() override;
 
   // name of the table to retrieve
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  // The description of the runtime filter, so that it is still available after the filter is reset in _on_cleanup()
+  std::string _runtime_filter_description;
 };
 }  // namespace opossum
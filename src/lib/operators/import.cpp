@@ -5,19 +5,36 @@
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
 #include "import_export/csv/csv_parser.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Encodes all columns that support @param target_encoding with it, leaves the others unencoded
+ChunkEncodingSpec chunk_encoding_spec(const std::vector<DataType>& data_types, const EncodingType target_encoding) {
+  auto encoding_spec = ChunkEncodingSpec{};
+  for (const auto data_type : data_types) {
+    encoding_spec.emplace_back(encoding_supports_data_type(target_encoding, data_type) ? target_encoding
+                                                                                        : EncodingType::Unencoded);
+  }
+  return encoding_spec;
+}
+
+}  // namespace
+
 Import::Import(const std::string& init_filename, const std::string& tablename, const ChunkOffset chunk_size,
-               const FileType file_type, const std::optional<CsvMeta>& csv_meta)
+               const FileType file_type, const std::optional<CsvMeta>& csv_meta,
+               const std::optional<EncodingType>& target_encoding)
     : AbstractReadOnlyOperator(OperatorType::Import),
       filename(init_filename),
       _tablename(tablename),
       _chunk_size(chunk_size),
       _file_type(file_type),
-      _csv_meta(csv_meta) {
+      _csv_meta(csv_meta),
+      _target_encoding(target_encoding) {
   if (_file_type == FileType::Auto) {
     _file_type = file_type_from_filename(filename);
   }
@@ -37,9 +54,18 @@ std::shared_ptr<const Table> Import::_on_execute() {
   std::shared_ptr<Table> table;
 
   switch (_file_type) {
-    case FileType::Csv:
-      table = CsvParser::parse(filename, _chunk_size, _csv_meta);
-      break;
+    case FileType::Csv: {
+      const auto csv_meta = _csv_meta ? *_csv_meta : process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
+
+      // The chunks are encoded by the parsing tasks, so that they are only written once
+      auto encoding_spec = std::optional<ChunkEncodingSpec>{};
+      if (_target_encoding) {
+        const auto data_types = CsvParser::create_table_from_meta(csv_meta)->column_data_types();
+        encoding_spec = chunk_encoding_spec(data_types, *_target_encoding);
+      }
+
+      table = CsvParser::parse(filename, _chunk_size, csv_meta, encoding_spec);
+    } break;
     case FileType::Tbl:
       table = load_table(filename, _chunk_size);
       break;
@@ -50,6 +76,10 @@ std::shared_ptr<const Table> Import::_on_execute() {
       Fail("File type should have been determined previously.");
   }
 
+  if (_target_encoding && _file_type != FileType::Csv) {
+    ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec(table->column_data_types(), *_target_encoding));
+  }
+
   if (Hyrise::get().storage_manager.has_table(_tablename)) {
     Hyrise::get().storage_manager.drop_table(_tablename);
   }
@@ -63,7 +93,7 @@ std::shared_ptr<const Table> Import::_on_execute() {
 std::shared_ptr<AbstractOperator> Import::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<Import>(filename, _tablename, _chunk_size, _file_type, _csv_meta);
+  return std::make_shared<Import>(filename, _tablename, _chunk_size, _file_type, _csv_meta, _target_encoding);
 }
 
 void Import::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -6,6 +6,7 @@
 #include "abstract_read_only_operator.hpp"
 #include "import_export/csv/csv_meta.hpp"
 #include "import_export/file_type.hpp"
+#include "storage/encoding_type.hpp"
 #include "types.hpp"
 
 #include "SQLParser.h"
@@ -26,10 +27,13 @@ class Import : public AbstractReadOnlyOperator {
    * @param chunk_size     Optional. Chunk size. Does not effect binary import.
    * @param file_type      Optional. Type indicating the file format. If not present, it is guessed by the filename.
    * @param csv_meta       Optional. A specific meta config, used instead of filename + '.json'
+   * @param target_encoding Optional. Encoding of the imported chunks. Columns whose data type it does not support are
+   *                        left unencoded. CSV files are encoded while they are parsed.
    */
   explicit Import(const std::string& init_filename, const std::string& tablename,
                   const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE, const FileType file_type = FileType::Auto,
-                  const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                  const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                  const std::optional<EncodingType>& target_encoding = std::nullopt);
 
   const std::string& name() const final;
   const std::string filename;
@@ -48,6 +52,7 @@ class Import : public AbstractReadOnlyOperator {
   const ChunkOffset _chunk_size;
   FileType _file_type;
   const std::optional<CsvMeta> _csv_meta;
+  const std::optional<EncodingType> _target_encoding;
 };
 
 }  // namespace opossum
@@ -273,6 +273,13 @@ void Insert::_on_rollback_records() {
   }
 }
 
+void Insert::_on_log_records(WriteAheadLog::RecordWriter& record_writer) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    record_writer.log_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                             target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
@@ -34,6 +34,7 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(WriteAheadLog::RecordWriter& record_writer) const override;
 
  private:
   const std::string _target_table_name;
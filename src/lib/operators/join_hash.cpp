@@ -1,7 +1,11 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <type_traits>
@@ -15,6 +19,8 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "memory/spill_file.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
@@ -28,6 +34,9 @@ namespace {
 // Semi/Anti* Joins only emit tuples from the probe table
 enum class OutputColumnOrder { BuildFirstProbeSecond, ProbeFirstBuildSecond, ProbeOnly };
 
+// Estimated memory consumption of a build partition and its hash table, relative to the size of the partition
+constexpr auto BUILD_PARTITION_BYTE_FACTOR = size_t{3};
+
 }  // namespace
 
 namespace opossum {
@@ -58,6 +67,10 @@ std::string JoinHash::description(DescriptionMode description_mode) const {
   std::ostringstream stream;
   stream << AbstractJoinOperator::description(description_mode);
   stream << " Radix bits: " << (_radix_bits ? std::to_string(*_radix_bits) : "Unspecified");
+  if (runtime_filter_source) {
+    stream << " Runtime filter from "
+           << (*runtime_filter_source == RuntimeFilterSource::LeftInput ? "left" : "right") << " input";
+  }
 
   return stream.str();
 }
@@ -65,8 +78,10 @@ std::string JoinHash::description(DescriptionMode description_mode) const {
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates, _radix_bits);
+  auto copy = std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                         _secondary_predicates, _radix_bits);
+  copy->runtime_filter_source = runtime_filter_source;
+  return copy;
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -317,10 +332,63 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *                          Probing (actual Join)
      */
 
+    /**
+     * If the materialized columns and their hash tables do not fit into the memory budget of the query (see
+     * BudgetedMemoryResource), they are radix partitioned and written to disk while they are materialized. Once the
+     * estimated size of the materialized chunks exceeds the budget, every further chunk is spilled right after it has
+     * been materialized, and the chunks materialized before are spilled afterwards. The partitions are then loaded,
+     * built, and probed in batches of partitions that fit into the budget (Grace hash join). As each probe partition
+     * only finds its join partners in the build partition with the same index, batches are independent of each other.
+     * This requires radix partitioning and values that can be written to disk as they are (i.e., no strings).
+     */
+    auto* const memory_resource = BudgetedMemoryResource::current();
+    constexpr auto IS_SPILLABLE = std::is_trivially_copyable_v<PartitionedElement<BuildColumnType>> &&
+                                  std::is_trivially_copyable_v<PartitionedElement<ProbeColumnType>>;
+    const auto spilled_partition_count = _radix_bits > 0 ? size_t{1} << _radix_bits : size_t{0};
+    auto spilled_build_column = SpilledRadixContainer{spilled_partition_count};
+    auto spilled_probe_column = SpilledRadixContainer{spilled_partition_count};
+    auto spill_file = std::unique_ptr<SpillFile>{};
+    auto spill_file_mutex = std::mutex{};
+    auto is_spilling = std::atomic_bool{false};
+    auto estimated_materialized_bytes = std::atomic<size_t>{0};
+
+    // Called for each materialized chunk (see materialize_input()), possibly concurrently
+    const auto spill_if_exceeding_budget = [&](auto& partition, const std::vector<size_t>& histogram,
+                                               SpilledRadixContainer& spilled_radix_container,
+                                               const size_t byte_factor) {
+      using ColumnType = std::decay_t<decltype(partition.elements.front().value)>;
+
+      const auto bytes = partition.elements.size() * byte_factor * sizeof(PartitionedElement<ColumnType>);
+      if (!is_spilling && !memory_resource->fits(estimated_materialized_bytes += bytes)) {
+        const auto lock = std::lock_guard<std::mutex>{spill_file_mutex};
+        if (!spill_file) spill_file = std::make_unique<SpillFile>();
+        is_spilling = true;
+      }
+
+      if (is_spilling) {
+        spill_by_radix<ColumnType, HashedType>(partition, histogram, *spill_file, spilled_radix_container);
+      }
+    };
+
+    auto build_chunk_handler = std::function<void(Partition<BuildColumnType>&, const std::vector<size_t>&)>{};
+    auto probe_chunk_handler = std::function<void(Partition<ProbeColumnType>&, const std::vector<size_t>&)>{};
+    if constexpr (IS_SPILLABLE) {
+      if (memory_resource && _radix_bits > 0) {
+        build_chunk_handler = [&](auto& partition, const auto& histogram) {
+          spill_if_exceeding_budget(partition, histogram, spilled_build_column, BUILD_PARTITION_BYTE_FACTOR);
+        };
+        probe_chunk_handler = [&](auto& partition, const auto& histogram) {
+          spill_if_exceeding_budget(partition, histogram, spilled_probe_column, size_t{1});
+        };
+      }
+    }
+
     /**
      * 1.1. Materialize the build partition, which is expected to be smaller. Create a bloom filter.
      */
 
+    // Bloom filters are sized for the row count of the side that is materialized first, which is an upper bound of its
+    // number of distinct values. An inactive (default-constructed) BloomFilter is neither filled nor used.
     auto build_side_bloom_filter = BloomFilter{};
     auto probe_side_bloom_filter = BloomFilter{};
 
@@ -328,11 +396,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       if (keep_nulls_build_column) {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
             _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, build_chunk_handler);
       } else {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
             _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, build_chunk_handler);
       }
     };
 
@@ -344,41 +412,88 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       if (keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, probe_chunk_handler);
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, probe_chunk_handler);
       }
     };
 
+    // Whether the build side has been reduced to the values that are contained in the probe side's bloom filter
+    auto build_side_filtered = false;
+
     Timer timer_materialization;
     if (_build_input_table->row_count() < _probe_input_table->row_count()) {
-      // When materializing the first side (here: the build side), we do not yet have a bloom filter. To keep the number
-      // of code paths low, materialize_*_side always expects a bloom filter. For the first step, we thus pass in a
-      // bloom filter that returns true for every probe.
-      materialize_build_side(ALL_TRUE_BLOOM_FILTER);
+      // When materializing the first side (here: the build side), we do not yet have a bloom filter, so we pass in an
+      // inactive bloom filter that does not skip any values.
+      build_side_bloom_filter = BloomFilter{_build_input_table->row_count()};
+      materialize_build_side(BloomFilter{});
       _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+
+      // The probe side's bloom filter is used to reduce the build side. Unless all probe values are materialized
+      // (keep_nulls_probe_column), it only receives values that passed the build side's bloom filter.
+      probe_side_bloom_filter = BloomFilter{keep_nulls_probe_column ? _probe_input_table->row_count()
+                                                                    : _build_input_table->row_count()};
       materialize_probe_side(build_side_bloom_filter);
       _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
     } else {
-      materialize_probe_side(ALL_TRUE_BLOOM_FILTER);
+      probe_side_bloom_filter = BloomFilter{_probe_input_table->row_count()};
+      materialize_probe_side(BloomFilter{});
       _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
       materialize_build_side(probe_side_bloom_filter);
       _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+      build_side_filtered = !keep_nulls_build_column;
     }
 
+    // The build side's bloom filter is not needed anymore
+    build_side_bloom_filter = BloomFilter{};
+
     /**
-     * 2. Perform radix partitioning for build and probe sides. The bloom filters are not used in this step. Future work
-     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
-     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
-     *    within partition_by_radix.
+     * 2. Perform radix partitioning for build and probe sides. If the build side has not been filtered during its
+     *    materialization, it is first reduced using the probe side's bloom filter. This reduces the size of the
+     *    partitions and the hash tables. When spilling, the chunks that are still in memory are partitioned and
+     *    spilled instead.
      */
-    if (_radix_bits > 0) {
+    if (is_spilling) {
+      if constexpr (IS_SPILLABLE) {
+        Timer timer_clustering;
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        for (auto chunk_idx = size_t{0}; chunk_idx < materialized_build_column.size(); ++chunk_idx) {
+          jobs.emplace_back(std::make_shared<JobTask>([&, chunk_idx]() {
+            spill_by_radix<BuildColumnType, HashedType>(materialized_build_column[chunk_idx],
+                                                        histograms_build_column[chunk_idx], *spill_file,
+                                                        spilled_build_column);
+          }));
+        }
+        for (auto chunk_idx = size_t{0}; chunk_idx < materialized_probe_column.size(); ++chunk_idx) {
+          jobs.emplace_back(std::make_shared<JobTask>([&, chunk_idx]() {
+            spill_by_radix<ProbeColumnType, HashedType>(materialized_probe_column[chunk_idx],
+                                                        histograms_probe_column[chunk_idx], *spill_file,
+                                                        spilled_probe_column);
+          }));
+        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+        materialized_build_column.clear();
+        materialized_probe_column.clear();
+        histograms_build_column.clear();
+        histograms_probe_column.clear();
+        memory_resource->add_spilled_bytes(spill_file->size());
+
+        _performance.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
+      }
+    } else if (_radix_bits > 0) {
       Timer timer_clustering;
       auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
       jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        if (!build_side_filtered && !keep_nulls_build_column) {
+          filter_by_bloom_filter<BuildColumnType, HashedType>(materialized_build_column, histograms_build_column,
+                                                              _radix_bits, probe_side_bloom_filter);
+          build_side_filtered = true;
+        }
+
         // radix partition the build table
         if (keep_nulls_build_column) {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
@@ -418,33 +533,24 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       radix_probe_column = std::move(materialized_probe_column);
     }
 
-    /**
-     * 3. Build hash tables.
-     *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
-     *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
-     *    all rows.
-     *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
-     *    probe step.
-     */
-    Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
-    _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
-
     /**
      * Short cut for AntiNullAsTrue:
-     *   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted anyway (as
-     *   long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right here is
-     *   hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
+     *   If there is any NULL value on the build side, do not bother building and probing as no tuples can be emitted
+     *   anyway (as long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right
+     *   here is hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
      *   detecting a NULL value on the build side there.
      */
     if (_mode == JoinMode::AntiNullAsTrue) {
+      const auto spilled_null_value =
+          std::any_of(spilled_build_column.partitions.begin(), spilled_build_column.partitions.end(),
+                      [](const auto& spilled_partition) { return spilled_partition.contains_null_value; });
+      if (spilled_null_value) {
+        Timer timer_output_writing;
+        const auto result = _join_hash._build_output_table({});
+        _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+        return result;
+      }
+
       for (const auto& build_side_partition : radix_build_column) {
         for (const auto null_value : build_side_partition.null_values) {
           if (null_value) {
@@ -457,60 +563,142 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       }
     }
 
+    /**
+     * 3. Build hash tables.
+     *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
+     *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
+     *    all rows.
+     *    Unless the build side has already been filtered, we use the probe side's bloom filter to exclude values from
+     *    the hash table that will not be accessed in the probe step.
+     */
+    const auto no_bloom_filter = BloomFilter{};
+    const auto& build_bloom_filter = build_side_filtered ? no_bloom_filter : probe_side_bloom_filter;
+    const auto build_mode = _secondary_predicates.empty() && (_mode == JoinMode::Semi ||
+                                                              _mode == JoinMode::AntiNullAsTrue ||
+                                                              _mode == JoinMode::AntiNullAsFalse)
+                                ? JoinHashBuildMode::SinglePosition
+                                : JoinHashBuildMode::AllPositions;
+
     /**
      * 4. Probe step
      */
     std::vector<RowIDPosList> build_side_pos_lists;
     std::vector<RowIDPosList> probe_side_pos_lists;
-    const size_t partition_count = radix_probe_column.size();
+    const size_t partition_count = is_spilling ? spilled_partition_count : radix_probe_column.size();
     build_side_pos_lists.resize(partition_count);
     probe_side_pos_lists.resize(partition_count);
 
-    // simple heuristic: half of the rows of the probe relation will match
-    const size_t result_rows_per_partition =
-        _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
-    for (size_t i = 0; i < partition_count; i++) {
-      build_side_pos_lists[i].reserve(result_rows_per_partition);
-      probe_side_pos_lists[i].reserve(result_rows_per_partition);
-    }
+    const auto probe_partitions = [&]() {
+      switch (_mode) {
+        case JoinMode::Inner:
+          probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
+                                                    probe_side_pos_lists, _mode, *_build_input_table,
+                                                    *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Left:
+        case JoinMode::Right:
+          probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
+                                                   probe_side_pos_lists, _mode, *_build_input_table,
+                                                   *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Semi:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
+                                                                       probe_side_pos_lists, *_build_input_table,
+                                                                       *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsTrue:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+              radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsFalse:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+              radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        default:
+          Fail("JoinMode not supported by JoinHash");
+      }
+    };
+
+    if (!is_spilling) {
+      // simple heuristic: half of the rows of the probe relation will match
+      const size_t result_rows_per_partition =
+          _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
+      for (size_t i = 0; i < partition_count; i++) {
+        build_side_pos_lists[i].reserve(result_rows_per_partition);
+        probe_side_pos_lists[i].reserve(result_rows_per_partition);
+      }
+
+      Timer timer_hash_map_building;
+      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, build_mode, _radix_bits,
+                                                       build_bloom_filter);
+      probe_side_bloom_filter = BloomFilter{};
+      _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
+
+      Timer timer_probing;
+      probe_partitions();
+      _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+    } else {
+      const auto& spilled_build_partitions = spilled_build_column.partitions;
+      const auto& spilled_probe_partitions = spilled_probe_column.partitions;
+      const auto partition_bytes = [&](const size_t partition_idx) {
+        return spilled_build_partitions[partition_idx].element_count * BUILD_PARTITION_BYTE_FACTOR *
+                   sizeof(PartitionedElement<BuildColumnType>) +
+               spilled_probe_partitions[partition_idx].element_count * sizeof(PartitionedElement<ProbeColumnType>);
+      };
+
+      // Reading the partitions back is accounted for in the building step
+      auto building_runtime = std::chrono::nanoseconds{};
+      auto probing_runtime = std::chrono::nanoseconds{};
+      const auto batch_budget = memory_resource->available_bytes();
+      auto batch_begin = size_t{0};
+      while (batch_begin < partition_count) {
+        // Each batch contains at least one partition
+        auto batch_end = batch_begin + 1;
+        auto batch_bytes = partition_bytes(batch_begin);
+        while (batch_end < partition_count && batch_bytes + partition_bytes(batch_end) <= batch_budget) {
+          batch_bytes += partition_bytes(batch_end);
+          ++batch_end;
+        }
+
+        // Partitions outside of the batch stay empty and are skipped by build() and probe()
+        Timer timer_hash_map_building;
+        radix_build_column = RadixContainer<BuildColumnType>(partition_count);
+        radix_probe_column = RadixContainer<ProbeColumnType>(partition_count);
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        jobs.reserve(batch_end - batch_begin);
+        for (auto partition_idx = batch_begin; partition_idx < batch_end; ++partition_idx) {
+          jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+            load_spilled_partition(spilled_build_partitions[partition_idx], *spill_file,
+                                   radix_build_column[partition_idx]);
+            load_spilled_partition(spilled_probe_partitions[partition_idx], *spill_file,
+                                   radix_probe_column[partition_idx]);
+          }));
+        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+        hash_tables = build<BuildColumnType, HashedType>(radix_build_column, build_mode, _radix_bits,
+                                                         build_bloom_filter);
+        building_runtime += timer_hash_map_building.lap();
+
+        Timer timer_probing;
+        probe_partitions();
+        hash_tables.clear();
+        probing_runtime += timer_probing.lap();
+
+        batch_begin = batch_end;
+      }
 
-    Timer timer_probing;
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
+      probe_side_bloom_filter = BloomFilter{};
+      _performance.set_step_runtime(OperatorSteps::Building, building_runtime);
+      _performance.set_step_runtime(OperatorSteps::Probing, probing_runtime);
     }
-    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
 
     // After probing, the partitioned columns are not needed anymore.
     radix_build_column.clear();
@@ -4,6 +4,7 @@
 
 #include "abstract_join_operator.hpp"
 #include "operator_join_predicate.hpp"
+#include "runtime_filter.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -30,6 +31,13 @@ class JoinHash : public AbstractJoinOperator {
   const std::string& name() const override;
   std::string description(DescriptionMode description_mode) const override;
 
+  /**
+   * If set, the join keys of this input are published as a RuntimeFilter to the TableScans and GetTables that produce
+   * the other input. Only valid for Inner and Semi joins (for Semi joins, only the right input can be the source). Set
+   * by the LQPTranslator, see RuntimeFilter.
+   */
+  std::optional<RuntimeFilterSource> runtime_filter_source;
+
   template <typename T>
   static size_t calculate_radix_bits(const size_t build_relation_size, const size_t probe_relation_size);
 
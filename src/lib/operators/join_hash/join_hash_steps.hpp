@@ -1,12 +1,12 @@
 #pragma once
 
 #include <boost/container/small_vector.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "memory/spill_file.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
@@ -14,6 +14,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
+#include "utils/bloom_filter.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -183,46 +184,57 @@ class PosHashTable {
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
 
-// The bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether bloom filters are worth the memory and computational costs This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Check whether using multiple hash functions (k>1) brings any improvement.
-// (4) Use the probe side bloom filter when partitioning the build side. By doing that, we reduce the size of the
-//     intermediary results. When a bloom filter-supported partitioning has been done (i.e., partitioning has not
-//     been skipped), we do not need to use a bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
-static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
-static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
-
-// Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
-// needed for merging partial bloom filters created by different threads. Note that the dynamic_bitset(n, value)
-// constructor does not do what you would expect it to, so try to avoid it.
-using BloomFilter = boost::dynamic_bitset<>;
-
-// ALL_TRUE_BLOOM_FILTER is initialized by creating a BloomFilter with every value being false and using bitwise
-// negation (~x). As the negation is surprisingly expensive, we create a static empty bloom filter and reference
-// it where needed. Having a bloom filter that always returns true avoids a branch in the hot loop.
-static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
+// Bloom filters are used to skip rows of one join side whose values do not occur on the other side. The side that is
+// materialized first (usually the smaller one) creates a BloomFilter, which is then used when materializing the other
+// side. If that is the probe side, the probe side creates a second BloomFilter, which is applied to the build side
+// before it is radix partitioned (or, without radix partitioning, while the hash tables are built). As false positives
+// only lead to additional rows being processed, the filters do not need to be exact.
+//
+// A bloom filter does not pay off if (nearly) all values pass it. After BLOOM_FILTER_SAMPLE_SIZE values have been
+// tested, it is thus no longer used if more than BLOOM_FILTER_MAX_PASS_RATE of them passed.
+static constexpr auto BLOOM_FILTER_SAMPLE_SIZE = size_t{16'384};
+static constexpr auto BLOOM_FILTER_MAX_PASS_RATE = 0.75;
+
+// Collects the pass rate of a BloomFilter across the concurrently processed chunks of one input and decides whether
+// it is still used
+class BloomFilterPassRate {
+ public:
+  explicit BloomFilterPassRate(const bool is_used) : _is_used(is_used) {}
+
+  bool is_used() const { return _is_used.load(std::memory_order_relaxed); }
+
+  void add(const size_t tested_count, const size_t passed_count) {
+    const auto total_tested_count = static_cast<double>(_tested_count.fetch_add(tested_count) + tested_count);
+    const auto total_passed_count = static_cast<double>(_passed_count.fetch_add(passed_count) + passed_count);
+    if (total_tested_count >= BLOOM_FILTER_SAMPLE_SIZE &&
+        total_passed_count > BLOOM_FILTER_MAX_PASS_RATE * total_tested_count) {
+      _is_used.store(false, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::atomic<bool> _is_used;
+  std::atomic<size_t> _tested_count{0};
+  std::atomic<size_t> _passed_count{0};
+};
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
-//                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             bloom filter is false
+// @param output_bloom_filter  Out: Each materialized value is inserted into the BloomFilter, unless it is inactive
+// @param input_bloom_filter   Optional: Materialization is skipped for each value that is not contained in the
+//                             BloomFilter (unless NULL values are kept). It is no longer used if it does not filter
+//                             enough values (see BLOOM_FILTER_MAX_PASS_RATE).
+// @param chunk_handler        Optional: Called with the partition and the histogram of each chunk once the chunk has
+//                             been materialized, e.g., to spill the partition to disk (see spill_by_radix())
 template <typename T, typename HashedType, bool keep_null_values>
-RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                    BloomFilter& output_bloom_filter,
-                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+RadixContainer<T> materialize_input(
+    const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits, BloomFilter& output_bloom_filter,
+    const BloomFilter& input_bloom_filter = BloomFilter{},
+    const std::function<void(Partition<T>&, const std::vector<size_t>&)>& chunk_handler = nullptr) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
@@ -238,11 +250,8 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto pass = size_t{0};
   const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
-  std::mutex output_bloom_filter_mutex;
-
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  // If NULL values are kept, every row is materialized
+  auto input_bloom_filter_pass_rate = BloomFilterPassRate{input_bloom_filter.is_active() && !keep_null_values};
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -253,14 +262,6 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
     if (!in_table->get_chunk(chunk_id)) continue;
 
     jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
-      auto local_output_bloom_filter = BloomFilter{};
-      std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
-      if (Hyrise::get().is_multi_threaded()) {
-        // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
-        used_output_bloom_filter = local_output_bloom_filter;
-      }
-
       const auto chunk_in = in_table->get_chunk(chunk_id);
 
       // Skip chunks that were physically deleted
@@ -283,6 +284,11 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       auto reference_chunk_offset = ChunkOffset{0};
 
+      // Whether the input_bloom_filter is still used is decided once per chunk
+      const auto use_input_bloom_filter = input_bloom_filter_pass_rate.is_used();
+      auto bloom_filter_tested_count = size_t{0};
+      auto bloom_filter_passed_count = size_t{0};
+
       const auto segment = chunk_in->get_segment(column_id);
       segment_with_iterators<T>(*segment, [&](auto it, auto end) {
         using IterableType = typename decltype(it)::IterableType;
@@ -307,14 +313,18 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
             auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
+            if (use_input_bloom_filter && !value.is_null()) {
+              ++bloom_filter_tested_count;
+              if (input_bloom_filter.contains(hashed_value)) {
+                ++bloom_filter_passed_count;
+              } else {
+                // Value in not present in input bloom filter and can be skipped
+                skip = true;
+              }
             }
 
             if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
+              output_bloom_filter.insert(hashed_value);
 
               /*
               For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -357,12 +367,14 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       elements.resize(std::distance(elements.begin(), elements_iter));
       null_values.resize(std::distance(null_values.begin(), null_values_iter));
 
+      if (chunk_handler) {
+        chunk_handler(radix_container[chunk_id], histogram);
+      }
+
       histograms[chunk_id] = std::move(histogram);
 
-      if (Hyrise::get().is_multi_threaded()) {
-        // Merge the local_output_bloom_filter into output_bloom_filter
-        std::lock_guard<std::mutex> lock{output_bloom_filter_mutex};
-        output_bloom_filter |= local_output_bloom_filter;
+      if (use_input_bloom_filter) {
+        input_bloom_filter_pass_rate.add(bloom_filter_tested_count, bloom_filter_passed_count);
       }
     }));
   }
@@ -379,8 +391,6 @@ template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
                                                            const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
-
   if (radix_container.empty()) return {};
 
   /*
@@ -422,7 +432,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
         const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+        if (!input_bloom_filter.contains(hashed_value)) {
           continue;
         }
 
@@ -451,10 +461,53 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+/*
+Removes the materialized values that are not contained in bloom_filter and updates the histograms accordingly. This is
+used to reduce the build side with the probe side's bloom filter before it is radix partitioned. NULL values must not
+have been materialized. As in materialize_input, the bloom_filter is no longer used if it does not filter enough values.
+*/
+template <typename T, typename HashedType>
+void filter_by_bloom_filter(RadixContainer<T>& radix_container, std::vector<std::vector<size_t>>& histograms,
+                            const size_t radix_bits, const BloomFilter& bloom_filter) {
+  const std::hash<HashedType> hash_function;
+  const auto radix_mask = (size_t{1} << radix_bits) - 1;
+
+  auto bloom_filter_pass_rate = BloomFilterPassRate{bloom_filter.is_active()};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(radix_container.size());
+  for (auto partition_idx = size_t{0}; partition_idx < radix_container.size(); ++partition_idx) {
+    if (radix_container[partition_idx].elements.empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      if (!bloom_filter_pass_rate.is_used()) return;
+
+      auto& elements = radix_container[partition_idx].elements;
+      DebugAssert(radix_container[partition_idx].null_values.empty(), "NULL values cannot be filtered");
+      auto& histogram = histograms[partition_idx];
+      std::fill(histogram.begin(), histogram.end(), 0);
+
+      const auto tested_count = elements.size();
+      auto output_iter = elements.begin();
+      for (const auto& element : elements) {
+        const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
+        if (!bloom_filter.contains(hashed_value)) continue;
+
+        *output_iter = element;
+        ++output_iter;
+        if (radix_bits > 0) ++histogram[hashed_value & radix_mask];
+      }
+      elements.resize(std::distance(elements.begin(), output_iter));
+
+      bloom_filter_pass_rate.add(tested_count, elements.size());
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
-                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
   if (radix_container.empty()) return radix_container;
 
   if constexpr (keep_null_values) {
@@ -554,6 +607,110 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+// Part of a partition that has been written to a SpillFile
+struct SpilledRun {
+  size_t elements_offset{0};
+  size_t element_count{0};
+  std::optional<size_t> null_values_offset;
+};
+
+// A radix partition that has been written to a SpillFile. Each spilled input chunk adds one run.
+struct SpilledPartition {
+  std::vector<SpilledRun> runs;
+  size_t element_count{0};
+  bool contains_null_value{false};
+};
+
+// The spilled radix partitions of one side of the join. Chunks can be added concurrently.
+struct SpilledRadixContainer {
+  explicit SpilledRadixContainer(const size_t partition_count) : partitions(partition_count) {}
+
+  std::vector<SpilledPartition> partitions;
+  std::mutex mutex;
+};
+
+/*
+Radix partitions a materialized chunk, appends each part to spill_file, and frees the chunk. This is used if the
+materialized columns and their hash tables do not fit into the memory budget of the query, so that the partitions can
+later be loaded and joined in smaller batches (Grace hash join). As chunks are spilled right after they have been
+materialized, the materialized column is never completely held in memory. NULL flags are stored as one byte per
+element. Can be called concurrently for different chunks.
+*/
+template <typename T, typename HashedType>
+void spill_by_radix(Partition<T>& partition, const std::vector<size_t>& histogram, SpillFile& spill_file,
+                    SpilledRadixContainer& spilled_radix_container) {
+  static_assert(std::is_trivially_copyable_v<PartitionedElement<T>>, "Only trivially copyable values can be spilled");
+
+  if (partition.elements.empty()) return;
+
+  const auto partition_count = spilled_radix_container.partitions.size();
+  DebugAssert(histogram.size() == partition_count, "Expected one histogram bucket per partition");
+
+  const std::hash<HashedType> hash_function;
+  const auto radix_mask = partition_count - 1;
+  const auto has_null_values = !partition.null_values.empty();
+
+  auto elements_by_radix = std::vector<std::vector<PartitionedElement<T>>>(partition_count);
+  auto null_values_by_radix = std::vector<std::vector<char>>(has_null_values ? partition_count : 0);
+  for (auto radix = size_t{0}; radix < partition_count; ++radix) {
+    elements_by_radix[radix].reserve(histogram[radix]);
+    if (has_null_values) null_values_by_radix[radix].reserve(histogram[radix]);
+  }
+
+  for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+    const auto& element = partition.elements[element_idx];
+    const auto radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
+    elements_by_radix[radix].emplace_back(element);
+    if (has_null_values) null_values_by_radix[radix].emplace_back(partition.null_values[element_idx]);
+  }
+
+  partition.elements.clear();
+  partition.elements.shrink_to_fit();
+  partition.null_values.clear();
+  partition.null_values.shrink_to_fit();
+
+  for (auto radix = size_t{0}; radix < partition_count; ++radix) {
+    const auto& elements = elements_by_radix[radix];
+    if (elements.empty()) continue;
+
+    auto run = SpilledRun{spill_file.append(elements), elements.size(), std::nullopt};
+    auto contains_null_value = false;
+    if (has_null_values) {
+      const auto& null_values = null_values_by_radix[radix];
+      run.null_values_offset = spill_file.append(null_values);
+      contains_null_value = std::find(null_values.begin(), null_values.end(), true) != null_values.end();
+    }
+
+    const auto lock = std::lock_guard<std::mutex>{spilled_radix_container.mutex};
+    auto& spilled_partition = spilled_radix_container.partitions[radix];
+    spilled_partition.runs.emplace_back(run);
+    spilled_partition.element_count += run.element_count;
+    spilled_partition.contains_null_value |= contains_null_value;
+  }
+}
+
+template <typename T>
+void load_spilled_partition(const SpilledPartition& spilled_partition, SpillFile& spill_file,
+                            Partition<T>& partition) {
+  partition.elements.resize(spilled_partition.element_count);
+  auto null_values = std::vector<char>{};
+
+  auto element_offset = size_t{0};
+  for (const auto& run : spilled_partition.runs) {
+    spill_file.read(run.elements_offset, run.element_count * sizeof(PartitionedElement<T>),
+                    partition.elements.data() + element_offset);
+
+    // Either all or no runs of a partition have NULL flags
+    if (run.null_values_offset) {
+      null_values.resize(spilled_partition.element_count);
+      spill_file.read(*run.null_values_offset, run.element_count, null_values.data() + element_offset);
+    }
+    element_offset += run.element_count;
+  }
+
+  partition.null_values.assign(null_values.begin(), null_values.end());
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -34,7 +34,8 @@ bool JoinSortMerge::supports(const JoinConfiguration config) {
 * The sort merge join performs a join on two input tables on specific join columns. For usage notes, see the
 * join_sort_merge.hpp. This is how the join works:
 * -> The input tables are materialized and clustered into a specified number of clusters.
-*    /utils/radix_cluster_sort.hpp for more info on the clustering phase.
+*    /utils/radix_cluster_sort.hpp for more info on the clustering phase. Inputs whose chunks are individually sorted
+*    by the join column are not sorted again; their sorted chunks are merged instead.
 * -> The join is performed per cluster. For the joining phase, runs of entries with the same value are identified
 *    and handled at once. If a join-match is identified, the corresponding row_ids are noted for the output.
 * -> Using the join result, the output table is built using pos lists referencing the original tables.
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +49,8 @@ struct Subsample {
 /**
  * Materializes a table for a specific segment and sorts it if required. Result is a triple of
  * materialized values, positions of NULL values, and a list of samples.
+ * Segments of chunks that are individually sorted by the column are materialized in ascending order without sorting
+ * them, independent of whether sorting is required.
  **/
 template <typename T>
 class ColumnMaterializer {
@@ -95,7 +98,29 @@ class ColumnMaterializer {
     return {std::move(output), std::move(null_rows), std::move(gathered_samples)};
   }
 
+  /**
+   * Returns true if every chunk of @param input is individually sorted by @param column_id. In this case, all
+   * materialized segments are sorted, even if the ColumnMaterializer was created with sort set to false.
+   **/
+  static bool chunks_sorted_by(const Table& input, const ColumnID column_id) {
+    const auto chunk_count = input.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input.get_chunk(chunk_id);
+      if (chunk && !_sort_mode(*chunk, column_id)) return false;
+    }
+    return true;
+  }
+
  private:
+  static std::optional<SortMode> _sort_mode(const Chunk& chunk, const ColumnID column_id) {
+    const auto& sorted_by = chunk.individually_sorted_by();
+    const auto sort_definition_iter = std::find_if(sorted_by.cbegin(), sorted_by.cend(), [&](const auto& definition) {
+      return definition.column == column_id;
+    });
+    if (sort_definition_iter == sorted_by.cend()) return std::nullopt;
+    return sort_definition_iter->sort_mode;
+  }
+
   /**
    * Creates a job to materialize and sort a chunk.
    **/
@@ -105,13 +130,15 @@ class ColumnMaterializer {
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      const auto segment = chunk->get_segment(column_id);
+      const auto sort_mode = _sort_mode(*chunk, column_id);
 
       if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
         (*output)[chunk_id] =
-            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, subsample);
+            _materialize_dictionary_segment(*dictionary_segment, chunk_id, sort_mode, null_rows_output, subsample);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, subsample);
+        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, sort_mode, null_rows_output, subsample);
       }
     });
   }
@@ -140,10 +167,12 @@ class ColumnMaterializer {
   }
 
   /**
-   * Materialization works of all types of segments
+   * Materialization works of all types of segments. If @param sort_mode is set, the segment is already sorted in that
+   * order.
    */
   std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const AbstractSegment& segment,
                                                                        const ChunkID chunk_id,
+                                                                       const std::optional<SortMode> sort_mode,
                                                                        std::unique_ptr<RowIDPosList>& null_rows_output,
                                                                        Subsample<T>& subsample) {
     auto output = MaterializedSegment<T>{};
@@ -160,7 +189,9 @@ class ColumnMaterializer {
       }
     });
 
-    if (_sort) {
+    if (sort_mode == SortMode::Descending) {
+      std::reverse(output.begin(), output.end());
+    } else if (_sort && !sort_mode) {
       std::sort(output.begin(), output.end(),
                 [](const auto& left, const auto& right) { return left.value < right.value; });
     }
@@ -174,15 +205,15 @@ class ColumnMaterializer {
    * Specialization for dictionary segments
    */
   std::shared_ptr<MaterializedSegment<T>> _materialize_dictionary_segment(
-      const DictionarySegment<T>& segment, const ChunkID chunk_id, std::unique_ptr<RowIDPosList>& null_rows_output,
-      Subsample<T>& subsample) {
+      const DictionarySegment<T>& segment, const ChunkID chunk_id, const std::optional<SortMode> sort_mode,
+      std::unique_ptr<RowIDPosList>& null_rows_output, Subsample<T>& subsample) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
     auto base_attribute_vector = segment.attribute_vector();
     auto dict = segment.dictionary();
 
-    if (_sort) {
+    if (_sort && !sort_mode) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
@@ -232,6 +263,10 @@ class ColumnMaterializer {
           output.emplace_back(row_id, position.value());
         }
       });
+
+      if (sort_mode == SortMode::Descending) {
+        std::reverse(output.begin(), output.end());
+      }
     }
 
     _gather_samples_from_segment(output, subsample);
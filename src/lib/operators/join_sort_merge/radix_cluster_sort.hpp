@@ -4,6 +4,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,6 +12,10 @@
 #include "column_materializer.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/reference_segment.hpp"
 
 namespace opossum {
 
@@ -35,9 +40,15 @@ struct RadixClusterOutput {
 * beyond cluster borders. Therefore, the clustering defaults to a range clustering algorithm for the non-equi-join.
 * General clustering process:
 * -> Input chunks are materialized and sorted. Every value is stored together with its row id.
-* -> Then, either radix clustering or range clustering is performed.
+* -> Then, either radix clustering or range clustering is performed. The split values of the range clustering are
+*    taken from the histograms of the join columns if these are available, so that skewed inputs are clustered evenly.
 * -> At last, the resulting clusters are sorted.
 *
+* Clustering keeps the order of the values of each chunk. Thus, if all chunks of an input are sorted (either because
+* they are individually sorted by the join column or because they were sorted during the materialization of the
+* non-equi case), each cluster consists of one sorted run per chunk. These runs are merged instead of sorting the
+* cluster.
+*
 * Radix clustering example:
 * cluster_count = 4
 * bits for 4 clusters: 2
@@ -145,17 +156,20 @@ class RadixClusterSort {
   }
 
   /**
-  * Concatenates multiple materialized segments to a single materialized segment.
+  * Concatenates multiple materialized segments to a single materialized segment. The offsets at which the segments
+  * start are written to @param run_offsets.
   **/
   static std::unique_ptr<MaterializedSegmentList<T>> _concatenate_chunks(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks, std::vector<std::vector<size_t>>& run_offsets) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(1);
     (*output_table)[0] = std::make_shared<MaterializedSegment<T>>();
+    run_offsets.assign(1, {});
 
     // Reserve the required space and move the data to the output
     auto output_chunk = (*output_table)[0];
     output_chunk->reserve(_materialized_table_size(input_chunks));
     for (auto& chunk : *input_chunks) {
+      run_offsets[0].push_back(output_chunk->size());
       output_chunk->insert(output_chunk->end(), chunk->begin(), chunk->end());
     }
 
@@ -170,9 +184,11 @@ class RadixClusterSort {
   *    it will be inserting values in each cluster.
   * -> Reserve the appropriate space for each output cluster to avoid ongoing vector resizing.
   * -> At last, each value of each chunk is moved to the appropriate cluster.
+  * For each cluster, the offsets at which the values of the chunks start are written to @param run_offsets.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
+                                                       std::function<size_t(const T&)> clusterer,
+                                                       std::vector<std::vector<size_t>>& run_offsets) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
     TableInformation table_information(input_chunks->size(), _cluster_count);
 
@@ -204,9 +220,15 @@ class RadixClusterSort {
     }
 
     // Reserve the appropriate output space for the clusters
+    run_offsets.assign(_cluster_count, {});
     for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
       auto cluster_size = table_information.cluster_histogram[cluster_id];
       (*output_table)[cluster_id] = std::make_shared<MaterializedSegment<T>>(cluster_size);
+
+      run_offsets[cluster_id].reserve(input_chunks->size());
+      for (const auto& chunk_information : table_information.chunk_information) {
+        run_offsets[cluster_id].push_back(chunk_information.insert_position[cluster_id]);
+      }
     }
 
     // Move each entry into its appropriate cluster in parallel
@@ -239,9 +261,10 @@ class RadixClusterSort {
   * - consolidate clusters in order to reduce skew.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
-      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks, std::vector<std::vector<size_t>>& run_offsets) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    return _cluster(
+        input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); }, run_offsets);
   }
 
   /**
@@ -277,45 +300,177 @@ class RadixClusterSort {
     return split_values;
   }
 
+  /**
+  * Returns the histogram of the join column @param column_id of @param table, or nullptr if there is none. For
+  * reference tables, the histogram of the referenced column is used. As it also covers rows that were filtered out
+  * before the join, only the bins within the range of the actually joined values are considered later on.
+  **/
+  static std::shared_ptr<AbstractHistogram<T>> _column_histogram(const Table& table, const ColumnID column_id) {
+    auto statistics_table = std::shared_ptr<const Table>{};
+    auto statistics_column_id = column_id;
+    if (table.type() == TableType::References) {
+      if (table.chunk_count() == 0) return nullptr;
+      const auto chunk = table.get_chunk(ChunkID{0});
+      if (!chunk) return nullptr;
+
+      const auto reference_segment = std::static_pointer_cast<ReferenceSegment>(chunk->get_segment(column_id));
+      statistics_table = reference_segment->referenced_table();
+      statistics_column_id = reference_segment->referenced_column_id();
+    }
+
+    const auto table_statistics =
+        statistics_table ? statistics_table->table_statistics() : table.table_statistics();
+    if (!table_statistics) return nullptr;
+
+    const auto attribute_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<T>>(table_statistics->column_statistics[statistics_column_id]);
+    if (!attribute_statistics) return nullptr;
+    return attribute_statistics->histogram;
+  }
+
+  /**
+  * Picks split values from the histograms of both join columns, so that each cluster receives roughly the same
+  * number of values. The bins of both histograms are ordered by their upper bounds, and a split is placed at the
+  * upper bound of the bin that completes a cluster. A bin that holds the values of several clusters (i.e., a heavily
+  * skewed value) completes all of them at once, and the remaining values are evenly distributed over the remaining
+  * clusters. Only bins that overlap [@param min_value, @param max_value] are considered. Returns std::nullopt if
+  * not both join columns have histograms.
+  **/
+  std::optional<std::vector<T>> _histogram_split_values(const T& min_value, const T& max_value) const {
+    auto bins = std::vector<std::pair<T, HistogramCountType>>{};
+    for (const auto& [table, column_id] :
+         {std::pair{_left_input_table, _left_column_id}, std::pair{_right_input_table, _right_column_id}}) {
+      const auto histogram = _column_histogram(*table, column_id);
+      if (!histogram) return std::nullopt;
+
+      const auto bin_count = histogram->bin_count();
+      for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+        if (histogram->bin_maximum(bin_id) < min_value || histogram->bin_minimum(bin_id) > max_value) continue;
+        bins.emplace_back(histogram->bin_maximum(bin_id), histogram->bin_height(bin_id));
+      }
+    }
+
+    std::sort(bins.begin(), bins.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    auto total_height = HistogramCountType{0};
+    for (const auto& bin : bins) {
+      total_height += bin.second;
+    }
+
+    auto split_values = std::vector<T>{};
+    split_values.reserve(_cluster_count - 1);
+    const auto cluster_height = total_height / static_cast<HistogramCountType>(_cluster_count);
+    auto completed_cluster_count = size_t{0};
+    auto cumulative_height = HistogramCountType{0};
+    for (const auto& [bin_maximum, bin_height] : bins) {
+      cumulative_height += bin_height;
+      if (bin_maximum >= max_value || completed_cluster_count + 1 >= _cluster_count) break;
+      if (cumulative_height < cluster_height * static_cast<HistogramCountType>(completed_cluster_count + 1)) continue;
+
+      if (split_values.empty() || split_values.back() < bin_maximum) {
+        split_values.push_back(bin_maximum);
+      }
+      while (completed_cluster_count + 1 < _cluster_count &&
+             cumulative_height >= cluster_height * static_cast<HistogramCountType>(completed_cluster_count + 1)) {
+        ++completed_cluster_count;
+      }
+    }
+
+    return split_values;
+  }
+
   /**
   * Performs the range cluster sort for the non-equi case (>, >=, <, <=, !=) which requires the complete table to
   * be sorted and not only the clusters in themselves. Returns the clustered data from the left table and the
-  * right table in a pair.
+  * right table in a pair. Expects the materialized segments to be sorted.
   **/
   std::pair<std::unique_ptr<MaterializedSegmentList<T>>, std::unique_ptr<MaterializedSegmentList<T>>> _range_cluster(
       const std::unique_ptr<MaterializedSegmentList<T>>& left_input,
-      const std::unique_ptr<MaterializedSegmentList<T>>& right_input, std::vector<T> sample_values) {
-    const std::vector<T> split_values = _pick_split_values(sample_values);
+      const std::unique_ptr<MaterializedSegmentList<T>>& right_input, std::vector<T> sample_values,
+      std::vector<std::vector<size_t>>& run_offsets_left, std::vector<std::vector<size_t>>& run_offsets_right) {
+    // As the materialized segments are sorted, their first and last values are their minimum and maximum
+    auto min_value = std::optional<T>{};
+    auto max_value = std::optional<T>{};
+    for (const auto& input : {&left_input, &right_input}) {
+      for (const auto& segment : **input) {
+        if (segment->empty()) continue;
+        if (!min_value || segment->front().value < *min_value) min_value = segment->front().value;
+        if (!max_value || segment->back().value > *max_value) max_value = segment->back().value;
+      }
+    }
+
+    auto histogram_split_values = std::optional<std::vector<T>>{};
+    if (min_value) {
+      histogram_split_values = _histogram_split_values(*min_value, *max_value);
+    }
+    const std::vector<T> split_values =
+        histogram_split_values ? std::move(*histogram_split_values) : _pick_split_values(sample_values);
 
     // Implements range clustering
     auto clusterer = [&split_values](const T& value) {
-      // Find the first split value that is greater or equal to the entry.
-      // The split values are sorted in ascending order.
-      // Note: can we do this faster? (binary search?)
-      for (size_t split_id = 0; split_id < split_values.size(); ++split_id) {
-        if (value <= split_values[split_id]) {
-          // Each split (e.g., split #0) is the upper bound for its corresponding cluster (i.e., cluster #0).
-          return split_id;
-        }
-      }
-
-      // The value is greater than all split values, which means it belongs in the last cluster.
-      return split_values.size();
+      // Find the first split value that is greater or equal to the entry. The split values are sorted in ascending
+      // order. Each split (e.g., split #0) is the upper bound for its corresponding cluster (i.e., cluster #0). If the
+      // value is greater than all split values, it belongs in the last cluster.
+      return static_cast<size_t>(std::lower_bound(split_values.cbegin(), split_values.cend(), value) -
+                                 split_values.cbegin());
     };
 
-    auto output_left = _cluster(left_input, clusterer);
-    auto output_right = _cluster(right_input, clusterer);
+    auto output_left = _cluster(left_input, clusterer, run_offsets_left);
+    auto output_right = _cluster(right_input, clusterer, run_offsets_right);
 
     return {std::move(output_left), std::move(output_right)};
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Merges the sorted runs of a cluster, which start at @param run_offsets, pairwise until the cluster is sorted.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
-    for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+  static void _merge_runs(MaterializedSegment<T>& cluster, const std::vector<size_t>& run_offsets) {
+    auto run_bounds = run_offsets;
+    run_bounds.push_back(cluster.size());
+
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+    while (run_bounds.size() > 2) {
+      auto merged_run_bounds = std::vector<size_t>{};
+      merged_run_bounds.reserve(run_bounds.size() / 2 + 1);
+
+      auto run_id = size_t{0};
+      for (; run_id + 2 < run_bounds.size(); run_id += 2) {
+        std::inplace_merge(cluster.begin() + run_bounds[run_id], cluster.begin() + run_bounds[run_id + 1],
+                           cluster.begin() + run_bounds[run_id + 2], compare);
+        merged_run_bounds.push_back(run_bounds[run_id]);
+      }
+
+      // An odd number of runs leaves the last run for the next pass
+      if (run_id + 1 < run_bounds.size()) {
+        merged_run_bounds.push_back(run_bounds[run_id]);
+      }
+      merged_run_bounds.push_back(cluster.size());
+      run_bounds = std::move(merged_run_bounds);
+    }
+  }
+
+  /**
+  * Sorts all clusters of a materialized table in parallel. If @param runs_sorted is set, each cluster consists of
+  * sorted runs that start at the respective @param run_offsets and is sorted by merging these.
+  **/
+  void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters,
+                      const std::vector<std::vector<size_t>>& run_offsets, const bool runs_sorted) {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    jobs.reserve(clusters->size());
+    for (auto cluster_id = size_t{0}; cluster_id < clusters->size(); ++cluster_id) {
+      auto& cluster = *(*clusters)[cluster_id];
+      if (cluster.size() < 2) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&cluster, &run_offsets, runs_sorted, cluster_id] {
+        if (runs_sorted) {
+          _merge_runs(cluster, run_offsets[cluster_id]);
+        } else {
+          std::sort(cluster.begin(), cluster.end(), [](auto& left, auto& right) { return left.value < right.value; });
+        }
+      }));
     }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   }
 
  public:
@@ -325,7 +480,12 @@ class RadixClusterSort {
   RadixClusterOutput<T> execute() {
     RadixClusterOutput<T> output;
 
-    // Sort the chunks of the input tables in the non-equi cases
+    // Sort the chunks of the input tables in the non-equi cases. Chunks that are sorted by the join column are never
+    // sorted again.
+    const auto left_chunks_sorted =
+        !_equi_case || ColumnMaterializer<T>::chunks_sorted_by(*_left_input_table, _left_column_id);
+    const auto right_chunks_sorted =
+        !_equi_case || ColumnMaterializer<T>::chunks_sorted_by(*_right_input_table, _right_column_id);
     ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
     ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
     auto [materialized_left_segments, null_rows_left, samples_left] =
@@ -339,22 +499,24 @@ class RadixClusterSort {
     // determined the new capacity from iterator: https://stackoverflow.com/a/35359472/1147726)
     samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
 
+    auto run_offsets_left = std::vector<std::vector<size_t>>{};
+    auto run_offsets_right = std::vector<std::vector<size_t>>{};
     if (_cluster_count == 1) {
-      output.clusters_left = _concatenate_chunks(materialized_left_segments);
-      output.clusters_right = _concatenate_chunks(materialized_right_segments);
+      output.clusters_left = _concatenate_chunks(materialized_left_segments, run_offsets_left);
+      output.clusters_right = _concatenate_chunks(materialized_right_segments, run_offsets_right);
     } else if (_equi_case) {
-      output.clusters_left = _radix_cluster(materialized_left_segments);
-      output.clusters_right = _radix_cluster(materialized_right_segments);
+      output.clusters_left = _radix_cluster(materialized_left_segments, run_offsets_left);
+      output.clusters_right = _radix_cluster(materialized_right_segments, run_offsets_right);
     } else {
-      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left);
+      auto result = _range_cluster(materialized_left_segments, materialized_right_segments, samples_left,
+                                   run_offsets_left, run_offsets_right);
       output.clusters_left = std::move(result.first);
       output.clusters_right = std::move(result.second);
     }
 
-    // Sort each cluster (right now std::sort -> but maybe can be replaced with
-    // an more efficient algorithm if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    // Sort each cluster. Clusters of sorted chunks consist of sorted runs, which only need to be merged.
+    _sort_clusters(output.clusters_left, run_offsets_left, left_chunks_sorted);
+    _sort_clusters(output.clusters_right, run_offsets_right, right_chunks_sorted);
 
     return output;
   }
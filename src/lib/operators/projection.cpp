@@ -1,13 +1,17 @@
 #include "projection.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "abstract_chunkwise_operator.hpp"
+#include "expression/evaluation/compiled_expression.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -48,7 +52,15 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
 std::shared_ptr<const Table> Projection::_on_execute() {
   Timer timer;
 
-  const auto& input_table = *left_input_table();
+  // If the input is pipelined into this projection (see AbstractChunkwiseOperator), it is executed by this projection
+  // and never materialized. Each of its output chunks is evaluated in the job that produced it, while the chunk is
+  // still hot in the cache. The pipeline output table only holds the chunks that are currently being evaluated.
+  const auto pipelined_input = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(mutable_left_input());
+  const auto input_is_pipelined = pipelined_input && pipelined_input->is_pipelined;
+  const auto pipeline_output_table = input_is_pipelined ? pipelined_input->make_pipeline_output_table() : nullptr;
+  const auto input_table_ptr =
+      input_is_pipelined ? std::shared_ptr<const Table>{pipeline_output_table} : left_input_table();
+  const auto& input_table = *input_table_ptr;
 
   // Determine the type of the output table: If no input columns are forwarded, i.e., all output columns are newly
   // generated, the output type is always TableType::Data and all segments are ValueSegments. Otherwise, the output type
@@ -85,8 +97,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   });
   const auto output_table_type = forwards_any_columns ? input_table.type() : TableType::Data;
 
-  // NULLability information is either forwarded or collected during the execution of the ExpressionEvaluator
-  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  // NULLability information is either forwarded or collected during the execution of the ExpressionEvaluator. As
+  // pipelined chunks are evaluated concurrently, the flags are atomic.
+  auto column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
 
   // Uncorrelated subqueries need to be evaluated exactly once, not once per chunk.
   const auto uncorrelated_subquery_results =
@@ -97,23 +110,38 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     step_performance_data.set_step_runtime(OperatorSteps::UncorrelatedSubqueries, timer.lap());
   }
 
+  // Numeric expressions are evaluated by fused kernels if possible, see CompiledExpression. The others fall back to the
+  // ExpressionEvaluator.
+  auto compiled_expressions = std::vector<std::shared_ptr<const CompiledExpression>>(expressions.size());
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    if (expressions[column_id]->type == ExpressionType::PQPColumn) continue;
+    compiled_expressions[column_id] = CompiledExpression::compile(*expressions[column_id], input_table);
+  }
+
   // Perform the actual projection on a per-chunk level. `output_segments_by_chunk` will contain both forwarded and
   // newly generated columns. In the upcoming loop, we do not yet deal with the projection_result_table indirection
-  // described above.
-  auto output_segments_by_chunk = std::vector<Segments>(input_table.chunk_count());
+  // described above. Chunks that were entirely filtered out by a pipelined input are not evaluated and keep a nullptr
+  // in `input_chunks`.
+  const auto chunk_count = input_table.chunk_count();
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
+  auto input_chunks = std::vector<std::shared_ptr<const Chunk>>(chunk_count);
 
   auto forwarding_cost = std::chrono::nanoseconds{};
   auto expression_evaluator_cost = std::chrono::nanoseconds{};
+  auto cost_mutex = std::mutex{};
+
+  const auto evaluate_chunk = [&](const ChunkID chunk_id) {
+    auto chunk_timer = Timer{};
+    auto chunk_forwarding_cost = std::chrono::nanoseconds{};
+    auto chunk_expression_evaluator_cost = std::chrono::nanoseconds{};
 
-  const auto chunk_count = input_table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     auto output_segments = Segments{expressions.size()};
 
     // The ExpressionEvaluator is created once per chunk so that evaluated sub-expressions can be reused across columns.
-    ExpressionEvaluator evaluator(left_input_table(), chunk_id, uncorrelated_subquery_results);
+    ExpressionEvaluator evaluator(input_table_ptr, chunk_id, uncorrelated_subquery_results);
 
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
       const auto& expression = expressions[column_id];
@@ -122,24 +150,41 @@ std::shared_ptr<const Table> Projection::_on_execute() {
         // Forward input column if possible
         const auto& pqp_column_expression = static_cast<const PQPColumnExpression&>(*expression);
         output_segments[column_id] = input_chunk->get_segment(pqp_column_expression.column_id);
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression.column_id);
-        forwarding_cost += timer.lap();
+        if (input_table.column_is_nullable(pqp_column_expression.column_id)) column_is_nullable[column_id] = true;
+        chunk_forwarding_cost += chunk_timer.lap();
       } else {
         // Newly generated column - the expression needs to be evaluated
-        auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+        const auto& compiled_expression = compiled_expressions[column_id];
+        auto output_segment = compiled_expression ? compiled_expression->evaluate_to_segment(*input_chunk)
+                                                  : evaluator.evaluate_expression_to_segment(*expression);
+        if (output_segment->is_nullable()) column_is_nullable[column_id] = true;
 
         // Storing the result in output_segments means that the vector may contain both ReferenceSegments and
         // ValueSegments. We deal with this later.
         output_segments[column_id] = std::move(output_segment);
-        expression_evaluator_cost += timer.lap();
+        chunk_expression_evaluator_cost += chunk_timer.lap();
       }
     }
 
     output_segments_by_chunk[chunk_id] = std::move(output_segments);
+    input_chunks[chunk_id] = input_chunk;
+
+    const auto lock = std::lock_guard<std::mutex>{cost_mutex};
+    forwarding_cost += chunk_forwarding_cost;
+    expression_evaluator_cost += chunk_expression_evaluator_cost;
+  };
+
+  if (input_is_pipelined) {
+    pipelined_input->execute_as_pipeline(pipeline_output_table, evaluate_chunk);
+  } else {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      evaluate_chunk(chunk_id);
+    }
   }
 
+  // The evaluation is accounted for by the per-chunk costs
+  timer.lap();
+
   step_performance_data.set_step_runtime(OperatorSteps::ForwardUnmodifiedColumns, forwarding_cost);
   step_performance_data.set_step_runtime(OperatorSteps::EvaluateNewColumns, expression_evaluator_cost);
 
@@ -165,8 +210,8 @@ std::shared_ptr<const Table> Projection::_on_execute() {
                                                       std::nullopt, input_table.uses_mvcc());
   }
 
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count};
-  auto projection_result_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count};
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(chunk_count);
 
   // Create a mapping from input columns to output columns for future use. This is necessary as the order may have been
   // changed. The mapping only contains input column IDs that are forwarded to the output without modfications.
@@ -182,11 +227,14 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   // Create the actual chunks, and, if needed, fill the projection_result_table. Also set MVCC and
   // individually_sorted_by information as needed.
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto input_chunk = input_table.get_chunk(chunk_id);
-    Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    const auto& input_chunk = input_chunks[chunk_id];
+    if (!input_chunk) continue;
 
+    // The chunks of the projection_result_table correspond to the output chunks, which skip the chunks that were
+    // filtered out by a pipelined input
+    const auto output_chunk_id = ChunkID{static_cast<ChunkID::base_type>(output_chunks.size())};
     auto projection_result_segments = Segments{};
-    const auto entire_chunk_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size());
+    const auto entire_chunk_pos_list = std::make_shared<EntireChunkPosList>(output_chunk_id, input_chunk->size());
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
       // Turn newly generated ValueSegments into ReferenceSegments, if needed
       if (expressions[column_id]->type != ExpressionType::PQPColumn && output_table_type == TableType::References) {
@@ -238,7 +286,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       }
     }
 
-    output_chunks[chunk_id] = chunk;
+    output_chunks.emplace_back(chunk);
   }
 
   step_performance_data.set_step_runtime(OperatorSteps::BuildOutput, timer.lap());
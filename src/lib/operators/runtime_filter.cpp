@@ -0,0 +1,152 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RuntimeFilter::RuntimeFilter(const std::shared_ptr<const AbstractOperator>& source_operator,
+                             const ColumnID source_column_id, const ColumnID target_column_id)
+    : _source_operator(source_operator), _source_column_id(source_column_id), _target_column_id(target_column_id) {}
+
+void RuntimeFilter::build() {
+  std::call_once(_build_flag, [&]() {
+    const auto source_table = _source_operator->get_output();
+    Assert(source_table, "Source of the RuntimeFilter has not been executed");
+
+    _data_type = source_table->column_data_type(_source_column_id);
+
+    // The row count is an upper bound of the number of distinct values
+    _bloom_filter = BloomFilter{source_table->row_count()};
+
+    resolve_data_type(_data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto min_max = std::optional<std::pair<ColumnDataType, ColumnDataType>>{};
+      const auto chunk_count = source_table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = source_table->get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(_source_column_id), [&](const auto& position) {
+          if (position.is_null()) return;
+
+          const auto& value = position.value();
+          _bloom_filter.insert(std::hash<ColumnDataType>{}(value));
+          if (!min_max) {
+            min_max.emplace(value, value);
+          } else {
+            min_max->first = std::min(min_max->first, value);
+            min_max->second = std::max(min_max->second, value);
+          }
+        });
+      }
+
+      if (min_max) _min_max.emplace(AllTypeVariant{min_max->first}, AllTypeVariant{min_max->second});
+    });
+
+    // The filter does not need the source anymore. Its output is cleared by the OperatorTasks once the join is done.
+    _source_operator = nullptr;
+  });
+}
+
+ColumnID RuntimeFilter::target_column_id() const { return _target_column_id; }
+
+bool RuntimeFilter::can_prune(const Chunk& chunk, const ColumnID column_id) const {
+  if (!_min_max) return true;
+
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (pruning_statistics && _can_prune(*(*pruning_statistics)[column_id])) return true;
+
+  // A chunk whose dictionary does not contain any value that passes the filter can be pruned. Probing the dictionary
+  // stops at the first value that passes, so chunks that cannot be pruned are usually detected early.
+  const auto segment = chunk.get_segment(column_id);
+  auto can_prune = false;
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+    if (!dictionary_segment) return;
+
+    const auto& min = boost::get<ColumnDataType>(_min_max->first);
+    const auto& max = boost::get<ColumnDataType>(_min_max->second);
+    const auto& dictionary = *dictionary_segment->dictionary();
+    can_prune = std::none_of(dictionary.cbegin(), dictionary.cend(), [&](const auto& value) {
+      return value >= min && value <= max && _bloom_filter.contains(std::hash<ColumnDataType>{}(value));
+    });
+  });
+
+  return can_prune;
+}
+
+void RuntimeFilter::filter(const std::shared_ptr<const AbstractSegment>& segment, RowIDPosList& matches) const {
+  if (!_min_max) {
+    matches.clear();
+    return;
+  }
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& min = boost::get<ColumnDataType>(_min_max->first);
+    const auto& max = boost::get<ColumnDataType>(_min_max->second);
+    const auto segment_accessor = create_segment_accessor<ColumnDataType>(segment);
+
+    const auto matches_end = std::remove_if(matches.begin(), matches.end(), [&](const auto& row_id) {
+      const auto value = segment_accessor->access(row_id.chunk_offset);
+      return !value || *value < min || *value > max || !_bloom_filter.contains(std::hash<ColumnDataType>{}(*value));
+    });
+    matches.erase(matches_end, matches.end());
+  });
+}
+
+std::string RuntimeFilter::description() const {
+  std::stringstream stream;
+  stream << "Runtime filter on column #" << _target_column_id;
+  return stream.str();
+}
+
+bool RuntimeFilter::_can_prune(const BaseAttributeStatistics& base_segment_statistics) const {
+  auto can_prune = false;
+
+  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+
+    // Range filters are only available for arithmetic (non-string) types
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (segment_statistics.range_filter &&
+          segment_statistics.range_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min_max->first,
+                                                            _min_max->second)) {
+        can_prune = true;
+      }
+    }
+
+    if (segment_statistics.min_max_filter &&
+        segment_statistics.min_max_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min_max->first,
+                                                            _min_max->second)) {
+      can_prune = true;
+    }
+  });
+
+  return can_prune;
+}
+
+}  // namespace opossum
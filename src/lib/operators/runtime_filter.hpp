@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class AbstractSegment;
+class BaseAttributeStatistics;
+class Chunk;
+
+// The input of a JoinHash whose join keys are published as a RuntimeFilter
+enum class RuntimeFilterSource { LeftInput, RightInput };
+
+/**
+ * Runtime filter for sideways information passing: The join keys of one join input (the source) are summarized in a
+ * Bloom filter and a min/max range. The TableScans and GetTables that produce the other join input (the targets) use
+ * the filter to drop rows and entire chunks that cannot find a join partner, before these rows reach the join.
+ *
+ * This is only valid for join modes that discard the unmatched rows of the target input, i.e., Inner and Semi joins.
+ * As the targets have to wait for the source input to be executed, the filters are set up when the OperatorTasks are
+ * created (see OperatorTask::make_tasks_from_operator), which also adds the necessary dependencies. Operators that are
+ * executed without OperatorTasks are not filtered.
+ *
+ * The filter is built lazily by the first target that is executed. NULLs never pass the filter.
+ */
+class RuntimeFilter {
+ public:
+  RuntimeFilter(const std::shared_ptr<const AbstractOperator>& source_operator, const ColumnID source_column_id,
+                const ColumnID target_column_id);
+
+  // Builds the filter from the output of the source operator, which has to be executed. Thread-safe, only the first
+  // call builds the filter.
+  void build();
+
+  ColumnID target_column_id() const;
+
+  // Returns true if no value of the target column in @param chunk can pass the filter, based on the chunk's pruning
+  // statistics or, for dictionary-encoded segments, the dictionary. @param column_id is the column of the target in
+  // the chunk, which may differ from target_column_id() if the target operator prunes columns.
+  bool can_prune(const Chunk& chunk, const ColumnID column_id) const;
+
+  // Removes the positions from @param matches whose value in @param segment cannot pass the filter. The chunk offsets
+  // of @param matches refer to @param segment.
+  void filter(const std::shared_ptr<const AbstractSegment>& segment, RowIDPosList& matches) const;
+
+  std::string description() const;
+
+ private:
+  bool _can_prune(const BaseAttributeStatistics& base_segment_statistics) const;
+
+  std::shared_ptr<const AbstractOperator> _source_operator;
+  const ColumnID _source_column_id;
+  const ColumnID _target_column_id;
+
+  std::once_flag _build_flag;
+  DataType _data_type{DataType::Null};
+  BloomFilter _bloom_filter;
+
+  // Not set if the source does not contain any non-NULL value
+  std::optional<std::pair<AllTypeVariant, AllTypeVariant>> _min_max;
+};
+
+}  // namespace opossum
@@ -1,5 +1,14 @@
 #include "sort.hpp"
 
+#include <cstring>
+#include <optional>
+#include <queue>
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "memory/spill_file.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/timer.hpp"
 
@@ -215,22 +224,391 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   return output_table;
 }
 
+// Keys wider than this (which only happens for long strings) make the key buffer too large to pay off. In that case,
+// the Sort operator falls back to sorting column by column.
+constexpr auto MAX_NORMALIZED_KEY_WIDTH = size_t{128};
+
+// Size of the blocks in which spilled runs are written and read
+constexpr auto SPILL_BLOCK_SIZE = size_t{1} << 20;
+
+// Describes where and how a sort column is stored within a normalized key. Nullable columns are prefixed with one
+// byte that is 0 for NULL and 1 otherwise, so that NULLs come first independent of the sort mode (see SortImpl).
+struct NormalizedKeyColumn {
+  ColumnID column_id;
+  DataType data_type;
+  SortMode sort_mode;
+  bool nullable;
+  size_t offset;
+  size_t value_width;
+};
+
+template <typename UnsignedType>
+void write_big_endian(unsigned char* destination, UnsignedType value) {
+  for (auto byte_index = sizeof(UnsignedType); byte_index > 0; --byte_index) {
+    destination[byte_index - 1] = static_cast<unsigned char>(value & 0xFF);
+    value >>= 8;
+  }
+}
+
+// Writes the memcmp-comparable representation of value to destination. Signed integers get their sign bit flipped,
+// floating point numbers get all bits flipped if they are negative and only the sign bit otherwise. Strings are padded
+// with zeros to value_width - 1 bytes and followed by their length, so that "a" < "a\0" < "ab" still holds.
+template <typename ColumnDataType>
+void write_normalized_value(const ColumnDataType& value, unsigned char* destination, const size_t value_width) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    std::memcpy(destination, value.data(), value.size());
+    destination[value_width - 1] = static_cast<unsigned char>(value.size());
+  } else if constexpr (std::is_integral_v<ColumnDataType>) {
+    using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    write_big_endian(destination, static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ SIGN_BIT));
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    // -0.0 and 0.0 compare as equal and need to have the same key
+    const auto normalized_zero = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+    auto bits = UnsignedType{};
+    std::memcpy(&bits, &normalized_zero, sizeof(bits));
+    bits = (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+    write_big_endian(destination, bits);
+  }
+}
+
+// Layout of the normalized keys of a table. The keys of all rows are stored in input order, each chunk starting at
+// its offset in chunk_row_offsets (which has an additional entry for the total row count).
+struct NormalizedKeyLayout {
+  std::vector<NormalizedKeyColumn> columns;
+  size_t key_width;
+  std::vector<size_t> chunk_row_offsets;
+};
+
+// Returns std::nullopt if the keys would exceed MAX_NORMALIZED_KEY_WIDTH
+std::optional<NormalizedKeyLayout> create_normalized_key_layout(
+    const std::shared_ptr<const Table>& input_table, const std::vector<SortColumnDefinition>& sort_definitions) {
+  const auto chunk_count = input_table->chunk_count();
+  const auto sort_column_count = sort_definitions.size();
+
+  auto layout = NormalizedKeyLayout{{}, 0, std::vector<size_t>(chunk_count + 1)};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    layout.chunk_row_offsets[chunk_id + 1] = layout.chunk_row_offsets[chunk_id] + chunk->size();
+  }
+
+  // Strings are stored with a fixed width, which requires knowing the longest string of each sort column first
+  auto max_string_lengths_by_chunk =
+      std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(sort_column_count));
+  auto has_string_column = false;
+  for (const auto& sort_definition : sort_definitions) {
+    if (input_table->column_data_type(sort_definition.column) == DataType::String) has_string_column = true;
+  }
+
+  if (has_string_column) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+          const auto column_id = sort_definitions[sort_column_index].column;
+          if (input_table->column_data_type(column_id) != DataType::String) continue;
+
+          auto& max_string_length = max_string_lengths_by_chunk[chunk_id][sort_column_index];
+          segment_iterate<pmr_string>(*chunk->get_segment(column_id), [&](const auto& position) {
+            if (!position.is_null()) max_string_length = std::max(max_string_length, position.value().size());
+          });
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  layout.columns.reserve(sort_column_count);
+  for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+    const auto& sort_definition = sort_definitions[sort_column_index];
+    const auto data_type = input_table->column_data_type(sort_definition.column);
+    const auto nullable = input_table->column_is_nullable(sort_definition.column);
+
+    auto value_width = size_t{0};
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        auto max_string_length = size_t{0};
+        for (const auto& max_string_lengths : max_string_lengths_by_chunk) {
+          max_string_length = std::max(max_string_length, max_string_lengths[sort_column_index]);
+        }
+        // One additional byte for the length of the string
+        value_width = max_string_length + 1;
+      } else {
+        value_width = sizeof(ColumnDataType);
+      }
+    });
+
+    const auto offset = layout.key_width + (nullable ? 1 : 0);
+    layout.columns.emplace_back(NormalizedKeyColumn{sort_definition.column, data_type, sort_definition.sort_mode,
+                                                    nullable, offset, value_width});
+    layout.key_width = offset + value_width;
+    if (layout.key_width > MAX_NORMALIZED_KEY_WIDTH) return std::nullopt;
+  }
+
+  return layout;
+}
+
+// Writes the keys of all rows of chunk to chunk_keys, which has to be zeroed
+void write_normalized_keys(const Chunk& chunk, const NormalizedKeyLayout& layout, unsigned char* const chunk_keys) {
+  const auto chunk_size = chunk.size();
+  const auto key_width = layout.key_width;
+
+  for (const auto& key_column : layout.columns) {
+    resolve_data_type(key_column.data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(*chunk.get_segment(key_column.column_id), [&](const auto& position) {
+        auto* const key = chunk_keys + position.chunk_offset() * key_width;
+        if (position.is_null()) return;  // The NULL byte and the value stay zeroed
+
+        if (key_column.nullable) key[key_column.offset - 1] = 1;
+        write_normalized_value(position.value(), key + key_column.offset, key_column.value_width);
+      });
+
+      if (key_column.sort_mode == SortMode::Descending) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          auto* const key = chunk_keys + chunk_offset * key_width;
+          if (key_column.nullable && key[key_column.offset - 1] == 0) continue;
+          for (auto byte_index = size_t{0}; byte_index < key_column.value_width; ++byte_index) {
+            key[key_column.offset + byte_index] = ~key[key_column.offset + byte_index];
+          }
+        }
+      }
+    });
+  }
+}
+
+// Writes the keys of the chunks [first_chunk_id, end_chunk_id) to keys and sorts them into row_ids, both of which
+// start with the first of these chunks. Each chunk is sorted in its own JobTask, and the sorted chunks are then merged
+// pairwise. As chunks are ordered by their position in the input and std::merge prefers the first range for equal
+// keys, the sort is stable.
+template <typename KeyBuffer, typename RowIDs>
+void sort_chunks_by_normalized_keys(const Table& input_table, const NormalizedKeyLayout& layout,
+                                    const ChunkID first_chunk_id, const ChunkID end_chunk_id, KeyBuffer& keys,
+                                    RowIDs& row_ids) {
+  const auto key_width = layout.key_width;
+  const auto first_row_offset = layout.chunk_row_offsets[first_chunk_id];
+  const auto row_count = layout.chunk_row_offsets[end_chunk_id] - first_row_offset;
+
+  const auto key_of = [&](const RowID& row_id) {
+    const auto row_offset = layout.chunk_row_offsets[row_id.chunk_id] - first_row_offset + row_id.chunk_offset;
+    return keys.data() + row_offset * key_width;
+  };
+  const auto key_less = [&](const RowID& lhs, const RowID& rhs) {
+    return std::memcmp(key_of(lhs), key_of(rhs), key_width) < 0;
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(end_chunk_id - first_chunk_id);
+  for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table.get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+      const auto chunk_row_offset = layout.chunk_row_offsets[chunk_id] - first_row_offset;
+      write_normalized_keys(*chunk, layout, keys.data() + chunk_row_offset * key_width);
+
+      const auto run_begin = row_ids.begin() + chunk_row_offset;
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        run_begin[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+      std::stable_sort(run_begin, run_begin + chunk_size, key_less);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Merge neighboring runs pairwise until a single run remains
+  auto run_bounds = std::vector<size_t>{0};
+  for (auto chunk_id = first_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+    const auto run_end = layout.chunk_row_offsets[chunk_id + 1] - first_row_offset;
+    if (run_end > run_bounds.back()) run_bounds.emplace_back(run_end);
+  }
+
+  auto merge_buffer = RowIDs{};
+  if (run_bounds.size() > 2) merge_buffer.resize(row_count);
+
+  while (run_bounds.size() > 2) {
+    const auto run_count = run_bounds.size() - 1;
+    auto merged_run_bounds = std::vector<size_t>{0};
+    merged_run_bounds.reserve(run_count / 2 + 2);
+
+    jobs.clear();
+    for (auto run_index = size_t{0}; run_index < run_count; run_index += 2) {
+      const auto begin = run_bounds[run_index];
+      const auto middle = run_bounds[run_index + 1];
+      const auto end = run_index + 1 < run_count ? run_bounds[run_index + 2] : middle;
+      merged_run_bounds.emplace_back(end);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, begin, middle, end]() {
+        std::merge(row_ids.begin() + begin, row_ids.begin() + middle, row_ids.begin() + middle, row_ids.begin() + end,
+                   merge_buffer.begin() + begin, key_less);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    std::swap(row_ids, merge_buffer);
+    run_bounds = std::move(merged_run_bounds);
+  }
+}
+
+// Sorts the input table by packing all sort columns into normalized keys. The returned PosList has the same semantics
+// as the one produced by SortImpl, i.e., it points into the input table.
+RowIDPosList sort_by_normalized_keys(const std::shared_ptr<const Table>& input_table,
+                                     const NormalizedKeyLayout& layout) {
+  const auto row_count = layout.chunk_row_offsets.back();
+  auto keys = std::vector<unsigned char>(row_count * layout.key_width);
+  auto row_ids = RowIDPosList(row_count);
+  sort_chunks_by_normalized_keys(*input_table, layout, ChunkID{0}, input_table->chunk_count(), keys, row_ids);
+  return row_ids;
+}
+
+// External variant of sort_by_normalized_keys for inputs whose keys do not fit into the memory budget. Consecutive
+// chunks are combined into runs that fit into half of the remaining budget. Each run is sorted in memory and written
+// to a SpillFile as a sequence of (key, RowID) records. Finally, the runs are merged, reading each run in large blocks
+// that share the other half of the budget. Only the resulting PosList, which is required for the output anyway, is
+// kept in memory completely.
+RowIDPosList sort_by_spilled_normalized_keys(const std::shared_ptr<const Table>& input_table,
+                                             const NormalizedKeyLayout& layout,
+                                             BudgetedMemoryResource& memory_resource) {
+  const auto chunk_count = input_table->chunk_count();
+  const auto& chunk_row_offsets = layout.chunk_row_offsets;
+  const auto row_count = chunk_row_offsets.back();
+  const auto key_width = layout.key_width;
+  const auto record_width = key_width + sizeof(RowID);
+
+  auto spill_file = SpillFile{};
+
+  // Offset in the spill file and first row of each run, plus an additional entry for the end
+  auto run_file_offsets = std::vector<size_t>{};
+  auto run_row_offsets = std::vector<size_t>{};
+
+  // The result PosList is allocated before the runs are sorted, so that it is accounted for when sizing them
+  auto row_ids = RowIDPosList(row_count);
+  const auto run_budget = std::max(memory_resource.available_bytes() / 2, record_width);
+
+  auto first_chunk_id = ChunkID{0};
+  while (first_chunk_id < chunk_count) {
+    // Each run contains at least one chunk
+    auto end_chunk_id = ChunkID{first_chunk_id + 1};
+    while (end_chunk_id < chunk_count &&
+           (chunk_row_offsets[end_chunk_id + 1] - chunk_row_offsets[first_chunk_id]) * record_width <= run_budget) {
+      ++end_chunk_id;
+    }
+
+    const auto run_row_count = chunk_row_offsets[end_chunk_id] - chunk_row_offsets[first_chunk_id];
+    auto keys = pmr_vector<unsigned char>(run_row_count * key_width);
+    auto run_row_ids = pmr_vector<RowID>(run_row_count);
+    sort_chunks_by_normalized_keys(*input_table, layout, first_chunk_id, end_chunk_id, keys, run_row_ids);
+
+    // Write the records in blocks of about SPILL_BLOCK_SIZE bytes
+    const auto first_row_offset = chunk_row_offsets[first_chunk_id];
+    const auto block_row_count = std::max(SPILL_BLOCK_SIZE / record_width, size_t{1});
+    auto block = std::vector<unsigned char>(std::min(block_row_count, run_row_count) * record_width);
+
+    run_file_offsets.emplace_back(spill_file.size());
+    run_row_offsets.emplace_back(first_row_offset);
+    for (auto block_begin = size_t{0}; block_begin < run_row_count; block_begin += block_row_count) {
+      const auto block_end = std::min(block_begin + block_row_count, run_row_count);
+      for (auto row_index = block_begin; row_index < block_end; ++row_index) {
+        const auto& row_id = run_row_ids[row_index];
+        auto* const record = block.data() + (row_index - block_begin) * record_width;
+        const auto key_index = chunk_row_offsets[row_id.chunk_id] - first_row_offset + row_id.chunk_offset;
+        std::memcpy(record, keys.data() + key_index * key_width, key_width);
+        std::memcpy(record + key_width, &row_id, sizeof(RowID));
+      }
+      spill_file.append(block.data(), (block_end - block_begin) * record_width);
+    }
+
+    first_chunk_id = end_chunk_id;
+  }
+  run_row_offsets.emplace_back(row_count);
+  memory_resource.add_spilled_bytes(spill_file.size());
+
+  // Merge the runs. Each run is read in blocks of block_row_count records. Ties are broken by the index of the run,
+  // which keeps the sort stable as runs are ordered by their position in the input.
+  const auto run_count = run_file_offsets.size();
+  const auto merge_budget = std::max(memory_resource.available_bytes() / 2, record_width * run_count);
+  const auto max_block_row_count = std::max(SPILL_BLOCK_SIZE / record_width, size_t{1});
+  const auto block_row_count = std::clamp(merge_budget / (record_width * run_count), size_t{1}, max_block_row_count);
+
+  struct RunCursor {
+    std::vector<unsigned char> block;
+    size_t next_row;
+    size_t block_row;
+    size_t block_row_count;
+  };
+  auto cursors = std::vector<RunCursor>(run_count);
+
+  const auto load_block = [&](const size_t run_index) {
+    auto& cursor = cursors[run_index];
+    const auto run_begin = run_row_offsets[run_index];
+    const auto remaining_row_count = run_row_offsets[run_index + 1] - run_begin - cursor.next_row;
+    cursor.block_row_count = std::min(block_row_count, remaining_row_count);
+    cursor.block_row = 0;
+    cursor.block.resize(cursor.block_row_count * record_width);
+    spill_file.read(run_file_offsets[run_index] + cursor.next_row * record_width, cursor.block.size(),
+                    cursor.block.data());
+    cursor.next_row += cursor.block_row_count;
+  };
+
+  const auto record_of = [&](const size_t run_index) {
+    const auto& cursor = cursors[run_index];
+    return cursor.block.data() + cursor.block_row * record_width;
+  };
+
+  // std::priority_queue is a max-heap, so the comparator returns true if lhs comes after rhs
+  const auto comes_after = [&](const size_t lhs, const size_t rhs) {
+    const auto comparison = std::memcmp(record_of(lhs), record_of(rhs), key_width);
+    return comparison > 0 || (comparison == 0 && lhs > rhs);
+  };
+  auto heap = std::priority_queue<size_t, std::vector<size_t>, decltype(comes_after)>{comes_after};
+
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    cursors[run_index].next_row = 0;
+    load_block(run_index);
+    if (cursors[run_index].block_row_count > 0) heap.push(run_index);
+  }
+
+  for (auto output_index = size_t{0}; output_index < row_count; ++output_index) {
+    const auto run_index = heap.top();
+    heap.pop();
+
+    auto& cursor = cursors[run_index];
+    std::memcpy(&row_ids[output_index], record_of(run_index) + key_width, sizeof(RowID));
+
+    ++cursor.block_row;
+    if (cursor.block_row == cursor.block_row_count) load_block(run_index);
+    if (cursor.block_row < cursor.block_row_count) heap.push(run_index);
+  }
+
+  return row_ids;
+}
+
 }  // namespace
 
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
-           const ChunkOffset output_chunk_size, const ForceMaterialization force_materialization)
+           const ChunkOffset output_chunk_size, const ForceMaterialization force_materialization,
+           const Strategy strategy)
     : AbstractReadOnlyOperator(OperatorType::Sort, in, nullptr,
                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
       _sort_definitions(sort_definitions),
       _output_chunk_size(output_chunk_size),
-      _force_materialization(force_materialization) {
+      _force_materialization(force_materialization),
+      _strategy(strategy) {
   DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
 }
 
 const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
+Sort::Strategy Sort::strategy() const { return _strategy; }
+
 const std::string& Sort::name() const {
   static const auto name = std::string{"Sort"};
   return name;
@@ -239,7 +617,8 @@ const std::string& Sort::name() const {
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization);
+  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization,
+                                _strategy);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -269,16 +648,37 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   // ReferenceSegments.
   auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
 
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
+  // sort_by_normalized_keys sorts by all columns at once. If the keys would be too wide, we sort column by column
+  // instead. If the query has a memory budget that does not suffice for an in-memory sort (estimated by the PosLists
+  // that are needed for every strategy), the keys are sorted in runs that are spilled to disk, independent of the
+  // strategy.
+  auto* const memory_resource = BudgetedMemoryResource::current();
+  const auto row_count = input_table->row_count();
+  if (_strategy == Strategy::NormalizedKeys ||
+      (memory_resource && !memory_resource->fits(row_count * 2 * sizeof(RowID)))) {
+    const auto key_layout = create_normalized_key_layout(input_table, _sort_definitions);
+    if (key_layout) {
+      const auto in_memory_bytes = row_count * (key_layout->key_width + 2 * sizeof(RowID));
+      if (memory_resource && !memory_resource->fits(in_memory_bytes)) {
+        previously_sorted_pos_list = sort_by_spilled_normalized_keys(input_table, *key_layout, *memory_resource);
+      } else if (_strategy == Strategy::NormalizedKeys) {
+        previously_sorted_pos_list = sort_by_normalized_keys(input_table, *key_layout);
+      }
+    }
+  }
 
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+  if (!previously_sorted_pos_list) {
+    for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
+      const auto& sort_definition = _sort_definitions[sort_step];
+      const auto data_type = input_table->column_data_type(sort_definition.column);
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
-    });
+      resolve_data_type(data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
+        previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+      });
+    }
   }
 
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
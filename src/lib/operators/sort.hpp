@@ -18,19 +18,35 @@ namespace opossum {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ *
+ * Two strategies are available:
+ *  - ColumnByColumn sorts the table once per sort column, starting with the least significant one, using a
+ *    single-threaded std::stable_sort for each pass.
+ *  - NormalizedKeys packs all sort columns of a row into a single binary key that can be compared with memcmp (NULLs
+ *    first, descending columns inverted). Each input chunk is sorted in its own JobTask and the sorted runs are then
+ *    merged pairwise in parallel. If the keys would get too wide (i.e., for long strings), this falls back to
+ *    ColumnByColumn.
+ *
+ * If the query has a memory budget (see BudgetedMemoryResource) and the sort would exceed it, the normalized keys are
+ * sorted in runs that fit into the budget, spilled to disk, and merged from there, independent of the strategy.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   enum class ForceMaterialization : bool { Yes = true, No = false };
 
+  enum class Strategy : uint8_t { ColumnByColumn, NormalizedKeys };
+
   enum class OperatorSteps : uint8_t { Sort, WriteOutput };
 
   Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
        const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE,
-       const ForceMaterialization force_materialization = ForceMaterialization::No);
+       const ForceMaterialization force_materialization = ForceMaterialization::No,
+       const Strategy strategy = Strategy::ColumnByColumn);
 
   const std::vector<SortColumnDefinition>& sort_definitions() const;
 
+  Strategy strategy() const;
+
   const std::string& name() const override;
 
  protected:
@@ -49,6 +65,7 @@ class Sort : public AbstractReadOnlyOperator {
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
+  const Strategy _strategy;
 };
 
 }  // namespace opossum
@@ -1,8 +1,9 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -19,11 +20,9 @@
 #include "expression/is_null_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
-#include "hyrise.hpp"
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/job_task.hpp"
+#include "statistics/base_attribute_statistics.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
@@ -42,7 +41,7 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<PerformanceData>()},
+    : AbstractChunkwiseOperator{OperatorType::TableScan, in, nullptr, std::make_unique<PerformanceData>()},
       _predicate(predicate) {}
 
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const { return _predicate; }
@@ -60,6 +59,11 @@ std::string TableScan::description(DescriptionMode description_mode) const {
   stream << name() << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  if (runtime_filter) {
+    stream << separator << runtime_filter->description();
+  } else if (!_runtime_filter_description.empty()) {
+    stream << separator << _runtime_filter_description;
+  }
 
   return stream.str();
 }
@@ -78,129 +82,161 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
   return std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy());
 }
 
-std::shared_ptr<const Table> TableScan::_on_execute() {
-  const auto in_table = left_input_table();
-
-  _impl = create_impl();
+void TableScan::_on_prepare_chunks(const std::shared_ptr<const Table>& input_table) {
+  _impl = _create_impl(input_table);
   _impl_description = _impl->description();
 
-  std::mutex output_mutex;
-
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
-
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
-
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
-
-  const auto chunk_count = in_table->chunk_count();
-  for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-    const auto chunk_in = in_table->get_chunk(chunk_id);
-    Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      Segments out_segments;
-      out_segments.reserve(in_table->column_count());
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
-       */
-      auto keep_chunk_sort_order = true;
-      if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
-          // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-            out_segments.emplace_back(segment_in);
-          }
-        } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-
-            auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-            DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-            const auto pos_list_in = ref_segment_in->pos_list();
-
-            const auto table_out = ref_segment_in->referenced_table();
-            const auto column_id_out = ref_segment_in->referenced_column_id();
-
-            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-            if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              size_t offset = 0;
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
-            }
-
-            const auto ref_segment_out =
-                std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-            out_segments.push_back(ref_segment_out);
-          }
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
+  _excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
+
+  // The ChunkPruningRule only prunes chunks for predicates whose values are known when the query is optimized. The
+  // values of correlated parameters (which change with every execution of a correlated subquery) and the results of
+  // uncorrelated subqueries are only known now. If the impl compares a single column to such values, we check them
+  // against the pruning statistics of each chunk before scanning it.
+  _pruning_predicate.reset();
+  const auto has_execution_time_values =
+      expression_contains_correlated_parameter(_predicate) ||
+      std::any_of(_predicate->arguments.cbegin(), _predicate->arguments.cend(), [](const auto& argument) {
+        return std::dynamic_pointer_cast<PQPSubqueryExpression>(argument) != nullptr;
+      });
+  if (has_execution_time_values) {
+    if (const auto* column_vs_value_impl = dynamic_cast<const ColumnVsValueTableScanImpl*>(_impl.get())) {
+      _pruning_predicate = OperatorScanPredicate{
+          column_vs_value_impl->column_id(), column_vs_value_impl->predicate_condition, column_vs_value_impl->value};
+    } else if (const auto* between_impl = dynamic_cast<const ColumnBetweenTableScanImpl*>(_impl.get())) {
+      _pruning_predicate = OperatorScanPredicate{between_impl->column_id(), between_impl->predicate_condition,
+                                                 between_impl->left_value, between_impl->right_value};
+    }
+  }
 
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+  if (runtime_filter) runtime_filter->build();
+}
 
-        for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
-          const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
+std::shared_ptr<Chunk> TableScan::_on_process_chunk(const std::shared_ptr<const Table>& in_table,
+                                                    const ChunkID chunk_id) {
+  if (_excluded_chunk_set.count(chunk_id)) return nullptr;
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+  Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+  if (_pruning_predicate) {
+    // Only stored (i.e., data) chunks have pruning statistics, see GetTable
+    const auto& pruning_statistics = chunk_in->pruning_statistics();
+    if (pruning_statistics) {
+      const auto& segment_statistics = (*pruning_statistics)[_pruning_predicate->column_id];
+      const auto value2 = _pruning_predicate->value2
+                              ? std::optional<AllTypeVariant>{boost::get<AllTypeVariant>(*_pruning_predicate->value2)}
+                              : std::nullopt;
+      if (segment_statistics &&
+          segment_statistics->does_not_contain(_pruning_predicate->predicate_condition,
+                                               boost::get<AllTypeVariant>(_pruning_predicate->value), value2)) {
+        ++_chunks_pruned_at_runtime;
+        return nullptr;
       }
+    }
+  }
 
-      const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
-      chunk->finalize();
-      if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
-        chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+  if (runtime_filter && runtime_filter->can_prune(*chunk_in, runtime_filter->target_column_id())) {
+    ++_chunks_pruned_at_runtime;
+    return nullptr;
+  }
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = _impl->scan_chunk(chunk_id);
+  if (runtime_filter && !matches_out->empty()) {
+    const auto match_count = matches_out->size();
+    runtime_filter->filter(chunk_in->get_segment(runtime_filter->target_column_id()), *matches_out);
+    _rows_filtered_at_runtime += match_count - matches_out->size();
+  }
+  if (matches_out->empty()) return nullptr;
+
+  Segments out_segments;
+  out_segments.reserve(in_table->column_count());
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
+   * the matches to construct the reference segments of the output. If it is a reference segment, we need to
+   * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
+   * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
+   * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
+   * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
+   * share their position list).
+   */
+  auto keep_chunk_sort_order = true;
+  if (in_table->type() == TableType::References) {
+    if (matches_out->size() == chunk_in->size()) {
+      // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+        out_segments.emplace_back(segment_in);
       }
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_chunks.emplace_back(chunk);
-    });
+    } else {
+      auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
 
-    jobs.push_back(job_task);
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+          if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
+          } else {
+            // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+            // reason is that several table scan implementations split the pos lists by chunks (see
+            // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+            // this does not affect all scan implementations, we chose the safe and defensive path for now.
+            keep_chunk_sort_order = false;
+          }
+
+          size_t offset = 0;
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            (*filtered_pos_list)[offset] = row_id;
+            ++offset;
+          }
+        }
+
+        const auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+
+    // If the entire chunk is matched, create an EntireChunkPosList instead
+    const auto output_pos_list = matches_out->size() == chunk_in->size()
+                                     ? static_cast<std::shared_ptr<AbstractPosList>>(
+                                           std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
+                                     : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+
+    for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
+      const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
   }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+  chunk->finalize();
+  if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
+    chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+  }
+  return chunk;
+}
 
+void TableScan::_on_finish_chunks() {
   auto& scan_performance_data = static_cast<PerformanceData&>(*performance_data);
   scan_performance_data.chunk_scans_skipped = _impl->chunk_scans_skipped;
   scan_performance_data.chunk_scans_sorted = _impl->chunk_scans_sorted;
-
-  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+  scan_performance_data.chunks_pruned_at_runtime = _chunks_pruned_at_runtime;
+  scan_performance_data.rows_filtered_at_runtime = _rows_filtered_at_runtime;
 }
 
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
@@ -237,7 +273,9 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
   return new_predicate;
 }
 
-std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const { return _create_impl(left_input_table()); }
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(const std::shared_ptr<const Table>& in_table) const {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -299,23 +337,23 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column of type string> LIKE <value of type string>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnLikeTableScanImpl>(in_table, left_column_expression->column_id,
                                                        predicate_condition, boost::get<pmr_string>(*right_value));
     }
 
     // Predicate pattern: <column of type T> <binary predicate_condition> <value of type T>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, left_column_expression->column_id,
                                                           predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), right_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, right_column_expression->column_id,
                                                           flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                            predicate_condition, right_column_expression->column_id);
     }
   }
@@ -324,7 +362,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(left_input_table(), left_column_expression->column_id,
+      return std::make_unique<ColumnIsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                          is_null_expression->predicate_condition);
     }
   }
@@ -368,15 +406,20 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column of type T> BETWEEN <value of type T> AND <value of type T>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(left_input_table(), left_column->column_id,
+      return std::make_unique<ColumnBetweenTableScanImpl>(in_table, left_column->column_id,
                                                           *lower_bound_value, *upper_bound_value, predicate_condition);
     }
   }
 
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(left_input_table(), resolved_predicate);
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate);
 }
 
-void TableScan::_on_cleanup() { _impl.reset(); }
+void TableScan::_on_cleanup() {
+  _impl.reset();
+  if (!runtime_filter) return;
+  _runtime_filter_description = runtime_filter->description();
+  runtime_filter.reset();
+}
 
 }  // namespace opossum
@@ -1,13 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "operator_scan_predicate.hpp"
+#include "runtime_filter.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -16,7 +20,7 @@ namespace opossum {
 
 class Table;
 
-class TableScan : public AbstractReadOnlyOperator {
+class TableScan : public AbstractChunkwiseOperator {
   friend class LQPTranslatorTest;
 
  public:
@@ -48,16 +52,32 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  /**
+   * @brief If set, rows that cannot find a join partner in a subsequent join are dropped after the scan.
+   *
+   * The filter is set when the OperatorTasks are created and the scan is delayed until the filter's source is
+   * executed, see RuntimeFilter. It is not copied by deep_copy() and reset after the execution, so that cached PQPs do
+   * not keep the Bloom filter alive.
+   */
+  std::shared_ptr<RuntimeFilter> runtime_filter;
+
   struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
     size_t chunk_scans_skipped{0};
     size_t chunk_scans_sorted{0};
+    size_t chunks_pruned_at_runtime{0};
+    size_t rows_filtered_at_runtime{0};
 
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
+      const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+      if (chunks_pruned_at_runtime > 0 || rows_filtered_at_runtime > 0) {
+        stream << separator << "At runtime: " << chunks_pruned_at_runtime << " chunk(s) pruned, "
+               << rows_filtered_at_runtime << " row(s) filtered. ";
+      }
+
       if (chunk_scans_skipped == 0 && chunk_scans_sorted == 0) {
         return;
       }
 
-      const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
       stream << separator << "Chunks: ";
       if (chunk_scans_skipped > 0) {
         stream << chunk_scans_skipped << " skipped";
@@ -73,7 +93,10 @@ class TableScan : public AbstractReadOnlyOperator {
   };
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  void _on_prepare_chunks(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> _on_process_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
+  void _on_finish_chunks() override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
@@ -90,12 +113,24 @@ class TableScan : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractExpression>& predicate);
 
  private:
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(const std::shared_ptr<const Table>& in_table) const;
+
   const std::shared_ptr<AbstractExpression> _predicate;
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
 
+  std::unordered_set<ChunkID> _excluded_chunk_set;
+
+  // Set if the predicate's values were not known when the ChunkPruningRule ran (see _on_prepare_chunks)
+  std::optional<OperatorScanPredicate> _pruning_predicate;
+  std::atomic<size_t> _chunks_pruned_at_runtime{0};
+  std::atomic<size_t> _rows_filtered_at_runtime{0};
+
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
+
+  // The description of the runtime filter, so that it is still available after the filter is reset in _on_cleanup()
+  std::string _runtime_filter_description;
 };
 
 }  // namespace opossum
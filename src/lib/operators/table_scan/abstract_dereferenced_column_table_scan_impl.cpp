@@ -34,6 +34,8 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
   return matches;
 }
 
+ColumnID AbstractDereferencedColumnTableScanImpl::column_id() const { return _column_id; }
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
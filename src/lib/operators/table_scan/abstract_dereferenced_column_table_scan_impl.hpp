@@ -29,6 +29,8 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
 
+  ColumnID column_id() const;
+
   const PredicateCondition predicate_condition;
 
  protected:
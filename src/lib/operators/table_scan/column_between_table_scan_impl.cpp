@@ -3,14 +3,17 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "expression/between_expression.hpp"
+#include "simd_scan_kernels.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "utils/assert.hpp"
 
@@ -159,6 +162,17 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  // SIMD-BP128 compressed attribute vectors are compared on their packed blocks instead of being decompressed value by
+  // value
+  const auto attribute_vector = segment.attribute_vector();
+  if (const auto* simd_bp128_vector = dynamic_cast<const SimdBp128Vector*>(attribute_vector.get());
+      simd_bp128_vector && !position_filter) {
+    auto bitmap = std::vector<uint64_t>(simd_scan_bitmap_word_count(simd_bp128_vector->size()));
+    simd_bp128_vector->scan_range_to_bitmap(lower_bound_value_id, upper_bound_value_id, bitmap.data());
+    append_bitmap_matches(bitmap.data(), simd_bp128_vector->size(), chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
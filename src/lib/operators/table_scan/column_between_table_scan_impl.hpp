@@ -39,7 +39,7 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
-  // Optimized scan on DictionarySegments
+  // Optimized scan on DictionarySegments. SIMD-BP128 attribute vectors are scanned without decompressing them.
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
@@ -4,12 +4,16 @@
 #include <utility>
 #include <vector>
 
+#include "simd_scan_kernels.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -55,6 +59,8 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 void ColumnVsValueTableScanImpl::_scan_generic_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  if (!position_filter && _scan_value_segment_with_simd_kernel(segment, chunk_id, matches)) return;
+
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     // Don't instantiate this for this for DictionarySegments and ReferenceSegments to save compile time.
     // DictionarySegments are handled in _scan_dictionary_segment()
@@ -146,6 +152,10 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (!position_filter && _scan_attribute_vector_with_simd_kernel(segment, search_value_id, chunk_id, matches)) {
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -166,6 +176,120 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+bool ColumnVsValueTableScanImpl::_scan_value_segment_with_simd_kernel(const AbstractSegment& segment,
+                                                                      const ChunkID chunk_id,
+                                                                      RowIDPosList& matches) const {
+  auto scanned = false;
+  resolve_data_type(segment.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment);
+      if (!value_segment) return;
+
+      const auto size = value_segment->size();
+      auto bitmap = std::vector<uint64_t>(simd_scan_bitmap_word_count(size));
+      scan_to_bitmap(value_segment->values().data(), size, predicate_condition, boost::get<ColumnDataType>(value),
+                     std::optional<ColumnDataType>{}, bitmap.data());
+
+      // The values of NULL rows are undefined. Clear their bits instead of comparing the NULL flags in the kernels.
+      if (value_segment->is_nullable()) {
+        const auto& null_values = value_segment->null_values();
+        for (auto chunk_offset = size_t{0}; chunk_offset < size; ++chunk_offset) {
+          bitmap[chunk_offset / 64] &= ~(static_cast<uint64_t>(null_values[chunk_offset]) << (chunk_offset % 64));
+        }
+      }
+
+      append_bitmap_matches(bitmap.data(), size, chunk_id, matches);
+      scanned = true;
+    }
+  });
+  return scanned;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_attribute_vector_with_simd_kernel(const BaseDictionarySegment& segment,
+                                                                         const ValueID search_value_id,
+                                                                         const ChunkID chunk_id,
+                                                                         RowIDPosList& matches) const {
+  // Same mapping as in _with_operator_for_dict_segment_scan. NULLs are stored as null_value_id(), which is greater
+  // than all other value ids. It has to be excluded explicitly for != and >=.
+  auto kernel_condition = PredicateCondition::Equals;
+  auto exclude_null_value_id = false;
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      break;
+    case PredicateCondition::NotEquals:
+      kernel_condition = PredicateCondition::NotEquals;
+      exclude_null_value_id = true;
+      break;
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      kernel_condition = PredicateCondition::LessThan;
+      break;
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      kernel_condition = PredicateCondition::GreaterThanEquals;
+      exclude_null_value_id = true;
+      break;
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  const auto attribute_vector = segment.attribute_vector();
+  const auto scan = [&](const auto& data) {
+    using AttributeType = typename std::decay_t<decltype(data)>::value_type;
+
+    // The early outs guarantee that search_value_id is a valid ValueID, which fits into the attribute vector's width
+    const auto search_value = static_cast<AttributeType>(search_value_id);
+    const auto excluded_value = exclude_null_value_id
+                                    ? std::optional<AttributeType>{static_cast<AttributeType>(segment.null_value_id())}
+                                    : std::nullopt;
+
+    auto bitmap = std::vector<uint64_t>(simd_scan_bitmap_word_count(data.size()));
+    scan_to_bitmap(data.data(), data.size(), kernel_condition, search_value, excluded_value, bitmap.data());
+    append_bitmap_matches(bitmap.data(), data.size(), chunk_id, matches);
+  };
+
+  if (const auto* vector = dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>*>(attribute_vector.get())) {
+    scan(vector->data());
+  } else if (const auto* vector = dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>*>(attribute_vector.get())) {
+    scan(vector->data());
+  } else if (const auto* vector = dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>*>(attribute_vector.get())) {
+    scan(vector->data());
+  } else if (const auto* vector = dynamic_cast<const SimdBp128Vector*>(attribute_vector.get())) {
+    // SIMD-BP128 vectors are scanned on their packed blocks, which compares value ids against a range. The ranges
+    // end at null_value_id() so that NULLs are excluded.
+    const auto search_value = static_cast<uint32_t>(search_value_id);
+    const auto null_value_id = static_cast<uint32_t>(segment.null_value_id());
+    auto bitmap = std::vector<uint64_t>(simd_scan_bitmap_word_count(vector->size()));
+    switch (kernel_condition) {
+      case PredicateCondition::Equals:
+        vector->scan_range_to_bitmap(search_value, search_value + 1, bitmap.data());
+        break;
+      case PredicateCondition::NotEquals: {
+        vector->scan_range_to_bitmap(0, search_value, bitmap.data());
+        auto upper_bitmap = std::vector<uint64_t>(bitmap.size());
+        vector->scan_range_to_bitmap(search_value + 1, null_value_id, upper_bitmap.data());
+        for (auto word_index = size_t{0}; word_index < bitmap.size(); ++word_index) {
+          bitmap[word_index] |= upper_bitmap[word_index];
+        }
+      } break;
+      case PredicateCondition::LessThan:
+        vector->scan_range_to_bitmap(0, search_value, bitmap.data());
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        vector->scan_range_to_bitmap(search_value, null_value_id, bitmap.data());
+        break;
+      default:
+        Fail("Unexpected predicate condition");
+    }
+    append_bitmap_matches(bitmap.data(), vector->size(), chunk_id, matches);
+  } else {
+    return false;
+  }
+  return true;
+}
+
 void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
                                                       RowIDPosList& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
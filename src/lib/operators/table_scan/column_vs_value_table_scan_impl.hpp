@@ -18,6 +18,9 @@ namespace opossum {
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
  * - Value segments are scanned sequentially
+ * - Unfiltered value segments of arithmetic types and dictionary segments with FixedSizeByteAligned attribute vectors
+ *   are scanned with the SIMD kernels of simd_scan_kernels.hpp, which produce a match bitmap. Attribute vectors
+ *   compressed with SIMD-BP128 are compared on their packed blocks (see SimdBp128Vector::scan_range_to_bitmap).
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
@@ -40,6 +43,12 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  // Both return false if the segment's data cannot be scanned with the SIMD kernels
+  bool _scan_value_segment_with_simd_kernel(const AbstractSegment& segment, const ChunkID chunk_id,
+                                            RowIDPosList& matches) const;
+  bool _scan_attribute_vector_with_simd_kernel(const BaseDictionarySegment& segment, const ValueID search_value_id,
+                                               const ChunkID chunk_id, RowIDPosList& matches) const;
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter,
                             const SortMode sort_mode) const;
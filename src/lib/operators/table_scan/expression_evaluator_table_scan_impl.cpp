@@ -9,11 +9,20 @@ ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
     const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression)
     : _in_table(in_table), _expression(expression) {
   _uncorrelated_subquery_results = ExpressionEvaluator::populate_uncorrelated_subquery_results_cache({expression});
+
+  if (expression->type == ExpressionType::Predicate || expression->type == ExpressionType::Logical) {
+    _compiled_expression = CompiledExpression::compile(*expression, *in_table);
+  }
 }
 
 std::string ExpressionEvaluatorTableScanImpl::description() const { return "ExpressionEvaluator"; }
 
 std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  if (_compiled_expression) {
+    return std::make_shared<RowIDPosList>(
+        _compiled_expression->evaluate_to_pos_list(*_in_table->get_chunk(chunk_id), chunk_id));
+  }
+
   return std::make_shared<RowIDPosList>(
       ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list(
           *_expression));
@@ -0,0 +1,464 @@
+#include "simd_scan_kernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_SCAN_KERNELS_X86 1
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto BITS_PER_WORD = size_t{64};
+
+template <typename Functor>
+void resolve_scan_condition(const PredicateCondition predicate_condition, const Functor& functor) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::Equals>{});
+      return;
+    case PredicateCondition::NotEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::NotEquals>{});
+      return;
+    case PredicateCondition::LessThan:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::LessThan>{});
+      return;
+    case PredicateCondition::LessThanEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::LessThanEquals>{});
+      return;
+    case PredicateCondition::GreaterThan:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::GreaterThan>{});
+      return;
+    case PredicateCondition::GreaterThanEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::GreaterThanEquals>{});
+      return;
+    default:
+      Fail("Unsupported predicate condition for SIMD scan kernels");
+  }
+}
+
+template <PredicateCondition condition, typename T>
+bool compare(const T value, const T search_value) {
+  if constexpr (condition == PredicateCondition::Equals) return value == search_value;
+  if constexpr (condition == PredicateCondition::NotEquals) return value != search_value;
+  if constexpr (condition == PredicateCondition::LessThan) return value < search_value;
+  if constexpr (condition == PredicateCondition::LessThanEquals) return value <= search_value;
+  if constexpr (condition == PredicateCondition::GreaterThan) return value > search_value;
+  if constexpr (condition == PredicateCondition::GreaterThanEquals) return value >= search_value;
+}
+
+// Scans values[begin, size), begin being a multiple of 64. Used as the fallback and for the tails of the SIMD kernels.
+template <PredicateCondition condition, bool exclude, typename T>
+void scan_to_bitmap_scalar(const T* values, const size_t begin, const size_t size, const T search_value,
+                           const T excluded_value, uint64_t* bitmap) {
+  for (auto word_begin = begin; word_begin < size; word_begin += BITS_PER_WORD) {
+    const auto word_end = std::min(word_begin + BITS_PER_WORD, size);
+    auto word = uint64_t{0};
+    for (auto index = word_begin; index < word_end; ++index) {
+      const auto value = values[index];
+      const auto match = compare<condition>(value, search_value) & (!exclude | (value != excluded_value));
+      word |= static_cast<uint64_t>(match) << (index - word_begin);
+    }
+    bitmap[word_begin / BITS_PER_WORD] = word;
+  }
+}
+
+#ifdef SIMD_SCAN_KERNELS_X86
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+#define AVX512_TARGET __attribute__((target("avx512f,avx512bw")))
+
+/**
+ * AVX2 operations on integers. AVX2 only offers signed comparisons (==, >). Unsigned values are compared by flipping
+ * their sign bits when they are loaded, which maps the unsigned order to the signed order. The other conditions are
+ * derived by swapping the operands or negating the lane mask.
+ */
+template <typename T>
+struct Avx2IntegerOps {
+  using Vector = __m256i;
+  static constexpr auto LANES = 32 / sizeof(T);
+  static constexpr auto ALL_LANES = LANES == 32 ? ~uint32_t{0} : (uint32_t{1} << LANES) - 1;
+
+  AVX2_TARGET static Vector broadcast_raw(const T value) {
+    if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(static_cast<char>(value));
+    if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<int16_t>(value));
+    if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int32_t>(value));
+    if constexpr (sizeof(T) == 8) return _mm256_set1_epi64x(static_cast<int64_t>(value));
+  }
+
+  AVX2_TARGET static Vector sign_bias() {
+    if constexpr (std::is_unsigned_v<T>) return broadcast_raw(static_cast<T>(std::numeric_limits<T>::max() / 2 + 1));
+    return _mm256_setzero_si256();
+  }
+
+  AVX2_TARGET static Vector broadcast(const T value) { return _mm256_xor_si256(broadcast_raw(value), sign_bias()); }
+
+  AVX2_TARGET static Vector load(const T* values) {
+    return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)), sign_bias());
+  }
+
+  AVX2_TARGET static Vector equal(const Vector a, const Vector b) {
+    if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(a, b);
+    if constexpr (sizeof(T) == 2) return _mm256_cmpeq_epi16(a, b);
+    if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(a, b);
+    if constexpr (sizeof(T) == 8) return _mm256_cmpeq_epi64(a, b);
+  }
+
+  AVX2_TARGET static Vector greater(const Vector a, const Vector b) {
+    if constexpr (sizeof(T) == 1) return _mm256_cmpgt_epi8(a, b);
+    if constexpr (sizeof(T) == 2) return _mm256_cmpgt_epi16(a, b);
+    if constexpr (sizeof(T) == 4) return _mm256_cmpgt_epi32(a, b);
+    if constexpr (sizeof(T) == 8) return _mm256_cmpgt_epi64(a, b);
+  }
+
+  // Returns one bit per lane
+  AVX2_TARGET static uint32_t lane_mask(const Vector lanes) {
+    if constexpr (sizeof(T) == 1) return static_cast<uint32_t>(_mm256_movemask_epi8(lanes));
+    if constexpr (sizeof(T) == 2) {
+      // Packing to bytes yields the 16 lanes in bytes 0-7 and 16-23
+      const auto bytes = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_packs_epi16(lanes, lanes)));
+      return (bytes & 0xFFu) | ((bytes >> 8) & 0xFF00u);
+    }
+    if constexpr (sizeof(T) == 4) return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+    if constexpr (sizeof(T) == 8) return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(lanes)));
+  }
+
+  template <PredicateCondition condition>
+  AVX2_TARGET static uint32_t compare(const Vector values, const Vector search) {
+    if constexpr (condition == PredicateCondition::Equals) return lane_mask(equal(values, search));
+    if constexpr (condition == PredicateCondition::NotEquals) return ~lane_mask(equal(values, search)) & ALL_LANES;
+    if constexpr (condition == PredicateCondition::LessThan) return lane_mask(greater(search, values));
+    if constexpr (condition == PredicateCondition::LessThanEquals) {
+      return ~lane_mask(greater(values, search)) & ALL_LANES;
+    }
+    if constexpr (condition == PredicateCondition::GreaterThan) return lane_mask(greater(values, search));
+    if constexpr (condition == PredicateCondition::GreaterThanEquals) {
+      return ~lane_mask(greater(search, values)) & ALL_LANES;
+    }
+  }
+};
+
+// Vector types for floating-point values. std::conditional_t would drop the alignment attributes of the vector types.
+template <typename T, size_t register_width>
+struct FloatingPointVector;
+
+template <>
+struct FloatingPointVector<float, 32> {
+  using type = __m256;
+};
+
+template <>
+struct FloatingPointVector<double, 32> {
+  using type = __m256d;
+};
+
+template <>
+struct FloatingPointVector<float, 64> {
+  using type = __m512;
+};
+
+template <>
+struct FloatingPointVector<double, 64> {
+  using type = __m512d;
+};
+
+// AVX2 operations on floating-point values. Ordered predicates are used so that NaN matches nothing but !=.
+template <typename T>
+struct Avx2FloatingPointOps {
+  using Vector = typename FloatingPointVector<T, 32>::type;
+  static constexpr auto LANES = 32 / sizeof(T);
+
+  AVX2_TARGET static Vector broadcast(const T value) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_set1_ps(value);
+    if constexpr (std::is_same_v<T, double>) return _mm256_set1_pd(value);
+  }
+
+  AVX2_TARGET static Vector load(const T* values) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_loadu_ps(values);
+    if constexpr (std::is_same_v<T, double>) return _mm256_loadu_pd(values);
+  }
+
+  template <int predicate>
+  AVX2_TARGET static uint32_t compare_with(const Vector a, const Vector b) {
+    if constexpr (std::is_same_v<T, float>) {
+      return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, predicate)));
+    }
+    if constexpr (std::is_same_v<T, double>) {
+      return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, predicate)));
+    }
+  }
+
+  template <PredicateCondition condition>
+  AVX2_TARGET static uint32_t compare(const Vector values, const Vector search) {
+    if constexpr (condition == PredicateCondition::Equals) return compare_with<_CMP_EQ_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::NotEquals) return compare_with<_CMP_NEQ_UQ>(values, search);
+    if constexpr (condition == PredicateCondition::LessThan) return compare_with<_CMP_LT_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::LessThanEquals) return compare_with<_CMP_LE_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThan) return compare_with<_CMP_GT_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThanEquals) return compare_with<_CMP_GE_OQ>(values, search);
+  }
+};
+
+// AVX-512 operations. Other than AVX2, AVX-512 has unsigned comparisons and writes the results to mask registers.
+template <typename T>
+struct Avx512IntegerOps {
+  using Vector = __m512i;
+  static constexpr auto LANES = 64 / sizeof(T);
+
+  AVX512_TARGET static Vector broadcast(const T value) {
+    if constexpr (sizeof(T) == 1) return _mm512_set1_epi8(static_cast<char>(value));
+    if constexpr (sizeof(T) == 2) return _mm512_set1_epi16(static_cast<int16_t>(value));
+    if constexpr (sizeof(T) == 4) return _mm512_set1_epi32(static_cast<int32_t>(value));
+    if constexpr (sizeof(T) == 8) return _mm512_set1_epi64(static_cast<int64_t>(value));
+  }
+
+  AVX512_TARGET static Vector load(const T* values) { return _mm512_loadu_si512(values); }
+
+  template <int predicate>
+  AVX512_TARGET static uint64_t compare_with(const Vector a, const Vector b) {
+    if constexpr (std::is_unsigned_v<T>) {
+      if constexpr (sizeof(T) == 1) return _mm512_cmp_epu8_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 2) return _mm512_cmp_epu16_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 4) return _mm512_cmp_epu32_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 8) return _mm512_cmp_epu64_mask(a, b, predicate);
+    } else {
+      if constexpr (sizeof(T) == 1) return _mm512_cmp_epi8_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 2) return _mm512_cmp_epi16_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 4) return _mm512_cmp_epi32_mask(a, b, predicate);
+      if constexpr (sizeof(T) == 8) return _mm512_cmp_epi64_mask(a, b, predicate);
+    }
+  }
+
+  template <PredicateCondition condition>
+  AVX512_TARGET static uint64_t compare(const Vector values, const Vector search) {
+    if constexpr (condition == PredicateCondition::Equals) return compare_with<_MM_CMPINT_EQ>(values, search);
+    if constexpr (condition == PredicateCondition::NotEquals) return compare_with<_MM_CMPINT_NE>(values, search);
+    if constexpr (condition == PredicateCondition::LessThan) return compare_with<_MM_CMPINT_LT>(values, search);
+    if constexpr (condition == PredicateCondition::LessThanEquals) return compare_with<_MM_CMPINT_LE>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThan) return compare_with<_MM_CMPINT_NLE>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThanEquals) {
+      return compare_with<_MM_CMPINT_NLT>(values, search);
+    }
+  }
+};
+
+template <typename T>
+struct Avx512FloatingPointOps {
+  using Vector = typename FloatingPointVector<T, 64>::type;
+  static constexpr auto LANES = 64 / sizeof(T);
+
+  AVX512_TARGET static Vector broadcast(const T value) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_set1_ps(value);
+    if constexpr (std::is_same_v<T, double>) return _mm512_set1_pd(value);
+  }
+
+  AVX512_TARGET static Vector load(const T* values) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_loadu_ps(values);
+    if constexpr (std::is_same_v<T, double>) return _mm512_loadu_pd(values);
+  }
+
+  template <int predicate>
+  AVX512_TARGET static uint64_t compare_with(const Vector a, const Vector b) {
+    if constexpr (std::is_same_v<T, float>) return _mm512_cmp_ps_mask(a, b, predicate);
+    if constexpr (std::is_same_v<T, double>) return _mm512_cmp_pd_mask(a, b, predicate);
+  }
+
+  template <PredicateCondition condition>
+  AVX512_TARGET static uint64_t compare(const Vector values, const Vector search) {
+    if constexpr (condition == PredicateCondition::Equals) return compare_with<_CMP_EQ_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::NotEquals) return compare_with<_CMP_NEQ_UQ>(values, search);
+    if constexpr (condition == PredicateCondition::LessThan) return compare_with<_CMP_LT_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::LessThanEquals) return compare_with<_CMP_LE_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThan) return compare_with<_CMP_GT_OQ>(values, search);
+    if constexpr (condition == PredicateCondition::GreaterThanEquals) return compare_with<_CMP_GE_OQ>(values, search);
+  }
+};
+
+template <typename T>
+using Avx2Ops = std::conditional_t<std::is_floating_point_v<T>, Avx2FloatingPointOps<T>, Avx2IntegerOps<T>>;
+
+template <typename T>
+using Avx512Ops = std::conditional_t<std::is_floating_point_v<T>, Avx512FloatingPointOps<T>, Avx512IntegerOps<T>>;
+
+// Both kernels fill one bitmap word per iteration and return the number of values scanned, i.e., size rounded down to
+// a multiple of 64. The remaining values are left to the scalar kernel. Lambdas are avoided, as they would not inherit
+// the target attribute.
+template <typename Ops, PredicateCondition condition, bool exclude, typename T>
+AVX2_TARGET size_t scan_to_bitmap_avx2(const T* values, const size_t size, const T search_value, const T excluded_value,
+                                       uint64_t* bitmap) {
+  const auto search = Ops::broadcast(search_value);
+  const auto excluded = Ops::broadcast(excluded_value);
+  const auto word_count = size / BITS_PER_WORD;
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    const auto* word_values = values + word_index * BITS_PER_WORD;
+    auto word = uint64_t{0};
+    for (auto lane_offset = size_t{0}; lane_offset < BITS_PER_WORD; lane_offset += Ops::LANES) {
+      const auto vector = Ops::load(word_values + lane_offset);
+      auto mask = Ops::template compare<condition>(vector, search);
+      if constexpr (exclude) mask &= Ops::template compare<PredicateCondition::NotEquals>(vector, excluded);
+      word |= static_cast<uint64_t>(mask) << lane_offset;
+    }
+    bitmap[word_index] = word;
+  }
+  return word_count * BITS_PER_WORD;
+}
+
+template <typename Ops, PredicateCondition condition, bool exclude, typename T>
+AVX512_TARGET size_t scan_to_bitmap_avx512(const T* values, const size_t size, const T search_value,
+                                           const T excluded_value, uint64_t* bitmap) {
+  const auto search = Ops::broadcast(search_value);
+  const auto excluded = Ops::broadcast(excluded_value);
+  const auto word_count = size / BITS_PER_WORD;
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    const auto* word_values = values + word_index * BITS_PER_WORD;
+    auto word = uint64_t{0};
+    for (auto lane_offset = size_t{0}; lane_offset < BITS_PER_WORD; lane_offset += Ops::LANES) {
+      const auto vector = Ops::load(word_values + lane_offset);
+      auto mask = Ops::template compare<condition>(vector, search);
+      if constexpr (exclude) mask &= Ops::template compare<PredicateCondition::NotEquals>(vector, excluded);
+      word |= mask << lane_offset;
+    }
+    bitmap[word_index] = word;
+  }
+  return word_count * BITS_PER_WORD;
+}
+
+#undef AVX2_TARGET
+#undef AVX512_TARGET
+
+#endif
+
+SimdScanKernel best_supported_kernel() {
+  if (simd_scan_kernel_supported(SimdScanKernel::AVX512)) return SimdScanKernel::AVX512;
+  if (simd_scan_kernel_supported(SimdScanKernel::AVX2)) return SimdScanKernel::AVX2;
+  return SimdScanKernel::Scalar;
+}
+
+std::atomic<SimdScanKernel>& active_kernel() {
+  static auto kernel = std::atomic<SimdScanKernel>{best_supported_kernel()};
+  return kernel;
+}
+
+template <PredicateCondition condition, bool exclude, typename T>
+void scan_to_bitmap_with_kernel(const T* values, const size_t size, const T search_value, const T excluded_value,
+                                uint64_t* bitmap) {
+  auto scanned_count = size_t{0};
+#ifdef SIMD_SCAN_KERNELS_X86
+  switch (active_kernel().load(std::memory_order_relaxed)) {
+    case SimdScanKernel::AVX512:
+      scanned_count = scan_to_bitmap_avx512<Avx512Ops<T>, condition, exclude>(values, size, search_value,
+                                                                                excluded_value, bitmap);
+      break;
+    case SimdScanKernel::AVX2:
+      scanned_count =
+          scan_to_bitmap_avx2<Avx2Ops<T>, condition, exclude>(values, size, search_value, excluded_value, bitmap);
+      break;
+    case SimdScanKernel::Scalar:
+      break;
+  }
+#endif
+  scan_to_bitmap_scalar<condition, exclude>(values, scanned_count, size, search_value, excluded_value, bitmap);
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::ostream& operator<<(std::ostream& stream, const SimdScanKernel kernel) {
+  switch (kernel) {
+    case SimdScanKernel::Scalar:
+      return stream << "Scalar";
+    case SimdScanKernel::AVX2:
+      return stream << "AVX2";
+    case SimdScanKernel::AVX512:
+      return stream << "AVX-512";
+  }
+  Fail("Invalid SimdScanKernel");
+}
+
+bool simd_scan_kernel_supported(const SimdScanKernel kernel) {
+  switch (kernel) {
+    case SimdScanKernel::Scalar:
+      return true;
+#ifdef SIMD_SCAN_KERNELS_X86
+    case SimdScanKernel::AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    case SimdScanKernel::AVX512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#else
+    case SimdScanKernel::AVX2:
+    case SimdScanKernel::AVX512:
+      return false;
+#endif
+  }
+  Fail("Invalid SimdScanKernel");
+}
+
+SimdScanKernel simd_scan_kernel() { return active_kernel().load(); }
+
+void set_simd_scan_kernel(const SimdScanKernel kernel) {
+  Assert(simd_scan_kernel_supported(kernel), "SIMD scan kernel is not supported by this CPU");
+  active_kernel().store(kernel);
+}
+
+template <typename T>
+void scan_to_bitmap(const T* values, const size_t size, const PredicateCondition predicate_condition,
+                    const T search_value, const std::optional<T> excluded_value, uint64_t* bitmap) {
+  resolve_scan_condition(predicate_condition, [&](auto condition_t) {
+    constexpr auto CONDITION = decltype(condition_t)::value;
+    if (excluded_value) {
+      scan_to_bitmap_with_kernel<CONDITION, true>(values, size, search_value, *excluded_value, bitmap);
+    } else {
+      scan_to_bitmap_with_kernel<CONDITION, false>(values, size, search_value, T{}, bitmap);
+    }
+  });
+}
+
+void append_bitmap_matches(const uint64_t* bitmap, const size_t size, const ChunkID chunk_id, RowIDPosList& matches) {
+  const auto word_count = simd_scan_bitmap_word_count(size);
+
+  // Count first so that the RowIDs can be written without checking the capacity of matches
+  auto match_count = size_t{0};
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    match_count += __builtin_popcountll(bitmap[word_index]);
+  }
+
+  auto output_index = matches.size();
+  matches.resize(output_index + match_count);
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    auto word = bitmap[word_index];
+    const auto word_offset = static_cast<ChunkOffset>(word_index * BITS_PER_WORD);
+    while (word) {
+      matches[output_index] = RowID{chunk_id, word_offset + static_cast<ChunkOffset>(__builtin_ctzll(word))};
+      ++output_index;
+      word &= word - 1;
+    }
+  }
+}
+
+template void scan_to_bitmap<uint8_t>(const uint8_t*, const size_t, const PredicateCondition, const uint8_t,
+                                      const std::optional<uint8_t>, uint64_t*);
+template void scan_to_bitmap<uint16_t>(const uint16_t*, const size_t, const PredicateCondition, const uint16_t,
+                                       const std::optional<uint16_t>, uint64_t*);
+template void scan_to_bitmap<uint32_t>(const uint32_t*, const size_t, const PredicateCondition, const uint32_t,
+                                       const std::optional<uint32_t>, uint64_t*);
+template void scan_to_bitmap<int32_t>(const int32_t*, const size_t, const PredicateCondition, const int32_t,
+                                      const std::optional<int32_t>, uint64_t*);
+template void scan_to_bitmap<int64_t>(const int64_t*, const size_t, const PredicateCondition, const int64_t,
+                                      const std::optional<int64_t>, uint64_t*);
+template void scan_to_bitmap<float>(const float*, const size_t, const PredicateCondition, const float,
+                                    const std::optional<float>, uint64_t*);
+template void scan_to_bitmap<double>(const double*, const size_t, const PredicateCondition, const double,
+                                     const std::optional<double>, uint64_t*);
+
+}  // namespace opossum
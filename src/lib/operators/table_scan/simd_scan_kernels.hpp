@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Kernels that compare a contiguous array of values (an uncompressed FixedSizeByteAligned attribute vector or the
+ * values of a ValueSegment) with a search value. Instead of producing RowIDs one by one, they write a match bitmap
+ * (bit i of word i / 64 is set if values[i] matches), which is converted to RowIDs in bulk afterwards.
+ *
+ * Other than the auto-vectorized loop in AbstractTableScanImpl::_scan_with_iterators, the AVX2 and AVX-512 kernels
+ * are compiled for their instruction sets using target attributes, independent of the flags the binary is built with.
+ * The kernel used is chosen at runtime based on the CPU's capabilities (CPUID), with a scalar fallback.
+ *
+ * Supported types are uint8_t, uint16_t, uint32_t (attribute vectors), int32_t, int64_t, float, and double.
+ */
+enum class SimdScanKernel { Scalar, AVX2, AVX512 };
+
+std::ostream& operator<<(std::ostream& stream, const SimdScanKernel kernel);
+
+// Returns true if the CPU supports the instructions required by kernel
+bool simd_scan_kernel_supported(const SimdScanKernel kernel);
+
+// The kernel used by scan_to_bitmap. Defaults to the best kernel supported by the CPU. Setting it is meant for
+// benchmarks and tests.
+SimdScanKernel simd_scan_kernel();
+void set_simd_scan_kernel(const SimdScanKernel kernel);
+
+// Number of uint64_t words required for the match bitmap of size values
+constexpr size_t simd_scan_bitmap_word_count(const size_t size) { return (size + 63) / 64; }
+
+// Writes the match bitmap for values[0, size) to bitmap. A value matches if `value predicate_condition search_value` is
+// true and, if given, value != excluded_value. The latter is used to exclude the NULL value ID of dictionary segments.
+// predicate_condition has to be one of =, !=, <, <=, >, >=.
+template <typename T>
+void scan_to_bitmap(const T* values, const size_t size, const PredicateCondition predicate_condition,
+                    const T search_value, const std::optional<T> excluded_value, uint64_t* bitmap);
+
+// Appends a RowID for every bit that is set in the first simd_scan_bitmap_word_count(size) words of bitmap
+void append_bitmap_matches(const uint64_t* bitmap, const size_t size, const ChunkID chunk_id, RowIDPosList& matches);
+
+}  // namespace opossum
@@ -0,0 +1,424 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Compares the values of a sort column for two rows of the input table. Returns a negative number if the first row
+// comes first, zero if both values are equal, and a positive number otherwise. As in the Sort operator, NULLs come
+// before all other values, independent of the sort mode. Accessors are created lazily per chunk and are not
+// thread-safe, so every thread needs its own comparator.
+class AbstractColumnComparator {
+ public:
+  virtual ~AbstractColumnComparator() = default;
+
+  virtual int compare(const RowID& lhs, const RowID& rhs) = 0;
+};
+
+template <typename ColumnDataType>
+class ColumnComparator : public AbstractColumnComparator {
+ public:
+  ColumnComparator(const std::shared_ptr<const Table>& table, const SortColumnDefinition& sort_definition)
+      : _table(table), _sort_definition(sort_definition), _accessor_by_chunk_id(table->chunk_count()) {}
+
+  int compare(const RowID& lhs, const RowID& rhs) final {
+    const auto lhs_value = _accessor(lhs.chunk_id).access(lhs.chunk_offset);
+    const auto rhs_value = _accessor(rhs.chunk_id).access(rhs.chunk_offset);
+
+    if (!lhs_value || !rhs_value) {
+      return static_cast<int>(lhs_value.has_value()) - static_cast<int>(rhs_value.has_value());
+    }
+    if (*lhs_value == *rhs_value) return 0;
+
+    const auto lhs_first = _sort_definition.sort_mode == SortMode::Ascending ? *lhs_value < *rhs_value
+                                                                             : *lhs_value > *rhs_value;
+    return lhs_first ? -1 : 1;
+  }
+
+ protected:
+  AbstractSegmentAccessor<ColumnDataType>& _accessor(const ChunkID chunk_id) {
+    auto& accessor = _accessor_by_chunk_id[chunk_id];
+    if (!accessor) {
+      const auto& segment = _table->get_chunk(chunk_id)->get_segment(_sort_definition.column);
+      accessor = create_segment_accessor<ColumnDataType>(segment);
+    }
+    return *accessor;
+  }
+
+  const std::shared_ptr<const Table> _table;
+  const SortColumnDefinition _sort_definition;
+  std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>> _accessor_by_chunk_id;
+};
+
+// A candidate row for the output. The value of the first sort column is stored inline so that most comparisons do not
+// need to access the input segments.
+template <typename FirstColumnDataType>
+struct Candidate {
+  RowID row_id;
+  std::optional<FirstColumnDataType> first_value;
+};
+
+// Orders candidates by all sort columns and, for rows that are equal in all of them, by their position in the input.
+// This is a strict total order, which makes TopK stable.
+template <typename FirstColumnDataType>
+class CandidateComparator {
+ public:
+  CandidateComparator(const std::shared_ptr<const Table>& table,
+                      const std::vector<SortColumnDefinition>& sort_definitions)
+      : _first_sort_mode(sort_definitions.front().sort_mode) {
+    for (auto sort_column_index = size_t{1}; sort_column_index < sort_definitions.size(); ++sort_column_index) {
+      const auto& sort_definition = sort_definitions[sort_column_index];
+      resolve_data_type(table->column_data_type(sort_definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        _column_comparators.emplace_back(std::make_unique<ColumnComparator<ColumnDataType>>(table, sort_definition));
+      });
+    }
+  }
+
+  // Returns a negative number if lhs comes before rhs in the first sort column, zero if both are equal, and a positive
+  // number otherwise.
+  int compare_first_values(const std::optional<FirstColumnDataType>& lhs,
+                           const std::optional<FirstColumnDataType>& rhs) const {
+    if (!lhs || !rhs) return static_cast<int>(lhs.has_value()) - static_cast<int>(rhs.has_value());
+    if (*lhs == *rhs) return 0;
+
+    const auto lhs_first = _first_sort_mode == SortMode::Ascending ? *lhs < *rhs : *lhs > *rhs;
+    return lhs_first ? -1 : 1;
+  }
+
+  // Returns true if lhs comes before rhs in the output
+  bool operator()(const Candidate<FirstColumnDataType>& lhs, const Candidate<FirstColumnDataType>& rhs) {
+    const auto first_column_result = compare_first_values(lhs.first_value, rhs.first_value);
+    if (first_column_result != 0) return first_column_result < 0;
+    return _compare_remaining_columns(lhs.row_id, rhs.row_id);
+  }
+
+ protected:
+  bool _compare_remaining_columns(const RowID& lhs, const RowID& rhs) {
+    for (const auto& column_comparator : _column_comparators) {
+      const auto result = column_comparator->compare(lhs, rhs);
+      if (result != 0) return result < 0;
+    }
+    return lhs < rhs;
+  }
+
+  const SortMode _first_sort_mode;
+  std::vector<std::unique_ptr<AbstractColumnComparator>> _column_comparators;
+};
+
+// Returns the smallest and the largest value of a segment if the chunk's pruning statistics provide them.
+template <typename ColumnDataType>
+std::optional<std::pair<ColumnDataType, ColumnDataType>> min_max_from_pruning_statistics(const Chunk& chunk,
+                                                                                         const ColumnID column_id) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) return std::nullopt;
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>((*pruning_statistics)[column_id]);
+  if (!attribute_statistics) return std::nullopt;
+
+  if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+    if (attribute_statistics->range_filter && !attribute_statistics->range_filter->ranges.empty()) {
+      const auto& ranges = attribute_statistics->range_filter->ranges;
+      return std::make_pair(ranges.front().first, ranges.back().second);
+    }
+  }
+
+  if (attribute_statistics->min_max_filter) {
+    return std::make_pair(attribute_statistics->min_max_filter->min, attribute_statistics->min_max_filter->max);
+  }
+
+  return std::nullopt;
+}
+
+// Returns the best row_count rows of each chunk in no particular order
+template <typename FirstColumnDataType>
+std::vector<Candidate<FirstColumnDataType>> collect_candidates(
+    const std::shared_ptr<const Table>& input_table, const std::vector<SortColumnDefinition>& sort_definitions,
+    const size_t row_count, TopK::PerformanceData& performance_data) {
+  using CandidateType = Candidate<FirstColumnDataType>;
+
+  const auto& first_sort_definition = sort_definitions.front();
+  const auto first_sort_mode = first_sort_definition.sort_mode;
+
+  // Chunks can only be skipped based on their pruning statistics if the first sort column does not contain NULLs, as
+  // the statistics do not cover NULLs and these come first.
+  const auto chunks_can_be_skipped = !input_table->column_is_nullable(first_sort_definition.column);
+
+  // The best value of the first sort column that the row_count-th candidate of any chunk has had so far
+  auto threshold = std::optional<FirstColumnDataType>{};
+  auto threshold_mutex = std::mutex{};
+  auto chunks_skipped = std::atomic<size_t>{0};
+
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_by_chunk_id = std::vector<std::vector<CandidateType>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      if (chunks_can_be_skipped) {
+        const auto min_max = min_max_from_pruning_statistics<FirstColumnDataType>(*chunk, first_sort_definition.column);
+        if (min_max) {
+          const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+          if (threshold && ((first_sort_mode == SortMode::Ascending && min_max->first > *threshold) ||
+                            (first_sort_mode == SortMode::Descending && min_max->second < *threshold))) {
+            ++chunks_skipped;
+            return;
+          }
+        }
+      }
+
+      auto comparator = CandidateComparator<FirstColumnDataType>{input_table, sort_definitions};
+      const auto heap_comparator = [&](const CandidateType& lhs, const CandidateType& rhs) {
+        return comparator(lhs, rhs);
+      };
+
+      // Max-heap that keeps the candidate that would be output last on top
+      auto& heap = candidates_by_chunk_id[chunk_id];
+      heap.reserve(std::min(row_count, static_cast<size_t>(chunk->size())));
+
+      const auto& segment = *chunk->get_segment(first_sort_definition.column);
+      segment_iterate<FirstColumnDataType>(segment, [&](const auto& position) {
+        auto candidate = CandidateType{RowID{chunk_id, position.chunk_offset()}, std::nullopt};
+        if (!position.is_null()) candidate.first_value = position.value();
+
+        if (heap.size() < row_count) {
+          heap.emplace_back(std::move(candidate));
+          std::push_heap(heap.begin(), heap.end(), heap_comparator);
+          return;
+        }
+
+        // Only compare the remaining sort columns if the first one does not decide
+        const auto first_column_result =
+            comparator.compare_first_values(candidate.first_value, heap.front().first_value);
+        if (first_column_result > 0) return;
+        if (first_column_result == 0 && !comparator(candidate, heap.front())) return;
+
+        std::pop_heap(heap.begin(), heap.end(), heap_comparator);
+        heap.back() = std::move(candidate);
+        std::push_heap(heap.begin(), heap.end(), heap_comparator);
+      });
+
+      // Publish the worst candidate of this chunk as a threshold for the remaining chunks
+      if (chunks_can_be_skipped && heap.size() == row_count && heap.front().first_value) {
+        const auto& worst_value = *heap.front().first_value;
+        const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+        if (!threshold || (first_sort_mode == SortMode::Ascending && worst_value < *threshold) ||
+            (first_sort_mode == SortMode::Descending && worst_value > *threshold)) {
+          threshold = worst_value;
+        }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  performance_data.chunks_skipped = chunks_skipped;
+
+  auto candidates = std::vector<CandidateType>{};
+  for (auto& chunk_candidates : candidates_by_chunk_id) {
+    candidates.insert(candidates.end(), std::make_move_iterator(chunk_candidates.begin()),
+                      std::make_move_iterator(chunk_candidates.end()));
+    chunk_candidates = {};
+  }
+
+  return candidates;
+}
+
+// Materializes the rows given by pos_list into a new data table.
+std::shared_ptr<Table> write_output_table(const std::shared_ptr<const Table>& input_table,
+                                          const RowIDPosList& pos_list) {
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+
+  const auto column_count = input_table->column_count();
+  const auto output_row_count = pos_list.size();
+
+  for (auto chunk_begin = size_t{0}; chunk_begin < output_row_count; chunk_begin += Chunk::DEFAULT_SIZE) {
+    const auto chunk_end = std::min(chunk_begin + Chunk::DEFAULT_SIZE, output_row_count);
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto column_is_nullable = input_table->column_is_nullable(column_id);
+
+      resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto accessor_by_chunk_id =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+
+        auto values = pmr_vector<ColumnDataType>(chunk_end - chunk_begin);
+        auto null_values = pmr_vector<bool>(column_is_nullable ? chunk_end - chunk_begin : 0);
+
+        for (auto row_index = chunk_begin; row_index < chunk_end; ++row_index) {
+          const auto& [chunk_id, chunk_offset] = pos_list[row_index];
+
+          auto& accessor = accessor_by_chunk_id[chunk_id];
+          if (!accessor) {
+            const auto& segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+            accessor = create_segment_accessor<ColumnDataType>(segment);
+          }
+
+          const auto typed_value = accessor->access(chunk_offset);
+          if (typed_value) {
+            values[row_index - chunk_begin] = std::move(*typed_value);
+          } else {
+            null_values[row_index - chunk_begin] = true;
+          }
+        }
+
+        if (column_is_nullable) {
+          output_segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          output_segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    output_table->append_chunk(output_segments);
+  }
+
+  return output_table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in, nullptr, std::make_unique<PerformanceData>()),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  Timer timer;
+  const auto& input_table = left_input_table();
+
+  for (const auto& column_sort_definition : _sort_definitions) {
+    Assert(column_sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(column_sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  // Evaluate the _row_count_expression in the same way as the Limit operator does
+  auto row_count = size_t{};
+  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+    using LimitDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<LimitDataType>) {
+      const auto row_count_expression_result =
+          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(*_row_count_expression);
+      Assert(row_count_expression_result->size() == 1, "Expected exactly one row for TopK");
+      Assert(!row_count_expression_result->is_null(0), "Expected non-null for TopK");
+
+      const auto signed_row_count = row_count_expression_result->value(0);
+      Assert(signed_row_count >= 0, "Can't TopK to a negative number of Rows");
+
+      row_count = static_cast<size_t>(signed_row_count);
+    } else {
+      Fail("Non-integral types not allowed in TopK");
+    }
+  });
+
+  auto& top_k_performance_data = static_cast<PerformanceData&>(*performance_data);
+
+  auto pos_list = RowIDPosList{};
+  if (row_count > 0 && input_table->row_count() > 0) {
+    const auto& first_sort_definition = _sort_definitions.front();
+    resolve_data_type(input_table->column_data_type(first_sort_definition.column), [&](auto type) {
+      using FirstColumnDataType = typename decltype(type)::type;
+
+      using CandidateType = Candidate<FirstColumnDataType>;
+
+      auto candidates = collect_candidates<FirstColumnDataType>(input_table, _sort_definitions, row_count,
+                                                                top_k_performance_data);
+      top_k_performance_data.set_step_runtime(OperatorSteps::CollectCandidates, timer.lap());
+
+      const auto output_row_count = std::min(row_count, candidates.size());
+      auto comparator = CandidateComparator<FirstColumnDataType>{input_table, _sort_definitions};
+      std::partial_sort(candidates.begin(), candidates.begin() + output_row_count, candidates.end(),
+                        [&](const CandidateType& lhs, const CandidateType& rhs) { return comparator(lhs, rhs); });
+
+      pos_list.reserve(output_row_count);
+      for (auto candidate_index = size_t{0}; candidate_index < output_row_count; ++candidate_index) {
+        pos_list.emplace_back(candidates[candidate_index].row_id);
+      }
+      top_k_performance_data.set_step_runtime(OperatorSteps::MergeCandidates, timer.lap());
+    });
+  }
+
+  const auto output_table = write_output_table(input_table, pos_list);
+
+  // As in the Sort operator, the output chunks are sorted by the most significant sort column
+  const auto output_chunk_count = output_table->chunk_count();
+  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    const auto& output_chunk = output_table->get_chunk(output_chunk_id);
+    output_chunk->finalize();
+    output_chunk->set_individually_sorted_by(_sort_definitions.front());
+  }
+
+  top_k_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+  return output_table;
+}
+
+void TopK::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Chunks skipped: " << chunks_skipped
+         << ".";
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first rows of its input according to the sort definitions. It is equivalent to a Sort
+ * followed by a Limit (including the stable ordering and NULLs being placed first), but does not sort the entire
+ * input. Instead, every chunk is processed in its own JobTask that keeps the best rows seen so far in a bounded heap.
+ * Afterwards, the candidates of all chunks are merged.
+ *
+ * Once a chunk has found row_count candidates, the value of its worst candidate in the first sort column serves as a
+ * threshold for the remaining chunks. A chunk whose pruning statistics show that none of its values can beat this
+ * threshold is skipped entirely.
+ *
+ * As the output holds only few rows, it is always materialized.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { CollectCandidates, MergeCandidates, WriteOutput };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t chunks_skipped{0};
+  };
+
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  const std::string& name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,7 +17,7 @@ namespace opossum {
  *
  * Assumption: Validate happens before joins.
  */
-class Validate : public AbstractReadOnlyOperator {
+class Validate : public AbstractChunkwiseOperator {
   friend class OperatorsValidateTest;
 
  public:
@@ -29,19 +30,27 @@ class Validate : public AbstractReadOnlyOperator {
                              const CommitID begin_cid, const CommitID end_cid);
 
  private:
-  void _validate_chunks(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id_start,
-                        const ChunkID chunk_id_end, const TransactionID our_tid, const TransactionID snapshot_commit_id,
-                        std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
+  // Returns, for each chunk of @param referenced_table, whether it is entirely visible. Used for input chunks whose
+  // position lists reference multiple chunks.
+  const std::vector<bool>& _entirely_visible_chunks(const std::shared_ptr<const Table>& referenced_table);
 
   // This is a performance optimization that can only be used if a couple of conditions are met, i.e., if
-  // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
+  // _can_use_chunk_shortcut is true. Consult _on_prepare_chunks() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
   bool _can_use_chunk_shortcut = true;
 
+  TransactionID _our_tid{INVALID_TRANSACTION_ID};
+  CommitID _snapshot_commit_id{0};
+
+  std::once_flag _entirely_visible_chunks_flag;
+  std::shared_ptr<const Table> _entirely_visible_chunks_table;
+  std::vector<bool> _entirely_visible_chunks_cache;
+
  protected:
-  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
-  std::shared_ptr<const Table> _on_execute() override;
+  void _on_prepare_chunks(const std::shared_ptr<const Table>& input_table) override;
+  std::shared_ptr<Chunk> _on_process_chunk(const std::shared_ptr<const Table>& in_table,
+                                           const ChunkID chunk_id) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
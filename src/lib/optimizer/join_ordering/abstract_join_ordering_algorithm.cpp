@@ -43,10 +43,67 @@ std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_predicates_
   return predicate_nodes_and_cost.back().first;
 }
 
+std::vector<std::shared_ptr<AbstractLQPNode>> AbstractJoinOrderingAlgorithm::_build_vertex_plans(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  auto vertex_plans = join_graph.vertices;
+
+  /**
+   * 1. Place Uncorrelated Predicates
+   * 1.1 Collect uncorrelated predicates
+   */
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  /**
+   * 1.2 Find the largest vertex and place the uncorrelated predicates on top of it
+   */
+  if (!uncorrelated_predicates.empty()) {
+    auto largest_vertex_idx = size_t{0};
+    auto largest_vertex_cardinality =
+        cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices.front());
+
+    for (auto vertex_idx = size_t{1}; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
+      const auto vertex_cardinality =
+          cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices[vertex_idx]);
+      if (vertex_cardinality > largest_vertex_cardinality) {
+        largest_vertex_idx = vertex_idx;
+        largest_vertex_cardinality = vertex_cardinality;
+      }
+    }
+
+    auto& largest_vertex_plan = vertex_plans[largest_vertex_idx];
+    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+      largest_vertex_plan = PredicateNode::make(uncorrelated_predicate, largest_vertex_plan);
+    }
+  }
+
+  /**
+   * 2. Add local predicates on top of the vertices
+   */
+  for (auto vertex_idx = size_t{0}; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
+    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
+    vertex_plans[vertex_idx] = _add_predicates_to_plan(vertex_plans[vertex_idx], vertex_predicates, cost_estimator);
+  }
+
+  return vertex_plans;
+}
+
 std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_join_to_plan(
     std::shared_ptr<AbstractLQPNode> left_lqp, std::shared_ptr<AbstractLQPNode> right_lqp,
     const std::vector<std::shared_ptr<AbstractExpression>>& join_predicates,
     const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  const auto lqp = _build_join_plan_candidate(left_lqp, right_lqp, join_predicates, cost_estimator);
+  _attach_join_plan_candidate(lqp);
+  return lqp;
+}
+
+std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_build_join_plan_candidate(
+    std::shared_ptr<AbstractLQPNode> left_lqp, std::shared_ptr<AbstractLQPNode> right_lqp,
+    const std::vector<std::shared_ptr<AbstractExpression>>& join_predicates,
+    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   /**
    * To make the input sides more deterministic, we make sure that the larger input is on the right side. This helps
    * future rules to identify common subplans. For plans with equal cardinalities, this might still result in
@@ -64,7 +121,8 @@ std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_join_to_pla
   auto join_predicates_and_cost = std::vector<std::pair<std::shared_ptr<AbstractExpression>, Cost>>{};
   join_predicates_and_cost.reserve(join_predicates.size());
   for (const auto& join_predicate : join_predicates) {
-    const auto join_node = JoinNode::make(JoinMode::Inner, join_predicate, left_lqp, right_lqp);
+    const auto join_node = JoinNode::make(JoinMode::Inner, join_predicate);
+    join_node->set_detached_inputs(left_lqp, right_lqp);
     const auto cost = cost_estimator->estimate_node_cost(join_node);
     join_predicates_and_cost.emplace_back(join_predicate, cost);
   }
@@ -92,10 +150,11 @@ std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_join_to_pla
   // Build JoinNode (for primary predicate and secondary predicates)
   auto lqp = std::shared_ptr<AbstractLQPNode>{};
   if (!join_node_predicates.empty()) {
-    lqp = JoinNode::make(JoinMode::Inner, join_node_predicates, left_lqp, right_lqp);
+    lqp = JoinNode::make(JoinMode::Inner, join_node_predicates);
   } else {
-    lqp = JoinNode::make(JoinMode::Cross, left_lqp, right_lqp);
+    lqp = JoinNode::make(JoinMode::Cross);
   }
+  lqp->set_detached_inputs(left_lqp, right_lqp);
 
   // Post-JoinNode predicates are handled as normal predicates
   for (const auto& post_join_predicate : post_join_node_predicates) {
@@ -105,4 +164,14 @@ std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_join_to_pla
   return lqp;
 }
 
+void AbstractJoinOrderingAlgorithm::_attach_join_plan_candidate(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  // The post-join PredicateNodes are private to the candidate, only the JoinNode below them has detached inputs
+  auto node = lqp;
+  while (!node->has_detached_inputs()) {
+    DebugAssert(node->type == LQPNodeType::Predicate, "Expected a candidate built by _build_join_plan_candidate()");
+    node = node->left_input();
+  }
+  node->attach_inputs();
+}
+
 }  // namespace opossum
@@ -59,6 +59,19 @@ class AbstractJoinOrderingAlgorithm {
       const std::vector<std::shared_ptr<AbstractExpression>>& join_predicates,
       const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
 
+  /**
+   * Same as _add_join_to_plan(), but the JoinNode of the returned candidate plan references @param left_lqp and
+   * @param right_lqp as detached inputs (see AbstractLQPNode::set_detached_inputs()). As the subplans are not modified,
+   * candidates can be built and costed on shared subplans concurrently. The candidate that is chosen has to be attached
+   * to its subplans using _attach_join_plan_candidate(), the others are simply released.
+   */
+  static std::shared_ptr<AbstractLQPNode> _build_join_plan_candidate(
+      std::shared_ptr<AbstractLQPNode> left_lqp, std::shared_ptr<AbstractLQPNode> right_lqp,
+      const std::vector<std::shared_ptr<AbstractExpression>>& join_predicates,
+      const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  static void _attach_join_plan_candidate(const std::shared_ptr<AbstractLQPNode>& lqp);
+
   /**
    * Adds a non-join predicate, i.e., a predicate that filters the output of `lqp`, on top of `lqp` and returns
    * the resulting node. This is called internally for predicates that are contained in the JoinGraph but do not link
@@ -70,6 +83,17 @@ class AbstractJoinOrderingAlgorithm {
   static std::shared_ptr<AbstractLQPNode> _add_predicates_to_plan(
       const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<std::shared_ptr<AbstractExpression>>& predicates,
       const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  /**
+   * Returns the initial plan of each vertex, i.e., the vertex with its local predicates on top. This is used by the
+   * dynamic programming algorithms, which build their plans bottom up from these plans.
+   *
+   * Uncorrelated predicates (think "6 > 4": not referencing any vertex) are placed on the largest vertex. They are
+   * either False or True for *all* rows. If an uncorrelated predicate is False and we place it on top of the largest
+   * vertex we avoid processing the vertex' many rows in later joins.
+   */
+  static std::vector<std::shared_ptr<AbstractLQPNode>> _build_vertex_plans(
+      const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
 };
 
 }  // namespace opossum
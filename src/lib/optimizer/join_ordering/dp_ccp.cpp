@@ -1,129 +1,210 @@
 #include "dp_ccp.hpp"
 
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "cost_estimation/abstract_cost_estimator.hpp"
 #include "enumerate_ccp.hpp"
+#include "hyrise.hpp"
 #include "join_graph.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimator.hpp"
 
 namespace opossum {
 
+DpCcp::DpCcp(const std::optional<std::chrono::microseconds>& init_planning_time_budget,
+             const std::optional<size_t>& init_max_csg_cmp_pair_count)
+    : planning_time_budget(init_planning_time_budget), max_csg_cmp_pair_count(init_max_csg_cmp_pair_count) {}
+
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
 
+  auto deadline = std::optional<std::chrono::steady_clock::time_point>{};
+  if (planning_time_budget) deadline = std::chrono::steady_clock::now() + *planning_time_budget;
+
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
   auto best_plan = std::map<JoinGraphVertexSet, std::shared_ptr<AbstractLQPNode>>{};
 
   /**
-   * 1. Initialize best_plan[] with the vertices
+   * 1. Initialize best_plan[] with the vertices and their local and uncorrelated predicates
    */
+  const auto vertex_plans = _build_vertex_plans(join_graph, cost_estimator);
   for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
     single_vertex_set.set(vertex_idx);
 
-    best_plan[single_vertex_set] = join_graph.vertices[vertex_idx];
+    best_plan[single_vertex_set] = vertex_plans[vertex_idx];
   }
 
   /**
-   * 2. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
-   * 2.1 Collect uncorrelated predicates
+   * 2. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
    */
-  std::vector<std::shared_ptr<AbstractExpression>> uncorrelated_predicates;
+  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
   for (const auto& edge : join_graph.edges) {
-    if (!edge.vertex_set.none()) continue;
-    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
-  }
+    // EnumerateCcp only deals with binary join predicates
+    if (edge.vertex_set.count() != 2) continue;
 
-  /**
-   * 2.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
-   *     Reasoning: Uncorrelated predicates are either False or True for *all* rows. If an uncorrelated
-   *                predicate is False and we place it on top of the largest vertex we avoid processing the vertex'
-   *                many rows in later joins.
-   */
-  if (!uncorrelated_predicates.empty()) {
-    // Find the largest vertex
-    auto largest_vertex_idx = size_t{0};
-    auto largest_vertex_cardinality =
-        cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices.front());
-
-    for (size_t vertex_idx = 1; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
-      const auto vertex_cardinality =
-          cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices[vertex_idx]);
-      if (vertex_cardinality > largest_vertex_cardinality) {
-        largest_vertex_idx = vertex_idx;
-        largest_vertex_cardinality = vertex_cardinality;
-      }
-    }
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
 
-    // Place the uncorrelated predicates on top of the largest vertex
-    auto largest_vertex_single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
-    largest_vertex_single_vertex_set.set(largest_vertex_idx);
-    auto largest_vertex_plan = best_plan[largest_vertex_single_vertex_set];
-    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
-      largest_vertex_plan = PredicateNode::make(uncorrelated_predicate, largest_vertex_plan);
-    }
-    best_plan[largest_vertex_single_vertex_set] = largest_vertex_plan;
+    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
   }
 
   /**
-   * 3. Add local predicates on top of the vertices
+   * 3. Enumerate the CsgCmpPairs and group them by the number of vertices that they join. The order of the
+   *    CsgCmpPairs within a level is kept. As both components of a CsgCmpPair are smaller than their union, the best
+   *    plans for them have been determined in one of the previous levels.
    */
-  for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
-    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
-    auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
-    single_vertex_set.set(vertex_idx);
-
-    auto& vertex_best_plan = best_plan[single_vertex_set];
-    vertex_best_plan = _add_predicates_to_plan(vertex_best_plan, vertex_predicates, cost_estimator);
+  auto enumerate_ccp = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges, max_csg_cmp_pair_count};
+  auto csg_cmp_pairs = enumerate_ccp();
+  if (enumerate_ccp.limit_exceeded()) return nullptr;
+
+  auto csg_cmp_pairs_by_level = std::vector<std::vector<CsgCmpPair>>(join_graph.vertices.size() + 1);
+  for (auto& csg_cmp_pair : csg_cmp_pairs) {
+    const auto level = csg_cmp_pair.first.count() + csg_cmp_pair.second.count();
+    csg_cmp_pairs_by_level[level].emplace_back(std::move(csg_cmp_pair));
   }
 
   /**
-   * 4. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
+   * 4. Actual DpCcp algorithm: Build candidate plans for the CsgCmpPairs of a level; keep the candidate plan for a
+   *                            particular subset of vertices if it is cheaper than the cheapest plan known so far.
+   *
+   *    Large levels are split into consecutive ranges of CsgCmpPairs that are planned by parallel jobs. The jobs only
+   *    read best_plan and keep their best plans in a local map. The candidate plans reference the shared subplans from
+   *    best_plan as detached inputs, so that the jobs do not modify them. The job maps are merged in the order of the
+   *    jobs, so that ties are broken as in the sequential enumeration. Only the best plans of a level are attached to
+   *    their subplans, which happens on the calling thread. Each job uses its own cost estimator, as the estimators'
+   *    caches are not thread-safe. The costs of the best plans of a level are added to the caches of all estimators,
+   *    so that the subplans do not have to be costed again.
    */
-  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
-  for (const auto& edge : join_graph.edges) {
-    // EnumerateCcp only deals with binary join predicates
-    if (edge.vertex_set.count() != 2) continue;
+  using PlanAndCost = std::pair<std::shared_ptr<AbstractLQPNode>, Cost>;
 
-    const auto first_vertex_idx = edge.vertex_set.find_first();
-    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+  const auto multi_threaded = Hyrise::get().is_multi_threaded();
 
-    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
+  auto job_count_by_level = std::vector<size_t>(csg_cmp_pairs_by_level.size(), 1);
+  if (multi_threaded) {
+    for (auto level = size_t{0}; level < csg_cmp_pairs_by_level.size(); ++level) {
+      job_count_by_level[level] = std::clamp(csg_cmp_pairs_by_level[level].size() / MIN_CSG_CMP_PAIRS_PER_JOB,
+                                             size_t{1}, Hyrise::get().topology.num_cpus());
+    }
   }
 
-  /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
-   */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
-  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
-    const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
-    const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
-    DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
-                "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
+  auto job_cost_estimators = std::vector<std::shared_ptr<AbstractCostEstimator>>{cost_estimator};
+  const auto max_job_count = *std::max_element(job_count_by_level.begin(), job_count_by_level.end());
+  if (max_job_count > 1) {
+    // Lazily initialized members of the vertices (e.g., the output expressions of StoredTableNodes) are not
+    // thread-safe, so we initialize them before starting any job.
+    for (const auto& vertex : join_graph.vertices) {
+      visit_lqp(vertex, [](const auto& node) {
+        node->output_expressions();
+        return LQPVisitation::VisitInputs;
+      });
+    }
+
+    while (job_cost_estimators.size() < max_job_count) {
+      const auto job_cost_estimator = cost_estimator->new_instance();
+      if (cost_estimator->cost_estimation_by_lqp_cache) job_cost_estimator->guarantee_bottom_up_construction();
+      if (cost_estimator->cardinality_estimator->cardinality_estimation_cache.join_graph_statistics_cache) {
+        job_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+      }
+      job_cost_estimators.emplace_back(job_cost_estimator);
+    }
+  }
+
+  auto budget_exceeded = std::atomic_bool{false};
+
+  const auto plan_csg_cmp_pairs = [&](const std::vector<CsgCmpPair>::const_iterator begin,
+                                      const std::vector<CsgCmpPair>::const_iterator end,
+                                      const std::shared_ptr<AbstractCostEstimator>& job_cost_estimator,
+                                      std::map<JoinGraphVertexSet, PlanAndCost>& job_best_plan) {
+    auto planned_pair_count = size_t{0};
+    for (auto csg_cmp_pair_iter = begin; csg_cmp_pair_iter != end; ++csg_cmp_pair_iter) {
+      if (deadline && planned_pair_count++ % BUDGET_CHECK_INTERVAL == 0) {
+        if (budget_exceeded || std::chrono::steady_clock::now() >= *deadline) {
+          budget_exceeded = true;
+          return;
+        }
+      }
+
+      const auto& [csg, cmp] = *csg_cmp_pair_iter;
+      const auto best_plan_left_iter = best_plan.find(csg);
+      const auto best_plan_right_iter = best_plan.find(cmp);
+      DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
+                  "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
 
-    const auto join_predicates = join_graph.find_join_predicates(csg_cmp_pair.first, csg_cmp_pair.second);
+      const auto join_predicates = join_graph.find_join_predicates(csg, cmp);
 
-    auto candidate_plan =
-        _add_join_to_plan(best_plan_left_iter->second, best_plan_right_iter->second, join_predicates, cost_estimator);
+      auto candidate_plan = _build_join_plan_candidate(best_plan_left_iter->second, best_plan_right_iter->second,
+                                                       join_predicates, job_cost_estimator);
+      const auto candidate_cost = job_cost_estimator->estimate_plan_cost(candidate_plan);
 
-    const auto joined_vertex_set = csg_cmp_pair.first | csg_cmp_pair.second;
+      const auto joined_vertex_set = csg | cmp;
 
-    const auto best_plan_iter = best_plan.find(joined_vertex_set);
-    if (best_plan_iter == best_plan.end() || cost_estimator->estimate_plan_cost(candidate_plan) <
-                                                 cost_estimator->estimate_plan_cost(best_plan_iter->second)) {
-      best_plan.insert_or_assign(joined_vertex_set, candidate_plan);
+      const auto job_best_plan_iter = job_best_plan.find(joined_vertex_set);
+      if (job_best_plan_iter == job_best_plan.end() || candidate_cost < job_best_plan_iter->second.second) {
+        job_best_plan.insert_or_assign(joined_vertex_set, PlanAndCost{candidate_plan, candidate_cost});
+      }
+    }
+  };
+
+  for (auto level = size_t{0}; level < csg_cmp_pairs_by_level.size(); ++level) {
+    const auto& level_csg_cmp_pairs = csg_cmp_pairs_by_level[level];
+    if (level_csg_cmp_pairs.empty()) continue;
+
+    const auto job_count = job_count_by_level[level];
+    auto job_best_plans = std::vector<std::map<JoinGraphVertexSet, PlanAndCost>>(job_count);
+    if (job_count == 1) {
+      plan_csg_cmp_pairs(level_csg_cmp_pairs.cbegin(), level_csg_cmp_pairs.cend(), cost_estimator,
+                         job_best_plans.front());
+    } else {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(job_count);
+      for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+        const auto begin = level_csg_cmp_pairs.cbegin() + level_csg_cmp_pairs.size() * job_idx / job_count;
+        const auto end = level_csg_cmp_pairs.cbegin() + level_csg_cmp_pairs.size() * (job_idx + 1) / job_count;
+        jobs.emplace_back(std::make_shared<JobTask>([&, begin, end, job_idx]() {
+          plan_csg_cmp_pairs(begin, end, job_cost_estimators[job_idx], job_best_plans[job_idx]);
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    }
+
+    if (budget_exceeded) return nullptr;
+
+    auto level_best_plan = std::move(job_best_plans.front());
+    for (auto job_idx = size_t{1}; job_idx < job_count; ++job_idx) {
+      for (auto& [vertex_set, plan_and_cost] : job_best_plans[job_idx]) {
+        const auto [level_best_plan_iter, inserted] = level_best_plan.try_emplace(vertex_set, plan_and_cost);
+        if (!inserted && plan_and_cost.second < level_best_plan_iter->second.second) {
+          level_best_plan_iter->second = std::move(plan_and_cost);
+        }
+      }
+    }
+
+    for (const auto& [vertex_set, plan_and_cost] : level_best_plan) {
+      _attach_join_plan_candidate(plan_and_cost.first);
+      best_plan.emplace(vertex_set, plan_and_cost.first);
+
+      if (job_cost_estimators.size() == 1) continue;
+      for (const auto& job_cost_estimator : job_cost_estimators) {
+        if (!job_cost_estimator->cost_estimation_by_lqp_cache) continue;
+        job_cost_estimator->cost_estimation_by_lqp_cache->emplace(plan_and_cost.first, plan_and_cost.second);
+      }
     }
   }
 
   /**
-   * 6. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
+   * 5. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
    *    graph.
    */
   boost::dynamic_bitset<> all_vertices_set{join_graph.vertices.size()};
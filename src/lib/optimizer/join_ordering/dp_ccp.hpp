@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -16,12 +19,42 @@ class JoinGraph;
  * joins and treats outer joins as opaque (i.e. outer joins are not moved and no other joins are moved pass them).
  * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations.
  *
+ * The candidate joins are costed level by level, i.e., grouped by the number of vertices they join. The best plans
+ * of a level only depend on the best plans of the previous levels, so that large levels are costed by multiple jobs
+ * if Hyrise is multi-threaded. Apart from ties between plans whose estimated costs only differ because of rounding,
+ * the result is the same as for costing the candidates sequentially.
+ *
+ * As the number of candidate joins grows exponentially with the number of vertices for dense JoinGraphs, the
+ * planning effort can be bounded. If a budget is exceeded, no plan is returned and the caller has to fall back to a
+ * heuristic (see JoinOrderingRule).
+ *
  * Local predicates are pushed down and sorted by increasing cost.
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
+  /**
+   * @param init_planning_time_budget       If set, the planning is aborted once it takes longer than this
+   * @param init_max_csg_cmp_pair_count     If set, the planning is aborted without costing any plan if the JoinGraph
+   *                                        has more candidate joins (i.e., CsgCmpPairs) than this
+   */
+  explicit DpCcp(const std::optional<std::chrono::microseconds>& init_planning_time_budget = std::nullopt,
+                 const std::optional<size_t>& init_max_csg_cmp_pair_count = std::nullopt);
+
+  /**
+   * @return    The optimal plan or nullptr if one of the budgets was exceeded
+   */
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
                                               const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+  const std::optional<std::chrono::microseconds> planning_time_budget;
+  const std::optional<size_t> max_csg_cmp_pair_count;
+
+ protected:
+  // Levels with fewer candidate joins per job are not worth scheduling
+  static constexpr auto MIN_CSG_CMP_PAIRS_PER_JOB = size_t{64};
+
+  // The budget is checked after every this many candidate joins
+  static constexpr auto BUDGET_CHECK_INTERVAL = size_t{32};
 };
 
 }  // namespace opossum
@@ -54,11 +54,21 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
-
-  // Corresponds to EnumerateCsg in the paper
+  /**
+   * @param max_csg_cmp_pair_count  If set, the enumeration stops once more CsgCmpPairs than this have been found. The
+   *                                number of CsgCmpPairs grows exponentially for dense JoinGraphs (e.g., stars and
+   *                                cliques), so this bounds the time and memory spent on large JoinGraphs.
+   */
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const std::optional<size_t>& max_csg_cmp_pair_count = std::nullopt);
+
+  // Corresponds to EnumerateCsg in the paper. If the enumeration was stopped because of max_csg_cmp_pair_count, only a
+  // prefix of the CsgCmpPairs is returned.
   std::vector<CsgCmpPair> operator()();
 
+  // Whether the enumeration was stopped because more than max_csg_cmp_pair_count CsgCmpPairs exist
+  bool limit_exceeded() const;
+
  private:
   // Corresponds to EnumerateCsgRec in the paper
   void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
@@ -80,6 +90,7 @@ class EnumerateCcp final {
 
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const std::optional<size_t> _max_csg_cmp_pair_count;
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
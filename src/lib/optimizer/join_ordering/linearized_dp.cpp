@@ -0,0 +1,152 @@
+#include "linearized_dp.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+  const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+
+  /**
+   * 1. Initialize the plans of the vertices with their local and uncorrelated predicates
+   */
+  const auto vertex_plans = _build_vertex_plans(join_graph, cost_estimator);
+  if (vertex_count == 1) return vertex_plans.front();
+
+  /**
+   * 2. Determine the neighborhood of each vertex. As in DpCcp, only binary edges connect vertices.
+   */
+  auto vertex_neighborhoods = std::vector<JoinGraphVertexSet>(vertex_count, JoinGraphVertexSet{vertex_count});
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+
+    vertex_neighborhoods[first_vertex_idx].set(second_vertex_idx);
+    vertex_neighborhoods[second_vertex_idx].set(first_vertex_idx);
+  }
+
+  const auto neighborhood = [&](const JoinGraphVertexSet& vertex_set) {
+    auto vertex_set_neighborhood = JoinGraphVertexSet{vertex_count};
+    for (auto vertex_idx = vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = vertex_set.find_next(vertex_idx)) {
+      vertex_set_neighborhood |= vertex_neighborhoods[vertex_idx];
+    }
+    return vertex_set_neighborhood - vertex_set;
+  };
+
+  /**
+   * 3. Linearize the JoinGraph: Start with the vertex with the lowest cardinality and repeatedly append the connected
+   *    vertex that yields the lowest cardinality when joined with the vertices ordered so far
+   */
+  auto vertex_order = std::vector<size_t>{};
+  vertex_order.reserve(vertex_count);
+
+  auto first_vertex_idx = size_t{0};
+  auto first_vertex_cardinality = cardinality_estimator->estimate_cardinality(vertex_plans.front());
+  for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+    const auto vertex_cardinality = cardinality_estimator->estimate_cardinality(vertex_plans[vertex_idx]);
+    if (vertex_cardinality < first_vertex_cardinality) {
+      first_vertex_idx = vertex_idx;
+      first_vertex_cardinality = vertex_cardinality;
+    }
+  }
+
+  vertex_order.emplace_back(first_vertex_idx);
+  auto ordered_vertex_set = JoinGraphVertexSet{vertex_count};
+  ordered_vertex_set.set(first_vertex_idx);
+  auto ordered_plan = vertex_plans[first_vertex_idx];
+
+  while (vertex_order.size() < vertex_count) {
+    const auto candidate_vertex_set = neighborhood(ordered_vertex_set);
+    Assert(candidate_vertex_set.any(), "Vertices cannot be linearized. Maybe JoinGraph isn't connected?");
+
+    auto next_vertex_idx = size_t{0};
+    auto next_plan = std::shared_ptr<AbstractLQPNode>{};
+    auto next_cardinality = Cardinality{0};
+
+    for (auto vertex_idx = candidate_vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = candidate_vertex_set.find_next(vertex_idx)) {
+      auto single_vertex_set = JoinGraphVertexSet{vertex_count};
+      single_vertex_set.set(vertex_idx);
+
+      const auto join_predicates = join_graph.find_join_predicates(ordered_vertex_set, single_vertex_set);
+      const auto plan = _add_join_to_plan(ordered_plan, vertex_plans[vertex_idx], join_predicates, cost_estimator);
+      const auto cardinality = cardinality_estimator->estimate_cardinality(plan);
+
+      if (!next_plan || cardinality < next_cardinality) {
+        next_vertex_idx = vertex_idx;
+        next_plan = plan;
+        next_cardinality = cardinality;
+      }
+    }
+
+    vertex_order.emplace_back(next_vertex_idx);
+    ordered_vertex_set.set(next_vertex_idx);
+    ordered_plan = next_plan;
+  }
+
+  /**
+   * 4. Dynamic programming over the consecutive ranges of the linear order. best_plans[first][last] holds the best plan
+   *    for the vertices vertex_order[first..last] and its cost, or nullptr if these vertices are not connected.
+   */
+  using PlanAndCost = std::pair<std::shared_ptr<AbstractLQPNode>, Cost>;
+  auto best_plans = std::vector<std::vector<PlanAndCost>>(vertex_count, std::vector<PlanAndCost>(vertex_count));
+  auto range_vertex_sets =
+      std::vector<std::vector<JoinGraphVertexSet>>(vertex_count, std::vector<JoinGraphVertexSet>(vertex_count));
+
+  for (auto first = size_t{0}; first < vertex_count; ++first) {
+    best_plans[first][first].first = vertex_plans[vertex_order[first]];
+
+    range_vertex_sets[first][first] = JoinGraphVertexSet{vertex_count};
+    range_vertex_sets[first][first].set(vertex_order[first]);
+    for (auto last = first + 1; last < vertex_count; ++last) {
+      range_vertex_sets[first][last] = range_vertex_sets[first][last - 1];
+      range_vertex_sets[first][last].set(vertex_order[last]);
+    }
+  }
+
+  for (auto range_size = size_t{2}; range_size <= vertex_count; ++range_size) {
+    for (auto first = size_t{0}; first + range_size <= vertex_count; ++first) {
+      const auto last = first + range_size - 1;
+      auto& best_plan = best_plans[first][last];
+
+      for (auto split = first; split < last; ++split) {
+        const auto& left_plan = best_plans[first][split].first;
+        const auto& right_plan = best_plans[split + 1][last].first;
+        if (!left_plan || !right_plan) continue;
+
+        const auto& left_vertex_set = range_vertex_sets[first][split];
+        const auto& right_vertex_set = range_vertex_sets[split + 1][last];
+        if ((neighborhood(left_vertex_set) & right_vertex_set).none()) continue;
+
+        const auto join_predicates = join_graph.find_join_predicates(left_vertex_set, right_vertex_set);
+        auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, cost_estimator);
+        const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_plan);
+
+        if (!best_plan.first || candidate_cost < best_plan.second) {
+          best_plan = {candidate_plan, candidate_cost};
+        }
+      }
+    }
+  }
+
+  const auto& result_plan = best_plans.front().back().first;
+  Assert(result_plan, "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+  return result_plan;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Heuristic join ordering algorithm for JoinGraphs that are too large for DpCcp, described in "Adaptive Optimization
+ * of Very Large Join Queries" (Neumann and Radke, SIGMOD 2018):
+ * https://dl.acm.org/doi/10.1145/3183713.3183733
+ *
+ * The vertices are first brought into a linear order, which is then used to restrict dynamic programming to joins of
+ * consecutive ranges of vertices. This takes O(n^3) steps instead of the exponential effort of DpCcp. In contrast to
+ * GreedyOperatorOrdering, bushy plans are considered.
+ *
+ * The paper derives the linear order from IKKBZ, which requires a cost function with the ASI property. Our cost
+ * estimators do not guarantee it. Instead, the order is built greedily: Starting with the smallest vertex, the
+ * connected vertex that yields the lowest cardinality when joined with the vertices ordered so far is appended. Thus,
+ * each prefix of the order is connected and a plan for all vertices is always found.
+ *
+ * Like DpCcp, only inner joins and cross joins are handled and local predicates are pushed down.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+};
+
+}  // namespace opossum
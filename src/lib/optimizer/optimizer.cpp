@@ -137,16 +137,13 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // StoredTableNode as possible where the ChunkPruningRule can work with them.
   optimizer->add_rule(std::make_unique<ChunkPruningRule>());
 
+  // Prune chunks without join partners after the ChunkPruningRule, so that the chunks it pruned do not count as join
+  // partners anymore.
   optimizer->add_rule(std::make_unique<DipsPruningRule>());
 
-  // optimizer->add_rule(std::make_unique<ChunkPruningRule>());
-
-
-
-
   // This is an optimization for the PQP sub-plan memoization which is sensitive to the a StoredTableNode's table name,
   // set of pruned chunks and set of pruned columns. Since this rule depends on pruning information, it has to be
-  // executed after the ColumnPruningRule and ChunkPruningRule.
+  // executed after the ColumnPruningRule, ChunkPruningRule, and DipsPruningRule.
   optimizer->add_rule(std::make_unique<StoredTableColumnAlignmentRule>());
 
   // Bring predicates into the desired order once the PredicatePlacementRule has positioned them as desired
@@ -6,6 +6,9 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -95,6 +98,11 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
                                                                           *stored_table_node_without_column_pruning);
   // End of hacky
 
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate_without_column_pruning)) {
+    return _compute_exclude_list_for_in_expression(table, *in_expression, *stored_table_node_without_column_pruning,
+                                                   stored_table_node);
+  }
+
   if (!operator_predicates) return {};
 
   std::set<ChunkID> result;
@@ -167,45 +175,83 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
   return result;
 }
 
-bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
-                                  const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
-                                  const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
+std::set<ChunkID> ChunkPruningRule::_compute_exclude_list_for_in_expression(
+    const Table& table, const InExpression& in_expression,
+    const StoredTableNode& stored_table_node_without_column_pruning,
+    const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  // A chunk can be pruned for `column IN (value, ...)` if it can be pruned for `column = value` for each of the values.
+  const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression.set());
+  if (in_expression.is_negated() || !list_expression) return {};
 
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
+  const auto column_id = stored_table_node_without_column_pruning.find_column_id(*in_expression.value());
+  if (!column_id) return {};
 
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+  const auto column_data_type = in_expression.value()->data_type();
 
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
-    }
+  auto values = std::vector<AllTypeVariant>{};
+  for (const auto& element : list_expression->elements()) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(element);
+    if (!value_expression) return {};
 
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
+    // NULL is never equal to a value in the column, so that it does not prevent pruning
+    if (variant_is_null(value_expression->value)) continue;
+
+    // See _compute_exclude_list for why we do not prune values that cannot be converted losslessly
+    const auto value = lossless_variant_cast(value_expression->value, column_data_type);
+    if (!value) return {};
+
+    values.emplace_back(*value);
+  }
+
+  if (values.empty()) return {};
+
+  std::set<ChunkID> result;
+
+  const auto chunk_count = table.chunk_count();
+  auto num_rows_pruned = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto pruning_statistics = chunk->pruning_statistics();
+    if (!pruning_statistics) continue;
+
+    const auto& segment_statistics = *(*pruning_statistics)[*column_id];
+    const auto can_prune = std::all_of(values.begin(), values.end(), [&](const auto& value) {
+      return _can_prune(segment_statistics, PredicateCondition::Equals, value, std::nullopt);
+    });
+    if (!can_prune) continue;
+
+    const auto& already_pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+    if (std::find(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), chunk_id) ==
+        already_pruned_chunk_ids.end()) {
+      num_rows_pruned += chunk->size();
     }
-  });
+    result.insert(chunk_id);
+  }
 
-  return can_prune;
+  if (num_rows_pruned > size_t{0}) {
+    const auto& old_statistics =
+        stored_table_node->table_statistics ? stored_table_node->table_statistics : table.table_statistics();
+    stored_table_node->table_statistics = _prune_table_statistics(*old_statistics, std::nullopt, num_rows_pruned);
+  }
+
+  return result;
+}
+
+bool ChunkPruningRule::_can_prune(const BaseAttributeStatistics& base_segment_statistics,
+                                  const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                  const std::optional<AllTypeVariant>& variant_value2) {
+  return base_segment_statistics.does_not_contain(predicate_condition, variant_value, variant_value2);
 }
 
 bool ChunkPruningRule::_is_non_filtering_node(const AbstractLQPNode& node) {
   return node.type == LQPNodeType::Alias || node.type == LQPNodeType::Projection || node.type == LQPNodeType::Sort;
 }
 
-std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(const TableStatistics& old_statistics,
-                                                                           OperatorScanPredicate predicate,
-                                                                           size_t num_rows_pruned) {
+std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(
+    const TableStatistics& old_statistics, const std::optional<OperatorScanPredicate>& predicate,
+    size_t num_rows_pruned) {
   // If a chunk is pruned, we update the table statistics. This is so that the selectivity of the predicate that was
   // used for pruning can be correctly estimated. Example: For a table that has sorted values from 1 to 100 and a chunk
   // size of 10, the predicate `x > 90` has a selectivity of 10%. However, if the ChunkPruningRule removes nine chunks
@@ -218,6 +264,9 @@ std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(const
   //
   // For now, this does not take any sorting on a chunk- or table-level into account. In the future, this may be done
   // to further improve the accuracy of the statistics.
+  //
+  // Predicates that are not OperatorScanPredicates (i.e., IN) are passed as std::nullopt. In this case, all columns
+  // are scaled.
 
   const auto column_count = old_statistics.column_statistics.size();
 
@@ -225,11 +274,11 @@ std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(const
 
   const auto scale = 1 - (static_cast<float>(num_rows_pruned) / old_statistics.row_count);
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    if (column_id == predicate.column_id) {
+    if (predicate && column_id == predicate->column_id) {
       column_statistics[column_id] = old_statistics.column_statistics[column_id]->pruned(
-          num_rows_pruned, predicate.predicate_condition, boost::get<AllTypeVariant>(predicate.value),
-          predicate.value2 ? std::optional<AllTypeVariant>{boost::get<AllTypeVariant>(*predicate.value2)}
-                           : std::nullopt);
+          num_rows_pruned, predicate->predicate_condition, boost::get<AllTypeVariant>(predicate->value),
+          predicate->value2 ? std::optional<AllTypeVariant>{boost::get<AllTypeVariant>(*predicate->value2)}
+                            : std::nullopt);
     } else {
       column_statistics[column_id] = old_statistics.column_statistics[column_id]->scaled(scale);
     }
@@ -15,6 +15,7 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class AbstractExpression;
+class InExpression;
 class StoredTableNode;
 class PredicateNode;
 class Table;
@@ -32,6 +33,12 @@ class ChunkPruningRule : public AbstractRule {
   static std::set<ChunkID> _compute_exclude_list(const Table& table, const AbstractExpression& predicate,
                                                  const std::shared_ptr<StoredTableNode>& stored_table_node);
 
+  // IN predicates cannot be expressed as OperatorScanPredicates and are thus handled separately
+  static std::set<ChunkID> _compute_exclude_list_for_in_expression(
+      const Table& table, const InExpression& in_expression,
+      const StoredTableNode& stored_table_node_without_column_pruning,
+      const std::shared_ptr<StoredTableNode>& stored_table_node);
+
   // Check whether any of the statistics objects available for this Segment identify the predicate as prunable
   static bool _can_prune(const BaseAttributeStatistics& base_segment_statistics,
                          const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
@@ -39,9 +46,9 @@ class ChunkPruningRule : public AbstractRule {
 
   static bool _is_non_filtering_node(const AbstractLQPNode& node);
 
-  static std::shared_ptr<TableStatistics> _prune_table_statistics(const TableStatistics& old_statistics,
-                                                                  OperatorScanPredicate predicate,
-                                                                  size_t num_rows_pruned);
+  static std::shared_ptr<TableStatistics> _prune_table_statistics(
+      const TableStatistics& old_statistics, const std::optional<OperatorScanPredicate>& predicate,
+      size_t num_rows_pruned);
 };
 
 }  // namespace opossum
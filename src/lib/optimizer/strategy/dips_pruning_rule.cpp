@@ -1,186 +1,251 @@
 #include "dips_pruning_rule.hpp"
-#include "expression/abstract_expression.hpp"
-#include "logical_query_plan/lqp_utils.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
-#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
-#include "logical_query_plan/abstract_lqp_node.hpp"
-#include "expression/binary_predicate_expression.hpp"
-#include "expression/expression_functional.hpp"
-#include "expression/abstract_expression.hpp"
-#include "optimizer/strategy/chunk_pruning_rule.hpp"
-#include "statistics/base_attribute_statistics.hpp"
+#include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
-#include "resolve_type.hpp"
-#include "hyrise.hpp"
-#include <iostream>
-
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
+void DipsPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto join_graph_edges = _build_join_graph(node);
+
+  // Every iteration prunes at least one chunk or terminates the loop. Thus, this also terminates for cyclic join
+  // graphs.
+  auto pruned_chunks = true;
+  while (pruned_chunks) {
+    pruned_chunks = false;
+    for (const auto& edge : join_graph_edges) {
+      if (edge.prune_left) {
+        pruned_chunks |= _prune_join_partner(edge.left_node, edge.left_column_id, edge.right_node,
+                                             edge.right_column_id, edge.predicate_condition);
+      }
+      if (edge.prune_right) {
+        pruned_chunks |= _prune_join_partner(edge.right_node, edge.right_column_id, edge.left_node,
+                                             edge.left_column_id, flip_predicate_condition(edge.predicate_condition));
+      }
+    }
+  }
+}
+
+std::vector<DipsPruningRule::JoinGraphEdge> DipsPruningRule::_build_join_graph(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto edges = std::vector<JoinGraphEdge>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Join) return LQPVisitation::VisitInputs;
+
+    const auto& join_node = static_cast<const JoinNode&>(*node);
+    for (const auto& join_predicate : join_node.join_predicates()) {
+      const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+      if (!binary_predicate) continue;
+
+      const auto predicate_condition = binary_predicate->predicate_condition;
+      if (predicate_condition != PredicateCondition::Equals && predicate_condition != PredicateCondition::NotEquals &&
+          predicate_condition != PredicateCondition::LessThan &&
+          predicate_condition != PredicateCondition::LessThanEquals &&
+          predicate_condition != PredicateCondition::GreaterThan &&
+          predicate_condition != PredicateCondition::GreaterThanEquals) {
+        continue;
+      }
 
-  void DipsPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
-      
-      // 1. bau den JoinGraph (Baum traversieren)
-      // (1.1) Verhindere Zyklen
-      // 2. Waehle Wurzel
-      // 3. Child-Parent Pointers setzen
-      // 4. Baum von unten nach oben durchgehen (Paper)
-      // 5. Baum von oben nach unten durchgehen (Paper)
-
-    // _clear_join_graph();
+      const auto left_column = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+      const auto right_column = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+      if (!left_column || !right_column || left_column->data_type() != right_column->data_type()) continue;
+
+      const auto left_node = std::const_pointer_cast<StoredTableNode>(
+          std::dynamic_pointer_cast<const StoredTableNode>(left_column->original_node.lock()));
+      const auto right_node = std::const_pointer_cast<StoredTableNode>(
+          std::dynamic_pointer_cast<const StoredTableNode>(right_column->original_node.lock()));
+      if (!left_node || !right_node || left_node == right_node) continue;
+
+      const auto left_input_side = _join_input_side(left_node, join_node);
+      const auto right_input_side = _join_input_side(right_node, join_node);
+      if (!left_input_side || !right_input_side || *left_input_side == *right_input_side) continue;
+
+      // Rows without a join partner are only removed from the inputs of inner and semi joins and from the
+      // null-supplying side of outer joins. Rows of the right input of a semi join that have no partner do not affect
+      // the result either.
+      const auto can_prune_side = [&](const LQPInputSide input_side) {
+        switch (join_node.join_mode) {
+          case JoinMode::Inner:
+          case JoinMode::Semi:
+            return true;
+          case JoinMode::Left:
+            return input_side == LQPInputSide::Right;
+          case JoinMode::Right:
+            return input_side == LQPInputSide::Left;
+          default:
+            return false;
+        }
+      };
 
-    std::shared_ptr<DipsJoinGraph> join_graph = std::make_shared<DipsJoinGraph>();
-    _build_join_graph(node, join_graph);
-    
-    std::cout << *join_graph << '\n';
-    std::cout << "Is tree: "<< join_graph->is_tree() << '\n';
+      const auto prune_left = can_prune_side(*left_input_side);
+      const auto prune_right = can_prune_side(*right_input_side);
+      if (!prune_left && !prune_right) continue;
 
-    if(join_graph->is_tree()){
-      // TODO: tree implementation 
-    } else {
-      // TODO: cycle implementation
+      edges.emplace_back(JoinGraphEdge{left_node, left_column->original_column_id, right_node,
+                                       right_column->original_column_id, predicate_condition, prune_left,
+                                       prune_right});
     }
 
+    return LQPVisitation::VisitInputs;
+  });
+
+  return edges;
+}
+
+std::optional<LQPInputSide> DipsPruningRule::_join_input_side(
+    const std::shared_ptr<AbstractLQPNode>& stored_table_node, const JoinNode& join_node) {
+  auto node = stored_table_node;
+  while (node->output_count() == 1) {
+    const auto output = node->outputs().front();
+    const auto input_side = node->get_input_side(output);
+    if (output.get() == &join_node) return input_side;
+
+    switch (output->type) {
+      case LQPNodeType::Alias:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::Validate:
+        break;
+      case LQPNodeType::Join: {
+        // The right input of semi and anti joins is not part of their output, so it does not reach join_node anyway.
+        // For anti joins, removing rows from the right input would change the result.
+        const auto join_mode = static_cast<const JoinNode&>(*output).join_mode;
+        if (input_side == LQPInputSide::Right &&
+            (join_mode == JoinMode::Semi || join_mode == JoinMode::AntiNullAsTrue ||
+             join_mode == JoinMode::AntiNullAsFalse)) {
+          return std::nullopt;
+        }
+      } break;
+      default:
+        return std::nullopt;
+    }
 
-    /*
-    _apply_to_inputs(node);
-
-    if (node->type == LQPNodeType::Join) {
-      const auto& join_node = static_cast<JoinNode&>(*node);
-      const auto join_predicates = join_node.join_predicates();
-          
-      for (auto predicate : join_predicates) {
-
-        std::shared_ptr<BinaryPredicateExpression> binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
-        auto left_operand = binary_predicate->left_operand();
-        auto right_operand = binary_predicate->right_operand();
+    node = output;
+  }
 
-        auto left_lqp = std::dynamic_pointer_cast<LQPColumnExpression>(left_operand);
-        auto right_lqp = std::dynamic_pointer_cast<LQPColumnExpression>(right_operand);
+  return std::nullopt;
+}
 
-        if (!left_lqp || !right_lqp) {
-          return;
-        }
+bool DipsPruningRule::_prune_join_partner(const std::shared_ptr<StoredTableNode>& partner_node,
+                                          const ColumnID partner_column_id,
+                                          const std::shared_ptr<StoredTableNode>& base_node,
+                                          const ColumnID base_column_id, const PredicateCondition predicate_condition) {
+  const auto table = Hyrise::get().storage_manager.get_table(partner_node->table_name);
 
-        // TODO: check const pointer cast
+  auto pruned_chunk_ids = std::set<ChunkID>{};
+  resolve_data_type(table->column_data_type(partner_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
 
-        std::shared_ptr<StoredTableNode> left_stored_table_node = std::const_pointer_cast<StoredTableNode>(std::dynamic_pointer_cast<const StoredTableNode>(left_lqp->original_node.lock()));
-        std::shared_ptr<StoredTableNode> right_stored_table_node = std::const_pointer_cast<StoredTableNode>(std::dynamic_pointer_cast<const StoredTableNode>(right_lqp->original_node.lock()));
-        // int number_of_pruned_left = left_stored_table_node->pruned_chunk_ids().size();
-        // int number_of_pruned_right = right_stored_table_node->pruned_chunk_ids().size();
+    // If a base chunk has no statistics, we do not know which join partners it provides
+    const auto base_ranges = _get_not_pruned_range_statistics<ColumnDataType>(*base_node, base_column_id, false);
+    if (!base_ranges) return;
 
-        if (!left_stored_table_node || !right_stored_table_node) {
-          return;
-        }
+    const auto partner_ranges =
+        _get_not_pruned_range_statistics<ColumnDataType>(*partner_node, partner_column_id, true);
+    pruned_chunk_ids = calculate_pruned_chunks<ColumnDataType>(*base_ranges, *partner_ranges, predicate_condition);
+  });
 
-        // LEFT -> RIGHT
-        dips_pruning(left_stored_table_node, left_lqp->original_column_id, right_stored_table_node, right_lqp->original_column_id);
+  if (pruned_chunk_ids.empty()) return false;
 
-        // RIGHT -> LEFT
-        dips_pruning(right_stored_table_node, right_lqp->original_column_id, left_stored_table_node, left_lqp->original_column_id);
+  // Scale the statistics to the remaining rows, as the ChunkPruningRule does. We cannot slice the statistics of the
+  // join column, as the pruned ranges are not known to the statistics objects.
+  auto num_rows_pruned = size_t{0};
+  for (const auto chunk_id : pruned_chunk_ids) {
+    num_rows_pruned += table->get_chunk(chunk_id)->size();
+  }
 
-        // std::cout << "Prune on " << left_stored_table_node->table_name << " Before: " << number_of_pruned_left << " After " << left_stored_table_node->pruned_chunk_ids().size() << std::endl;
-        // std::cout << "Prune on " << right_stored_table_node->table_name << " Before: " << number_of_pruned_right << " After " << right_stored_table_node->pruned_chunk_ids().size() << std::endl;
-      
-      }
+  const auto& old_statistics =
+      partner_node->table_statistics ? partner_node->table_statistics : table->table_statistics();
+  if (old_statistics && old_statistics->row_count > 0.0f) {
+    const auto scale = 1.0f - std::min(static_cast<float>(num_rows_pruned) / old_statistics->row_count, 1.0f);
+    auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+    column_statistics.reserve(old_statistics->column_statistics.size());
+    for (const auto& old_column_statistics : old_statistics->column_statistics) {
+      column_statistics.emplace_back(old_column_statistics->scaled(scale));
     }
-    */
+    partner_node->table_statistics =
+        std::make_shared<TableStatistics>(std::move(column_statistics), old_statistics->row_count * scale);
   }
 
-  void DipsPruningRule::_build_join_graph(const std::shared_ptr<AbstractLQPNode>& node, std::shared_ptr<DipsJoinGraph> join_graph) const {
-    if (node->left_input()) _build_join_graph(node->left_input(), join_graph);
-    if (node->right_input()) _build_join_graph(node->right_input(), join_graph);
+  partner_node->join_pruned_chunk_count += pruned_chunk_ids.size();
+  _extend_pruned_chunks(*partner_node, pruned_chunk_ids);
 
-    if (node->type == LQPNodeType::Join) {
-      const auto& join_node = static_cast<JoinNode&>(*node);
-      const auto join_predicates = join_node.join_predicates();
+  return true;
+}
 
-      for (auto predicate : join_predicates) {
+void DipsPruningRule::_extend_pruned_chunks(StoredTableNode& stored_table_node,
+                                            const std::set<ChunkID>& pruned_chunk_ids) {
+  const auto& already_pruned_chunk_ids = stored_table_node.pruned_chunk_ids();
 
-        std::shared_ptr<BinaryPredicateExpression> binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
-        auto left_operand = binary_predicate->left_operand();
-        auto right_operand = binary_predicate->right_operand();
+  auto union_chunk_ids = std::vector<ChunkID>{};
+  std::set_union(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), pruned_chunk_ids.begin(),
+                 pruned_chunk_ids.end(), std::back_inserter(union_chunk_ids));
+  stored_table_node.set_pruned_chunk_ids(union_chunk_ids);
+}
 
-        auto left_lqp = std::dynamic_pointer_cast<LQPColumnExpression>(left_operand);
-        auto right_lqp = std::dynamic_pointer_cast<LQPColumnExpression>(right_operand);
+template <typename T>
+std::optional<std::map<ChunkID, std::vector<std::pair<T, T>>>> DipsPruningRule::_get_not_pruned_range_statistics(
+    const StoredTableNode& stored_table_node, const ColumnID column_id, const bool skip_chunks_without_statistics) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto& pruned_chunk_ids = stored_table_node.pruned_chunk_ids();
 
-        if (!left_lqp || !right_lqp) {
-          continue;
-        }
+  auto ranges = std::map<ChunkID, std::vector<std::pair<T, T>>>{};
 
-        std::shared_ptr<StoredTableNode> left_stored_table_node = std::const_pointer_cast<StoredTableNode>(std::dynamic_pointer_cast<const StoredTableNode>(left_lqp->original_node.lock()));
-        std::shared_ptr<StoredTableNode> right_stored_table_node = std::const_pointer_cast<StoredTableNode>(std::dynamic_pointer_cast<const StoredTableNode>(right_lqp->original_node.lock()));
-
-        // access join graph nodes
-        auto left_join_graph_node = join_graph->get_node_for_table(left_stored_table_node);
-        auto right_join_graph_node = join_graph->get_node_for_table(right_stored_table_node);
-        
-        // access edges
-        auto left_right_edge = left_join_graph_node->get_edge_for_table(right_join_graph_node);
-        auto right_left_edge = right_join_graph_node->get_edge_for_table(left_join_graph_node);
-
-        // append predicates
-        left_right_edge->predicates.push_back(predicate);
-        right_left_edge->predicates.push_back(predicate);
-        
-      }
-    }
-  }
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (std::binary_search(pruned_chunk_ids.begin(), pruned_chunk_ids.end(), chunk_id)) continue;
+
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
 
-  void DipsPruningRule::extend_pruned_chunks( std::shared_ptr<StoredTableNode> table_node, std::set<ChunkID> pruned_chunk_ids) const
-  {
-    const auto& already_pruned_chunk_ids = table_node->pruned_chunk_ids();
-    
-    if (!already_pruned_chunk_ids.empty()) {
-      std::vector<ChunkID> union_values;
-      std::set_union(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), pruned_chunk_ids.begin(),
-                          pruned_chunk_ids.end(), std::back_inserter(union_values));
-      table_node->set_pruned_chunk_ids(union_values);
-    } else {
-      table_node->set_pruned_chunk_ids(std::vector<ChunkID>(pruned_chunk_ids.begin(), pruned_chunk_ids.end()));
+    const auto pruning_statistics = chunk->pruning_statistics();
+    if (!pruning_statistics) {
+      if (skip_chunks_without_statistics) continue;
+      return std::nullopt;
     }
-  }
 
+    const auto segment_statistics =
+        std::dynamic_pointer_cast<const AttributeStatistics<T>>((*pruning_statistics)[column_id]);
+    DebugAssert(segment_statistics, "Expected AttributeStatistics of the column's data type");
 
-  void DipsPruningRule::dips_pruning(const std::shared_ptr<const StoredTableNode> table_node, ColumnID column_id, std::shared_ptr<StoredTableNode> join_partner_table_node, ColumnID join_partner_column_id) const {
-    auto table = Hyrise::get().storage_manager.get_table(table_node->table_name);
-
-    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
-      using ColumnDataType = typename decltype(data_type_t)::type;
-
-      // TODO: check if pointers would be more efficient
-      auto base_ranges = get_not_pruned_range_statistics<ColumnDataType>(table_node, column_id);
-      auto partner_ranges = get_not_pruned_range_statistics<ColumnDataType>(join_partner_table_node, join_partner_column_id);
-      auto pruned_chunks = calculate_pruned_chunks<ColumnDataType>(base_ranges, partner_ranges);
-      extend_pruned_chunks(join_partner_table_node, pruned_chunks);
-    });
-  } 
-
-  std::ostream& operator<<(std::ostream& stream, const DipsJoinGraph join_graph) {
-      stream << "==== Vertices ====" << std::endl;
-    if (join_graph.nodes.empty()) {
-      stream << "<none>" << std::endl;
-    } else {
-      for (const auto node : join_graph.nodes) {
-        stream << node->table_node->description() << std::endl;
-        stream << "      ==== Edges ====" << std::endl;
-        for (const auto edge : node->edges) {
-          stream << "      " << edge->partner_node->table_node->description() << std::endl;
-          stream << "            ==== Predicates ====" << std::endl;
-          for (auto predicate : edge->predicates) {
-            stream << "            " << predicate->description() << std::endl;
-          }
-        }
+    // The bins of a histogram are the most fine-grained ranges. If a segment has none of the statistics objects, all
+    // of its values are NULL and it has no join partners, so that its ranges remain empty.
+    auto& chunk_ranges = ranges[chunk_id];
+    if (segment_statistics->histogram) {
+      chunk_ranges = segment_statistics->histogram->bin_bounds();
+      continue;
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (segment_statistics->range_filter) {
+        chunk_ranges = segment_statistics->range_filter->ranges;
+        continue;
       }
     }
 
-    return stream;
+    if (segment_statistics->min_max_filter) {
+      chunk_ranges.emplace_back(segment_statistics->min_max_filter->min, segment_statistics->min_max_filter->max);
+    }
   }
 
+  return ranges;
+}
 
-
-}
\ No newline at end of file
+}  // namespace opossum
@@ -1,234 +1,141 @@
 #pragma once
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <optional>
 #include <set>
-#include <string>
+#include <utility>
 #include <vector>
 
-#include "logical_query_plan/predicate_node.hpp"
-#include "logical_query_plan/stored_table_node.hpp"
-#include "expression/expression_functional.hpp"
-#include "expression/abstract_expression.hpp"
-#include "statistics/attribute_statistics.hpp"
-#include "statistics/statistics_objects/min_max_filter.hpp"
-#include "statistics/statistics_objects/range_filter.hpp"
-
 #include "abstract_rule.hpp"
-
-#include "dips_pruning_rule.hpp"
-#include "logical_query_plan/lqp_utils.hpp"
-#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
-#include "expression/binary_predicate_expression.hpp"
-#include "optimizer/strategy/chunk_pruning_rule.hpp"
-#include "statistics/base_attribute_statistics.hpp"
-#include "statistics/table_statistics.hpp"
-#include "resolve_type.hpp"
-#include "hyrise.hpp"
-#include <iostream>
+#include "types.hpp"
 
 namespace opossum {
 
-  class AbstractLQPNode;
-  /**
-  * This rule determines which chunks can be pruned from table scans based on
-  * the predicates present in the LQP and stores that information in the stored
-  * table nodes.
-  */
-
-  class DipsJoinGraphEdge;
-  class DipsJoinGraphNode;
-  class DipsJoinGraph;
-  
-  class DipsJoinGraphEdge {
-    public:
-      std::shared_ptr<DipsJoinGraphNode> partner_node;
-      std::vector<std::shared_ptr<AbstractExpression>> predicates;
-
-      DipsJoinGraphEdge(std::shared_ptr<DipsJoinGraphNode> partner_node) {     
-        this->partner_node = partner_node;
-        this->predicates = std::vector<std::shared_ptr<AbstractExpression>>();
-      }
-      
+class JoinNode;
+class StoredTableNode;
+
+/**
+ * Data Induced Predicates (DIPS, Kandula et al., "Pushing Data-Induced Predicates Through Joins in Big-Data Clusters",
+ * 2019): A chunk of a joined table can be pruned if the value ranges of its join column do not overlap with the value
+ * ranges of the not yet pruned chunks of the join partner, as none of its rows can find a join partner. The value
+ * ranges are taken from the chunks' pruning statistics, i.e., from the bins of their histograms if they are available
+ * (see PruningStatisticsConfig::histogram_bin_count) and from their RangeFilters or MinMaxFilters otherwise.
+ *
+ * All join predicates between two columns of StoredTableNodes are considered, including non-equi predicates. Pruning
+ * the chunks of one table might allow us to prune chunks of its other join partners. Thus, the pruned ranges are
+ * propagated in both directions through the whole join graph until no more chunks can be pruned. As the pruned chunks
+ * of a StoredTableNode apply to all of its outputs, a table is only pruned if the rows without a join partner are
+ * guaranteed to be removed, i.e., if the StoredTableNode has a single output and only filtering or order-preserving
+ * nodes lie between it and the join, and if the join mode does not preserve rows of that side.
+ *
+ * This rule has to run after the ChunkPruningRule so that chunks pruned by predicates are not used as join partners.
+ */
+class DipsPruningRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ protected:
+  // A join predicate `left_column <predicate_condition> right_column` between two StoredTableNodes
+  struct JoinGraphEdge {
+    std::shared_ptr<StoredTableNode> left_node;
+    ColumnID left_column_id;
+    std::shared_ptr<StoredTableNode> right_node;
+    ColumnID right_column_id;
+    PredicateCondition predicate_condition;
+
+    // Whether the rows of the node that do not find a join partner are removed by the join
+    bool prune_left;
+    bool prune_right;
   };
 
-  class DipsJoinGraphNode {
-    public:
-      std::vector<std::shared_ptr<DipsJoinGraphNode>> children = std::vector<std::shared_ptr<DipsJoinGraphNode>>();
-      std::shared_ptr<DipsJoinGraphNode> parent;
-      std::shared_ptr<StoredTableNode> table_node;
-      std::vector<std::shared_ptr<DipsJoinGraphEdge>> edges;
-
-      DipsJoinGraphNode(std::shared_ptr<StoredTableNode> table_node) {     
-        this->table_node = table_node;
+  static std::vector<JoinGraphEdge> _build_join_graph(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns the input side of join_node that the output of stored_table_node flows into, or std::nullopt if its rows
+  // might be used by other nodes or altered before they reach the join.
+  static std::optional<LQPInputSide> _join_input_side(const std::shared_ptr<AbstractLQPNode>& stored_table_node,
+                                                      const JoinNode& join_node);
+
+  // Prunes the chunks of partner_node that have no join partner in the not pruned chunks of base_node, so that
+  // `partner_column <predicate_condition> base_column` holds. Returns true if chunks have been pruned.
+  static bool _prune_join_partner(const std::shared_ptr<StoredTableNode>& partner_node,
+                                  const ColumnID partner_column_id, const std::shared_ptr<StoredTableNode>& base_node,
+                                  const ColumnID base_column_id, const PredicateCondition predicate_condition);
+
+  static void _extend_pruned_chunks(StoredTableNode& stored_table_node, const std::set<ChunkID>& pruned_chunk_ids);
+
+  // Returns the value ranges of the not pruned chunks of stored_table_node. If skip_chunks_without_statistics is false,
+  // std::nullopt is returned if a chunk (e.g., a mutable chunk) has no pruning statistics.
+  template <typename T>
+  static std::optional<std::map<ChunkID, std::vector<std::pair<T, T>>>> _get_not_pruned_range_statistics(
+      const StoredTableNode& stored_table_node, const ColumnID column_id, const bool skip_chunks_without_statistics);
+
+  template <typename T>
+  static bool range_intersect(const std::pair<T, T>& range_a, const std::pair<T, T>& range_b) {
+    return !(range_a.second < range_b.first || range_b.second < range_a.first);
+  }
+
+  // Returns the ids of the chunks in partner_chunk_ranges for which none of the values in base_chunk_ranges is a join
+  // partner, i.e., `partner_value <predicate_condition> base_value` does not hold for any pair of values.
+  template <typename T>
+  static std::set<ChunkID> calculate_pruned_chunks(
+      const std::map<ChunkID, std::vector<std::pair<T, T>>>& base_chunk_ranges,
+      const std::map<ChunkID, std::vector<std::pair<T, T>>>& partner_chunk_ranges,
+      const PredicateCondition predicate_condition = PredicateCondition::Equals) {
+    // Merge the ranges of all base chunks into sorted, disjoint ranges that can be searched using binary search
+    auto base_ranges = std::vector<std::pair<T, T>>{};
+    for (const auto& [base_chunk_id, ranges] : base_chunk_ranges) {
+      base_ranges.insert(base_ranges.end(), ranges.begin(), ranges.end());
+    }
+    std::sort(base_ranges.begin(), base_ranges.end());
+
+    auto merged_base_ranges = std::vector<std::pair<T, T>>{};
+    for (const auto& range : base_ranges) {
+      if (!merged_base_ranges.empty() && !(merged_base_ranges.back().second < range.first)) {
+        merged_base_ranges.back().second = std::max(merged_base_ranges.back().second, range.second);
+      } else {
+        merged_base_ranges.emplace_back(range);
       }
+    }
 
-      std::shared_ptr<DipsJoinGraphEdge> get_edge_for_table(std::shared_ptr<DipsJoinGraphNode> table_node){
-        for(auto edge : edges){
-          if (edge->partner_node == table_node){
-            return edge;
-          }
-        }
-        std::shared_ptr<DipsJoinGraphEdge> edge = std::make_shared<DipsJoinGraphEdge>(table_node);
-        edges.push_back(edge);
-        return edge;
-      }
-  };
+    const auto has_join_partner = [&](const std::pair<T, T>& partner_range) {
+      if (merged_base_ranges.empty()) return false;
 
-  class DipsJoinGraph {
-    public:
-      std::shared_ptr<DipsJoinGraphNode> get_node_for_table(std::shared_ptr<StoredTableNode> table_node){
-        for(auto graph_node : nodes){
-          if (graph_node->table_node == table_node){
-            return graph_node;
-          }
-        }
-        std::shared_ptr<DipsJoinGraphNode> graph_node = std::make_shared<DipsJoinGraphNode>(table_node);
-        nodes.push_back(graph_node);
-        return graph_node;
-      }
-      bool is_tree(){
-        if (nodes.size()==0){
-          return true;
-        }
-        std::shared_ptr<std::vector<std::shared_ptr<DipsJoinGraphNode>>> visited_nodes = std::make_shared<std::vector<std::shared_ptr<DipsJoinGraphNode>>>();
-        return _is_tree_dfs(nullptr, nodes[0], visited_nodes);
-      }
+      const auto& base_min = merged_base_ranges.front().first;
+      const auto& base_max = merged_base_ranges.back().second;
 
-      std::vector<std::shared_ptr<DipsJoinGraphNode>> nodes;
-    
-    private:
-      bool _is_tree_dfs(
-        std::shared_ptr<DipsJoinGraphNode> parent_node, 
-        std::shared_ptr<DipsJoinGraphNode> node, 
-        std::shared_ptr<std::vector<std::shared_ptr<DipsJoinGraphNode>>> visited_nodes
-      )
-      {
-        visited_nodes->push_back(node);
-        for(auto edge : node->edges){
-          if (edge->partner_node != parent_node){
-            if(std::find(visited_nodes->begin(), visited_nodes->end(), edge->partner_node) == visited_nodes->end()){
-              if(!_is_tree_dfs(node, edge->partner_node, visited_nodes)){
-                return false;
-              }
-            }else{
-              return false;
-            }
-          }
+      switch (predicate_condition) {
+        case PredicateCondition::Equals: {
+          // First merged range that does not end before the partner range starts
+          const auto range_iter = std::lower_bound(
+              merged_base_ranges.begin(), merged_base_ranges.end(), partner_range.first,
+              [](const auto& base_range, const auto& partner_min) { return base_range.second < partner_min; });
+          return range_iter != merged_base_ranges.end() && range_intersect<T>(*range_iter, partner_range);
         }
-        return true;
+        case PredicateCondition::LessThan:
+          return partner_range.first < base_max;
+        case PredicateCondition::LessThanEquals:
+          return !(base_max < partner_range.first);
+        case PredicateCondition::GreaterThan:
+          return base_min < partner_range.second;
+        case PredicateCondition::GreaterThanEquals:
+          return !(partner_range.second < base_min);
+        default:
+          return true;
       }
-  };
-
+    };
 
-  std::ostream& operator<<(std::ostream& stream, const DipsJoinGraph join_graph);
-
-  class DipsPruningRule : public AbstractRule {
-  public:
-    void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
-    
-
-  protected:
-    
-    void dips_pruning(
-      const std::shared_ptr<const StoredTableNode> table_node, 
-      ColumnID column_id, 
-      std::shared_ptr<StoredTableNode> join_partner_table_node, 
-      ColumnID join_partner_column_id) const;
-
-    void _build_join_graph(const std::shared_ptr<AbstractLQPNode>& node, std::shared_ptr<DipsJoinGraph> join_graph) const;
-    void extend_pruned_chunks( std::shared_ptr<StoredTableNode> table_node, std::set<ChunkID> pruned_chunk_ids) const;
-
-    template<typename COLUMN_TYPE>
-    std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>>
-    get_not_pruned_range_statistics(const std::shared_ptr<const StoredTableNode> table_node, ColumnID column_id) const {
-      /* For every non pruned chunk, return its ranges for the given attribute (segment) */
-      std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> ranges;
-
-      auto pruned_chunks_ids = table_node->pruned_chunk_ids();                          //const std::vector<ChunkID>&
-      auto table = Hyrise::get().storage_manager.get_table(table_node->table_name);
-
-      for (ChunkID chunk_index = ChunkID{0}; chunk_index < table->chunk_count(); ++chunk_index){
-        if(std::find(pruned_chunks_ids.begin(), pruned_chunks_ids.end(), chunk_index) == pruned_chunks_ids.end())
-        {
-          auto chunk_statistic = (*table->get_chunk(chunk_index)->pruning_statistics())[column_id];
-          const auto segment_statistics = std::dynamic_pointer_cast<const AttributeStatistics<COLUMN_TYPE>>(chunk_statistic);
-
-          if constexpr (std::is_arithmetic_v<COLUMN_TYPE>) {
-            if (segment_statistics->range_filter) {                       // false if all values in the chunk are NULL
-              ranges.insert(std::pair<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>>(chunk_index, segment_statistics->range_filter->ranges));
-            } else {
-              ranges.insert(std::pair<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>>(chunk_index, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>()));
-              // Note: if we don't do it, we assume, the chunk has been already pruned -> error
-              continue;  
-            }
-
-            // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-            DebugAssert(!segment_statistics->min_max_filter,
-                        "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
-          }
-
-          if (segment_statistics->min_max_filter) {
-            ranges.insert(std::pair<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>>(
-              chunk_index, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>(
-                {std::pair<COLUMN_TYPE, COLUMN_TYPE>(segment_statistics->min_max_filter->min,
-                                                        segment_statistics->min_max_filter->max)}
-                )
-              )
-            );
-          }
-        }
+    auto pruned_chunk_ids = std::set<ChunkID>{};
+    for (const auto& [partner_chunk_id, partner_ranges] : partner_chunk_ranges) {
+      if (std::none_of(partner_ranges.begin(), partner_ranges.end(), has_join_partner)) {
+        pruned_chunk_ids.insert(partner_chunk_id);
       }
-
-      return ranges;
     }
 
-
-    template<typename COLUMN_TYPE>
-    bool range_intersect(std::pair<COLUMN_TYPE, COLUMN_TYPE> range_a, std::pair<COLUMN_TYPE, COLUMN_TYPE> range_b) const {
-      return !(
-        (
-          (range_a.first < range_b.first) && (range_a.second < range_b.first)
-        )
-        ||
-        (
-          (range_a.first > range_b.second) && (range_a.second > range_b.second)
-        )
-      );
-    } 
-
-
-    template<typename COLUMN_TYPE>
-    std::set<ChunkID> calculate_pruned_chunks(
-      std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> base_chunk_ranges,
-      std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> partner_chunk_ranges
-    ) const
-    {
-      /* Calculate the chunks ids of the partner table which can be pruned (based on base_chunk_ranges) */
-      std::set<ChunkID> pruned_chunk_ids;
-      
-      for (auto const& [partner_chunk_id, partner_ranges] : partner_chunk_ranges) {
-        bool can_be_pruned = true;
-
-        for (auto partner_range : partner_ranges){
-          if(!can_be_pruned) break;
-          for (auto const& [base_chunk_id, base_ranges] : base_chunk_ranges) {
-            if(!can_be_pruned) break;
-            for (auto base_range : base_ranges){
-              if (range_intersect<COLUMN_TYPE>(partner_range, base_range)){
-                can_be_pruned = false;
-                break;
-              }
-            }
-          }
-        }
-        if(can_be_pruned){
-          pruned_chunk_ids.insert(partner_chunk_id);
-        }
-      }
-
-      return pruned_chunk_ids;
-    }
-  };
+    return pruned_chunk_ids;
+  }
+};
 
 }  // namespace opossum
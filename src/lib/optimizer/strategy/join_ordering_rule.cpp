@@ -6,6 +6,7 @@
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "statistics/table_statistics.hpp"
@@ -65,18 +66,30 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Simple heuristic: Use DpCcp for any query with less than MIN_VERTEX_COUNT_FOR_BUDGET tables. For more complex
+   * queries, the number of candidate joins enumerated by DpCcp can grow exponentially. Thus, DpCcp is aborted once
+   * it exceeds its budget. In that case, we fall back to the cheaper plan of two polynomial algorithms: LinearizedDp,
+   * which considers bushy plans, and GOO, which does not depend on a good linearization of the vertices.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
   DebugAssert(!join_graph->vertices.empty(), "There should be nodes in the join graph.");
   if (join_graph->vertices.size() == 1) {
     // a join graph with only one vertex is no actual join and needs no ordering
     result_lqp = lqp;
-  } else if (join_graph->vertices.size() < 9) {
+  } else if (join_graph->vertices.size() < MIN_VERTEX_COUNT_FOR_BUDGET) {
     result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
-    result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    auto dp_ccp = DpCcp{DP_CCP_PLANNING_TIME_BUDGET, DP_CCP_MAX_CSG_CMP_PAIR_COUNT};
+    result_lqp = dp_ccp(*join_graph, caching_cost_estimator);
+
+    if (!result_lqp) {
+      result_lqp = LinearizedDp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+      const auto greedy_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT
+      if (caching_cost_estimator->estimate_plan_cost(greedy_lqp) <
+          caching_cost_estimator->estimate_plan_cost(result_lqp)) {
+        result_lqp = greedy_lqp;
+      }
+    }
   }
 
   for (const auto& vertex : join_graph->vertices) {
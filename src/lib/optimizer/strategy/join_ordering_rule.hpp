@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "abstract_rule.hpp"
@@ -10,12 +11,21 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified. Small JoinGraphs are ordered optimally by DpCcp. For larger
+ * JoinGraphs, DpCcp is tried with a bounded planning effort. If it exceeds the budget, the cheaper plan of
+ * LinearizedDp and GreedyOperatorOrdering is used.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
+  // JoinGraphs with at least this many vertices are ordered with a bounded planning effort
+  static constexpr auto MIN_VERTEX_COUNT_FOR_BUDGET = size_t{9};
+
+  // Budgets of DpCcp for large JoinGraphs, see DpCcp::DpCcp()
+  static constexpr auto DP_CCP_PLANNING_TIME_BUDGET = std::chrono::microseconds{100'000};
+  static constexpr auto DP_CCP_MAX_CSG_CMP_PAIR_COUNT = size_t{100'000};
+
  private:
   std::shared_ptr<AbstractLQPNode> _perform_join_ordering_recursively(
       const std::shared_ptr<AbstractLQPNode>& lqp) const;
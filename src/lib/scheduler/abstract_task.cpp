@@ -7,6 +7,7 @@
 
 #include "abstract_scheduler.hpp"
 #include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
@@ -15,7 +16,11 @@
 
 namespace opossum {
 
-AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
+AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {
+  if (auto* const memory_resource = BudgetedMemoryResource::current()) {
+    _memory_resource = memory_resource->shared_from_this();
+  }
+}
 
 TaskID AbstractTask::id() const { return _id; }
 
@@ -91,7 +96,10 @@ void AbstractTask::execute() {
   // spawned the task are pushed down to a point where this thread is already running.
   Assert(_is_scheduled, "Task should have been scheduled before being executed");
 
-  _on_execute();
+  {
+    const auto memory_resource_scope = MemoryResourceScope{_memory_resource};
+    _on_execute();
+  }
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
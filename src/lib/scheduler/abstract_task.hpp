@@ -12,12 +12,16 @@
 
 namespace opossum {
 
+class BudgetedMemoryResource;
 class Worker;
 
 /**
  * Base class for anything that can be scheduled by the Scheduler and gets executed by a Worker.
  *
  * Derive and implement logic in _on_execute()
+ *
+ * If a task is created within a MemoryResourceScope, it is executed within a scope of the same memory resource, so that
+ * the allocations of the task are accounted to the same query.
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // Using friend classes is quite uncommon in Hyrise. The reason it is done here is that the _join method must
@@ -157,6 +161,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
+
+  // The memory resource of the MemoryResourceScope in which the task was created, if any
+  std::shared_ptr<BudgetedMemoryResource> _memory_resource;
 };
 
 }  // namespace opossum
@@ -0,0 +1,199 @@
+#include "admission_controller.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "memory/budgeted_memory_resource.hpp"
+#include "scheduler/worker.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionController::Admission::Admission(AdmissionController& admission_controller, const std::string& sql)
+    : _admission_controller(admission_controller) {
+  // Allocations of the statement are also accounted to the resource of the surrounding scope, if any
+  auto* const parent_resource = BudgetedMemoryResource::current();
+  _memory_resource = BudgetedMemoryResource::create(
+      _admission_controller.query_budget().value_or(std::numeric_limits<size_t>::max()),
+      parent_resource ? parent_resource->shared_from_this() : nullptr);
+
+  if (!_admission_controller._is_nested_statement()) {
+    const auto may_queue = !Worker::get_this_thread_worker();
+    _query_id = _admission_controller._admit(sql, _memory_resource, may_queue);
+  }
+}
+
+AdmissionController::Admission::Admission(AdmissionController& admission_controller, const uint64_t query_id,
+                                          const std::shared_ptr<BudgetedMemoryResource>& memory_resource)
+    : _admission_controller(admission_controller), _query_id(query_id), _memory_resource(memory_resource) {}
+
+std::unique_ptr<AdmissionController::Admission> AdmissionController::Admission::try_create(
+    AdmissionController& admission_controller, const std::string& sql,
+    const std::shared_ptr<BudgetedMemoryResource>& parent_resource) {
+  const auto memory_resource = BudgetedMemoryResource::create(
+      admission_controller.query_budget().value_or(std::numeric_limits<size_t>::max()), parent_resource);
+
+  const auto query_id = admission_controller._try_admit(sql, memory_resource);
+  if (!query_id) return nullptr;
+
+  // The constructor is private, so std::make_unique cannot be used
+  return std::unique_ptr<Admission>(new Admission(admission_controller, *query_id, memory_resource));
+}
+
+AdmissionController::Admission::~Admission() {
+  if (_query_id) _admission_controller._release(*_query_id);
+}
+
+const std::shared_ptr<BudgetedMemoryResource>& AdmissionController::Admission::memory_resource() const {
+  return _memory_resource;
+}
+
+AdmissionController::SessionRegistration::SessionRegistration(AdmissionController& admission_controller,
+                                                               const std::string& client)
+    : _admission_controller(admission_controller),
+      _memory_resource(BudgetedMemoryResource::create(std::numeric_limits<size_t>::max())) {
+  std::lock_guard<std::mutex> lock(_admission_controller._mutex);
+  _session_id = _admission_controller._next_session_id++;
+  _admission_controller._sessions.emplace_back(
+      RegisteredSession{_session_id, client, std::chrono::steady_clock::now(), _memory_resource});
+}
+
+AdmissionController::SessionRegistration::~SessionRegistration() {
+  std::lock_guard<std::mutex> lock(_admission_controller._mutex);
+  auto& sessions = _admission_controller._sessions;
+  const auto session_iter = std::find_if(sessions.begin(), sessions.end(),
+                                         [&](const auto& session) { return session.session_id == _session_id; });
+  DebugAssert(session_iter != sessions.end(), "Unregistered session is not registered");
+  sessions.erase(session_iter);
+}
+
+const std::shared_ptr<BudgetedMemoryResource>& AdmissionController::SessionRegistration::memory_resource() const {
+  return _memory_resource;
+}
+
+std::vector<AdmissionController::RunningQuery> AdmissionController::running_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_queries;
+}
+
+std::vector<AdmissionController::RegisteredSession> AdmissionController::sessions() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _sessions;
+}
+
+size_t AdmissionController::queued_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queued_query_count;
+}
+
+size_t AdmissionController::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto allocated_bytes = size_t{0};
+  for (const auto& running_query : _running_queries) {
+    allocated_bytes += running_query.memory_resource->allocated_bytes();
+  }
+  return allocated_bytes;
+}
+
+void AdmissionController::set_global_budget(const std::optional<size_t>& global_budget) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _global_budget = global_budget;
+  }
+  _release_condition.notify_all();
+}
+
+std::optional<size_t> AdmissionController::global_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _global_budget;
+}
+
+void AdmissionController::set_query_budget(const std::optional<size_t>& query_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _query_budget = query_budget;
+}
+
+std::optional<size_t> AdmissionController::query_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _query_budget;
+}
+
+void AdmissionController::set_admission_threshold(const double admission_threshold) {
+  Assert(admission_threshold > 0.0 && admission_threshold <= 1.0, "Admission threshold has to be in (0, 1]");
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _admission_threshold = admission_threshold;
+  }
+  _release_condition.notify_all();
+}
+
+double AdmissionController::admission_threshold() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _admission_threshold;
+}
+
+uint64_t AdmissionController::_admit(const std::string& sql,
+                                     const std::shared_ptr<BudgetedMemoryResource>& memory_resource,
+                                     const bool may_queue) {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+
+  if (may_queue && !_running_queries.empty() && !_has_available_memory()) {
+    ++_queued_query_count;
+    while (!_running_queries.empty() && !_has_available_memory()) {
+      _release_condition.wait_for(lock, RECHECK_INTERVAL);
+    }
+    --_queued_query_count;
+  }
+
+  return _add_running_query(sql, memory_resource);
+}
+
+std::optional<uint64_t> AdmissionController::_try_admit(
+    const std::string& sql, const std::shared_ptr<BudgetedMemoryResource>& memory_resource) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_running_queries.empty() && !_has_available_memory()) return std::nullopt;
+
+  return _add_running_query(sql, memory_resource);
+}
+
+uint64_t AdmissionController::_add_running_query(const std::string& sql,
+                                                 const std::shared_ptr<BudgetedMemoryResource>& memory_resource) {
+  const auto query_id = _next_query_id++;
+  _running_queries.emplace_back(RunningQuery{query_id, sql, std::chrono::steady_clock::now(), memory_resource});
+  return query_id;
+}
+
+void AdmissionController::_release(const uint64_t query_id) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto running_query_iter =
+        std::find_if(_running_queries.begin(), _running_queries.end(),
+                     [&](const auto& running_query) { return running_query.query_id == query_id; });
+    DebugAssert(running_query_iter != _running_queries.end(), "Released statement is not running");
+    _running_queries.erase(running_query_iter);
+  }
+  _release_condition.notify_all();
+}
+
+bool AdmissionController::_has_available_memory() const {
+  if (!_global_budget) return true;
+
+  auto allocated_bytes = size_t{0};
+  for (const auto& running_query : _running_queries) {
+    allocated_bytes += running_query.memory_resource->allocated_bytes();
+  }
+  return static_cast<double>(allocated_bytes) < _admission_threshold * static_cast<double>(*_global_budget);
+}
+
+bool AdmissionController::_is_nested_statement() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto* resource = BudgetedMemoryResource::current(); resource; resource = resource->parent().get()) {
+    const auto is_running_query = std::any_of(_running_queries.begin(), _running_queries.end(), [&](const auto& query) {
+      return query.memory_resource.get() == resource;
+    });
+    if (is_running_query) return true;
+  }
+  return false;
+}
+
+}  // namespace opossum
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BudgetedMemoryResource;
+
+/**
+ * Keeps track of the SQL statements that are currently executed and of the memory they have allocated. Each
+ * SQLPipelineStatement is admitted before its tasks are scheduled and executed within a MemoryResourceScope of the
+ * statement's BudgetedMemoryResource, so that all of its intermediate tables are accounted to it.
+ *
+ * If a global budget is set, new statements are queued while the running statements have allocated more than
+ * admission_threshold * global_budget bytes. As the memory of a running statement might only be freed when it has
+ * finished, a statement is always admitted if no other statement is running. Statements that are executed from within
+ * another statement (i.e., within the scope of a running statement's memory resource) are accounted to that statement
+ * and admitted right away, as queueing them could never succeed while the outer statement is waiting for them.
+ *
+ * Statements are never queued on a scheduler worker. A blocked worker could not execute the tasks of the running
+ * statements. Moreover, a worker that waits for the tasks of a statement executes other tasks meanwhile (see
+ * Worker::_wait_for_tasks), which might start another statement on the same stack. That statement could not be
+ * admitted before the statement below it has finished. Thus, callers that schedule statements as tasks (e.g., the
+ * server's sessions) admit them before scheduling them, using the non-blocking Admission::try_create.
+ *
+ * Sessions (e.g., of the server) can be registered, so that the memory of all their statements, including results
+ * that are kept after a statement has finished, is accounted to the session as well.
+ *
+ * The budgets are configured using the setters, e.g., by the server's --memory_budget option.
+ */
+class AdmissionController : private Noncopyable {
+ public:
+  // A statement that has been admitted and has not finished yet
+  struct RunningQuery {
+    uint64_t query_id;
+    std::string sql;
+    std::chrono::steady_clock::time_point admission_time;
+    std::shared_ptr<BudgetedMemoryResource> memory_resource;
+  };
+
+  // A registered session and the memory resource that its statements are accounted to
+  struct RegisteredSession {
+    uint64_t session_id;
+    std::string client;
+    std::chrono::steady_clock::time_point registration_time;
+    std::shared_ptr<BudgetedMemoryResource> memory_resource;
+  };
+
+  /**
+   * Admits a statement when it is created (which blocks while the statement is queued, unless the current thread is a
+   * scheduler worker) and releases it when it is destroyed.
+   */
+  class Admission : private Noncopyable {
+   public:
+    Admission(AdmissionController& admission_controller, const std::string& sql);
+    ~Admission();
+
+    /**
+     * Admits a statement without blocking and returns nullptr if the statement has to be queued. In that case, the
+     * caller tries again later (e.g., after RECHECK_INTERVAL). The statement is accounted to @param parent_resource
+     * (e.g., the memory resource of a session).
+     */
+    static std::unique_ptr<Admission> try_create(AdmissionController& admission_controller, const std::string& sql,
+                                                 const std::shared_ptr<BudgetedMemoryResource>& parent_resource);
+
+    const std::shared_ptr<BudgetedMemoryResource>& memory_resource() const;
+
+   private:
+    Admission(AdmissionController& admission_controller, const uint64_t query_id,
+              const std::shared_ptr<BudgetedMemoryResource>& memory_resource);
+
+    AdmissionController& _admission_controller;
+    std::optional<uint64_t> _query_id;
+    std::shared_ptr<BudgetedMemoryResource> _memory_resource;
+  };
+
+  /**
+   * Registers a session when it is created and unregisters it when it is destroyed. The session's memory resource has
+   * no budget of its own. It is used as the parent of the session's statements (see Admission::try_create).
+   */
+  class SessionRegistration : private Noncopyable {
+   public:
+    SessionRegistration(AdmissionController& admission_controller, const std::string& client);
+    ~SessionRegistration();
+
+    const std::shared_ptr<BudgetedMemoryResource>& memory_resource() const;
+
+   private:
+    AdmissionController& _admission_controller;
+    uint64_t _session_id;
+    std::shared_ptr<BudgetedMemoryResource> _memory_resource;
+  };
+
+  // Queued statements are not notified when a running statement frees memory, only when it finishes. Thus, they check
+  // again in this interval.
+  static constexpr auto RECHECK_INTERVAL = std::chrono::milliseconds{10};
+
+  std::vector<RunningQuery> running_queries() const;
+  std::vector<RegisteredSession> sessions() const;
+
+  // Number of statements that are blocked in the constructor of Admission. Callers of Admission::try_create that wait
+  // for their next attempt are not included.
+  size_t queued_query_count() const;
+
+  // Sum of the bytes allocated by all running statements
+  size_t allocated_bytes() const;
+
+  // Total memory for all running statements. std::nullopt (the default) admits all statements right away.
+  void set_global_budget(const std::optional<size_t>& global_budget);
+  std::optional<size_t> global_budget() const;
+
+  // Budget of each statement's memory resource, which determines when operators spill to disk. Defaults to unlimited.
+  void set_query_budget(const std::optional<size_t>& query_budget);
+  std::optional<size_t> query_budget() const;
+
+  // Fraction of the global budget above which new statements are queued. Defaults to 0.9.
+  void set_admission_threshold(const double admission_threshold);
+  double admission_threshold() const;
+
+ protected:
+  // Blocks until the statement can be admitted, unless @param may_queue is false, and returns its id
+  uint64_t _admit(const std::string& sql, const std::shared_ptr<BudgetedMemoryResource>& memory_resource,
+                  const bool may_queue);
+
+  // Returns the id of the statement if it can be admitted right away
+  std::optional<uint64_t> _try_admit(const std::string& sql,
+                                     const std::shared_ptr<BudgetedMemoryResource>& memory_resource);
+
+  // Adds the statement to the running statements and returns its id. _mutex has to be held.
+  uint64_t _add_running_query(const std::string& sql, const std::shared_ptr<BudgetedMemoryResource>& memory_resource);
+
+  void _release(const uint64_t query_id);
+
+  // Returns true if the running statements leave enough of the global budget. _mutex has to be held.
+  bool _has_available_memory() const;
+
+  // Returns true if the current thread executes a running statement
+  bool _is_nested_statement() const;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _release_condition;
+
+  std::vector<RunningQuery> _running_queries;
+  size_t _queued_query_count{0};
+  uint64_t _next_query_id{0};
+
+  std::vector<RegisteredSession> _sessions;
+  uint64_t _next_session_id{0};
+
+  std::optional<size_t> _global_budget;
+  std::optional<size_t> _query_budget;
+  double _admission_threshold{0.9};
+};
+
+}  // namespace opossum
@@ -12,6 +12,8 @@ bool ImmediateExecutionScheduler::active() const { return false; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& ImmediateExecutionScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& ImmediateExecutionScheduler::workers() const { return _workers; }
+
 void ImmediateExecutionScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                            SchedulePriority priority) {
   DebugAssert(task->is_scheduled(), "Don't call ImmediateExecutionScheduler::schedule(), call schedule() on the task");
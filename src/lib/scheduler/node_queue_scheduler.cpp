@@ -15,7 +15,9 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+NodeQueueScheduler::NodeQueueScheduler(Mode mode) : _mode(mode) {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
 
 NodeQueueScheduler::~NodeQueueScheduler() {
   if (HYRISE_DEBUG && _active) {
@@ -39,7 +41,8 @@ void NodeQueueScheduler::begin() {
     const auto& topology_node = Hyrise::get().topology.nodes()[node_id];
 
     for (const auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id,
+                                                     _mode == Mode::WorkStealingDeques));
     }
   }
 
@@ -71,10 +74,18 @@ void NodeQueueScheduler::finish() {
     for (auto& queue : _queues) {
       Assert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for (auto& worker : _workers) {
+      Assert(worker->deque().empty(), "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
 
+  // Parked workers would otherwise only notice the shutdown once their timeout has passed
+  for (auto& worker : _workers) {
+    worker->unpark();
+  }
+
   for (auto& worker : _workers) {
     worker->join();
   }
@@ -88,6 +99,10 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
+NodeQueueScheduler::Mode NodeQueueScheduler::mode() const { return _mode; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -102,8 +117,8 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (!task->is_ready()) return;
 
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -115,6 +130,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
               "preferred_node_id is not within range of available nodes");
 
+  if (_mode == Mode::WorkStealingDeques) {
+    // Only the owner may push into a deque. Tasks that must not be stolen by other nodes are put into the TaskQueue,
+    // as they could otherwise be taken from the deque by a worker of another node.
+    if (worker && worker->queue()->node_id() == preferred_node_id && task->is_stealable()) {
+      worker->push_to_deque(task);
+    } else {
+      _queues[preferred_node_id]->push(task, static_cast<uint32_t>(priority));
+    }
+    Worker::unpark_one(_workers, preferred_node_id);
+    return;
+  }
+
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
 }
@@ -69,6 +69,14 @@ namespace opossum {
  * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
  * Afterwards, the current worker is checking its local queue gain.
  *
+ * Optionally (Mode::WorkStealingDeques), every worker additionally owns a lock-free Chase-Lev deque. Tasks that are
+ * scheduled from within a worker (e.g., the JobTasks spawned by JoinHash or AggregateHash) are pushed into the
+ * deque of that worker instead of the node's TaskQueue. The owner pops from its deque in LIFO order, idle workers
+ * steal from randomly chosen workers of their own node and only look at other nodes once their node has no more
+ * work. This avoids the contention on the single TaskQueue of a node when thousands of small tasks are spawned.
+ * Idle workers park on a per-worker condition variable, so that scheduling a task wakes up a single worker instead
+ * of all waiters of a shared condition variable.
+ *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
 
@@ -81,7 +89,9 @@ class UidAllocator;
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  enum class Mode : uint8_t { NodeQueues, WorkStealingDeques };
+
+  explicit NodeQueueScheduler(Mode mode = Mode::NodeQueues);
   ~NodeQueueScheduler() override;
 
   /**
@@ -96,6 +106,10 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
+  Mode mode() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -113,6 +127,7 @@ class NodeQueueScheduler : public AbstractScheduler {
   void _group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const override;
 
  private:
+  const Mode _mode;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
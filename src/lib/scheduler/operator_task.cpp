@@ -4,8 +4,15 @@
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/worker.hpp"
@@ -23,7 +30,9 @@ std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operato
     const std::shared_ptr<AbstractOperator>& op) {
   std::vector<std::shared_ptr<AbstractTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>> task_by_op;
+  if (Hyrise::get().enable_pipelining) _set_up_pipelines(op);
   _add_tasks_from_operator(op, tasks, task_by_op);
+  _link_runtime_filters(task_by_op);
   return tasks;
 }
 
@@ -36,7 +45,15 @@ std::shared_ptr<AbstractTask> OperatorTask::_add_tasks_from_operator(
   auto task = std::make_shared<OperatorTask>(op);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_left_input()) {
+  // Operators that are pipelined into this operator are executed by its task
+  auto left = op->mutable_left_input();
+  while (const auto chunkwise_left = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(left)) {
+    if (!chunkwise_left->is_pipelined) break;
+    task_by_op.emplace(left, task);
+    left = left->mutable_left_input();
+  }
+
+  if (left) {
     auto subtree_root = _add_tasks_from_operator(left, tasks, task_by_op);
     subtree_root->set_as_predecessor_of(task);
   }
@@ -52,6 +69,75 @@ std::shared_ptr<AbstractTask> OperatorTask::_add_tasks_from_operator(
   return task;
 }
 
+void OperatorTask::_set_up_pipelines(const std::shared_ptr<AbstractOperator>& op) {
+  // A chunkwise operator is pipelined into its consumer if the consumer is chunkwise as well or a Projection, and if it
+  // is the only consumer. Operators with multiple consumers (diamonds) are materialized.
+  auto consumer_counts = std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>{};
+  auto pipeline_candidates = std::vector<std::shared_ptr<AbstractChunkwiseOperator>>{};
+  visit_pqp(op, [&](const auto& node) {
+    for (const auto& input : {node->mutable_left_input(), node->mutable_right_input()}) {
+      if (input) ++consumer_counts[input];
+    }
+
+    const auto chunkwise_input = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(node->mutable_left_input());
+    const auto consumes_pipelines =
+        std::dynamic_pointer_cast<AbstractChunkwiseOperator>(node) || node->type() == OperatorType::Projection;
+    if (chunkwise_input && consumes_pipelines && !node->performance_data->executed &&
+        !chunkwise_input->performance_data->executed) {
+      pipeline_candidates.emplace_back(chunkwise_input);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+
+  for (const auto& pipeline_candidate : pipeline_candidates) {
+    if (consumer_counts[pipeline_candidate] == 1) pipeline_candidate->is_pipelined = true;
+  }
+}
+
+void OperatorTask::_link_runtime_filters(
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>& task_by_op) {
+  for (const auto& [op, task] : task_by_op) {
+    if (op->type() != OperatorType::JoinHash) continue;
+    const auto& join_hash = static_cast<const JoinHash&>(*op);
+    if (!join_hash.runtime_filter_source) continue;
+
+    const auto source_is_left = *join_hash.runtime_filter_source == RuntimeFilterSource::LeftInput;
+    const auto& column_ids = join_hash.primary_predicate().column_ids;
+    const auto source = source_is_left ? op->mutable_left_input() : op->mutable_right_input();
+    const auto source_column_id = source_is_left ? column_ids.first : column_ids.second;
+    const auto target_column_id = source_is_left ? column_ids.second : column_ids.first;
+
+    // Walk down the target input as long as the column layout stays the same. Operators with other consumers must
+    // not be filtered, as the filter is only valid for this join. The topmost TableScan filters rows, the GetTable at
+    // the bottom prunes chunks.
+    auto table_scan = std::shared_ptr<TableScan>{};
+    auto get_table = std::shared_ptr<GetTable>{};
+    auto target = source_is_left ? op->mutable_right_input() : op->mutable_left_input();
+    while (target && task_by_op.at(target)->successors().size() == 1) {
+      if (target->type() == OperatorType::TableScan) {
+        if (!table_scan) table_scan = std::static_pointer_cast<TableScan>(target);
+      } else if (target->type() == OperatorType::GetTable) {
+        get_table = std::static_pointer_cast<GetTable>(target);
+        break;
+      } else if (target->type() != OperatorType::Validate) {
+        break;
+      }
+      target = target->mutable_left_input();
+    }
+
+    if (!table_scan && !get_table) continue;
+
+    const auto runtime_filter = std::make_shared<RuntimeFilter>(source, source_column_id, target_column_id);
+    const auto& source_task = task_by_op.at(source);
+    for (const auto& target_operator : std::vector<std::shared_ptr<AbstractOperator>>{table_scan, get_table}) {
+      if (!target_operator) continue;
+      source_task->set_as_predecessor_of(task_by_op.at(target_operator));
+    }
+    if (table_scan) table_scan->runtime_filter = runtime_filter;
+    if (get_table) get_table->runtime_filter = runtime_filter;
+  }
+}
+
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
@@ -40,6 +40,19 @@ class OperatorTask : public AbstractTask {
       const std::shared_ptr<AbstractOperator>& op, std::vector<std::shared_ptr<AbstractTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>& task_by_op);
 
+  /**
+   * Marks the chunkwise operators that are executed as part of the pipeline of their consumer (see
+   * AbstractChunkwiseOperator). Called by `make_tasks_from_operator` if Hyrise::get().enable_pipelining is set.
+   */
+  static void _set_up_pipelines(const std::shared_ptr<AbstractOperator>& op);
+
+  /**
+   * Hands the RuntimeFilters published by JoinHash operators to the TableScans and GetTables of the other join input
+   * and makes the tasks of these operators wait for the task of the source input.
+   */
+  static void _link_runtime_filters(
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>& task_by_op);
+
  private:
   std::shared_ptr<AbstractOperator> _op;
 };
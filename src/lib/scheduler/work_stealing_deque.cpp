@@ -0,0 +1,119 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::RingBuffer::RingBuffer(size_t init_capacity)
+    : capacity(init_capacity), mask(init_capacity - 1), slots(init_capacity) {
+  DebugAssert(capacity > 0 && (capacity & mask) == 0, "Capacity of the ring buffer has to be a power of two");
+}
+
+WorkStealingDeque::TaskBox* WorkStealingDeque::RingBuffer::get(int64_t index) const {
+  return slots[static_cast<size_t>(index) & mask].load(std::memory_order_acquire);
+}
+
+void WorkStealingDeque::RingBuffer::put(int64_t index, TaskBox* task_box) {
+  slots[static_cast<size_t>(index) & mask].store(task_box, std::memory_order_release);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<RingBuffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Free the boxes of tasks that were never removed. Usually, the deque is empty when the scheduler shuts down.
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = top; index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, bottom, top);
+  }
+
+  // Lê et al. use a release fence followed by a relaxed store. As tsan does not understand standalone fences, we use a
+  // release store instead, which is equally cheap on x86.
+  buffer->put(bottom, new TaskBox(task));
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty, restore bottom
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task_box = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task in the deque, race against thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task_box = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!task_box) return nullptr;
+  }
+
+  auto task = std::move(*task_box);
+  delete task_box;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  const auto* buffer = _buffer.load(std::memory_order_acquire);
+  auto* task_box = buffer->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race against the owner or another thief
+    return nullptr;
+  }
+
+  auto task = std::move(*task_box);
+  delete task_box;
+  return task;
+}
+
+bool WorkStealingDeque::empty() const { return size() == 0; }
+
+size_t WorkStealingDeque::size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+}
+
+WorkStealingDeque::RingBuffer* WorkStealingDeque::_grow(RingBuffer* buffer, int64_t bottom, int64_t top) {
+  _buffers.emplace_back(std::make_unique<RingBuffer>(buffer->capacity * 2));
+  auto* new_buffer = _buffers.back().get();
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+  _buffer.store(new_buffer, std::memory_order_release);
+  return new_buffer;
+}
+
+}  // namespace opossum
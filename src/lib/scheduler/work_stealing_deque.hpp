@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque as described by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005),
+ * using the C11 memory orderings from Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models",
+ * PPoPP 2013).
+ *
+ * Exactly one thread (the owning Worker) may call push() and pop(), which operate on the bottom end of the deque in
+ * LIFO order. Any other thread may call steal(), which takes the oldest task from the top end. As the tasks that were
+ * pushed first are usually the largest ones (e.g., the first chunk ranges of an operator), thieves get the most work
+ * per successful steal while the owner keeps working on cache-hot tasks.
+ *
+ * The ring buffer grows if it is full. Replaced buffers are kept until the deque is destroyed, because a concurrent
+ * thief might still read from them.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 1024);
+  ~WorkStealingDeque();
+
+  /**
+   * Adds a task to the bottom of the deque. Must only be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes and returns the most recently pushed task, or nullptr if the deque is empty. Must only be called by the
+   * owner.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes and returns the oldest task, or nullptr if the deque is empty or another thread won the race for the
+   * task. Can be called by any thread.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Only a snapshot, the deque might be modified concurrently.
+   */
+  bool empty() const;
+  size_t size() const;
+
+ private:
+  // Tasks are stored as heap-allocated shared_ptrs so that a slot can be read and written atomically. The thread that
+  // successfully removes a task from the deque takes over the ownership of the box.
+  using TaskBox = std::shared_ptr<AbstractTask>;
+
+  struct RingBuffer {
+    explicit RingBuffer(size_t init_capacity);
+
+    TaskBox* get(int64_t index) const;
+    void put(int64_t index, TaskBox* task_box);
+
+    const size_t capacity;
+    const size_t mask;
+    std::vector<std::atomic<TaskBox*>> slots;
+  };
+
+  RingBuffer* _grow(RingBuffer* buffer, int64_t bottom, int64_t top);
+
+  // top and bottom are only ever incremented (except for the temporary decrement of bottom in pop()), so that the ABA
+  // problem cannot occur. They are placed on separate cache lines as the owner mostly writes to _bottom and thieves
+  // write to _top.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<RingBuffer*> _buffer;
+
+  // Accessed by the owner only
+  std::vector<std::unique_ptr<RingBuffer>> _buffers;
+};
+
+}  // namespace opossum
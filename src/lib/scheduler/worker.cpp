@@ -32,8 +32,19 @@ namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, bool use_work_stealing_deque)
+    : _queue(queue),
+      _id(id),
+      _cpu_id(cpu_id),
+      _use_work_stealing_deque(use_work_stealing_deque),
+      _random_engine(static_cast<uint32_t>(id) + 1) {}
+
+bool Worker::unpark_one(const std::vector<std::shared_ptr<Worker>>& workers, NodeID node_id) {
+  for (const auto& worker : workers) {
+    if (worker->queue()->node_id() == node_id && worker->unpark()) return true;
+  }
+  return false;
+}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -41,6 +52,10 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+bool Worker::uses_work_stealing_deque() const { return _use_work_stealing_deque; }
+
+const WorkStealingDeque& Worker::deque() const { return _deque; }
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -59,6 +74,13 @@ void Worker::_work() {
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
+  } else if (_use_work_stealing_deque) {
+    // Tasks spawned by this worker are most likely to find their data in the caches, so these come first. Only then,
+    // take tasks that were scheduled from outside of the workers or steal from the other workers of this node.
+    task = _deque.pop();
+    if (!task) task = _queue->pull();
+    if (!task) task = _steal_from_workers(true);
+    if (!task) task = _steal_from_workers(false);
   } else {
     task = _queue->pull();
   }
@@ -82,6 +104,11 @@ void Worker::_work() {
     // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
     // own queue or returns after timer exceeded (whatever occurs first).
     if (!work_stealing_successful) {
+      if (_use_work_stealing_deque) {
+        _park();
+        return;
+      }
+
       {
         std::unique_lock<std::mutex> unique_lock(_queue->lock);
         _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
@@ -113,11 +140,37 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
+  } else if (_use_work_stealing_deque && task->is_stealable()) {
+    // Being at the bottom of the deque, the task will be the next one that this worker pops. Another worker might
+    // steal it in the meantime.
+    push_to_deque(task);
+    unpark_one(Hyrise::get().scheduler()->workers(), _queue->node_id());
   } else {
     _queue->push(task, static_cast<uint32_t>(SchedulePriority::High));
+    if (_use_work_stealing_deque) unpark_one(Hyrise::get().scheduler()->workers(), _queue->node_id());
   }
 }
 
+void Worker::push_to_deque(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this, "Only the owning worker may push into its deque");
+  DebugAssert(_use_work_stealing_deque, "Worker does not use a work-stealing deque");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque.push(task);
+}
+
+bool Worker::unpark() {
+  if (!_parked.exchange(false)) return false;
+
+  // Acquiring the mutex makes sure that the worker either has not checked the predicate yet or is already waiting.
+  { std::lock_guard<std::mutex> lock(_park_mutex); }
+  _park_condition_variable.notify_one();
+  return true;
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -143,6 +196,49 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
   }
 }
 
+std::shared_ptr<AbstractTask> Worker::_steal_from_workers(bool local_node) {
+  const auto& workers = Hyrise::get().scheduler()->workers();
+  const auto worker_count = workers.size();
+  if (worker_count < 2) return nullptr;
+
+  // Start at a random victim to avoid all idle workers contending on the same deque
+  const auto first_victim = std::uniform_int_distribution<size_t>{0, worker_count - 1}(_random_engine);
+  for (auto offset = size_t{0}; offset < worker_count; ++offset) {
+    const auto& victim = workers[(first_victim + offset) % worker_count];
+    if (victim.get() == this) continue;
+    if ((victim->queue() == _queue) != local_node) continue;
+
+    auto task = victim->_deque.steal();
+    if (task) {
+      if (!local_node) task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void Worker::_park() {
+  std::unique_lock<std::mutex> lock(_park_mutex);
+  _parked = true;
+
+  // Tasks might have been added after this worker last looked for them, but before it was marked as parked. Whoever
+  // adds a task first pushes it and then tries to unpark a worker, while this worker first marks itself as parked and
+  // then looks for tasks. Thus, one of the two threads sees the other one's write.
+  const auto has_visible_work = [&]() {
+    if (!_queue->empty()) return true;
+    for (const auto& worker : Hyrise::get().scheduler()->workers()) {
+      if (worker->queue() == _queue && !worker->_deque.empty()) return true;
+    }
+    return false;
+  };
+
+  if (!has_visible_work()) {
+    // The timeout guards against lost wake-ups, e.g., for tasks that become ready on another node
+    _park_condition_variable.wait_for(lock, WORKER_SLEEP_TIME, [&]() { return !_parked; });
+  }
+  _parked = false;
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <thread>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,6 +20,11 @@ class TaskQueue;
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * If use_work_stealing_deque is set, the Worker additionally owns a WorkStealingDeque, into which the tasks that it
+ * spawns are pushed. An idle Worker first steals from randomly chosen Workers of its own node and only then from
+ * other nodes. Instead of waiting on the condition variable of the node's TaskQueue, an idle Worker parks on its own
+ * condition variable, so that a new task wakes up exactly one Worker.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -23,7 +32,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, bool use_work_stealing_deque = false);
+
+  /**
+   * Wakes up one parked Worker of the given node, if there is any. Returns whether a Worker was woken up.
+   */
+  static bool unpark_one(const std::vector<std::shared_ptr<Worker>>& workers, NodeID node_id);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -31,6 +45,8 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
+  bool uses_work_stealing_deque() const;
+  const WorkStealingDeque& deque() const;
 
   void start();
   void join();
@@ -42,6 +58,16 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // so that they are worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  /**
+   * Pushes the task into the deque of this Worker. Must be called from the thread that the worker works in.
+   */
+  void push_to_deque(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Wakes up this Worker if it is parked. Returns whether it was parked.
+   */
+  bool unpark();
+
   uint64_t num_finished_tasks() const;
 
   void operator=(const Worker&) = delete;
@@ -60,12 +86,27 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  // Tries to steal a task from the deque of a randomly chosen Worker on the own node (or, if local_node is false, on
+  // any other node).
+  std::shared_ptr<AbstractTask> _steal_from_workers(bool local_node);
+
+  // Blocks until unpark() is called or WORKER_SLEEP_TIME has passed
+  void _park();
+
   std::shared_ptr<AbstractTask> _next_task{};
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+
+  const bool _use_work_stealing_deque;
+  WorkStealingDeque _deque;
+  std::minstd_rand _random_engine;
+
+  std::atomic_bool _parked{false};
+  std::mutex _park_mutex;
+  std::condition_variable _park_condition_variable;
 };
 
 }  // namespace opossum
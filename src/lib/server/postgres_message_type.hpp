@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 // Each message contains a field (4 bytes) indicating the packet's size including itself. Using extra variable here to
@@ -22,6 +24,7 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  PortalSuspended = 's',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
@@ -51,6 +54,9 @@ enum class TransactionStatusIndicator : unsigned char {
   InFailedTransactionBlock = 'e'
 };
 
+// Format of parameter and result values. Binary values are sent in network byte order.
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 // SQL error codes
 constexpr char TRANSACTION_CONFLICT[] = "40001";
 
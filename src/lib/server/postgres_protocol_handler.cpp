@@ -7,7 +7,7 @@ PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_p
     : _read_buffer(socket), _write_buffer(socket) {}
 
 template <typename SocketType>
-uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
+std::optional<uint32_t> PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
   // Special SSL version number that we catch to deny SSL support
   constexpr auto SSL_REQUEST_CODE = 80877103u;
 
@@ -17,7 +17,7 @@ uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
   // We currently do not support SSL
   if (protocol_version == SSL_REQUEST_CODE) {
     _ssl_deny();
-    return read_startup_packet_header();
+    return std::nullopt;
   } else {
     // Subtract uint32_t twice, since both packet length and protocol version have been read already
     return body_length - 2 * LENGTH_FIELD_SIZE;
@@ -89,7 +89,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width, const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,12 +99,12 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
 }
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_data_row(
-    const std::vector<std::optional<std::string>>& values_as_strings, const uint32_t string_length_sum) {
+    const std::vector<std::optional<std::string_view>>& values_as_strings, const uint32_t string_length_sum) {
   // The documentation of the fields in this message can be found at:
   // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
 
@@ -120,10 +120,10 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
 
   for (const auto& value_string : values_as_strings) {
     if (value_string.has_value()) {
-      // Size of string representation of value, NOT of value type's size
+      // Size of the value's text or binary representation
       _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(value_string.value().size()));
 
-      // Text mode means all values are sent as non-terminated strings
+      // Both text and binary values are sent without terminator
       _write_buffer.put_string(value_string.value(), HasNullTerminator::No);
     } else {
       // NULL values are represented by setting the value's length to -1
@@ -207,15 +207,21 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
+  std::vector<FormatCode> result_format_codes;
+  result_format_codes.reserve(num_result_column_format_codes);
   for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    AssertInput(format_code == static_cast<int16_t>(FormatCode::Text) ||
+                    format_code == static_cast<int16_t>(FormatCode::Binary),
+                "Unknown result format code " + std::to_string(format_code) + ".");
+    result_format_codes.emplace_back(static_cast<FormatCode>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_format_codes};
 }
 
 template <typename SocketType>
-std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
+std::pair<std::string, uint32_t> PostgresProtocolHandler<SocketType>::read_execute_packet() {
   const auto packet_size = _read_buffer.template get_value<uint32_t>();
   auto portal = _read_buffer.get_string(packet_size - 2 * sizeof(uint32_t));
   /* https://www.postgresql.org/docs/12/protocol-flow.html:
@@ -223,8 +229,8 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
    the command is always executed to completion, and the row count is ignored.
   */
   const auto row_limit = _read_buffer.template get_value<int32_t>();
-  Assert(row_limit == 0, "Row limit of 0 (unlimited) expected.");
-  return portal;
+  AssertInput(row_limit >= 0, "Row limit must not be negative.");
+  return {portal, static_cast<uint32_t>(row_limit)};
 }
 
 template <typename SocketType>
@@ -272,7 +278,7 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<SessionStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
@@ -1,21 +1,27 @@
 #pragma once
 
+#include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
 #include "postgres_message_type.hpp"
 #include "read_buffer.hpp"
+#include "session_stream.hpp"
 #include "write_buffer.hpp"
 
 namespace opossum {
 
 using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the requested formats
+// of the result columns. The format codes are either empty (all columns in text format), a single code that applies
+// to all columns, or one code per column.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<FormatCode> result_format_codes;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -25,8 +31,9 @@ class PostgresProtocolHandler {
  public:
   explicit PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket);
 
-  // Handle the startup packet header returning the body's size
-  uint32_t read_startup_packet_header();
+  // Handle the startup packet header returning the body's size. SSL requests are denied, in which case std::nullopt is
+  // returned and the client continues with another startup packet.
+  std::optional<uint32_t> read_startup_packet_header();
   void read_startup_packet_body(const uint32_t size);
 
   // Setup new connection: successful authentication + sending parameters
@@ -44,8 +51,9 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
-  void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
+  void send_data_row(const std::vector<std::optional<std::string_view>>& values_as_strings,
                      const uint32_t string_length_sum);
   void send_command_complete(const std::string& command_complete_message);
 
@@ -59,7 +67,8 @@ class PostgresProtocolHandler {
   // Series of packets for binding and executing prepared statements
   void read_describe_packet();
   PreparedStatementDetails read_bind_packet();
-  std::string read_execute_packet();
+  // Returns the portal name and the maximum number of rows to return (0 means unlimited)
+  std::pair<std::string, uint32_t> read_execute_packet();
 
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessage& error_message);
@@ -67,6 +76,10 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
+  // Check if the client has sent data that has been received but not been read yet, e.g., because the client sent
+  // multiple messages at once
+  bool has_buffered_input() const { return _read_buffer.size() > 0; }
+
   // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
   void force_flush() { _write_buffer.flush(); }
 
@@ -1,13 +1,100 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+#include <boost/lexical_cast.hpp>
+
 #include "query_handler.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Serialized representation of a range of a segment's values. The bytes of all values are stored back to back. NULL
+// values are stored as a length of NULL_LENGTH.
+struct SerializedColumn {
+  std::string bytes;
+  std::vector<size_t> lengths;
+};
+
+constexpr auto NULL_LENGTH = std::numeric_limits<size_t>::max();
+
+// Expands the format codes of a Bind message to one format code per column
+std::vector<FormatCode> column_format_codes(const std::vector<FormatCode>& result_format_codes,
+                                            const ColumnCount column_count) {
+  if (result_format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (result_format_codes.size() == 1) return std::vector<FormatCode>(column_count, result_format_codes.front());
+
+  AssertInput(result_format_codes.size() == column_count,
+              "Expected one result format code per column, got " + std::to_string(result_format_codes.size()) + ".");
+  return result_format_codes;
+}
+
+// Appends the binary representation of an int4, int8, float4, or float8 value in network byte order
+template <typename ColumnDataType>
+void append_binary_value(std::string& bytes, const ColumnDataType value) {
+  using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+  auto bits = UnsignedType{};
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  auto buffer = std::array<char, sizeof(UnsignedType)>{};
+  for (auto byte_index = sizeof(UnsignedType); byte_index > 0; --byte_index) {
+    buffer[byte_index - 1] = static_cast<char>(bits & 0xFF);
+    bits >>= 8;
+  }
+  bytes.append(buffer.data(), buffer.size());
+}
+
+template <typename ColumnDataType>
+void append_values(const AbstractSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                   const FormatCode format_code, SerializedColumn& serialized_column) {
+  auto& bytes = serialized_column.bytes;
+  segment_with_iterators<ColumnDataType>(segment, [&](const auto begin, const auto /* end */) {
+    const auto range_end = begin + end_offset;
+    for (auto iter = begin + begin_offset; iter != range_end; ++iter) {
+      if (iter->is_null()) {
+        serialized_column.lengths.emplace_back(NULL_LENGTH);
+        continue;
+      }
+
+      const auto previous_size = bytes.size();
+      const auto& value = iter->value();
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        // Text and binary representation of strings are the same
+        bytes.append(value);
+      } else {
+        if (format_code == FormatCode::Binary) {
+          append_binary_value(bytes, value);
+        } else if constexpr (std::is_integral_v<ColumnDataType>) {
+          auto buffer = std::array<char, std::numeric_limits<ColumnDataType>::digits10 + 3>{};
+          const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+          bytes.append(buffer.data(), result.ptr);
+        } else {
+          // Floating-point values are formatted the same way as by lossy_variant_cast
+          bytes.append(boost::lexical_cast<std::string>(value));
+        }
+      }
+      serialized_column.lengths.emplace_back(bytes.size() - previous_size);
+    }
+  });
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_format_codes) {
+  const auto format_codes = column_format_codes(result_format_codes, table->column_count());
+
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -48,7 +135,8 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    format_codes[column_id]);
   }
 }
 
@@ -56,38 +144,87 @@ template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
     const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+  send_query_response(table, postgres_protocol_handler, position, 0);
+}
 
+template <typename SocketType>
+uint64_t ResultSerializer::send_query_response(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, RowID& position,
+    const uint64_t max_rows, const std::vector<FormatCode>& result_format_codes) {
   const auto chunk_count = table->chunk_count();
+  const auto column_count = table->column_count();
+  const auto format_codes = column_format_codes(result_format_codes, column_count);
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_size = chunk->size();
+  // The buffers are reused for all chunks
+  auto serialized_columns = std::vector<SerializedColumn>(column_count);
+  auto byte_offsets = std::vector<size_t>(column_count);
+  auto values = std::vector<std::optional<std::string_view>>(column_count);
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+  auto sent_row_count = uint64_t{0};
+
+  while (position.chunk_id < chunk_count && (max_rows == 0 || sent_row_count < max_rows)) {
+    const auto chunk = table->get_chunk(position.chunk_id);
+    const auto chunk_size = static_cast<uint64_t>(chunk->size());
+    const auto begin_offset = static_cast<uint64_t>(position.chunk_offset);
+    auto end_offset = chunk_size;
+    if (max_rows != 0) {
+      end_offset = std::min(end_offset, begin_offset + (max_rows - sent_row_count));
     }
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
+    if (begin_offset < end_offset) {
+      // Convert the rows of this chunk column by column, so that each segment is only resolved once
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        auto& serialized_column = serialized_columns[column_id];
+        serialized_column.bytes.clear();
+        serialized_column.lengths.clear();
+        byte_offsets[column_id] = 0;
+
+        const auto& segment = *chunk->get_segment(column_id);
+        resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          append_values<ColumnDataType>(segment, static_cast<ChunkOffset>(begin_offset),
+                                        static_cast<ChunkOffset>(end_offset), format_codes[column_id],
+                                        serialized_column);
+        });
+      }
+
+      for (auto row_index = size_t{0}; row_index < end_offset - begin_offset; ++row_index) {
+        // Sum up value lengths for a row to save an extra loop during serialization
+        auto length_sum = uint32_t{0};
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          const auto& serialized_column = serialized_columns[column_id];
+          const auto length = serialized_column.lengths[row_index];
+          if (length == NULL_LENGTH) {
+            values[column_id] = std::nullopt;
+            continue;
+          }
+
+          values[column_id] = std::string_view{serialized_column.bytes.data() + byte_offsets[column_id], length};
+          byte_offsets[column_id] += length;
+          length_sum += length;
         }
-        values_as_strings[segment_id] = string_value;
+        postgres_protocol_handler->send_data_row(values, length_sum);
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+
+      sent_row_count += end_offset - begin_offset;
+    }
+
+    if (end_offset == chunk_size) {
+      ++position.chunk_id;
+      position.chunk_offset = ChunkOffset{0};
+    } else {
+      position.chunk_offset = static_cast<ChunkOffset>(end_offset);
     }
   }
+
+  // Skip empty chunks at the end, so that callers can tell from the position whether any rows are left
+  while (position.chunk_id < chunk_count && table->get_chunk(position.chunk_id)->size() == 0) {
+    ++position.chunk_id;
+  }
+
+  return sent_row_count;
 }
 
 std::string ResultSerializer::build_command_complete_message(const ExecutionInformation& execution_information,
@@ -122,18 +259,29 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_table_description<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
     const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
 
+template uint64_t ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&, RowID&,
+    const uint64_t, const std::vector<FormatCode>&);
+
+template uint64_t ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&, RowID&, const uint64_t,
+    const std::vector<FormatCode>&);
+
 }  // namespace opossum
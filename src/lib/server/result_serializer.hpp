@@ -12,18 +12,32 @@ struct ExecutionInformation;
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
 class ResultSerializer {
  public:
-  // Serialize information about the result table
+  // Serialize information about the result table. result_format_codes are the codes of the Bind message (see
+  // PreparedStatementDetails). By default, all columns are sent in text format.
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_format_codes = {});
 
-  template <typename SocketType>
   // Cast attributes of the result table and send them row-wise
+  template <typename SocketType>
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
       const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
 
+  // Send at most max_rows rows (0 means all remaining rows), starting at position. Values are converted to their text
+  // or binary representation (see send_table_description for result_format_codes) one chunk (range) at a time by
+  // iterating the typed segments, instead of materializing an AllTypeVariant and a std::string per value. The rows
+  // are written to the protocol handler's WriteBuffer, which sends them to the client whenever it runs full, while the
+  // following rows are still being converted. Afterwards, position points to the first row that has not been sent. Its
+  // chunk_id equals the table's chunk count once all rows have been sent. Returns the number of rows sent.
+  template <typename SocketType>
+  static uint64_t send_query_response(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, RowID& position,
+      const uint64_t max_rows, const std::vector<FormatCode>& result_format_codes = {});
+
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
                                                     const uint64_t row_count);
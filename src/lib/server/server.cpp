@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -12,8 +13,11 @@ namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const uint32_t io_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _io_thread_count(io_thread_count) {
+  Assert(_io_thread_count > 0, "At least one I/O thread is required.");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost " << server_address() << "' to connect to the server" << std::endl;
 }
@@ -30,45 +34,51 @@ void Server::run() {
 
   _is_initialized = true;
   _accept_new_session();
+
+  // The calling thread is one of the I/O threads
+  auto io_threads = std::vector<std::thread>{};
+  io_threads.reserve(_io_thread_count - 1);
+  for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+    io_threads.emplace_back([&, thread_id]() {
+      const auto thread_name = "server_io_" + std::to_string(thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
+  // Sessions are referenced by the handlers and tasks processing their requests. The number of running sessions is only
+  // reduced once the session (including its socket) has been destroyed. This makes sure that the server has not shut
+  // down yet.
+  ++_num_running_sessions;
+  auto new_session = std::shared_ptr<Session>(new Session(_io_service, _send_execution_info),
+                                              [&num_running_sessions = _num_running_sessions](Session* session) {
+                                                delete session;
+                                                --num_running_sessions;
+                                              });
   _acceptor.async_accept(*(new_session->socket()),
                          boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
 }
 
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
+  // The acceptor was closed by shutdown()
+  if (error == boost::asio::error::operation_aborted) return;
   Assert(!error, error.message());
 
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
-
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
-
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
+  new_session->start();
   _accept_new_session();
 }
 
@@ -77,6 +87,10 @@ boost::asio::ip::address Server::server_address() const { return _acceptor.local
 uint16_t Server::server_port() const { return _acceptor.local_endpoint().port(); }
 
 void Server::shutdown() {
+  // Cancel accepting the next connection. The acceptor is closed by an I/O thread, as asio objects must not be used
+  // concurrently.
+  boost::asio::post(_io_service, [&]() { _acceptor.close(); });
+
   while (_num_running_sessions > 0) {
     // This busy wait might be inefficient, but as this is only to guarantee a clean shutdown, it's good enough.
     std::this_thread::yield();
@@ -10,9 +10,11 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. A fixed number of I/O threads runs the
+*           io_service, which accepts connections and waits for incoming requests.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. Requests are read and answered by the I/O threads, queries are executed by tasks on
+*            the scheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -29,9 +31,14 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const uint32_t io_thread_count = DEFAULT_IO_THREAD_COUNT);
 
-  // Start server to accept new sessions.
+  // As the I/O threads only read requests and send results, but do not execute queries, few of them suffice for
+  // thousands of connections.
+  static constexpr auto DEFAULT_IO_THREAD_COUNT = uint32_t{2};
+
+  // Start server to accept new sessions. Blocks until the server is shut down.
   void run();
 
   // Return the port the server is running on.
@@ -40,7 +47,7 @@ class Server {
   // Get the current address the server is running. This is important especially for multi-NIC devices.
   boost::asio::ip::address server_address() const;
 
-  // Shutdown Hyrise server.
+  // Shutdown Hyrise server. No new connections are accepted, and the server waits until all clients disconnected.
   void shutdown();
 
   // Indicates if setup is completed.
@@ -51,10 +58,12 @@ class Server {
 
   void _start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error);
 
+  // Number of sessions that have not been destroyed yet, including the one waiting for the next connection
   std::atomic<uint64_t> _num_running_sessions{0};
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const uint32_t _io_thread_count;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace opossum
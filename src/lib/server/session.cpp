@@ -1,56 +1,194 @@
 #include "session.hpp"
 
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "client_disconnect_exception.hpp"
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
 Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
-    : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
-      _send_execution_info(send_execution_info) {}
+    : _io_service(io_service),
+      _socket(std::make_shared<Socket>(io_service)),
+      _stream(std::make_shared<SessionStream>()),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream)),
+      _send_execution_info(send_execution_info),
+      _admission_timer(io_service) {}
 
 std::shared_ptr<Socket> Session::socket() { return _socket; }
 
-void Session::run() {
+void Session::start() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
-  _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
+  auto error = boost::system::error_code{};
+  _socket->set_option(boost::asio::ip::tcp::no_delay(true), error);
+
+  // The client may already have reset the connection. As this runs on an I/O thread, we must not throw but drop the
+  // session, which closes the socket once the last reference is gone.
+  const auto remote_endpoint = _socket->remote_endpoint(error);
+  if (error) return;
+
+  _session_registration = std::make_unique<AdmissionController::SessionRegistration>(
+      *Hyrise::get().admission_controller,
+      remote_endpoint.address().to_string() + ":" + std::to_string(remote_endpoint.port()));
+
+  _receive();
+}
+
+void Session::_receive() {
+  // The handler keeps the session alive. Once no handler and no task references it anymore, it is destroyed and the
+  // socket is closed.
+  const auto receive_buffer = _stream->prepare_receive(SERVER_BUFFER_SIZE);
+  _socket->async_read_some(receive_buffer, [session = shared_from_this()](const boost::system::error_code& error,
+                                                                          const size_t bytes_received) {
+    // An error (including the end of the stream) means that the client closed the connection
+    if (error) return;
+
     try {
-      _handle_request();
+      session->_stream->commit_received(bytes_received);
     } catch (const ClientDisconnectException&) {
       return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
     }
+    session->_handle_received_requests();
+  });
+}
+
+void Session::_handle_received_requests() {
+  // Clients often send multiple messages at once (e.g., Parse, Bind, Execute, and Sync). Handle all of them before
+  // receiving again. Only complete messages are readable, so handling a request never waits for the network.
+  try {
+    while (!_terminate_session && !_pending_task &&
+           (_postgres_protocol_handler->has_buffered_input() || _stream->has_readable_data())) {
+      if (!_connection_established) {
+        _establish_connection();
+      } else {
+        _report_errors([&]() { _handle_request(); });
+      }
+    }
+  } catch (const ClientDisconnectException&) {
+    return;
+  }
+
+  if (_terminate_session) return;
+
+  _send_responses();
+}
+
+void Session::_send_responses() {
+  const auto& unsent_data = _stream->unsent_data();
+  if (!unsent_data.empty()) {
+    // Nothing is written to the stream until the data has been sent, as the session only continues afterwards
+    boost::asio::async_write(*_socket, boost::asio::buffer(unsent_data),
+                             [session = shared_from_this()](const boost::system::error_code& error, const size_t) {
+                               if (error) return;
+                               session->_stream->clear_unsent_data();
+                               session->_send_responses();
+                             });
+    return;
+  }
+
+  if (_pending_task) {
+    // The task is only scheduled now, as it continues with the session's requests once it has finished
+    _schedule_pending_task();
+    return;
   }
+
+  _receive();
+}
+
+void Session::_schedule_pending_task() {
+  _admission = AdmissionController::Admission::try_create(*Hyrise::get().admission_controller, _pending_statement,
+                                                          _session_registration->memory_resource());
+  if (!_admission) {
+    // The memory of the running statements is nearly exhausted. Instead of blocking, the I/O thread serves other
+    // sessions until the next attempt.
+    _admission_timer.expires_after(AdmissionController::RECHECK_INTERVAL);
+    _admission_timer.async_wait([session = shared_from_this()](const boost::system::error_code& error) {
+      if (error) return;
+      session->_schedule_pending_task();
+    });
+    return;
+  }
+
+  // From now on, this thread must not access the session anymore
+  const auto task = std::move(_pending_task);
+  task->schedule();
 }
 
 void Session::_establish_connection() {
   const auto body_length = _postgres_protocol_handler->read_startup_packet_header();
 
+  // The client requested SSL, which was denied. It sends the actual startup packet once it has received the response.
+  if (!body_length) return;
+
   // Currently, the information available in the start up packet body (such as db name, user name) is ignored
-  _postgres_protocol_handler->read_startup_packet_body(body_length);
+  _postgres_protocol_handler->read_startup_packet_body(*body_length);
   _postgres_protocol_handler->send_authentication_response();
   _postgres_protocol_handler->send_parameter("server_version", "12");
   _postgres_protocol_handler->send_parameter("server_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("client_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("DateStyle", "ISO, DMY");
   _postgres_protocol_handler->send_ready_for_query();
+  _connection_established = true;
+}
+
+void Session::_report_errors(const std::function<void()>& handler) {
+  try {
+    handler();
+  } catch (const ClientDisconnectException&) {
+    throw;
+  } catch (const std::exception& e) {
+    std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+              << e.what() << std::endl;
+    const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
+    _postgres_protocol_handler->send_error_message(error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+    // Messages that have already been received are processed further. A "sync" message makes the server send another
+    // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
+    // query arrives it must be set to false again to ensure correct message flow.
+    _sync_send_after_error = true;
+  }
+}
+
+void Session::_execute_on_scheduler(const std::string& statement, const std::function<void()>& execute,
+                                    const std::function<void()>& send_result) {
+  DebugAssert(!_pending_task, "Only one request can wait for the scheduler at a time");
+
+  // The task runs on a worker and must not use the socket. Sending the result is posted to the I/O threads.
+  _pending_statement = statement;
+  _pending_task = std::make_shared<JobTask>([session = shared_from_this(), execute, send_result]() {
+    auto exception = std::exception_ptr{};
+    try {
+      // The SQLPipelineStatements of the request are executed as nested statements of its admission
+      const auto memory_resource_scope = MemoryResourceScope{session->_admission->memory_resource()};
+      execute();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    session->_admission.reset();
+
+    boost::asio::post(session->_io_service, [session, send_result, exception]() {
+      try {
+        session->_report_errors([&]() {
+          if (exception) std::rethrow_exception(exception);
+          send_result();
+        });
+        session->_handle_received_requests();
+      } catch (const ClientDisconnectException&) {
+        return;
+      }
+    });
+  });
 }
 
 void Session::_handle_request() {
@@ -100,44 +238,53 @@ void Session::_handle_request() {
 }
 
 void Session::_handle_simple_query() {
-  const auto& query = _postgres_protocol_handler->read_query_packet();
+  const auto query = _postgres_protocol_handler->read_query_packet();
 
   // A simple query command invalidates unnamed portals
   _portals.erase("");
 
-  ExecutionInformation execution_information;
-
-  std::tie(execution_information, _transaction_context) =
-      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
-
-  if (!execution_information.error_message.empty()) {
-    _postgres_protocol_handler->send_error_message(execution_information.error_message);
-  } else {
-    uint64_t row_count = 0;
-    // If there is no result table, e.g. after an INSERT command, we cannot send row data. Otherwise, the result table
-    // of the last statement will be send back.
-    if (execution_information.result_table) {
-      ResultSerializer::send_table_description(execution_information.result_table, _postgres_protocol_handler);
-      ResultSerializer::send_query_response(execution_information.result_table, _postgres_protocol_handler);
-      row_count = execution_information.result_table->row_count();
-    }
-    if (_send_execution_info == SendExecutionInfo::Yes) {
-      _postgres_protocol_handler->send_execution_info(execution_information.pipeline_metrics);
-    }
-    _postgres_protocol_handler->send_command_complete(
-        ResultSerializer::build_command_complete_message(execution_information, row_count));
-  }
-
-  _postgres_protocol_handler->send_ready_for_query();
+  const auto execution_information = std::make_shared<ExecutionInformation>();
+
+  _execute_on_scheduler(
+      query,
+      [this, query, execution_information]() {
+        std::tie(*execution_information, _transaction_context) =
+            QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
+      },
+      [this, execution_information]() {
+        if (!execution_information->error_message.empty()) {
+          _postgres_protocol_handler->send_error_message(execution_information->error_message);
+        } else {
+          uint64_t row_count = 0;
+          // If there is no result table, e.g. after an INSERT command, we cannot send row data. Otherwise, the result
+          // table of the last statement will be send back.
+          if (execution_information->result_table) {
+            ResultSerializer::send_table_description(execution_information->result_table, _postgres_protocol_handler);
+            ResultSerializer::send_query_response(execution_information->result_table, _postgres_protocol_handler);
+            row_count = execution_information->result_table->row_count();
+          }
+          if (_send_execution_info == SendExecutionInfo::Yes) {
+            _postgres_protocol_handler->send_execution_info(execution_information->pipeline_metrics);
+          }
+          _postgres_protocol_handler->send_command_complete(
+              ResultSerializer::build_command_complete_message(*execution_information, row_count));
+        }
+
+        _postgres_protocol_handler->send_ready_for_query();
+      });
 }
 
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
-  QueryHandler::setup_prepared_plan(statement_name, query);
 
-  _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
+  _execute_on_scheduler(
+      query,
+      [statement_name = statement_name, query = query]() { QueryHandler::setup_prepared_plan(statement_name, query); },
+      [this]() {
+        _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
 
-  // Ready for query + flush will be done after reading sync message
+        // Ready for query + flush will be done after reading sync message
+      });
 }
 
 void Session::_handle_bind_command() {
@@ -155,61 +302,103 @@ void Session::_handle_bind_command() {
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
-
-  const auto pqp = QueryHandler::bind_prepared_plan(parameters);
-
-  _portals[parameters.portal] = pqp;
-  _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
-
-  // Ready for query + flush will be done after reading sync message
+  _portals.emplace(parameters.portal, Portal{});
+
+  // Binding optimizes the instantiated plan, which is done by the scheduler
+  const auto pqp = std::make_shared<std::shared_ptr<AbstractOperator>>();
+
+  _execute_on_scheduler(
+      "BIND " + parameters.statement_name,
+      [parameters, pqp]() { *pqp = QueryHandler::bind_prepared_plan(parameters); },
+      [this, parameters, pqp]() {
+        auto& portal = _portals[parameters.portal];
+        portal.statement_name = parameters.statement_name;
+        portal.physical_plan = *pqp;
+        portal.result_format_codes = parameters.result_format_codes;
+        _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
+
+        // Ready for query + flush will be done after reading sync message
+      });
 }
 
 void Session::_sync() {
   _postgres_protocol_handler->read_sync_packet();
-  if (_transaction_context) {
-    _transaction_context->commit();
-    _transaction_context.reset();
+  if (!_transaction_context) {
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
   }
-  _postgres_protocol_handler->send_ready_for_query();
+
+  _execute_on_scheduler(
+      "COMMIT",
+      [this]() {
+        _transaction_context->commit();
+        _transaction_context.reset();
+      },
+      [this]() { _postgres_protocol_handler->send_ready_for_query(); });
 }
 
 void Session::_handle_execute() {
-  const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
+  const auto [portal_name, max_rows] = _postgres_protocol_handler->read_execute_packet();
 
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
 
+  // The portal is only put back if it is named or if it was suspended. Thus, an unnamed portal is gone if the
+  // execution fails.
+  const auto portal = std::make_shared<Portal>(std::move(portal_it->second));
+  _portals.erase(portal_it);
+
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
-    _portals.erase(portal_it);
-    return;
-  }
+  if (!portal->physical_plan) return;
 
-  const auto physical_plan = portal_it->second;
+  const auto send_rows = [this, portal_name = portal_name, max_rows = max_rows, portal]() {
+    uint64_t row_count = 0;
+    if (portal->result_table) {
+      row_count = ResultSerializer::send_query_response(portal->result_table, _postgres_protocol_handler,
+                                                        portal->next_row, max_rows, portal->result_format_codes);
+
+      if (portal->next_row.chunk_id < portal->result_table->chunk_count()) {
+        // The row limit was reached before all rows were sent
+        _postgres_protocol_handler->send_status_message(PostgresMessageType::PortalSuspended);
+        _portals.emplace(portal_name, std::move(*portal));
+        return;
+      }
+    }
+
+    _postgres_protocol_handler->send_command_complete(
+        ResultSerializer::build_command_complete_message(portal->physical_plan->type(), row_count));
+
+    if (!portal_name.empty()) _portals.emplace(portal_name, std::move(*portal));
+    // Ready for query + flush will be done after reading sync message
+  };
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  // A suspended portal is neither executed again nor is its row description sent again
+  if (portal->executed) {
+    send_rows();
+    return;
+  }
 
   if (!_transaction_context) {
     _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   }
-  physical_plan->set_transaction_context_recursively(_transaction_context);
-
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
-
-  uint64_t row_count = 0;
-  // If there is no result table, e.g. after an INSERT command, we cannot send row data
-  if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
-    row_count = result_table->row_count();
-  } else {
-    _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
-  }
-
-  _postgres_protocol_handler->send_command_complete(
-      ResultSerializer::build_command_complete_message(physical_plan->type(), row_count));
-  // Ready for query + flush will be done after reading sync message
+  portal->physical_plan->set_transaction_context_recursively(_transaction_context);
+
+  _execute_on_scheduler(
+      "EXECUTE " + portal->statement_name,
+      [portal]() { portal->result_table = QueryHandler::execute_prepared_plan(portal->physical_plan); },
+      [this, portal, send_rows]() {
+        portal->executed = true;
+
+        // If there is no result table, e.g. after an INSERT command, we cannot send row data
+        if (portal->result_table) {
+          ResultSerializer::send_table_description(portal->result_table, _postgres_protocol_handler,
+                                                   portal->result_format_codes);
+        } else {
+          _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+        }
+
+        send_rows();
+      });
 }
 }  // namespace opossum
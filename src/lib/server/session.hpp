@@ -1,9 +1,18 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "scheduler/admission_controller.hpp"
 #include "scheduler/operator_task.hpp"
+#include "server_types.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -12,19 +21,55 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not own a thread, and their I/O threads never wait for the network. All data is received with
+// async_read_some and sent with async_write by the server's io_service. The protocol handler parses the requests from
+// and serializes the responses into the session's SessionStream, which only hands out complete messages. Once
+// requests have been received, they are handled by the I/O thread. Only the work on the database (optimizing,
+// executing, and committing) is handed to the scheduler as a JobTask. Meanwhile, the session does not handle further
+// requests, and the I/O thread serves other sessions. Once the task has finished, the I/O threads serialize the result
+// and continue with the session's next requests. Hence, the number of connections is independent of the number of
+// threads, and the scheduler's workers never wait for the network.
+//
+// Each session is registered at the AdmissionController, which accounts the memory of all its statements (including
+// the results kept in its portals) to the session. A request is admitted by the I/O thread before its task is
+// scheduled. If the request has to be queued, the I/O thread retries after AdmissionController::RECHECK_INTERVAL
+// instead of blocking, so that neither I/O threads nor workers wait for the admission.
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. The session stays alive as long as the client is connected.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
+  // Receive (asynchronously) the data the client sends next and handle the requests that are complete then.
+  void _receive();
+
+  // Handle the requests that have already been received. Then, send the responses and continue with the session.
+  void _handle_received_requests();
+
+  // Send (asynchronously) the responses that have been serialized. Then, wait for the next request or, if a request is
+  // waiting for the scheduler, schedule its task.
+  void _send_responses();
+
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
+  // Call @param handler and send an error message to the client if it fails.
+  void _report_errors(const std::function<void()>& handler);
+
+  // Let the scheduler perform @param execute, which is admitted as @param statement. Once it has finished,
+  // @param send_result is called by an I/O thread and the session continues with the next request. If @param execute
+  // throws, the error is sent instead of the result.
+  void _execute_on_scheduler(const std::string& statement, const std::function<void()>& execute,
+                             const std::function<void()>& send_result);
+
+  // Admit the pending statement and schedule its task. If the statement has to be queued, try again later.
+  void _schedule_pending_task();
+
   // Determine message and call the appropriate method.
   void _handle_request();
 
@@ -40,18 +85,42 @@ class Session {
   // Read describe message. Row description will be send after execution.
   void _handle_describe();
 
-  // Execute prepared statement and send row description.
+  // Execute prepared statement and send row description. If the client limits the number of rows, the portal is
+  // suspended and the next Execute message for it continues with the remaining rows.
   void _handle_execute();
 
   // Commit current transaction.
   void _sync();
 
+  boost::asio::io_service& _io_service;
   const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  const std::shared_ptr<SessionStream> _stream;
+  const std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+
+  // Task of a request that waits for the scheduler, see _execute_on_scheduler
+  std::shared_ptr<AbstractTask> _pending_task;
+  std::string _pending_statement;
+
+  std::unique_ptr<AdmissionController::SessionRegistration> _session_registration;
+  std::unique_ptr<AdmissionController::Admission> _admission;
+  boost::asio::steady_timer _admission_timer;
+
+  // A bound prepared statement. A physical_plan of nullptr signalizes that binding failed. Once executed, the result
+  // table is kept until all of its rows have been fetched.
+  struct Portal {
+    std::string statement_name;
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_format_codes;
+    bool executed = false;
+    std::shared_ptr<const Table> result_table;
+    RowID next_row{ChunkID{0}, ChunkOffset{0}};
+  };
+
+  std::unordered_map<std::string, Portal> _portals;
 };
 }  // namespace opossum
@@ -0,0 +1,72 @@
+#include "session_stream.hpp"
+
+#include <cstring>
+
+#include "client_disconnect_exception.hpp"
+#include "postgres_message_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Special protocol version of SSL requests. The client sends them in the startup phase, before the startup packet.
+constexpr auto SSL_REQUEST_CODE = 80877103u;
+
+uint32_t read_network_value(const char* data) {
+  auto network_value = uint32_t{0};
+  std::memcpy(&network_value, data, sizeof(uint32_t));
+  return ntohl(network_value);
+}
+
+}  // namespace
+
+namespace opossum {
+
+boost::asio::mutable_buffer SessionStream::prepare_receive(const size_t size) {
+  // Discard the data that has already been read
+  if (_read_position > 0) {
+    _received.erase(_received.begin(), _received.begin() + _read_position);
+    _received_size -= _read_position;
+    _readable_end -= _read_position;
+    _read_position = 0;
+  }
+
+  _received.resize(_received_size + size);
+  return boost::asio::buffer(_received.data() + _received_size, size);
+}
+
+void SessionStream::commit_received(const size_t size) {
+  // prepare_receive() resized the vector for the maximum size
+  DebugAssert(_received_size + size <= _received.size(), "Received more data than prepared");
+  _received_size += size;
+  _received.resize(_received_size);
+
+  // Make all complete messages readable
+  while (true) {
+    const auto header_size = _startup_phase ? LENGTH_FIELD_SIZE : sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE;
+    if (_received_size - _readable_end < header_size) break;
+
+    const auto* const message = _received.data() + _readable_end;
+    const auto message_length = read_network_value(message + header_size - LENGTH_FIELD_SIZE);
+    // The length includes the length field, but not the message type. Startup packets also contain a protocol version.
+    if (message_length < (_startup_phase ? 2 : 1) * LENGTH_FIELD_SIZE) {
+      throw ClientDisconnectException("Received a message with an invalid length.");
+    }
+    const auto message_size = header_size - LENGTH_FIELD_SIZE + message_length;
+    if (_received_size - _readable_end < message_size) break;
+
+    // The startup phase ends with the first startup packet that is not an SSL request
+    if (_startup_phase && read_network_value(message + LENGTH_FIELD_SIZE) != SSL_REQUEST_CODE) {
+      _startup_phase = false;
+    }
+
+    _readable_end += message_size;
+  }
+}
+
+bool SessionStream::has_readable_data() const { return _readable_end > _read_position; }
+
+const std::vector<char>& SessionStream::unsent_data() const { return _unsent_data; }
+
+void SessionStream::clear_unsent_data() { _unsent_data.clear(); }
+
+}  // namespace opossum
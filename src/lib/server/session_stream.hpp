@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include "server_types.hpp"
+
+namespace opossum {
+
+// In-memory stream between the PostgresProtocolHandler of a Session and its socket. The session's I/O threads must
+// not wait for the network. Therefore, the session receives data with async_read_some and sends data with async_write,
+// while the protocol handler reads from and writes to this stream (it implements asio's SyncReadStream and
+// SyncWriteStream concepts):
+//  - Received data only becomes readable once it contains complete messages. Thus, parsing a message never has to wait
+//    for its remaining bytes. To find the message boundaries, the stream knows the framing of the PostgreSQL protocol:
+//    Messages in the startup phase (the startup packet and SSL requests) only consist of their length and their body,
+//    all later messages also start with their type.
+//  - Written data is collected until the session sends it.
+class SessionStream {
+ public:
+  // Returns space for receiving up to @param size bytes. commit_received() has to be called with the number of bytes
+  // actually received.
+  boost::asio::mutable_buffer prepare_receive(const size_t size);
+  void commit_received(const size_t size);
+
+  // Check if a complete message has been received that has not been read yet
+  bool has_readable_data() const;
+
+  // Data written since the last call to clear_unsent_data()
+  const std::vector<char>& unsent_data() const;
+  void clear_unsent_data();
+
+  // SyncReadStream concept. If no complete message is available, nothing is read and error_code is set to eof.
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error_code) {
+    if (!has_readable_data()) {
+      error_code = boost::asio::error::eof;
+      return 0;
+    }
+
+    const auto bytes_read = boost::asio::buffer_copy(
+        buffers, boost::asio::buffer(_received.data() + _read_position, _readable_end - _read_position));
+    _read_position += bytes_read;
+    error_code = {};
+    return bytes_read;
+  }
+
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers) {
+    auto error_code = boost::system::error_code{};
+    const auto bytes_read = read_some(buffers, error_code);
+    if (error_code) throw boost::system::system_error{error_code};
+    return bytes_read;
+  }
+
+  // SyncWriteStream concept. All data is accepted.
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto bytes_written = boost::asio::buffer_size(buffers);
+    const auto offset = _unsent_data.size();
+    _unsent_data.resize(offset + bytes_written);
+    boost::asio::buffer_copy(boost::asio::buffer(_unsent_data.data() + offset, bytes_written), buffers);
+    error_code = {};
+    return bytes_written;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers) {
+    auto error_code = boost::system::error_code{};
+    return write_some(buffers, error_code);
+  }
+
+ private:
+  // Received data. The bytes before _read_position have been read, the bytes from _readable_end on belong to an
+  // incomplete message. Between prepare_receive() and commit_received(), the vector is larger than _received_size.
+  std::vector<char> _received;
+  size_t _received_size{0};
+  size_t _read_position{0};
+  size_t _readable_end{0};
+  bool _startup_phase{true};
+
+  std::vector<char> _unsent_data;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -43,7 +45,7 @@ class WriteBuffer {
   }
 
   // Put string into the buffer. If the string is longer than the buffer itself the buffer will flush automatically.
-  void put_string(const std::string& value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
+  void put_string(const std::string_view value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
 
   // Flush buffer by at least bytes_required. 0 means, flush whole buffer.
   void flush(const size_t bytes_required = 0);
@@ -11,6 +11,7 @@
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "memory/budgeted_memory_resource.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -265,6 +266,12 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  // The statement is queued while the memory of the running statements is nearly exhausted. All allocations of its
+  // tasks (including the result table) are accounted to the statement's memory resource. As tasks are executed within
+  // the scope they were created in, the tasks are created within the scope as well.
+  const auto admission = AdmissionController::Admission{*Hyrise::get().admission_controller, _sql_string};
+  const auto memory_resource_scope = MemoryResourceScope{admission.memory_resource()};
+
   const auto& tasks = get_tasks();
 
   const auto started = std::chrono::high_resolution_clock::now();
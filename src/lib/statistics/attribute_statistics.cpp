@@ -4,6 +4,8 @@
 
 #include "resolve_type.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/bloom_filter_statistics.hpp"
+#include "statistics/statistics_objects/distinct_count_sketch.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
@@ -28,6 +30,11 @@ void AttributeStatistics<T>::set_statistics_object(const std::shared_ptr<Abstrac
   } else if (const auto null_value_ratio_object =
                  std::dynamic_pointer_cast<NullValueRatioStatistics>(statistics_object)) {
     null_value_ratio = null_value_ratio_object;
+  } else if (const auto bloom_filter_object = std::dynamic_pointer_cast<BloomFilterStatistics<T>>(statistics_object)) {
+    bloom_filter = bloom_filter_object;
+  } else if (const auto distinct_count_sketch_object =
+                 std::dynamic_pointer_cast<DistinctCountSketch>(statistics_object)) {
+    distinct_count_sketch = distinct_count_sketch_object;
   } else {
     if constexpr (std::is_arithmetic_v<
                       T>) {  // NOLINT clang-tidy is crazy and sees a "potentially unintended semicolon" here...
@@ -58,6 +65,14 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::scaled(const Se
     statistics->set_statistics_object(min_max_filter->scaled(selectivity));
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->scaled(selectivity));
+  }
+
+  if (distinct_count_sketch) {
+    statistics->set_statistics_object(distinct_count_sketch->scaled(selectivity));
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -97,6 +112,15 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::sliced(
     statistics->set_statistics_object(min_max_filter->sliced(predicate_condition, variant_value, variant_value2));
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->sliced(predicate_condition, variant_value, variant_value2));
+  }
+
+  if (distinct_count_sketch) {
+    statistics->set_statistics_object(
+        distinct_count_sketch->sliced(predicate_condition, variant_value, variant_value2));
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -123,6 +147,11 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
     statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio->ratio));
   }
 
+  if (distinct_count_sketch) {
+    statistics->set_statistics_object(
+        distinct_count_sketch->pruned(num_values_pruned, predicate_condition, variant_value, variant_value2));
+  }
+
   // As pruning is on a table-level granularity, it does not make too much sense to implement pruning on chunk-level
   // statistics such as the filters below.
 
@@ -130,6 +159,10 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
     Fail("Pruning not implemented for min/max filters");
   }
 
+  if (bloom_filter) {
+    Fail("Pruning not implemented for Bloom filters");
+  }
+
   // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
   if constexpr (std::is_arithmetic_v<T>) {
     if (range_filter) {
@@ -140,6 +173,32 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
   return statistics;
 }
 
+template <typename T>
+bool AttributeStatistics<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                              const AllTypeVariant& variant_value,
+                                              const std::optional<AllTypeVariant>& variant_value2) const {
+  // Range filters are only available for arithmetic (non-string) types.
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (range_filter && range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+      return true;
+    }
+    // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
+    DebugAssert(!min_max_filter, "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+  }
+
+  if (min_max_filter && min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return true;
+  }
+
+  // Bloom filters and histograms are optional (see PruningStatisticsConfig). Bloom filters only prune Equals
+  // predicates.
+  if (bloom_filter && bloom_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return true;
+  }
+
+  return histogram && histogram->does_not_contain(predicate_condition, variant_value, variant_value2);
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(AttributeStatistics);
 
 }  // namespace opossum
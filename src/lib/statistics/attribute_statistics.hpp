@@ -15,6 +15,9 @@ template <typename T>
 class AbstractHistogram;
 class AbstractStatisticsObject;
 template <typename T>
+class BloomFilterStatistics;
+class DistinctCountSketch;
+template <typename T>
 class MinMaxFilter;
 template <typename T>
 class RangeFilter;
@@ -41,12 +44,17 @@ class AttributeStatistics : public BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
 
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
   std::string range_strings() const;
 
   std::shared_ptr<AbstractHistogram<T>> histogram;
   std::shared_ptr<MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<RangeFilter<T>> range_filter;
   std::shared_ptr<NullValueRatioStatistics> null_value_ratio;
+  std::shared_ptr<BloomFilterStatistics<T>> bloom_filter;
+  std::shared_ptr<DistinctCountSketch> distinct_count_sketch;
 };
 
 template <typename T>
@@ -71,6 +79,14 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << std::endl;
   }
 
+  if (attribute_statistics.bloom_filter) {
+    stream << "Has BloomFilterStatistics" << std::endl;
+  }
+
+  if (attribute_statistics.distinct_count_sketch) {
+    stream << "Has DistinctCountSketch" << std::endl;
+  }
+
   stream << "}" << std::endl;
 
   return stream;
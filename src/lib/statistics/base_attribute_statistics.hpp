@@ -52,6 +52,14 @@ class BaseAttributeStatistics {
       const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
       const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns true if the pruning filters (MinMaxFilter, RangeFilter, BloomFilterStatistics, histogram) guarantee that no
+   * value of the represented segment satisfies the predicate. Used to prune chunks, both by the ChunkPruningRule and by
+   * operators that only know the predicate's values at execution time (see TableScan).
+   */
+  virtual bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                                const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const = 0;
+
   const DataType data_type;
 
   std::string range_strings() const {return "";};
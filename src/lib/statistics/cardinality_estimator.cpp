@@ -1,7 +1,9 @@
 #include "cardinality_estimator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 
 #include "attribute_statistics.hpp"
 #include "expression/abstract_expression.hpp"
@@ -30,6 +32,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/statistics_objects/distinct_count_sketch.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
@@ -287,10 +290,19 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     const AggregateNode& aggregate_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
   // For AggregateNodes, statistics from group-by columns are forwarded and for the aggregate columns
   // dummy statistics are created for now.
+  //
+  // If all group-by columns have a DistinctCountSketch (see PruningStatisticsConfig), there are at most as many groups
+  // as the product of their distinct counts. Otherwise, we assume that there are as many groups as input rows.
 
   auto column_statistics =
       std::vector<std::shared_ptr<BaseAttributeStatistics>>{aggregate_node.output_expressions().size()};
 
+  const auto group_by_expression_count = aggregate_node.aggregate_expressions_begin_idx;
+  auto group_count = std::optional<Cardinality>{};
+  if (group_by_expression_count > 0) {
+    group_count = Cardinality{1};
+  }
+
   for (size_t expression_idx{0}; expression_idx < aggregate_node.output_expressions().size(); ++expression_idx) {
     const auto& expression = *aggregate_node.output_expressions()[expression_idx];
     const auto input_column_id = aggregate_node.left_input()->find_column_id(expression);
@@ -302,9 +314,30 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
         column_statistics[expression_idx] = std::make_shared<AttributeStatistics<ColumnDataType>>();
       });
     }
+
+    if (expression_idx < group_by_expression_count && group_count) {
+      resolve_data_type(column_statistics[expression_idx]->data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto& group_by_column_statistics =
+            static_cast<const AttributeStatistics<ColumnDataType>&>(*column_statistics[expression_idx]);
+        if (group_by_column_statistics.distinct_count_sketch) {
+          // NULL forms a group of its own
+          const auto& null_value_ratio = group_by_column_statistics.null_value_ratio;
+          const auto null_group_count = !null_value_ratio || null_value_ratio->ratio > 0.0f ? 1.0f : 0.0f;
+          *group_count *= group_by_column_statistics.distinct_count_sketch->sketch.estimate() + null_group_count;
+        } else {
+          group_count.reset();
+        }
+      });
+    }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  auto row_count = input_table_statistics->row_count;
+  if (group_count) {
+    row_count = std::min(row_count, *group_count);
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
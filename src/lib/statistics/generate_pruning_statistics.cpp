@@ -1,13 +1,18 @@
 #include "generate_pruning_statistics.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/hyper_log_log_sketch.hpp"
+#include "statistics/statistics_objects/bloom_filter_statistics.hpp"
+#include "statistics/statistics_objects/distinct_count_sketch.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
@@ -16,6 +21,7 @@
 #include "statistics/table_statistics.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/table.hpp"
+#include "utils/assert.hpp"
 
 namespace {
 
@@ -42,28 +48,105 @@ void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_stati
 
 namespace opossum {
 
-void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
-  if (chunk->pruning_statistics()) {
-    // Pruning statistics should be stable no matter what encoding or sort order is used. Hence, when they are present
-    // they are up to date and we can skip the recreation.
-    return;
-  }
+void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk,
+                                       const std::vector<PruningStatisticsConfig>& column_configs) {
+  const auto column_count = chunk->column_count();
+  Assert(column_configs.empty() || column_configs.size() == static_cast<size_t>(column_count),
+         "Need one PruningStatisticsConfig per column");
 
-  auto chunk_statistics = ChunkPruningStatistics{chunk->column_count()};
+  // Pruning statistics should be stable no matter what encoding or sort order is used. Hence, when they are present
+  // they are up to date and we only have to add the statistics objects that were configured since.
+  const auto& existing_chunk_statistics = chunk->pruning_statistics();
+  auto chunk_statistics =
+      existing_chunk_statistics ? *existing_chunk_statistics : ChunkPruningStatistics{chunk->column_count()};
+  auto statistics_changed = false;
 
-  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
     const auto segment = chunk->get_segment(column_id);
+    const auto column_config = column_configs.empty() ? PruningStatisticsConfig{} : column_configs[column_id];
 
     resolve_data_and_segment_type(*segment, [&](auto type, auto& typed_segment) {
       using SegmentType = std::decay_t<decltype(typed_segment)>;
       using ColumnDataType = typename decltype(type)::type;
 
+      const auto existing_segment_statistics =
+          std::static_pointer_cast<AttributeStatistics<ColumnDataType>>(chunk_statistics[column_id]);
+      const auto needs_filter = !existing_segment_statistics;
+      const auto needs_bloom_filter = column_config.bloom_filter_bits_per_value > 0.0f &&
+                                      (!existing_segment_statistics || !existing_segment_statistics->bloom_filter);
+      const auto needs_distinct_count_sketch =
+          column_config.distinct_count_sketch_precision > 0 &&
+          (!existing_segment_statistics || !existing_segment_statistics->distinct_count_sketch);
+      const auto needs_histogram = column_config.histogram_bin_count > 0 &&
+                                   (!existing_segment_statistics || !existing_segment_statistics->histogram);
+      if (!needs_filter && !needs_bloom_filter && !needs_distinct_count_sketch && !needs_histogram) return;
+
+      // The statistics might be in use by the optimizer. Thus, we extend a copy instead of the existing object.
       const auto segment_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+      if (existing_segment_statistics) {
+        segment_statistics->histogram = existing_segment_statistics->histogram;
+        segment_statistics->null_value_ratio = existing_segment_statistics->null_value_ratio;
+        segment_statistics->min_max_filter = existing_segment_statistics->min_max_filter;
+        segment_statistics->range_filter = existing_segment_statistics->range_filter;
+        segment_statistics->bloom_filter = existing_segment_statistics->bloom_filter;
+        segment_statistics->distinct_count_sketch = existing_segment_statistics->distinct_count_sketch;
+      }
+
+      const auto create_statistics = [&](const pmr_vector<ColumnDataType>& dictionary) {
+        if (needs_filter) {
+          create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        }
+
+        if (needs_bloom_filter) {
+          segment_statistics->set_statistics_object(BloomFilterStatistics<ColumnDataType>::from_values(
+              dictionary, column_config.bloom_filter_bits_per_value));
+        }
+
+        if (needs_distinct_count_sketch) {
+          auto sketch = HyperLogLogSketch{column_config.distinct_count_sketch_precision};
+          for (const auto& value : dictionary) {
+            sketch.add(value);
+          }
+          segment_statistics->set_statistics_object(
+              std::make_shared<DistinctCountSketch>(data_type_from_type<ColumnDataType>(), sketch));
+        }
+      };
+
+      if (needs_histogram) {
+        // The dictionary does not contain the number of occurrences of each value, so we count them ourselves
+        auto value_counts = std::unordered_map<ColumnDataType, HistogramCountType>{};
+        create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+          if (!value.is_null()) {
+            ++value_counts[value.value()];
+          }
+        });
+        auto value_distribution =
+            std::vector<std::pair<ColumnDataType, HistogramCountType>>{value_counts.cbegin(), value_counts.cend()};
+        std::sort(value_distribution.begin(), value_distribution.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        // String histograms only support the characters of their HistogramDomain. Mapping the other values into the
+        // domain would move the bin bounds, so that values could be pruned wrongly. Such segments keep only their
+        // MinMaxFilter.
+        auto values_in_domain = true;
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          const auto domain = StringHistogramDomain{};
+          values_in_domain =
+              std::all_of(value_distribution.cbegin(), value_distribution.cend(),
+                          [&](const auto& value_and_count) { return domain.contains(value_and_count.first); });
+        }
+
+        // Segments without non-NULL values do not get a histogram, see EqualDistinctCountHistogram::from_distribution
+        if (values_in_domain) {
+          segment_statistics->set_statistics_object(EqualDistinctCountHistogram<ColumnDataType>::from_distribution(
+              value_distribution, column_config.histogram_bin_count));
+        }
+      }
 
       if constexpr (std::is_same_v<SegmentType, DictionarySegment<ColumnDataType>>) {
         // we can use the fact that dictionary segments have an accessor for the dictionary
         const auto& dictionary = *typed_segment.dictionary();
-        create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        create_statistics(dictionary);
       } else {
         // if we have a generic segment we create the dictionary ourselves
         auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
@@ -76,14 +159,17 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk) {
         });
         pmr_vector<ColumnDataType> dictionary{values.cbegin(), values.cend()};
         std::sort(dictionary.begin(), dictionary.end());
-        create_pruning_statistics_for_segment(*segment_statistics, dictionary);
+        create_statistics(dictionary);
       }
 
       chunk_statistics[column_id] = segment_statistics;
+      statistics_changed = true;
     });
   }
 
-  chunk->set_pruning_statistics(chunk_statistics);
+  if (statistics_changed) {
+    chunk->set_pruning_statistics(chunk_statistics);
+  }
 }
 
 void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table) {
@@ -95,7 +181,7 @@ void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table) {
       continue;
     }
 
-    generate_chunk_pruning_statistics(chunk);
+    generate_chunk_pruning_statistics(chunk, table->pruning_statistics_configs());
   }
 }
 
@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <unordered_set>
+#include <vector>
+
+#include "types.hpp"
 
 namespace opossum {
 
@@ -9,12 +12,39 @@ class Chunk;
 class Table;
 
 /**
- * Generate Pruning Filters for an immutable Chunk
+ * Besides a MinMaxFilter or RangeFilter, the pruning statistics of a segment can contain a BloomFilterStatistics and
+ * a DistinctCountSketch. Both are disabled by default (zero) and can be enabled per column using
+ * Table::set_pruning_statistics_config, as they need more space and only pay off for some columns:
+ *
+ * A BloomFilterStatistics with bloom_filter_bits_per_value bits per distinct value (rounded up, see BloomFilter) of
+ * the segment allows the ChunkPruningRule to prune chunks for = and IN predicates on unsorted columns with many
+ * distinct values, where the value range of every segment covers almost all searched values. Ten bits per value give
+ * a false positive rate of about 1%.
+ *
+ * A DistinctCountSketch uses 2^distinct_count_sketch_precision bytes (see HyperLogLogSketch). The sketches of all
+ * chunks are merged into the column's TableStatistics, which the CardinalityEstimator uses for the number of groups
+ * of an aggregate.
+ *
+ * An EqualDistinctCountHistogram with up to histogram_bin_count bins describes the values of a segment more precisely
+ * than its MinMaxFilter or RangeFilter. Its bins are used as value ranges by the DipsPruningRule and allow pruning
+ * for values that fall between two bins, e.g., for unsorted string columns whose values are clustered.
+ */
+struct PruningStatisticsConfig {
+  float bloom_filter_bits_per_value{0.0f};
+  uint8_t distinct_count_sketch_precision{0};
+  uint32_t histogram_bin_count{0};
+};
+
+/**
+ * Generate Pruning Filters for an immutable Chunk. Segments whose statistics already exist only get the Bloom filters,
+ * DistinctCountSketches, and histograms that were configured in @param column_configs but are missing. If
+ * @param column_configs is empty, only MinMaxFilters and RangeFilters are created.
  */
-void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk);
+void generate_chunk_pruning_statistics(const std::shared_ptr<Chunk>& chunk,
+                                       const std::vector<PruningStatisticsConfig>& column_configs = {});
 
 /**
- * Generate Pruning Filters for all immutable Chunks in this Table
+ * Generate Pruning Filters for all immutable Chunks in this Table, using Table::pruning_statistics_configs
  */
 void generate_chunk_pruning_statistics(const std::shared_ptr<Table>& table);
 
@@ -0,0 +1,78 @@
+#include "hyper_log_log_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Finalizer of SplitMix64, which distributes the bits of its input over the entire output
+uint64_t mix_hash(uint64_t hash) {
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+HyperLogLogSketch::HyperLogLogSketch(const uint8_t precision) : _precision(precision) {
+  Assert(precision >= 4 && precision <= 18, "HyperLogLogSketch precision must be in [4, 18]");
+  _registers.resize(size_t{1} << precision);
+}
+
+void HyperLogLogSketch::add_hash(const size_t hash) {
+  const auto mixed_hash = mix_hash(static_cast<uint64_t>(hash));
+
+  // The first bits select the register, the position of the first set bit in the remaining bits determines the
+  // value. Setting the lowest bit limits the value to 64 - precision + 1 if all remaining bits are zero.
+  const auto register_index = mixed_hash >> (64 - _precision);
+  const auto remaining_bits = (mixed_hash << _precision) | uint64_t{1};
+  const auto value = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_index] = std::max(_registers[register_index], value);
+}
+
+void HyperLogLogSketch::merge(const HyperLogLogSketch& other) {
+  Assert(_precision == other._precision, "Can only merge HyperLogLogSketches with the same precision");
+  for (auto register_index = size_t{0}; register_index < _registers.size(); ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+Cardinality HyperLogLogSketch::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto value : _registers) {
+    inverse_sum += std::ldexp(1.0, -value);
+    zero_register_count += value == 0;
+  }
+
+  // Bias correction constant alpha_m as given in the paper
+  auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  if (_registers.size() == 16) alpha = 0.673;
+  if (_registers.size() == 32) alpha = 0.697;
+  if (_registers.size() == 64) alpha = 0.709;
+
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, many registers are still empty and linear counting is more accurate. As we use 64 bit
+  // hashes, no correction for large cardinalities is required.
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    const auto inverse_zero_register_ratio = register_count / static_cast<double>(zero_register_count);
+    return static_cast<Cardinality>(register_count * std::log(inverse_zero_register_ratio));
+  }
+
+  return static_cast<Cardinality>(raw_estimate);
+}
+
+uint8_t HyperLogLogSketch::precision() const { return _precision; }
+
+}  // namespace opossum
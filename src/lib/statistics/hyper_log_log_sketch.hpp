@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm",
+ * 2007) that estimates the number of distinct values added to it. With a precision of p, the sketch uses 2^p bytes and
+ * its estimates have a standard error of about 1.04 / sqrt(2^p), i.e., 1.6% for the default precision.
+ *
+ * Sketches with the same precision can be merged. The sketch of a union of value sets is the merge of their sketches,
+ * which allows us to create the sketches per segment and combine them for a column.
+ */
+class HyperLogLogSketch {
+ public:
+  static constexpr uint8_t DEFAULT_PRECISION = 12;
+
+  explicit HyperLogLogSketch(const uint8_t precision = DEFAULT_PRECISION);
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  // The hash is mixed before it is used, so that std::hash's identity hash for integers can be passed as well
+  void add_hash(const size_t hash);
+
+  void merge(const HyperLogLogSketch& other);
+
+  Cardinality estimate() const;
+
+  uint8_t precision() const;
+
+ private:
+  uint8_t _precision;
+
+  // Maximum number of leading zeros (plus one) of the hashes that were assigned to each register
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "segment_summary.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+BaseSegmentSummary::BaseSegmentSummary(const DataType init_data_type, const uint8_t sketch_precision)
+    : data_type(init_data_type), distinct_values(sketch_precision) {}
+
+template <typename T>
+SegmentSummary<T>::SegmentSummary(const uint8_t sketch_precision)
+    : BaseSegmentSummary(data_type_from_type<T>(), sketch_precision) {}
+
+template <typename T>
+std::shared_ptr<SegmentSummary<T>> SegmentSummary<T>::from_segment(const AbstractSegment& segment,
+                                                                   const size_t sample_size,
+                                                                   const uint8_t sketch_precision) {
+  auto summary = std::make_shared<SegmentSummary<T>>(sketch_precision);
+  summary->sample.reserve(std::min(sample_size, static_cast<size_t>(segment.size())));
+
+  // Reservoir sampling with Li's Algorithm L: Once the reservoir is full, the number of values to skip until the next
+  // one that replaces a random sampled value is drawn from a geometric distribution. Thus, the values in between only
+  // cost a comparison (and the HyperLogLog hash) instead of a random number each.
+  auto random_engine = std::minstd_rand{};
+  // In (0, 1], so that its logarithm is finite
+  const auto random_weight = [&]() { return 1.0 - std::uniform_real_distribution<double>{}(random_engine); };
+
+  auto weight = 1.0;
+  auto next_sampled_index = std::numeric_limits<size_t>::max();
+  const auto skip_to_next_sampled_index = [&]() {
+    weight *= std::exp(std::log(random_weight()) / static_cast<double>(sample_size));
+    const auto skipped_value_count = std::log(random_weight()) / std::log(1.0 - weight);
+    // For small weights, the skip can exceed the range of size_t or, if 1.0 - weight rounds to 1.0, be infinite or NaN.
+    // Either way, no further value of the segment is sampled.
+    const auto skips_segment = !(skipped_value_count < static_cast<double>(segment.size()));
+    next_sampled_index += (skips_segment ? segment.size() : static_cast<size_t>(skipped_value_count)) + 1;
+  };
+
+  auto non_null_value_index = size_t{0};
+  segment_iterate<T>(segment, [&](const auto& position) {
+    ++summary->row_count;
+    if (position.is_null()) {
+      ++summary->null_value_count;
+      return;
+    }
+
+    const auto& value = position.value();
+    summary->distinct_values.add(value);
+
+    if (summary->sample.size() < sample_size) {
+      summary->sample.emplace_back(value);
+      if (summary->sample.size() == sample_size) {
+        next_sampled_index = non_null_value_index;
+        skip_to_next_sampled_index();
+      }
+    } else if (non_null_value_index == next_sampled_index) {
+      summary->sample[std::uniform_int_distribution<size_t>{0, sample_size - 1}(random_engine)] = value;
+      skip_to_next_sampled_index();
+    }
+    ++non_null_value_index;
+  });
+
+  return summary;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentSummary);
+
+}  // namespace opossum
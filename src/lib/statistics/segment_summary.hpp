@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "statistics/hyper_log_log_sketch.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+/**
+ * Summary of the values of a segment from which TableStatistics can build sampled histograms (see
+ * StatisticsGenerationConfig). The summaries of multiple segments are combined by merging their sketches and weighting
+ * the values in each sample with the number of non-null values that it represents.
+ *
+ * The summaries of immutable chunks do not change, so that they are kept with the TableStatistics and only the
+ * summaries of new chunks have to be created when the statistics are refreshed.
+ */
+class BaseSegmentSummary {
+ public:
+  BaseSegmentSummary(const DataType init_data_type, const uint8_t sketch_precision);
+  virtual ~BaseSegmentSummary() = default;
+
+  const DataType data_type;
+
+  size_t row_count{0};
+  size_t null_value_count{0};
+
+  HyperLogLogSketch distinct_values;
+};
+
+template <typename T>
+class SegmentSummary : public BaseSegmentSummary {
+ public:
+  explicit SegmentSummary(const uint8_t sketch_precision = HyperLogLogSketch::DEFAULT_PRECISION);
+
+  /**
+   * Creates the summary of a segment by iterating over it once. The sample is drawn using reservoir sampling (Algorithm
+   * L) with a fixed seed, so that the summary of a segment is deterministic.
+   */
+  static std::shared_ptr<SegmentSummary<T>> from_segment(const AbstractSegment& segment, const size_t sample_size,
+                                                         const uint8_t sketch_precision);
+
+  // Uniform sample of at most sample_size non-null values. Contains all non-null values if there are not more.
+  std::vector<T> sample;
+};
+
+}  // namespace opossum
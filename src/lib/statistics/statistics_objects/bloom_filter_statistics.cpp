@@ -0,0 +1,81 @@
+#include "bloom_filter_statistics.hpp"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+std::shared_ptr<BloomFilterStatistics<T>> BloomFilterStatistics<T>::from_values(const pmr_vector<T>& distinct_values,
+                                                                                const float bits_per_value) {
+  Assert(bits_per_value > 0.0f, "BloomFilterStatistics needs at least one bit per value");
+
+  auto bloom_filter = std::make_shared<BloomFilter>(distinct_values.size(),
+                                                    static_cast<size_t>(std::ceil(bits_per_value)));
+  for (const auto& value : distinct_values) {
+    bloom_filter->insert(std::hash<T>{}(value));
+  }
+
+  return std::make_shared<BloomFilterStatistics<T>>(std::move(bloom_filter));
+}
+
+template <typename T>
+BloomFilterStatistics<T>::BloomFilterStatistics(const std::shared_ptr<const BloomFilter>& init_bloom_filter)
+    : AbstractStatisticsObject(data_type_from_type<T>()), _bloom_filter(init_bloom_filter) {
+  DebugAssert(_bloom_filter && _bloom_filter->is_active(), "BloomFilterStatistics needs an active BloomFilter");
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilterStatistics<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return nullptr;
+  }
+
+  // The remaining values are a subset of the values in this filter, for which it has no false negatives either
+  return std::make_shared<BloomFilterStatistics<T>>(_bloom_filter);
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> BloomFilterStatistics<T>::scaled(const Selectivity /*selectivity*/) const {
+  return std::make_shared<BloomFilterStatistics<T>>(_bloom_filter);
+}
+
+template <typename T>
+bool BloomFilterStatistics<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                                const AllTypeVariant& variant_value,
+                                                const std::optional<AllTypeVariant>& variant_value2) const {
+  // Early exit for NULL variants.
+  if (variant_is_null(variant_value)) {
+    return false;
+  }
+
+  if (predicate_condition != PredicateCondition::Equals) {
+    return false;
+  }
+
+  // We expect the caller (e.g., the ChunkPruningRule) to handle type-safe conversions. Boost will throw an exception
+  // if this was not done.
+  return !may_contain(boost::get<T>(variant_value));
+}
+
+template <typename T>
+bool BloomFilterStatistics<T>::may_contain(const T& value) const {
+  return _bloom_filter->contains(std::hash<T>{}(value));
+}
+
+template <typename T>
+const BloomFilter& BloomFilterStatistics<T>::bloom_filter() const {
+  return *_bloom_filter;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BloomFilterStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+/**
+ * A Bloom filter (Bloom, "Space/Time Trade-offs in Hash Coding with Allowable Errors", 1970) answers membership
+ * queries for the values of a segment without false negatives. In contrast to MinMaxFilters and RangeFilters, it is
+ * also able to prune segments for equality predicates on unsorted columns with many distinct values (e.g., IDs), where
+ * the searched value is almost always within the segment's value range.
+ *
+ * The values are stored in a (register-blocked) BloomFilter, which is shared by the sliced and scaled copies.
+ */
+template <typename T>
+class BloomFilterStatistics : public AbstractStatisticsObject {
+ public:
+  // Creates a filter with (at least) bits_per_value bits for each of the given distinct values
+  static std::shared_ptr<BloomFilterStatistics<T>> from_values(const pmr_vector<T>& distinct_values,
+                                                               const float bits_per_value);
+
+  explicit BloomFilterStatistics(const std::shared_ptr<const BloomFilter>& init_bloom_filter);
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Only Equals predicates can be pruned
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  bool may_contain(const T& value) const;
+
+  const BloomFilter& bloom_filter() const;
+
+ protected:
+  const std::shared_ptr<const BloomFilter> _bloom_filter;
+};
+
+}  // namespace opossum
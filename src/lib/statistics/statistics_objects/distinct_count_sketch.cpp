@@ -0,0 +1,26 @@
+#include "distinct_count_sketch.hpp"
+
+#include <memory>
+
+namespace opossum {
+
+DistinctCountSketch::DistinctCountSketch(const DataType init_data_type, const HyperLogLogSketch& init_sketch)
+    : AbstractStatisticsObject(init_data_type), sketch(init_sketch) {}
+
+std::shared_ptr<AbstractStatisticsObject> DistinctCountSketch::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  return std::make_shared<DistinctCountSketch>(data_type, sketch);
+}
+
+std::shared_ptr<AbstractStatisticsObject> DistinctCountSketch::pruned(
+    const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  return std::make_shared<DistinctCountSketch>(data_type, sketch);
+}
+
+std::shared_ptr<AbstractStatisticsObject> DistinctCountSketch::scaled(const Selectivity selectivity) const {
+  return std::make_shared<DistinctCountSketch>(data_type, sketch);
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "abstract_statistics_object.hpp"
+#include "statistics/hyper_log_log_sketch.hpp"
+
+namespace opossum {
+
+/**
+ * A HyperLogLogSketch of the distinct values of a segment or column as an AbstractStatisticsObject. The sketches of
+ * all chunks' pruning statistics are merged into the column's statistics (see TableStatistics::from_table), which the
+ * CardinalityEstimator uses as the number of distinct values.
+ *
+ * Predicates and pruning only remove values. Thus, the sketch is kept unchanged in sliced/scaled/pruned statistics and
+ * its estimate becomes an upper bound for the distinct values in the resulting data.
+ */
+class DistinctCountSketch : public AbstractStatisticsObject {
+ public:
+  DistinctCountSketch(const DataType init_data_type, const HyperLogLogSketch& init_sketch);
+
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> pruned(
+      const size_t num_values_pruned, const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  const HyperLogLogSketch sketch;
+};
+
+}  // namespace opossum
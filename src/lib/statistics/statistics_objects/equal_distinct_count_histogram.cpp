@@ -4,6 +4,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -101,7 +102,20 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
   Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+  auto value_distribution = value_distribution_from_column(table, column_id, domain);
+
+  return from_distribution(std::move(value_distribution), max_bin_count, std::nullopt, domain);
+}
+
+namespace {
+
+// Implements both overloads of EqualDistinctCountHistogram::from_distribution. If @param value_distribution is an
+// rvalue, the bin bounds are moved out of it instead of being copied.
+template <typename T, typename Distribution>
+std::shared_ptr<EqualDistinctCountHistogram<T>> histogram_from_distribution(
+    Distribution&& value_distribution, const BinID max_bin_count, const std::optional<size_t>& total_distinct_count,
+    const HistogramDomain<T>& domain) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
   if (value_distribution.empty()) {
     return nullptr;
@@ -128,15 +142,16 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
       max_value_idx++;
     }
 
-    // We'd like to move strings, but have to copy if we need the same string for the bin_maximum
-    if (std::is_same_v<T, std::string> && min_value_idx != max_value_idx) {
-      bin_minima[bin_idx] = std::move(value_distribution[min_value_idx].first);
-    } else {
+    if constexpr (std::is_reference_v<Distribution>) {
       bin_minima[bin_idx] = value_distribution[min_value_idx].first;
+      bin_maxima[bin_idx] = value_distribution[max_value_idx].first;
+    } else {
+      // The bounds of a bin with a single distinct value are the same value, which can only be moved once
+      bin_maxima[bin_idx] = std::move(value_distribution[max_value_idx].first);
+      bin_minima[bin_idx] = min_value_idx == max_value_idx ? bin_maxima[bin_idx]
+                                                           : std::move(value_distribution[min_value_idx].first);
     }
 
-    bin_maxima[bin_idx] = std::move(value_distribution[max_value_idx].first);
-
     bin_heights[bin_idx] =
         std::accumulate(value_distribution.cbegin() + min_value_idx, value_distribution.cbegin() + max_value_idx + 1,
                         HistogramCountType{0},
@@ -145,9 +160,33 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     min_value_idx = max_value_idx + 1;
   }
 
+  // Spread the distinct values that are not part of the distribution evenly among the bins
+  if (total_distinct_count && *total_distinct_count > value_distribution.size()) {
+    return std::make_shared<EqualDistinctCountHistogram<T>>(
+        std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+        static_cast<HistogramCountType>(*total_distinct_count / bin_count),
+        static_cast<BinID>(*total_distinct_count % bin_count), domain);
+  }
+
   return std::make_shared<EqualDistinctCountHistogram<T>>(
       std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
-      static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value);
+      static_cast<HistogramCountType>(distinct_count_per_bin), bin_count_with_extra_value, domain);
+}
+
+}  // namespace
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& value_distribution, const BinID max_bin_count,
+    const std::optional<size_t>& total_distinct_count, const HistogramDomain<T>& domain) {
+  return histogram_from_distribution<T>(value_distribution, max_bin_count, total_distinct_count, domain);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+    const std::optional<size_t>& total_distinct_count, const HistogramDomain<T>& domain) {
+  return histogram_from_distribution<T>(std::move(value_distribution), max_bin_count, total_distinct_count, domain);
 }
 
 template <typename T>
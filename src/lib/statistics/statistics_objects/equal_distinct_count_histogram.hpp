@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -36,6 +37,22 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram from the (value, count) pairs of a distribution that is sorted by value,
+   * e.g., a weighted sample of a column. The distinct values of the distribution are split evenly among the bins.
+   * @param total_distinct_count  Number of distinct values that the histogram represents, if the distribution does not
+   *                              contain all of them (e.g., as estimated by a HyperLogLogSketch). They are assumed to
+   *                              be spread evenly among the bins as well.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      const std::vector<std::pair<T, HistogramCountType>>& value_distribution, const BinID max_bin_count,
+      const std::optional<size_t>& total_distinct_count = std::nullopt, const HistogramDomain<T>& domain = {});
+
+  // Same as above, but moves the bin bounds out of @param value_distribution instead of copying them
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count,
+      const std::optional<size_t>& total_distinct_count = std::nullopt, const HistogramDomain<T>& domain = {});
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -1,19 +1,140 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <optional>
 #include <thread>
+#include <utility>
 
 #include "attribute_statistics.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "statistics/segment_summary.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/distinct_count_sketch.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Builds a histogram from the samples of the segment summaries. Each sampled value stands for
+ * non_null_value_count / sample.size() values of its segment. The distinct count is estimated by the merged sketches,
+ * unless the samples contain all values of their segments.
+ */
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> histogram_from_segment_summaries(
+    const std::vector<std::shared_ptr<const SegmentSummary<T>>>& segment_summaries, const BinID max_bin_count,
+    const uint8_t sketch_precision) {
+  const auto domain = HistogramDomain<T>{};
+
+  auto weighted_sample = std::vector<std::pair<T, HistogramCountType>>{};
+  auto distinct_values = HyperLogLogSketch{sketch_precision};
+  auto samples_are_complete = true;
+
+  for (const auto& segment_summary : segment_summaries) {
+    distinct_values.merge(segment_summary->distinct_values);
+    if (segment_summary->sample.empty()) continue;
+
+    const auto non_null_value_count = segment_summary->row_count - segment_summary->null_value_count;
+    samples_are_complete &= segment_summary->sample.size() == non_null_value_count;
+
+    const auto weight = static_cast<HistogramCountType>(non_null_value_count) /
+                        static_cast<HistogramCountType>(segment_summary->sample.size());
+    for (const auto& value : segment_summary->sample) {
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        weighted_sample.emplace_back(domain.contains(value) ? value : domain.string_to_domain(value), weight);
+      } else {
+        weighted_sample.emplace_back(value, weight);
+      }
+    }
+  }
+
+  std::sort(weighted_sample.begin(), weighted_sample.end(),
+            [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  auto value_distribution = std::vector<std::pair<T, HistogramCountType>>{};
+  for (auto& [value, weight] : weighted_sample) {
+    if (!value_distribution.empty() && value_distribution.back().first == value) {
+      value_distribution.back().second += weight;
+    } else {
+      value_distribution.emplace_back(std::move(value), weight);
+    }
+  }
+
+  auto total_distinct_count = std::optional<size_t>{};
+  if (!samples_are_complete) {
+    total_distinct_count = static_cast<size_t>(std::lround(distinct_values.estimate()));
+  }
+
+  return EqualDistinctCountHistogram<T>::from_distribution(std::move(value_distribution), max_bin_count,
+                                                          total_distinct_count);
+}
+
+/**
+ * Merges the DistinctCountSketches of the column's segments in the chunks' pruning statistics (see
+ * PruningStatisticsConfig). Only if all chunks have a sketch (of the same precision), as the estimate would otherwise
+ * miss the distinct values of the other chunks.
+ */
+template <typename T>
+std::shared_ptr<DistinctCountSketch> merge_distinct_count_sketches(const Table& table, const ColumnID column_id) {
+  auto merged_sketch = std::optional<HyperLogLogSketch>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& pruning_statistics = chunk->pruning_statistics();
+    if (!pruning_statistics) return nullptr;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<T>&>(*(*pruning_statistics)[column_id]);
+    if (!segment_statistics.distinct_count_sketch) return nullptr;
+
+    const auto& segment_sketch = segment_statistics.distinct_count_sketch->sketch;
+    if (!merged_sketch) {
+      merged_sketch = segment_sketch;
+    } else if (merged_sketch->precision() == segment_sketch.precision()) {
+      merged_sketch->merge(segment_sketch);
+    } else {
+      return nullptr;
+    }
+  }
+
+  if (!merged_sketch) return nullptr;
+
+  return std::make_shared<DistinctCountSketch>(data_type_from_type<T>(), *merged_sketch);
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+  return from_table(table, Hyrise::get().statistics_generation_config);
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::from_table(
+    const Table& table, const StatisticsGenerationConfig& config,
+    const std::shared_ptr<const TableStatistics>& previous_statistics) {
+  Assert(!config.sample_size_per_chunk || *config.sample_size_per_chunk > 0, "Sample size must be greater than zero");
+
   std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
 
+  // The summaries of immutable chunks are kept, see StatisticsGenerationConfig
+  const auto chunk_count = table.chunk_count();
+  auto segment_summaries = std::vector<std::vector<std::shared_ptr<const BaseSegmentSummary>>>{};
+  if (config.sample_size_per_chunk) {
+    segment_summaries.resize(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (chunk && !chunk->is_mutable()) segment_summaries[chunk_id].resize(table.column_count());
+    }
+  }
+
   /**
    * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
    * (for tables with >= 200m rows) are created.
@@ -42,8 +163,41 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
 
           const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
 
-          const auto histogram =
-              EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
+          auto histogram = std::shared_ptr<EqualDistinctCountHistogram<ColumnDataType>>{};
+          if (config.sample_size_per_chunk) {
+            auto column_segment_summaries = std::vector<std::shared_ptr<const SegmentSummary<ColumnDataType>>>{};
+            column_segment_summaries.reserve(chunk_count);
+
+            for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+              const auto chunk = table.get_chunk(chunk_id);
+              if (!chunk) continue;
+
+              auto segment_summary = std::shared_ptr<const SegmentSummary<ColumnDataType>>{};
+              if (previous_statistics && chunk_id < previous_statistics->segment_summaries.size() &&
+                  !previous_statistics->segment_summaries[chunk_id].empty()) {
+                segment_summary = std::dynamic_pointer_cast<const SegmentSummary<ColumnDataType>>(
+                    previous_statistics->segment_summaries[chunk_id][my_column_id]);
+                if (segment_summary && segment_summary->distinct_values.precision() != config.sketch_precision) {
+                  segment_summary = nullptr;
+                }
+              }
+
+              if (!segment_summary) {
+                segment_summary = SegmentSummary<ColumnDataType>::from_segment(
+                    *chunk->get_segment(my_column_id), *config.sample_size_per_chunk, config.sketch_precision);
+              }
+
+              // Only kept for chunks that were immutable before we started. Each thread writes to its column only.
+              if (!segment_summaries[chunk_id].empty()) segment_summaries[chunk_id][my_column_id] = segment_summary;
+              column_segment_summaries.emplace_back(std::move(segment_summary));
+            }
+
+            histogram = histogram_from_segment_summaries(column_segment_summaries, histogram_bin_count,
+                                                         config.sketch_precision);
+          } else {
+            histogram =
+                EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
+          }
 
           if (histogram) {
             output_column_statistics->set_statistics_object(histogram);
@@ -62,6 +216,9 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
             output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
           }
 
+          output_column_statistics->set_statistics_object(
+              merge_distinct_count_sketches<ColumnDataType>(table, my_column_id));
+
           column_statistics[my_column_id] = output_column_statistics;
         });
       }
@@ -72,7 +229,9 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
     thread.join();
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  table_statistics->segment_summaries = std::move(segment_summaries);
+  return table_statistics;
 }
 
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
@@ -8,12 +8,26 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "statistics/hyper_log_log_sketch.hpp"
 
 namespace opossum {
 
 class BaseAttributeStatistics;
+class BaseSegmentSummary;
 class Table;
 
+/**
+ * Determines how TableStatistics::from_table creates the histograms. By default, every value of a column is counted
+ * in a hash map. If sample_size_per_chunk is set, each segment is instead summarized by a uniform sample of that many
+ * values and a HyperLogLogSketch of its distinct values (see SegmentSummary). This needs a single pass over the
+ * segment without a hash map, but the bin heights and distinct counts become estimates. Larger samples and a higher
+ * sketch precision make the histograms more accurate at the cost of generation time and memory.
+ */
+struct StatisticsGenerationConfig {
+  std::optional<size_t> sample_size_per_chunk;
+  uint8_t sketch_precision = HyperLogLogSketch::DEFAULT_PRECISION;
+};
+
 /**
  * Container for all cardinality estimation statistics gathered about a Table. Also used to represent the estimation of
  * a temporary Table during Optimization.
@@ -22,10 +36,19 @@ class TableStatistics {
  public:
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. Uses Hyrise::get().statistics_generation_config.
    */
   static std::shared_ptr<TableStatistics> from_table(const Table& table);
 
+  /**
+   * @param previous_statistics  If these statistics were created from samples, the summaries of the immutable chunks
+   *                             are reused, so that only chunks that were added (or finalized) since have to be
+   *                             scanned. This is used to refresh the statistics of a growing table.
+   */
+  static std::shared_ptr<TableStatistics> from_table(
+      const Table& table, const StatisticsGenerationConfig& config,
+      const std::shared_ptr<const TableStatistics>& previous_statistics = nullptr);
+
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
 
@@ -36,6 +59,10 @@ class TableStatistics {
 
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // If the statistics were created from samples, the summaries of the segments of all immutable chunks, indexed by
+  // ChunkID and ColumnID. Empty for physically deleted and mutable chunks.
+  std::vector<std::vector<std::shared_ptr<const BaseSegmentSummary>>> segment_summaries;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
@@ -33,10 +33,11 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  // Create table statistics and chunk pruning statistics for added table.
+  // Create chunk pruning statistics and table statistics for added table. The pruning statistics come first, as
+  // their DistinctCountSketches (if configured) are merged into the table statistics.
 
-  table->set_table_statistics(TableStatistics::from_table(*table));
   generate_chunk_pruning_statistics(table);
+  table->set_table_statistics(TableStatistics::from_table(*table));
 
   _tables[name] = std::move(table);
 }
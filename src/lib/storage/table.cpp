@@ -29,6 +29,7 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
+      _pruning_statistics_configs(column_definitions.size()),
       _append_mutex(std::make_unique<std::mutex>()) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
@@ -224,6 +225,13 @@ void Table::remove_chunk(ChunkID chunk_id) {
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
 }
 
+void Table::set_chunk(ChunkID chunk_id, std::shared_ptr<Chunk> chunk) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  Assert(_type == TableType::References, "Setting chunks is only intended for reference tables.");
+  DebugAssert(!chunk || chunk->column_count() == column_count(), "Invalid Chunk column count");
+  std::atomic_store(&_chunks[chunk_id], std::move(chunk));
+}
+
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
                          const std::optional<PolymorphicAllocator<Chunk>>& alloc) {
   Assert(_type != TableType::Data || static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes),
@@ -313,10 +321,24 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  // The statistics might be refreshed (see ChunkCompressionTask) while the optimizer reads them
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+const std::vector<PruningStatisticsConfig>& Table::pruning_statistics_configs() const {
+  return _pruning_statistics_configs;
+}
+
+void Table::set_pruning_statistics_config(const ColumnID column_id, const PruningStatisticsConfig& config) {
+  Assert(column_id < _pruning_statistics_configs.size(), "ColumnID out of range");
+  Assert(config.bloom_filter_bits_per_value >= 0.0f, "Bits per value must not be negative");
+  Assert(config.distinct_count_sketch_precision == 0 || (config.distinct_count_sketch_precision >= 4 &&
+                                                         config.distinct_count_sketch_precision <= 18),
+         "Sketch precision must be zero (disabled) or in [4, 18]");
+  _pruning_statistics_configs[column_id] = config;
 }
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
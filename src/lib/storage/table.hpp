@@ -9,6 +9,7 @@
 #include "abstract_segment.hpp"
 #include "boost/variant.hpp"
 #include "chunk.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "storage/index/index_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "table_key_constraint.hpp"
@@ -100,6 +101,12 @@ class Table : private Noncopyable {
    */
   void remove_chunk(ChunkID chunk_id);
 
+  /**
+   * Sets the chunk at @param chunk_id of a reference table. Only used for the tables that connect the stages of a
+   * pipeline (see AbstractChunkwiseOperator), where each chunk is only accessed by the job that processes it.
+   */
+  void set_chunk(ChunkID chunk_id, std::shared_ptr<Chunk> chunk);
+
   /**
    * Creates a new Chunk from a set of segments and appends it to this table.
    * When implementing operators, prefer building the Chunks upfront and adding them to the output table on
@@ -179,6 +186,16 @@ class Table : private Noncopyable {
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
   /** @} */
 
+  /**
+   * Configures the optional pruning statistics (BloomFilters and DistinctCountSketches) that
+   * generate_chunk_pruning_statistics creates for the segments of a column. Existing pruning statistics are only
+   * extended when generate_chunk_pruning_statistics is called for the table again, e.g., by StorageManager::add_table.
+   * @{
+   */
+  const std::vector<PruningStatisticsConfig>& pruning_statistics_configs() const;
+  void set_pruning_statistics_config(const ColumnID column_id, const PruningStatisticsConfig& config);
+  /** @} */
+
   std::vector<IndexStatistics> indexes_statistics() const;
 
   template <typename Index>
@@ -242,6 +259,7 @@ class Table : private Noncopyable {
 
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
+  std::vector<PruningStatisticsConfig> _pruning_statistics_configs;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
 
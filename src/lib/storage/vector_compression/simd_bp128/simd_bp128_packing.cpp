@@ -1,7 +1,5 @@
 #include "simd_bp128_packing.hpp"
 
-#include <algorithm>
-
 #include "utils/assert.hpp"
 
 // When casting into this data type, make sure that the underlying data is properly aligned to 16 byte boundaries.
@@ -76,10 +74,14 @@ struct Pack128Bit<bit_size, carry_over, 0u> {
 
 /**
  * @brief Unpacks 128 unsigned integers with the specified bit size
+ *
+ * The unpacked integers are passed to output in groups of four, i.e., output receives integers 4 * i to 4 * i + 3 in
+ * its i-th call. Thus, the integers can either be stored or processed while they are still in a register.
  */
 template <uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
 struct Unpack128Bit {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Output>
+  void operator()(const simd_type* in, Output& output, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {
     constexpr auto BITS_IN_WORD = 32u;
 
@@ -89,7 +91,7 @@ struct Unpack128Bit {
     for (auto i = 0u; i < I_MAX; ++i) {
       const auto offset = carry_over + i * bit_size;
       out_reg = (in_reg >> offset) & mask;
-      *out++ = out_reg;
+      output(out_reg);
     }
 
     constexpr auto NEXT_OFFSET = carry_over + I_MAX * bit_size;
@@ -101,7 +103,7 @@ struct Unpack128Bit {
       in_reg = *in++;
 
       out_reg = out_reg | ((in_reg << NUM_FIRST_BITS) & mask);
-      *out++ = out_reg;
+      output(out_reg);
     } else {
       constexpr auto LAST_RECURSION = 1u;
 
@@ -113,325 +115,346 @@ struct Unpack128Bit {
 
     // Calculate the new carry over
     constexpr auto NEW_CARRY_OVER = NEXT_OFFSET < BITS_IN_WORD ? bit_size - NUM_FIRST_BITS : 0u;
-    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, out, in_reg, out_reg, mask);
+    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, output, in_reg, out_reg, mask);
   }
 };
 
 template <uint8_t bit_size, uint8_t carry_over>
 struct Unpack128Bit<bit_size, carry_over, 0u> {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Output>
+  void operator()(const simd_type* in, Output& output, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {}
 };
 
-void unpack_128_zeros(uint32_t* out) {
-  static constexpr auto NUM_ZEROES = 128u;
-  std::fill(out, out + NUM_ZEROES, 0u);
-}
+// Stores the unpacked integers
+struct StoreOutput {
+  void operator()(const simd_type& values) { *out++ = values; }
 
-}  // namespace
-
-void SimdBp128Packing::write_meta_info(const uint8_t* const in, uint128_t* const out) {
-  const auto* const simd_in = reinterpret_cast<const simd_type*>(in);
-  auto* const simd_out = reinterpret_cast<simd_type*>(out);
+  simd_type* out;
+};
 
-  *simd_out = *simd_in;
-}
+// Sets bit i of the 128-bit bitmap out if lower_bound <= integer i < lower_bound + range_size. Because the integers
+// are unsigned, (x >= a && x < b) is equivalent to (x - a) < (b - a).
+struct CompareRangeOutput {
+  void operator()(const simd_type& values) {
+    const auto matches = (values - lower_bound) < range_size;
+    const auto mask = (matches[0] & 1) | (matches[1] & 2) | (matches[2] & 4) | (matches[3] & 8);
+    out[group_index / 16u] |= static_cast<uint64_t>(mask) << (group_index % 16u * 4u);
+    ++group_index;
+  }
 
-void SimdBp128Packing::read_meta_info(const uint128_t* const in, uint8_t* const out) {
-  const auto* const simd_in = reinterpret_cast<const simd_type*>(in);
-  auto* const simd_out = reinterpret_cast<simd_type*>(out);
+  const simd_type lower_bound;
+  const simd_type range_size;
+  uint64_t* const out;
+  uint32_t group_index{0};
+};
 
-  *simd_out = *simd_in;
-}
+template <typename Output>
+void unpack_block_to_output(const uint128_t* in, const uint8_t bit_size, Output& output) {
+  if (bit_size == 0u) {
+    const simd_type zero_reg = {0, 0, 0, 0};
+    for (auto group_index = 0u; group_index < SimdBp128Packing::block_size / 4u; ++group_index) {
+      output(zero_reg);
+    }
+    return;
+  }
 
-void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
   const auto* simd_in = reinterpret_cast<const simd_type*>(in);
-  auto* simd_out = reinterpret_cast<simd_type*>(out);
 
-  simd_type in_reg = {0, 0, 0, 0};
+  simd_type in_reg = *simd_in++;
   simd_type out_reg = {0, 0, 0, 0};
   auto one_mask = static_cast<unsigned int>((1ul << bit_size) - 1);
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 
   switch (bit_size) {
-    case 0u:
-      // No compression needed, since all values equal to zero.
-      return;
-
     case 1u:
-      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<1u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<2u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<3u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<4u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<5u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<6u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<7u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<8u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<9u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<10u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<11u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<12u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<13u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<14u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<15u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<16u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<17u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<18u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<19u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<20u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<21u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<22u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<23u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<24u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<25u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<26u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<27u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<28u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<29u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<30u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<31u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<32u>{}(simd_in, output, in_reg, out_reg, mask);
       return;
-
     default:
       Fail("Bit size must be in range [0, 32]");
   }
 }
 
-void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
-  if (bit_size == 0u) {
-    unpack_128_zeros(out);
-    return;
-  }
+}  // namespace
 
+void SimdBp128Packing::write_meta_info(const uint8_t* const in, uint128_t* const out) {
+  const auto* const simd_in = reinterpret_cast<const simd_type*>(in);
+  auto* const simd_out = reinterpret_cast<simd_type*>(out);
+
+  *simd_out = *simd_in;
+}
+
+void SimdBp128Packing::read_meta_info(const uint128_t* const in, uint8_t* const out) {
+  const auto* const simd_in = reinterpret_cast<const simd_type*>(in);
+  auto* const simd_out = reinterpret_cast<simd_type*>(out);
+
+  *simd_out = *simd_in;
+}
+
+void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
   const auto* simd_in = reinterpret_cast<const simd_type*>(in);
   auto* simd_out = reinterpret_cast<simd_type*>(out);
 
-  simd_type in_reg = *simd_in++;
+  simd_type in_reg = {0, 0, 0, 0};
   simd_type out_reg = {0, 0, 0, 0};
   auto one_mask = static_cast<unsigned int>((1ul << bit_size) - 1);
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 
   switch (bit_size) {
+    case 0u:
+      // No compression needed, since all values equal to zero.
+      return;
+
     case 1u:
-      Unpack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Unpack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Unpack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Unpack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Unpack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Unpack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Unpack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Unpack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Unpack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Unpack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Unpack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Unpack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Unpack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Unpack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Unpack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Unpack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Unpack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Unpack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Unpack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Unpack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Unpack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Unpack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Unpack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Unpack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Unpack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Unpack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Unpack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Unpack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Unpack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Unpack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Unpack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Unpack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     default:
@@ -439,4 +462,30 @@ void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const ui
   }
 }
 
+void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  auto output = StoreOutput{reinterpret_cast<simd_type*>(out)};
+  unpack_block_to_output(in, bit_size, output);
+}
+
+void SimdBp128Packing::compare_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size,
+                                     const uint32_t lower_bound, const uint32_t range_size) {
+  out[0] = 0u;
+  out[1] = 0u;
+
+  // All integers of the block are in [0, max_value]. If that interval is entirely in- or outside of the searched
+  // range, the block does not need to be unpacked.
+  const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_size) - 1u);
+  if (lower_bound == 0u && range_size > max_value) {
+    out[0] = ~uint64_t{0};
+    out[1] = ~uint64_t{0};
+    return;
+  }
+  if (lower_bound > max_value || range_size == 0u) return;
+
+  auto output = CompareRangeOutput{{lower_bound, lower_bound, lower_bound, lower_bound},
+                                   {range_size, range_size, range_size, range_size},
+                                   out};
+  unpack_block_to_output(in, bit_size, output);
+}
+
 }  // namespace opossum
@@ -26,6 +26,11 @@ class SimdBp128Packing {
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+
+  // Compares the packed integers with the range [lower_bound, lower_bound + range_size) while unpacking them, without
+  // writing them to memory. Bit i of the 128-bit bitmap (out[i / 64]) is set if integer i is within the range.
+  static void compare_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size, const uint32_t lower_bound,
+                            const uint32_t range_size);
 };
 
 }  // namespace opossum
@@ -1,11 +1,51 @@
 #include "simd_bp128_vector.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace opossum {
 
 SimdBp128Vector::SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size) : _data{std::move(vector)}, _size{size} {}
 
 const pmr_vector<uint128_t>& SimdBp128Vector::data() const { return _data; }
 
+void SimdBp128Vector::scan_range_to_bitmap(const uint32_t lower_bound, const uint32_t upper_bound,
+                                           uint64_t* bitmap) const {
+  using Packing = SimdBp128Packing;
+  constexpr auto WORDS_PER_BLOCK = Packing::block_size / 64u;
+
+  const auto range_size = upper_bound > lower_bound ? upper_bound - lower_bound : 0u;
+  const auto word_count = (_size + 63u) / 64u;
+
+  const auto* in = _data.data();
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  auto block_bitmap = std::array<uint64_t, WORDS_PER_BLOCK>{};
+
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < _size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(in, meta_info.data());
+    ++in;
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= _size) break;
+
+      const auto bit_size = meta_info[block_index];
+      Packing::compare_block(in, block_bitmap.data(), bit_size, lower_bound, range_size);
+      in += bit_size;
+
+      // The last block might have fewer words
+      const auto first_word = block_begin / 64u;
+      const auto block_word_count = std::min(size_t{WORDS_PER_BLOCK}, word_count - first_word);
+      std::copy_n(block_bitmap.begin(), block_word_count, bitmap + first_word);
+    }
+  }
+
+  // The last block is padded with zeros, which must not be reported as matches
+  if (_size % 64u != 0u) {
+    bitmap[word_count - 1] &= (uint64_t{1} << (_size % 64u)) - 1u;
+  }
+}
+
 size_t SimdBp128Vector::on_size() const { return _size; }
 size_t SimdBp128Vector::on_data_size() const { return sizeof(uint128_t) * _data.size(); }
 
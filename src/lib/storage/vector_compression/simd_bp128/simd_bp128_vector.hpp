@@ -28,6 +28,14 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
 
   const pmr_vector<uint128_t>& data() const;
 
+  /**
+   * Sets bit i of bitmap (bitmap[i / 64]) if lower_bound <= value i < upper_bound and clears it otherwise. The values
+   * are compared block by block while they are unpacked, so that the vector is never decompressed into memory. Blocks
+   * whose bit size shows that all or none of their values are in the range are not unpacked at all. bitmap needs to
+   * hold (size() + 63) / 64 words. Used by the table scans to evaluate predicates on value ids.
+   */
+  void scan_range_to_bitmap(const uint32_t lower_bound, const uint32_t upper_bound, uint64_t* bitmap) const;
+
   size_t on_size() const;
   size_t on_data_size() const;
 
@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
@@ -36,6 +38,18 @@ void ChunkCompressionTask::_on_execute() {
                 "Chunk is not completed and thus can’t be compressed.");
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+
+    // ChunkEncoder::encode_chunk does not know the table's configuration of the optional pruning statistics
+    generate_chunk_pruning_statistics(chunk, table->pruning_statistics_configs());
+  }
+
+  // Sampled table statistics keep the summaries of the immutable chunks. Thus, refreshing them only has to scan the
+  // chunks that were completed since the statistics were created.
+  const auto& statistics_generation_config = Hyrise::get().statistics_generation_config;
+  const auto table_statistics = table->table_statistics();
+  if (statistics_generation_config.sample_size_per_chunk && table_statistics &&
+      !table_statistics->segment_summaries.empty()) {
+    table->set_table_statistics(TableStatistics::from_table(*table, statistics_generation_config, table_statistics));
   }
 }
 
@@ -0,0 +1,60 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t distinct_count, const size_t bits_per_value) {
+  Assert(bits_per_value > 0, "BloomFilter needs at least one bit per value");
+
+  // Round the number of words up to the next power of two, so that the word index can be taken from the upper bits of
+  // the mixed hash
+  const auto value_count = std::max(distinct_count, size_t{1});
+  const auto required_word_count = (value_count * bits_per_value + 63) / 64;
+  _word_count = MIN_WORD_COUNT;
+  while (_word_count < required_word_count && _word_count < MAX_WORD_COUNT) {
+    _word_count *= 2;
+  }
+  _word_shift = static_cast<uint8_t>(64 - std::log2(_word_count));
+
+  // The standard optimum of bits_per_value * ln(2) bits per value does not apply to register-blocked filters, as the
+  // bits of values mapped to the same word collide more often. About 0.6 bits per available bit was found to minimize
+  // the false positive rate. More than eight bits have little effect.
+  const auto available_bits_per_value = static_cast<double>(_word_count * 64) / static_cast<double>(value_count);
+  _bits_per_value_set = static_cast<uint8_t>(std::clamp(std::lround(available_bits_per_value * 0.6), 1l, 8l));
+
+  _words = std::make_unique<std::atomic<uint64_t>[]>(_word_count);
+}
+
+BloomFilter::BloomFilter(BloomFilter&& other) noexcept
+    : _words(std::move(other._words)),
+      _word_count(other._word_count),
+      _word_shift(other._word_shift),
+      _bits_per_value_set(other._bits_per_value_set) {
+  other._word_count = 0;
+}
+
+BloomFilter& BloomFilter::operator=(BloomFilter&& other) noexcept {
+  _words = std::move(other._words);
+  _word_count = other._word_count;
+  _word_shift = other._word_shift;
+  _bits_per_value_set = other._bits_per_value_set;
+  other._word_count = 0;
+  return *this;
+}
+
+double BloomFilter::fill_ratio() const {
+  if (!is_active()) return 1.0;
+
+  auto set_bit_count = size_t{0};
+  for (auto word_index = size_t{0}; word_index < _word_count; ++word_index) {
+    set_bit_count += std::bitset<64>(_words[word_index].load(std::memory_order_relaxed)).count();
+  }
+  return static_cast<double>(set_bit_count) / static_cast<double>(_word_count * 64);
+}
+
+}  // namespace opossum
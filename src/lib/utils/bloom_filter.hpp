@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace opossum {
+
+/**
+ * Register-blocked Bloom filter: each value sets its bits within a single 64-bit word, so inserting or looking up a
+ * value costs one memory access. The size and the number of bits set per value are derived from the expected number
+ * of distinct values. Compared to a standard Bloom filter, the false positive rate is slightly higher for the same
+ * memory (e.g., about 2.5% instead of 2% for 8 bits per value).
+ *
+ * Values are passed as hashes (e.g., of std::hash). As std::hash is the identity for integers, the hashes are mixed
+ * again so that the filter works independently of the lower bits used, e.g., for radix partitioning.
+ *
+ * A default-constructed BloomFilter has no bits. It contains every value and ignores inserts, which is used where a
+ * filter is optional. insert() can be called concurrently.
+ */
+class BloomFilter {
+ public:
+  static constexpr auto DEFAULT_BITS_PER_VALUE = size_t{8};
+
+  // The filter size is limited to MAX_WORD_COUNT words (32 MB). Larger inputs lead to more false positives.
+  static constexpr auto MIN_WORD_COUNT = size_t{64};
+  static constexpr auto MAX_WORD_COUNT = size_t{1} << 22;
+
+  BloomFilter() = default;
+  explicit BloomFilter(const size_t distinct_count, const size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  // A moved-from BloomFilter is inactive
+  BloomFilter(BloomFilter&& other) noexcept;
+  BloomFilter& operator=(BloomFilter&& other) noexcept;
+
+  // False for a default-constructed BloomFilter, which contains every value
+  bool is_active() const { return _word_count > 0; }
+
+  void insert(const size_t hash) {
+    if (!is_active()) return;
+
+    const auto mask = _mask(hash);
+    auto& word = _words[_word_index(hash)];
+    // Skipping the write if all bits are set already avoids invalidating cache lines shared with other threads
+    if ((word.load(std::memory_order_relaxed) & mask) != mask) word.fetch_or(mask, std::memory_order_relaxed);
+  }
+
+  bool contains(const size_t hash) const {
+    if (!is_active()) return true;
+
+    const auto mask = _mask(hash);
+    return (_words[_word_index(hash)].load(std::memory_order_relaxed) & mask) == mask;
+  }
+
+  size_t word_count() const { return _word_count; }
+  uint8_t bits_per_value_set() const { return _bits_per_value_set; }
+
+  // Fraction of set bits. Meant for tests and diagnostics, as it reads the entire filter.
+  double fill_ratio() const;
+
+ private:
+  size_t _word_index(const size_t hash) const {
+    // Multiplicative (Fibonacci) hashing, using the upper bits
+    return static_cast<size_t>((uint64_t{hash} * 0x9E3779B97F4A7C15ull) >> _word_shift);
+  }
+
+  uint64_t _mask(const size_t hash) const {
+    // A second, independent mix (from SplitMix64) provides six bits per bit position
+    auto mixed = (uint64_t{hash} ^ (uint64_t{hash} >> 31)) * 0xBF58476D1CE4E5B9ull;
+    mixed ^= mixed >> 29;
+
+    auto mask = uint64_t{0};
+    for (auto bit_index = uint8_t{0}; bit_index < _bits_per_value_set; ++bit_index) {
+      mask |= uint64_t{1} << ((mixed >> (6 * bit_index)) & 63u);
+    }
+    return mask;
+  }
+
+  std::unique_ptr<std::atomic<uint64_t>[]> _words;
+  size_t _word_count{0};
+  uint8_t _word_shift{64};
+  uint8_t _bits_per_value_set{0};
+};
+
+}  // namespace opossum
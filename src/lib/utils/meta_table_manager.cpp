@@ -5,8 +5,10 @@
 #include "utils/meta_tables/meta_columns_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_query_memory_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
+#include "utils/meta_tables/meta_session_memory_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
 #include "utils/meta_tables/meta_system_information_table.hpp"
 #include "utils/meta_tables/meta_system_utilization_table.hpp"
@@ -25,7 +27,9 @@ MetaTableManager::MetaTableManager() {
                                                                        std::make_shared<MetaPluginsTable>(),
                                                                        std::make_shared<MetaSettingsTable>(),
                                                                        std::make_shared<MetaSystemInformationTable>(),
-                                                                       std::make_shared<MetaSystemUtilizationTable>()};
+                                                                       std::make_shared<MetaSystemUtilizationTable>(),
+                                                                       std::make_shared<MetaQueryMemoryTable>(),
+                                                                       std::make_shared<MetaSessionMemoryTable>()};
 
   _table_names.reserve(_meta_tables.size());
   for (const auto& table : meta_tables) {
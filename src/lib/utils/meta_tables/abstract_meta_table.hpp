@@ -34,6 +34,8 @@ class AbstractMetaTable : public Noncopyable {
   friend class MetaTableManagerTest;
   friend class MetaTableTest;
   friend class MetaPluginsTest;
+  friend class MetaQueryMemoryTest;
+  friend class MetaSessionMemoryTest;
   friend class MetaSettingsTest;
   friend class MetaSystemUtilizationTest;
   friend class MetaSystemInformationTest;
@@ -0,0 +1,45 @@
+#include "meta_query_memory_table.hpp"
+
+#include <limits>
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+
+namespace opossum {
+
+MetaQueryMemoryTable::MetaQueryMemoryTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"query_id", DataType::Long, false},
+                                               {"sql_string", DataType::String, false},
+                                               {"running_time", DataType::Long, false},
+                                               {"allocated_memory", DataType::Long, false},
+                                               {"peak_allocated_memory", DataType::Long, false},
+                                               {"spilled_bytes", DataType::Long, false},
+                                               {"memory_budget", DataType::Long, true}}) {}
+
+const std::string& MetaQueryMemoryTable::name() const {
+  static const auto name = std::string{"query_memory"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaQueryMemoryTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto& running_query : Hyrise::get().admission_controller->running_queries()) {
+    const auto& memory_resource = *running_query.memory_resource;
+    const auto running_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - running_query.admission_time).count();
+    const auto memory_budget = memory_resource.budget() == std::numeric_limits<size_t>::max()
+                                   ? AllTypeVariant{NULL_VALUE}
+                                   : AllTypeVariant{static_cast<int64_t>(memory_resource.budget())};
+
+    output_table->append({static_cast<int64_t>(running_query.query_id), pmr_string{running_query.sql},
+                          static_cast<int64_t>(running_time), static_cast<int64_t>(memory_resource.allocated_bytes()),
+                          static_cast<int64_t>(memory_resource.peak_allocated_bytes()),
+                          static_cast<int64_t>(memory_resource.spilled_bytes()), memory_budget});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
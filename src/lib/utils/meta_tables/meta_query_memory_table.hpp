@@ -0,0 +1,23 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the memory of the SQL statements that are currently executed (see AdmissionController).
+ * Meta tables are generated when the querying statement is translated, i.e., before that statement is admitted. Thus,
+ * it only lists the other statements.
+ */
+class MetaQueryMemoryTable : public AbstractMetaTable {
+ public:
+  MetaQueryMemoryTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaQueryMemoryTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
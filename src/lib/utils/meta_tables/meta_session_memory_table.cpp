@@ -0,0 +1,40 @@
+#include "meta_session_memory_table.hpp"
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+
+namespace opossum {
+
+MetaSessionMemoryTable::MetaSessionMemoryTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"session_id", DataType::Long, false},
+                                               {"client", DataType::String, false},
+                                               {"connection_time", DataType::Long, false},
+                                               {"allocated_memory", DataType::Long, false},
+                                               {"peak_allocated_memory", DataType::Long, false},
+                                               {"spilled_bytes", DataType::Long, false}}) {}
+
+const std::string& MetaSessionMemoryTable::name() const {
+  static const auto name = std::string{"session_memory"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaSessionMemoryTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto& session : Hyrise::get().admission_controller->sessions()) {
+    const auto& memory_resource = *session.memory_resource;
+    const auto connection_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - session.registration_time).count();
+
+    output_table->append({static_cast<int64_t>(session.session_id), pmr_string{session.client},
+                          static_cast<int64_t>(connection_time),
+                          static_cast<int64_t>(memory_resource.allocated_bytes()),
+                          static_cast<int64_t>(memory_resource.peak_allocated_bytes()),
+                          static_cast<int64_t>(memory_resource.spilled_bytes())});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the memory of the sessions that are registered at the AdmissionController, e.g., the
+ * connections of the server. The memory of a session includes the results that are kept after its statements have
+ * finished.
+ */
+class MetaSessionMemoryTable : public AbstractMetaTable {
+ public:
+  MetaSessionMemoryTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaSessionMemoryTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
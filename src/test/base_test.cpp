@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "expression/expression_functional.hpp"
+#include "memory/budgeted_memory_resource.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/statistics_objects/abstract_statistics_object.hpp"
@@ -49,6 +50,15 @@ void execute_all(const std::vector<std::shared_ptr<AbstractOperator>>& operators
   }
 }
 
+size_t execute_with_memory_budget(const std::shared_ptr<AbstractOperator>& op, const size_t budget_bytes) {
+  const auto memory_resource = BudgetedMemoryResource::create(budget_bytes);
+  {
+    const auto memory_resource_scope = MemoryResourceScope{memory_resource};
+    op->execute();
+  }
+  return memory_resource->spilled_bytes();
+}
+
 std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
                                                           const ColumnID column_id) {
   Assert(op->get_output(), "Expected Operator to be executed");
@@ -55,6 +55,10 @@ std::shared_ptr<DictionarySegment<T>> create_dict_segment_by_type(DataType data_
 
 void execute_all(const std::vector<std::shared_ptr<AbstractOperator>>& operators);
 
+// Executes op within the scope of a BudgetedMemoryResource with budget_bytes and returns the number of bytes that the
+// operator spilled to disk
+size_t execute_with_memory_budget(const std::shared_ptr<AbstractOperator>& op, const size_t budget_bytes);
+
 std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
                                                           const ColumnID column_id);
 
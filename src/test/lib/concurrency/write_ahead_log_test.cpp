@@ -0,0 +1,148 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(filename.c_str());
+    _load_tables();
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(filename);
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::remove(filename.c_str());
+  }
+
+  // Simulates a restart: The log is closed and the tables are loaded again in their original state
+  void _restart() {
+    Hyrise::get().write_ahead_log = nullptr;
+    Hyrise::get().storage_manager.drop_table("table_a");
+    Hyrise::get().storage_manager.drop_table("table_b");
+    _load_tables();
+  }
+
+  void _load_tables() {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_string.tbl", 2));
+    Hyrise::get().storage_manager.add_table("table_b",
+                                            load_table("resources/test_data/tbl/int_float_with_null.tbl", 2));
+  }
+
+  static void _execute(const std::string& sql) {
+    const auto [status, _] = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    ASSERT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> _select(const std::string& table_name) {
+    return SQLPipelineBuilder{"SELECT * FROM " + table_name}.create_pipeline().get_result_table().second;
+  }
+
+  const std::string filename = test_data_path + "write_ahead_log_test.log";
+};
+
+TEST_F(WriteAheadLogTest, RecoverCommittedTransactions) {
+  _execute("INSERT INTO table_a VALUES (100, 'hundred'), (101, 'hundred and one')");
+  _execute("INSERT INTO table_b VALUES (NULL, 1.5), (7, NULL)");
+  _execute("DELETE FROM table_a WHERE a = 2");
+  _execute("UPDATE table_a SET b = 'updated' WHERE a = 100");
+
+  // Rolled back transactions are not logged, but leave gaps in the table that the recovery has to reproduce
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"INSERT INTO table_b VALUES (8, 8.5)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->rollback(RollbackReason::User);
+
+  _execute("INSERT INTO table_b VALUES (9, 9.5)");
+
+  EXPECT_EQ(Hyrise::get().write_ahead_log->statistics().logged_transactions, 5);
+
+  const auto expected_table_a = _select("table_a");
+  const auto expected_table_b = _select("table_b");
+
+  _restart();
+  EXPECT_EQ(_select("table_a")->row_count(), 12);
+
+  EXPECT_EQ(WriteAheadLog::recover(filename), 5);
+  EXPECT_TABLE_EQ_UNORDERED(_select("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_UNORDERED(_select("table_b"), expected_table_b);
+  // Four rows from the file, three committed inserts, and one rolled back insert
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("table_b")->row_count(), 8);
+}
+
+TEST_F(WriteAheadLogTest, ReadOnlyTransactionsAreNotLogged) {
+  _select("table_a");
+  _execute("DELETE FROM table_a WHERE a = -1");
+
+  EXPECT_EQ(Hyrise::get().write_ahead_log->statistics().logged_transactions, 0);
+}
+
+TEST_F(WriteAheadLogTest, TruncateIncompleteEntry) {
+  _execute("INSERT INTO table_a VALUES (100, 'hundred')");
+  _restart();
+
+  const auto complete_size = std::filesystem::file_size(filename);
+  {
+    // Write the beginning of an entry, as if the system crashed during a write
+    auto file = std::ofstream{filename, std::ios::binary | std::ios::app};
+    const auto payload_size = uint32_t{1000};
+    file.write(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+    file.write("abc", 3);
+  }
+
+  EXPECT_EQ(WriteAheadLog::recover(filename), 1);
+  EXPECT_EQ(std::filesystem::file_size(filename), complete_size);
+  EXPECT_EQ(_select("table_a")->row_count(), 13);
+}
+
+TEST_F(WriteAheadLogTest, RestartFromCheckpoint) {
+  // Same steps as the startup of hyriseServer with --checkpoint and --write_ahead_log
+  const auto checkpoint_filename = test_data_path + "write_ahead_log_test.checkpoint";
+  const auto start = [&]() {
+    Hyrise::get().write_ahead_log = nullptr;
+    Hyrise::get().storage_manager.drop_table("table_a");
+    Hyrise::get().storage_manager.drop_table("table_b");
+    Checkpoint::load(checkpoint_filename);
+    return WriteAheadLog::recover_and_enable(filename);
+  };
+
+  Hyrise::get().write_ahead_log = nullptr;
+  std::remove(filename.c_str());
+  Checkpoint::write(checkpoint_filename);
+
+  // First start: The log does not exist yet
+  EXPECT_EQ(start(), 0);
+  _execute("INSERT INTO table_a VALUES (100, 'hundred')");
+  _execute("DELETE FROM table_b WHERE a = 12345");
+  const auto expected_table_b = _select("table_b");
+
+  // Second start: The transactions of the first run are recovered and the log is continued
+  EXPECT_EQ(start(), 2);
+  EXPECT_EQ(_select("table_a")->row_count(), 13);
+  _execute("DELETE FROM table_a WHERE a = 100");
+  const auto expected_table_a = _select("table_a");
+
+  // Third start: The transactions of both runs are recovered
+  EXPECT_EQ(start(), 3);
+  EXPECT_TABLE_EQ_UNORDERED(_select("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_UNORDERED(_select("table_b"), expected_table_b);
+  EXPECT_EQ(_select("table_a")->row_count(), 12);
+
+  std::remove(checkpoint_filename.c_str());
+}
+
+}  // namespace opossum
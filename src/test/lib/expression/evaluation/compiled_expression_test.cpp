@@ -0,0 +1,163 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/evaluation/compiled_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CompiledExpressionTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"i", DataType::Int, true},    {"l", DataType::Long, false},
+                               {"f", DataType::Float, true},  {"d", DataType::Double, false},
+                               {"s", DataType::String, false}};
+
+    // More rows than fit into a single block of the compiled kernels, including zeros and NULLs
+    _value_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1000});
+    _dictionary_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1000});
+    for (auto row = int32_t{0}; row < 1500; ++row) {
+      const auto i = row % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row % 23 - 11};
+      const auto f = row % 5 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<float>(row) * 0.5f - 100};
+      const auto values = std::vector<AllTypeVariant>{i, int64_t{row} * 3 - 1000, f, row % 13 - 6.0, pmr_string{"x"}};
+      _value_table->append(values);
+      _dictionary_table->append(values);
+    }
+    _value_table->last_chunk()->finalize();
+    _dictionary_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_dictionary_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    _i = PQPColumnExpression::from_table(*_value_table, "i");
+    _l = PQPColumnExpression::from_table(*_value_table, "l");
+    _f = PQPColumnExpression::from_table(*_value_table, "f");
+    _d = PQPColumnExpression::from_table(*_value_table, "d");
+    _s = PQPColumnExpression::from_table(*_value_table, "s");
+  }
+
+  // Compiled expressions have to return the same values and NULLs as the ExpressionEvaluator
+  void expect_same_segments(const std::shared_ptr<AbstractExpression>& expression) {
+    for (const auto& table : {_value_table, _dictionary_table}) {
+      const auto compiled_expression = CompiledExpression::compile(*expression, *table);
+      ASSERT_TRUE(compiled_expression) << expression->description(AbstractExpression::DescriptionMode::Detailed);
+      EXPECT_EQ(compiled_expression->data_type(), expression->data_type());
+
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto expected = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_segment(*expression);
+        const auto actual = compiled_expression->evaluate_to_segment(*table->get_chunk(chunk_id));
+
+        EXPECT_EQ(actual->data_type(), expected->data_type());
+        EXPECT_EQ(actual->is_nullable(), expected->is_nullable());
+        EXPECT_EQ(compiled_expression->is_nullable(), expected->is_nullable());
+        ASSERT_EQ(actual->size(), expected->size());
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < actual->size(); ++chunk_offset) {
+          const auto actual_value = (*actual)[chunk_offset];
+          const auto expected_value = (*expected)[chunk_offset];
+          ASSERT_EQ(variant_is_null(actual_value), variant_is_null(expected_value));
+          if (!variant_is_null(actual_value)) {
+            ASSERT_EQ(actual_value, expected_value);
+          }
+        }
+      }
+    }
+  }
+
+  void expect_same_pos_lists(const std::shared_ptr<AbstractExpression>& expression) {
+    for (const auto& table : {_value_table, _dictionary_table}) {
+      const auto compiled_expression = CompiledExpression::compile(*expression, *table);
+      ASSERT_TRUE(compiled_expression) << expression->description(AbstractExpression::DescriptionMode::Detailed);
+
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        EXPECT_EQ(compiled_expression->evaluate_to_pos_list(*table->get_chunk(chunk_id), chunk_id),
+                  ExpressionEvaluator(table, chunk_id).evaluate_expression_to_pos_list(*expression));
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _value_table, _dictionary_table;
+  std::shared_ptr<PQPColumnExpression> _i, _l, _f, _d, _s;
+};
+
+TEST_F(CompiledExpressionTest, Arithmetics) {
+  expect_same_segments(add_(_i, _l));
+  expect_same_segments(sub_(_f, _d));
+  expect_same_segments(mul_(_l, _f));
+  expect_same_segments(div_(_i, _d));
+  expect_same_segments(div_(_l, _i));
+  expect_same_segments(mod_(_i, 5));
+  expect_same_segments(mod_(_d, _i));
+  expect_same_segments(unary_minus_(_f));
+  expect_same_segments(add_(mul_(_i, 2), sub_(_l, 7.5)));
+  expect_same_segments(value_(3));
+}
+
+TEST_F(CompiledExpressionTest, PredicatesAndCase) {
+  expect_same_segments(is_null_(_f));
+  expect_same_segments(is_not_null_(add_(_i, _l)));
+  expect_same_segments(is_null_(_d));
+  expect_same_segments(not_equals_(_l, _d));
+  expect_same_segments(greater_than_(_i, _f));
+  expect_same_segments(and_(less_than_(_i, 3), is_null_(_f)));
+  expect_same_segments(or_(equals_(_i, 0), greater_than_equals_(_d, _f)));
+  expect_same_segments(case_(greater_than_(_i, 0), _l, _f));
+  expect_same_segments(case_(less_than_equals_(div_(_l, _i), 10), add_(_i, 1), 0));
+}
+
+TEST_F(CompiledExpressionTest, PosLists) {
+  expect_same_pos_lists(greater_than_(add_(_i, _l), 500));
+  expect_same_pos_lists(less_than_(mul_(_f, 2), _d));
+  expect_same_pos_lists(and_(greater_than_equals_(_i, 0), less_than_(div_(_l, _i), 100)));
+  expect_same_pos_lists(or_(is_null_(_i), equals_(mod_(_l, 3), 0)));
+  expect_same_pos_lists(is_not_null_(div_(_d, _i)));
+}
+
+TEST_F(CompiledExpressionTest, UnsupportedExpressions) {
+  EXPECT_FALSE(CompiledExpression::compile(*_s, *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*equals_(_s, "x"), *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*like_(_s, "%x"), *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*in_(_i, list_(1, 2)), *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*add_(_i, null_()), *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*and_(is_null_(_i), between_inclusive_(_i, 1, 3)), *_value_table));
+  EXPECT_FALSE(CompiledExpression::compile(*cast_(_i, DataType::Long), *_value_table));
+}
+
+TEST_F(CompiledExpressionTest, NestingDepth) {
+  // The kernels keep their buffers on the stack, so deeply nested expressions are not compiled
+  auto expression = std::shared_ptr<AbstractExpression>{_i};
+  for (auto depth = 1; depth < 32; ++depth) {
+    expression = add_(expression, 1);
+  }
+  expect_same_segments(expression);
+
+  expression = add_(expression, 1);
+  EXPECT_FALSE(CompiledExpression::compile(*expression, *_value_table));
+}
+
+TEST_F(CompiledExpressionTest, CacheIgnoresValues) {
+  CompiledExpression::clear_cache();
+
+  const auto plus_five = CompiledExpression::compile(*add_(_i, 5), *_value_table);
+  const auto plus_six = CompiledExpression::compile(*add_(_i, 6), *_value_table);
+  EXPECT_EQ(CompiledExpression::cache_size(), 1);
+
+  // The programs are shared, but evaluated with their own values
+  const auto& chunk = *_value_table->get_chunk(ChunkID{0});
+  EXPECT_EQ(plus_five->evaluate_to_segment(chunk)->operator[](ChunkOffset{1}), AllTypeVariant{-10 + 5});
+  EXPECT_EQ(plus_six->evaluate_to_segment(chunk)->operator[](ChunkOffset{1}), AllTypeVariant{-10 + 6});
+
+  CompiledExpression::compile(*add_(_l, 5), *_value_table);
+  CompiledExpression::compile(*add_(_i, 5.0), *_value_table);
+  EXPECT_EQ(CompiledExpression::cache_size(), 3);
+}
+
+}  // namespace opossum
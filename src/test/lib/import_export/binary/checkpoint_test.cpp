@@ -0,0 +1,198 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include "../../storage/encoding_test.hpp"
+
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override { std::remove(filename.c_str()); }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  static void _execute(const std::string& sql,
+                       const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    const auto [status, _] = builder.create_pipeline().get_result_table();
+    ASSERT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> _select(const std::string& table_name) {
+    return SQLPipelineBuilder{"SELECT * FROM " + table_name}.create_pipeline().get_result_table().second;
+  }
+
+  const std::string filename = test_data_path + "checkpoint_test.bin";
+};
+
+class CheckpointMultiEncodingTest : public EncodingTest {
+ protected:
+  void SetUp() override { std::remove(filename.c_str()); }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  const std::string filename = test_data_path + "checkpoint_test.bin";
+};
+
+INSTANTIATE_TEST_SUITE_P(CheckpointMultiEncodingTestInstances, CheckpointMultiEncodingTest,
+                         ::testing::ValuesIn(all_segment_encoding_specs), all_segment_encoding_specs_formatter);
+
+TEST_P(CheckpointMultiEncodingTest, WriteAndLoad) {
+  const auto table = load_table_with_encoding("resources/test_data/tbl/all_data_types_sorted.tbl", 3);
+  table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  table->add_soft_key_constraint({{ColumnID{2}, ColumnID{4}}, KeyConstraintType::UNIQUE});
+  table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  Checkpoint::write(filename);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+
+  ASSERT_TRUE(Hyrise::get().storage_manager.has_table("table_a"));
+  const auto loaded_table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_TABLE_EQ_ORDERED(loaded_table, table);
+  EXPECT_EQ(loaded_table->target_chunk_size(), 3);
+  EXPECT_EQ(loaded_table->soft_key_constraints(), table->soft_key_constraints());
+
+  ASSERT_EQ(loaded_table->chunk_count(), table->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto loaded_chunk = loaded_table->get_chunk(chunk_id);
+    EXPECT_FALSE(loaded_chunk->is_mutable());
+    EXPECT_EQ(loaded_chunk->individually_sorted_by(), chunk->individually_sorted_by());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      EXPECT_EQ(get_segment_encoding_spec(loaded_chunk->get_segment(column_id)),
+                get_segment_encoding_spec(chunk->get_segment(column_id)));
+    }
+  }
+}
+
+TEST_F(CheckpointTest, MultipleTables) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_string.tbl"));
+  const auto expected_table_a = _select("table_a");
+  const auto expected_table_b = _select("table_b");
+
+  Checkpoint::write(filename);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(_select("table_a"), expected_table_a);
+  EXPECT_TABLE_EQ_ORDERED(_select("table_b"), expected_table_b);
+}
+
+TEST_F(CheckpointTest, VisibilityAsOfCheckpoint) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  _execute("DELETE FROM table_a WHERE a = 123");
+  _execute("INSERT INTO table_a VALUES (1, 1.5)");
+
+  // Not committed when the checkpoint is written, so it must not be visible after loading the checkpoint
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _execute("INSERT INTO table_a VALUES (2, 2.5)", transaction_context);
+
+  const auto expected_table = _select("table_a");
+  Checkpoint::write(filename);
+  transaction_context->rollback(RollbackReason::User);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table->row_count(), 5);
+  EXPECT_TABLE_EQ_UNORDERED(_select("table_a"), expected_table);
+
+  auto invalid_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    invalid_row_count += table->get_chunk(chunk_id)->invalid_row_count();
+  }
+  EXPECT_EQ(invalid_row_count, 2);
+
+  // The last chunk was not finalized and accepts further inserts
+  EXPECT_TRUE(table->last_chunk()->is_mutable());
+  _execute("INSERT INTO table_a VALUES (3, 3.5)");
+  EXPECT_EQ(_select("table_a")->row_count(), 4);
+}
+
+TEST_F(CheckpointTest, InsertIntoLoadedChunk) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 10));
+
+  Checkpoint::write(filename);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  ASSERT_EQ(table->chunk_count(), 1);
+  ASSERT_TRUE(table->last_chunk()->is_mutable());
+
+  // The row is inserted into the free capacity of the loaded chunk and must not be visible before it is committed
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _execute("INSERT INTO table_a VALUES (1, 1.5)", transaction_context);
+  EXPECT_EQ(table->chunk_count(), 1);
+  EXPECT_EQ(_select("table_a")->row_count(), 3);
+
+  transaction_context->commit();
+  EXPECT_EQ(_select("table_a")->row_count(), 4);
+}
+
+TEST_F(CheckpointTest, LoadArraysFromMapping) {
+  // The arrays of the segments span multiple pages and are therefore backed by the mapped file instead of being copied
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 4000, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+  const auto expected_table = _select("table_a");
+
+  Checkpoint::write(filename);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+
+  const auto loaded_table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_TABLE_EQ_ORDERED(_select("table_a"), expected_table);
+
+  const auto& values = static_cast<const ValueSegment<int32_t>&>(*loaded_table->last_chunk()->get_segment(ColumnID{0}));
+  EXPECT_NE(values.values().get_allocator().resource(), boost::container::pmr::get_default_resource());
+  EXPECT_GE(values.values().capacity(), 4000);
+
+  // Writing a new checkpoint replaces the file, so that the loaded table keeps its pages
+  Checkpoint::write(filename);
+  EXPECT_TABLE_EQ_ORDERED(_select("table_a"), expected_table);
+
+  // Inserting into the mapped capacity of the mutable chunk does not modify the file
+  _execute("INSERT INTO table_a VALUES (-1)");
+  EXPECT_EQ(loaded_table->chunk_count(), 3);
+  EXPECT_EQ(_select("table_a")->row_count(), 10'001);
+  Hyrise::reset();
+  Checkpoint::load(filename);
+  EXPECT_TABLE_EQ_ORDERED(_select("table_a"), expected_table);
+}
+
+TEST_F(CheckpointTest, LoadInvalidFile) {
+  {
+    auto file = std::ofstream{filename, std::ios::binary};
+    file << "This is not a checkpoint";
+  }
+  EXPECT_THROW(Checkpoint::load(filename), std::logic_error);
+  EXPECT_THROW(Checkpoint::load(test_data_path + "does_not_exist.bin"), std::logic_error);
+}
+
+TEST_F(CheckpointTest, LoadExistingTable) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  Checkpoint::write(filename);
+  EXPECT_THROW(Checkpoint::load(filename), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+
 #include "base_test.hpp"
 
 #include "hyrise.hpp"
@@ -5,6 +8,7 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -300,4 +304,69 @@ TEST_F(CsvParserTest, FinalizedChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, QuotedDelimitersAcrossRanges) {
+  // The file is larger than the ranges that are scanned in parallel, so that rows and quoted fields span the borders of
+  // the 64 byte blocks as well as of the ranges. It does not end with a delimiter.
+  const auto filename = test_data_path + "csv_parser_test_quoted_delimiters.csv";
+  const auto row_count = size_t{100'000};
+  {
+    auto file = std::ofstream{filename};
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      if (row > 0) file << '\n';
+      file << row << ",\"value \"\"" << row << "\"\", with separator,\nand delimiter\"";
+    }
+  }
+
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns = {{"a", "int", false}, {"b", "string", false}};
+  const auto table = CsvParser::parse(filename, ChunkOffset{30'000}, csv_meta);
+  std::remove(filename.c_str());
+
+  EXPECT_EQ(table->row_count(), row_count);
+  EXPECT_EQ(table->chunk_count(), 4U);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 10'000U);
+
+  for (const auto row : {size_t{0}, size_t{29'999}, size_t{30'000}, size_t{99'999}}) {
+    EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, row), static_cast<int32_t>(row));
+    EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, row),
+              pmr_string{"value \"" + std::to_string(row) + "\", with separator,\nand delimiter"});
+  }
+}
+
+TEST_F(CsvParserTest, UnterminatedQuoteThrows) {
+  const auto filename = test_data_path + "csv_parser_test_unterminated_quote.csv";
+  {
+    auto file = std::ofstream{filename};
+    file << "1,\"a\"\n2,\"b\n";
+  }
+
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns = {{"a", "int", false}, {"b", "string", false}};
+  EXPECT_THROW(CsvParser::parse(filename, Chunk::DEFAULT_SIZE, csv_meta), std::exception);
+  std::remove(filename.c_str());
+}
+
+TEST_F(CsvParserTest, EncodedChunks) {
+  const auto encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::RunLength}};
+  const auto table =
+      CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{40}, std::nullopt, encoding_spec);
+
+  EXPECT_EQ(table->chunk_count(), 3U);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::Dictionary);
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{1})).encoding_type, EncodingType::RunLength);
+  }
+
+  TableColumnDefinitions column_definitions{{"b", DataType::Float, false}, {"a", DataType::Int, false}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 20);
+  for (int i = 0; i < 100; ++i) {
+    expected_table->append({458.7f, 12345});
+  }
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
 }  // namespace opossum
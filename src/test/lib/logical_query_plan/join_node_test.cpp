@@ -106,6 +106,40 @@ TEST_F(JoinNodeTest, Copy) {
   EXPECT_EQ(*_anti_join_node, *_anti_join_node->deep_copy());
 }
 
+TEST_F(JoinNodeTest, DetachedInputs) {
+  const auto output_count_a = _mock_node_a->output_count();
+  const auto output_count_b = _mock_node_b->output_count();
+
+  // Candidates with detached inputs can be used like other nodes, but do not modify their inputs
+  auto candidate = JoinNode::make(JoinMode::Inner, equals_(_t_a_a, _t_b_y));
+  candidate->set_detached_inputs(_mock_node_a, _mock_node_b);
+  EXPECT_TRUE(candidate->has_detached_inputs());
+  EXPECT_EQ(candidate->left_input(), _mock_node_a);
+  EXPECT_EQ(candidate->right_input(), _mock_node_b);
+  EXPECT_EQ(*candidate, *_inner_join_node);
+  EXPECT_EQ(_mock_node_a->output_count(), output_count_a);
+  EXPECT_EQ(_mock_node_b->output_count(), output_count_b);
+
+  // Discarded candidates are simply released
+  candidate.reset();
+  EXPECT_EQ(_mock_node_a->output_count(), output_count_a);
+  EXPECT_EQ(_mock_node_b->output_count(), output_count_b);
+
+  // Chosen candidates are attached to their inputs
+  candidate = JoinNode::make(JoinMode::Inner, equals_(_t_a_a, _t_b_y));
+  candidate->set_detached_inputs(_mock_node_a, _mock_node_b);
+  candidate->attach_inputs();
+  EXPECT_FALSE(candidate->has_detached_inputs());
+  EXPECT_EQ(_mock_node_a->output_count(), output_count_a + 1);
+  EXPECT_EQ(_mock_node_b->output_count(), output_count_b + 1);
+  EXPECT_EQ(_mock_node_a->outputs().back(), candidate);
+  EXPECT_EQ(_mock_node_b->get_input_side(candidate), LQPInputSide::Right);
+
+  candidate.reset();
+  EXPECT_EQ(_mock_node_a->output_count(), output_count_a);
+  EXPECT_EQ(_mock_node_b->output_count(), output_count_b);
+}
+
 TEST_F(JoinNodeTest, OutputColumnExpressionsSemiJoin) {
   ASSERT_EQ(_semi_join_node->output_expressions().size(), 3u);
   EXPECT_EQ(*_semi_join_node->output_expressions().at(0), *_t_a_a);
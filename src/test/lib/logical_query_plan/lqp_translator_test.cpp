@@ -50,6 +50,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -626,6 +627,32 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinHashRuntimeFilterSource) {
+  // table_int_float has three rows, table_int_float2 has four rows. The smaller input is the source.
+  const auto inner_join = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node));
+  EXPECT_EQ(std::static_pointer_cast<JoinHash>(inner_join)->runtime_filter_source, RuntimeFilterSource::LeftInput);
+
+  // For semi joins, only the right input can be the source
+  const auto semi_join = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Semi, equals_(int_float2_a, int_float_a), int_float2_node, int_float_node));
+  EXPECT_EQ(std::static_pointer_cast<JoinHash>(semi_join)->runtime_filter_source, RuntimeFilterSource::RightInput);
+
+  const auto semi_join_larger_right_input = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float2_a), int_float_node, int_float2_node));
+  EXPECT_FALSE(std::static_pointer_cast<JoinHash>(semi_join_larger_right_input)->runtime_filter_source);
+
+  // Outer joins keep unmatched rows
+  const auto left_join = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Left, equals_(int_float2_a, int_float_a), int_float2_node, int_float_node));
+  EXPECT_FALSE(std::static_pointer_cast<JoinHash>(left_join)->runtime_filter_source);
+
+  // Hashes of different data types are not comparable
+  const auto different_types_join = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_b), int_float_node, int_float2_node));
+  EXPECT_FALSE(std::static_pointer_cast<JoinHash>(different_types_join)->runtime_filter_source);
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   /**
    * Build LQP and translate to PQP
@@ -748,6 +775,64 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, LimitOnSortToTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 3
+   */
+  const auto sort_modes = std::vector<SortMode>{SortMode::Descending, SortMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(int64_t{3}),
+    SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<const TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{3}));
+  EXPECT_EQ(top_k->sort_definitions(),
+            std::vector({SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                         SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->left_input());
+  ASSERT_TRUE(get_table);
+}
+
+TEST_F(LQPTranslatorTest, LimitOnSortWithoutTopK) {
+  /**
+   * Large or non-constant row counts and Sorts with multiple outputs are not translated to a TopK operator
+   */
+  const auto sort_node = SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+                                        int_float_node);
+
+  const auto large_limit_pqp = LQPTranslator{}.translate_node(LimitNode::make(value_(int64_t{1'000'000}), sort_node));
+  EXPECT_EQ(large_limit_pqp->type(), OperatorType::Limit);
+  EXPECT_EQ(large_limit_pqp->left_input()->type(), OperatorType::Sort);
+
+  const auto parameter_limit_pqp = LQPTranslator{}.translate_node(
+      LimitNode::make(placeholder_(ParameterID{0}), SortNode::make(expression_vector(int_float_a),
+                                                                   std::vector<SortMode>{SortMode::Ascending},
+                                                                   int_float_node)));
+  EXPECT_EQ(parameter_limit_pqp->type(), OperatorType::Limit);
+
+  // clang-format off
+  const auto diamond_lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(int64_t{3}), sort_node),
+    sort_node);
+  // clang-format on
+  const auto diamond_pqp = LQPTranslator{}.translate_node(diamond_lqp);
+  EXPECT_EQ(diamond_pqp->left_input()->type(), OperatorType::Limit);
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -53,6 +53,10 @@ TEST_F(StoredTableNodeTest, Description) {
   stored_table_node_b->set_pruned_chunk_ids({ChunkID{2}});
   stored_table_node_b->set_pruned_column_ids({ColumnID{1}});
   EXPECT_EQ(stored_table_node_b->description(), "[StoredTable] Name: 't_a' pruned: 1/4 chunk(s), 1/3 column(s)");
+
+  stored_table_node_b->join_pruned_chunk_count = 1;
+  EXPECT_EQ(stored_table_node_b->description(),
+            "[StoredTable] Name: 't_a' pruned: 1/4 chunk(s) (1 without join partners), 1/3 column(s)");
 }
 
 TEST_F(StoredTableNodeTest, GetColumn) {
@@ -0,0 +1,134 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace opossum {
+
+class BudgetedMemoryResourceTest : public BaseTest {};
+
+TEST_F(BudgetedMemoryResourceTest, TracksAllocations) {
+  const auto resource = BudgetedMemoryResource::create(1'000);
+  EXPECT_EQ(resource->budget(), 1'000);
+  EXPECT_EQ(resource->allocated_bytes(), 0);
+  EXPECT_TRUE(resource->fits(1'000));
+
+  {
+    auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{resource.get()});
+    EXPECT_EQ(resource->allocated_bytes(), 400);
+    EXPECT_EQ(resource->available_bytes(), 600);
+    EXPECT_TRUE(resource->fits(600));
+    EXPECT_FALSE(resource->fits(601));
+
+    // The budget is not enforced when allocating
+    values.resize(1'000);
+    EXPECT_GE(resource->allocated_bytes(), 4'000);
+    EXPECT_EQ(resource->available_bytes(), 0);
+  }
+
+  EXPECT_EQ(resource->allocated_bytes(), 0);
+  EXPECT_GE(resource->peak_allocated_bytes(), 4'000);
+
+  resource->add_spilled_bytes(10);
+  resource->add_spilled_bytes(5);
+  EXPECT_EQ(resource->spilled_bytes(), 15);
+}
+
+TEST_F(BudgetedMemoryResourceTest, ScopeSetsDefaultResource) {
+  const auto outer_resource = BudgetedMemoryResource::create(1'000);
+  const auto inner_resource = BudgetedMemoryResource::create(1'000);
+  EXPECT_EQ(BudgetedMemoryResource::current(), nullptr);
+
+  {
+    const auto outer_scope = MemoryResourceScope{outer_resource};
+    EXPECT_EQ(BudgetedMemoryResource::current(), outer_resource.get());
+
+    auto outer_values = pmr_vector<int32_t>(10);
+    EXPECT_EQ(outer_resource->allocated_bytes(), 40);
+
+    {
+      const auto inner_scope = MemoryResourceScope{inner_resource};
+      EXPECT_EQ(BudgetedMemoryResource::current(), inner_resource.get());
+
+      auto inner_values = pmr_vector<int32_t>(20);
+      EXPECT_EQ(inner_resource->allocated_bytes(), 80);
+      EXPECT_EQ(outer_resource->allocated_bytes(), 40);
+
+      {
+        const auto untracked_scope = MemoryResourceScope{nullptr};
+        EXPECT_EQ(BudgetedMemoryResource::current(), nullptr);
+
+        auto untracked_values = pmr_vector<int32_t>(30);
+        EXPECT_EQ(inner_resource->allocated_bytes(), 80);
+        EXPECT_EQ(outer_resource->allocated_bytes(), 40);
+      }
+    }
+
+    EXPECT_EQ(BudgetedMemoryResource::current(), outer_resource.get());
+    EXPECT_EQ(inner_resource->allocated_bytes(), 0);
+  }
+
+  EXPECT_EQ(BudgetedMemoryResource::current(), nullptr);
+  EXPECT_EQ(outer_resource->allocated_bytes(), 0);
+}
+
+TEST_F(BudgetedMemoryResourceTest, AccountsToParent) {
+  const auto parent_resource = BudgetedMemoryResource::create(1'000);
+  const auto child_resource = BudgetedMemoryResource::create(2'000, parent_resource);
+  EXPECT_EQ(child_resource->parent(), parent_resource);
+
+  // The budget of the parent limits the child
+  EXPECT_EQ(child_resource->available_bytes(), 1'000);
+
+  {
+    auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{child_resource.get()});
+    EXPECT_EQ(child_resource->allocated_bytes(), 400);
+    EXPECT_EQ(parent_resource->allocated_bytes(), 400);
+    EXPECT_EQ(child_resource->available_bytes(), 600);
+
+    child_resource->add_spilled_bytes(10);
+    EXPECT_EQ(parent_resource->spilled_bytes(), 10);
+  }
+
+  EXPECT_EQ(parent_resource->allocated_bytes(), 0);
+  EXPECT_EQ(parent_resource->peak_allocated_bytes(), 400);
+}
+
+TEST_F(BudgetedMemoryResourceTest, AllocationsOutliveResourceOwner) {
+  auto resource = BudgetedMemoryResource::create(1'000);
+  auto values = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{resource.get()});
+
+  // The resource is kept alive by its allocation and deleted once values is freed
+  resource = nullptr;
+  values.resize(100);
+  EXPECT_EQ(values.size(), 100);
+  values = pmr_vector<int32_t>{};
+}
+
+TEST_F(BudgetedMemoryResourceTest, TasksInheritResource) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto resource = BudgetedMemoryResource::create(1'000);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto resources_in_jobs = std::vector<BudgetedMemoryResource*>(10);
+
+  {
+    const auto scope = MemoryResourceScope{resource};
+    for (auto job_id = size_t{0}; job_id < resources_in_jobs.size(); ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+        resources_in_jobs[job_id] = BudgetedMemoryResource::current();
+      }));
+    }
+  }
+
+  // The jobs are executed outside of the scope, but within the scope of the resource they were created in
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  for (const auto resource_in_job : resources_in_jobs) {
+    EXPECT_EQ(resource_in_job, resource.get());
+  }
+  EXPECT_EQ(BudgetedMemoryResource::current(), nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#include <numeric>
+
+#include "base_test.hpp"
+
+#include "memory/spill_file.hpp"
+
+namespace opossum {
+
+class SpillFileTest : public BaseTest {};
+
+TEST_F(SpillFileTest, AppendAndRead) {
+  auto spill_file = SpillFile{};
+  EXPECT_EQ(spill_file.size(), 0);
+
+  const auto small_values = std::vector<int32_t>{1, 2, 3, 4};
+  const auto small_offset = spill_file.append(small_values);
+  EXPECT_EQ(small_offset, 0);
+  EXPECT_EQ(spill_file.size(), 16);
+
+  // Large blocks bypass the write buffer
+  auto large_values = std::vector<int64_t>(300'000);
+  std::iota(large_values.begin(), large_values.end(), int64_t{0});
+  const auto large_offset = spill_file.append(large_values);
+  EXPECT_EQ(large_offset, 16);
+
+  const auto more_small_values = std::vector<char>{'a', 'b', 'c'};
+  const auto more_small_offset = spill_file.append(more_small_values);
+  EXPECT_EQ(more_small_offset, 16 + 300'000 * sizeof(int64_t));
+  EXPECT_EQ(spill_file.size(), more_small_offset + 3);
+
+  // Data that is still in the write buffer can be read as well
+  auto read_more_small_values = std::vector<char>(3);
+  spill_file.read(more_small_offset, 3, read_more_small_values.data());
+  EXPECT_EQ(read_more_small_values, more_small_values);
+
+  auto read_small_values = std::vector<int32_t>(4);
+  spill_file.read(small_offset, 16, read_small_values.data());
+  EXPECT_EQ(read_small_values, small_values);
+
+  auto read_large_values = std::vector<int64_t>(300'000);
+  spill_file.read(large_offset, 300'000 * sizeof(int64_t), read_large_values.data());
+  EXPECT_EQ(read_large_values, large_values);
+
+  // Partial reads
+  auto read_value = int64_t{0};
+  spill_file.read(large_offset + 1'234 * sizeof(int64_t), sizeof(int64_t), &read_value);
+  EXPECT_EQ(read_value, 1'234);
+}
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/aggregate_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/**
+ * AggregateHash uses a parallel implementation (thread-local pre-aggregation and merging of radix partitions) if a
+ * multi-threaded scheduler is active. These tests compare its results with the single-threaded implementation.
+ */
+class OperatorsAggregateHashParallelTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().topology.use_fake_numa_topology(8, 4);
+
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false},    {"b", DataType::Long, false},
+                               {"c", DataType::Int, true},     {"d", DataType::Double, true},
+                               {"e", DataType::String, false}, {"f", DataType::Float, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+    for (auto row_id = 0; row_id < 50'000; ++row_id) {
+      // Rows of the same group are spread over all chunks so that their partial aggregates need to be merged
+      const auto c = row_id % 7 == 0 ? AllTypeVariant{} : AllTypeVariant{row_id % 13};
+      const auto d = row_id % 5 == 0 ? AllTypeVariant{} : AllTypeVariant{static_cast<double>(row_id % 101) / 4};
+      const auto f = row_id % 3 == 0 ? AllTypeVariant{} : AllTypeVariant{static_cast<float>(row_id % 17)};
+      _table->append({row_id % 4, int64_t{(row_id * 7919) % 30'000}, c, d, pmr_string{std::to_string(row_id % 11)}, f});
+    }
+    _table->last_chunk()->finalize();
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>()); }
+
+  std::shared_ptr<AggregateExpression> _aggregate(const AggregateFunction aggregate_function,
+                                                  const ColumnID column_id) const {
+    if (column_id == INVALID_COLUMN_ID) {
+      return std::make_shared<AggregateExpression>(aggregate_function,
+                                                   pqp_column_(column_id, DataType::Long, false, "*"));
+    }
+    return std::make_shared<AggregateExpression>(
+        aggregate_function, pqp_column_(column_id, _table->column_data_type(column_id),
+                                        _table->column_is_nullable(column_id), _table->column_name(column_id)));
+  }
+
+  void _check(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+              const std::vector<ColumnID>& groupby_column_ids) const {
+    Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+    const auto expected_aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+    const auto aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    Hyrise::get().scheduler()->finish();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateHashParallelTest, AllAggregateFunctions) {
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      _aggregate(AggregateFunction::Min, ColumnID{2}),
+      _aggregate(AggregateFunction::Max, ColumnID{4}),
+      _aggregate(AggregateFunction::Sum, ColumnID{2}),
+      _aggregate(AggregateFunction::Avg, ColumnID{3}),
+      _aggregate(AggregateFunction::Count, ColumnID{5}),
+      _aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+      _aggregate(AggregateFunction::CountDistinct, ColumnID{4}),
+      _aggregate(AggregateFunction::StandardDeviationSample, ColumnID{3}),
+      _aggregate(AggregateFunction::StandardDeviationSample, ColumnID{5})};
+
+  // Without GROUP BY columns and with one, two, and three GROUP BY columns
+  _check(aggregates, {});
+  _check(aggregates, {ColumnID{0}});
+  _check(aggregates, {ColumnID{0}, ColumnID{2}});
+  _check(aggregates, {ColumnID{0}, ColumnID{2}, ColumnID{4}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, ManyGroups) {
+  // With two workers, each pre-aggregation task sees more groups than its thread-local table can hold
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      _aggregate(AggregateFunction::Sum, ColumnID{0}), _aggregate(AggregateFunction::Max, ColumnID{3}),
+      _aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+      _aggregate(AggregateFunction::StandardDeviationSample, ColumnID{2})};
+
+  _check(aggregates, {ColumnID{1}});
+  _check(aggregates, {ColumnID{1}, ColumnID{4}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, Distinct) {
+  _check({}, {ColumnID{1}});
+  _check({_aggregate(AggregateFunction::Any, ColumnID{0})}, {ColumnID{1}, ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, SpillsPartialAggregatesWithSmallMemoryBudget) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // AVG is combined from a partial SUM and COUNT, COUNT from the sum of the partial COUNTs
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      _aggregate(AggregateFunction::Min, ColumnID{2}),   _aggregate(AggregateFunction::Max, ColumnID{4}),
+      _aggregate(AggregateFunction::Sum, ColumnID{5}),   _aggregate(AggregateFunction::Avg, ColumnID{3}),
+      _aggregate(AggregateFunction::Count, ColumnID{2}), _aggregate(AggregateFunction::Count, INVALID_COLUMN_ID),
+      _aggregate(AggregateFunction::Any, ColumnID{0})};
+
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 3);
+  table_scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{_table_wrapper, table_scan}) {
+    const auto groupby_column_ids_variants =
+        std::vector<std::vector<ColumnID>>{{ColumnID{1}}, {ColumnID{4}, ColumnID{2}}};
+    for (const auto& groupby_column_ids : groupby_column_ids_variants) {
+      const auto expected_aggregate = std::make_shared<AggregateHash>(input, aggregates, groupby_column_ids);
+      expected_aggregate->execute();
+
+      const auto aggregate = std::make_shared<AggregateHash>(input, aggregates, groupby_column_ids);
+      EXPECT_GT(execute_with_memory_budget(aggregate, 64), 0);
+      EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, AggregatesInMemoryIfPartialAggregatesCannotBeCombined) {
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{1}};
+  for (const auto aggregate_function :
+       {AggregateFunction::CountDistinct, AggregateFunction::StandardDeviationSample}) {
+    const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+        _aggregate(AggregateFunction::Sum, ColumnID{2}), _aggregate(aggregate_function, ColumnID{3})};
+
+    const auto expected_aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    const auto aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    EXPECT_EQ(execute_with_memory_budget(aggregate, 64), 0);
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+}  // namespace opossum
@@ -200,4 +200,39 @@ TEST_F(AggregateSortTest, AggregateOnPresortedValueClustered) {
   test_clustered_table_input(to_simple_reference_table(table_sorted_value_clustered));
 }
 
+TEST_F(AggregateSortTest, AggregateOnIndividuallySortedChunks) {
+  // The chunks are sorted by column a, but the table is neither sorted nor clustered. Groups span multiple chunks.
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}}, TableType::Data, 4);
+  for (const auto& [a, b] : std::vector<std::pair<AllTypeVariant, int32_t>>{
+           {1, 10}, {1, 11}, {2, 12}, {5, 13}, {NullValue{}, 14}, {5, 15}, {3, 16}, {1, 17}, {NullValue{}, 20},
+           {2, 18}, {2, 18}, {3, 19}}) {
+    table->append({a, b});
+  }
+  table->last_chunk()->finalize();
+  table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+  table->get_chunk(ChunkID{1})->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Descending));
+  table->get_chunk(ChunkID{2})->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+
+  for (const auto& input_table : std::vector<std::shared_ptr<const Table>>{table, to_simple_reference_table(table)}) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+
+    const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+    const auto count_star =
+        std::make_shared<AggregateExpression>(AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long,
+                                                                                    false, "*"));
+    const auto aggregates =
+        std::vector<std::shared_ptr<AggregateExpression>>{sum_(b), avg_(b), count_distinct_(b), count_star};
+    const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+    const auto aggregate_sort = std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate_sort->execute();
+    const auto aggregate_hash = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate_hash->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate_sort->get_output(), aggregate_hash->get_output());
+    EXPECT_EQ(aggregate_sort->get_output()->row_count(), 5);
+  }
+}
+
 }  // namespace opossum
@@ -163,6 +163,24 @@ TEST_F(OperatorsGetTableTest, PrunedColumnsAndChunks) {
   EXPECT_EQ(table->get_chunk(ChunkID{1})->get_indexes(column_ids_1).size(), 0u);
 }
 
+TEST_F(OperatorsGetTableTest, ForwardPruningStatistics) {
+  const auto& stored_table = Hyrise::get().storage_manager.get_table("int_int_float");
+  auto get_table =
+      std::make_shared<opossum::GetTable>("int_int_float", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table->execute();
+
+  const auto& table = get_table->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& stored_pruning_statistics = stored_table->get_chunk(chunk_id)->pruning_statistics();
+    const auto& pruning_statistics = table->get_chunk(chunk_id)->pruning_statistics();
+    ASSERT_TRUE(stored_pruning_statistics);
+    ASSERT_TRUE(pruning_statistics);
+    ASSERT_EQ(pruning_statistics->size(), 2u);
+    EXPECT_EQ((*pruning_statistics)[0], (*stored_pruning_statistics)[0]);
+    EXPECT_EQ((*pruning_statistics)[1], (*stored_pruning_statistics)[2]);
+  }
+}
+
 TEST_F(OperatorsGetTableTest, ExcludeCleanedUpChunk) {
   auto get_table = std::make_shared<opossum::GetTable>("int_int_float");
   auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
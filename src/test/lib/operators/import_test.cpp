@@ -9,6 +9,7 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -68,6 +69,34 @@ TEST_P(OperatorsImportMultiFileTypeTest, ImportWithoutFileType) {
   EXPECT_TABLE_EQ_ORDERED(Hyrise::get().storage_manager.get_table("a"), expected_table);
 }
 
+TEST_P(OperatorsImportMultiFileTypeTest, ImportWithTargetEncoding) {
+  const auto reference_filename = reference_filepath + reference_filenames.at(GetParam());
+  auto importer = std::make_shared<Import>(reference_filename, "a", Chunk::DEFAULT_SIZE, GetParam(), std::nullopt,
+                                           EncodingType::RunLength);
+  importer->execute();
+
+  const auto table = Hyrise::get().storage_manager.get_table("a");
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(get_segment_encoding_spec(segment).encoding_type, EncodingType::RunLength);
+
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float, false}}, TableType::Data, 5);
+  expected_table->append({1.1f});
+  expected_table->append({2.2f});
+  expected_table->append({3.3f});
+  expected_table->append({4.4f});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Columns whose data type is not supported by the encoding are left unencoded
+  importer = std::make_shared<Import>(reference_filename, "b", Chunk::DEFAULT_SIZE, GetParam(), std::nullopt,
+                                      EncodingType::FixedStringDictionary);
+  importer->execute();
+
+  const auto unencoded_segment =
+      Hyrise::get().storage_manager.get_table("b")->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(get_segment_encoding_spec(unencoded_segment).encoding_type, EncodingType::Unencoded);
+}
+
 TEST_P(OperatorsImportMultiFileTypeTest, HasCorrectMvccData) {
   const auto reference_filename =
       reference_filepath + reference_filenames.at(GetParam()) + file_extensions.at(GetParam());
@@ -157,9 +157,8 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
     });
   }
 
-  // Build a BloomFilter that cannot be used to skip any entries by creating a BloomFilter with every value being false
-  // and using bitwise negation (~x).
-  auto bloom_filter = ~BloomFilter(BLOOM_FILTER_SIZE);
+  // An inactive BloomFilter does not skip any entries
+  const auto bloom_filter = BloomFilter{};
 
   // Build phase: NULLs should be discarded
   auto hash_map_with_nulls = build<int, int>(materialized_with_nulls, JoinHashBuildMode::AllPositions, 0, bloom_filter);
@@ -184,21 +183,20 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
 TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
   {
     std::vector<std::vector<size_t>> histograms;  // Ignored in this test
-    BloomFilter bloom_filter;
+    auto bloom_filter = BloomFilter{100};
 
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
+    // All input values should be contained in the bloom filter
     for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
-
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+      EXPECT_TRUE(bloom_filter.contains(std::hash<int>{}(value)));
     }
 
-    // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    // Other values are not contained (with a small number of entries, false positives are unlikely)
+    for (auto value : std::vector<int>{1, 2, 5, 8, 10, 12, 17, 19, 100}) {
+      EXPECT_FALSE(bloom_filter.contains(std::hash<int>{}(value)));
+    }
   }
 }
 
@@ -208,9 +206,9 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
     BloomFilter output_bloom_filter;
 
     // Fill input_bloom_filter
-    BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+    auto input_bloom_filter = BloomFilter{100};
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      input_bloom_filter.insert(std::hash<int>{}(value));
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -234,6 +232,59 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
   }
 }
 
+TEST_F(JoinHashStepsTest, FilterByBloomFilter) {
+  const size_t radix_bit_count = 1;
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter output_bloom_filter;  // Ignored in this test
+
+  auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
+                                                      histograms, radix_bit_count, output_bloom_filter);
+
+  auto bloom_filter = BloomFilter{100};
+  for (auto value : std::vector<int>{6, 7, 9}) {
+    bloom_filter.insert(std::hash<int>{}(value));
+  }
+
+  filter_by_bloom_filter<int, int>(container, histograms, radix_bit_count, bloom_filter);
+
+  auto materialized_values = std::vector<int>{};
+  auto histogram_sum = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < container.size(); ++partition_idx) {
+    for (const auto& element : container[partition_idx].elements) {
+      materialized_values.emplace_back(element.value);
+    }
+    for (const auto count : histograms[partition_idx]) {
+      histogram_sum += count;
+    }
+  }
+
+  EXPECT_EQ(materialized_values, std::vector<int>({7, 7, 9, 6, 9, 7}));
+  EXPECT_EQ(histogram_sum, materialized_values.size());
+
+  // The partitioning works on the reduced input
+  const auto radix_container = partition_by_radix<int, int, false>(container, histograms, radix_bit_count);
+  auto partitioned_value_count = size_t{0};
+  for (const auto& partition : radix_container) {
+    partitioned_value_count += partition.elements.size();
+  }
+  EXPECT_EQ(partitioned_value_count, materialized_values.size());
+}
+
+TEST_F(JoinHashStepsTest, BloomFilterPassRate) {
+  // Filters that let most values pass are no longer used once enough values have been tested
+  auto pass_rate = BloomFilterPassRate{true};
+  pass_rate.add(BLOOM_FILTER_SAMPLE_SIZE / 2, BLOOM_FILTER_SAMPLE_SIZE / 2);
+  EXPECT_TRUE(pass_rate.is_used());
+  pass_rate.add(BLOOM_FILTER_SAMPLE_SIZE / 2, BLOOM_FILTER_SAMPLE_SIZE / 2);
+  EXPECT_FALSE(pass_rate.is_used());
+
+  auto selective_pass_rate = BloomFilterPassRate{true};
+  selective_pass_rate.add(BLOOM_FILTER_SAMPLE_SIZE * 2, BLOOM_FILTER_SAMPLE_SIZE / 10);
+  EXPECT_TRUE(selective_pass_rate.is_used());
+
+  EXPECT_FALSE(BloomFilterPassRate{false}.is_used());
+}
+
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   {
     std::vector<std::vector<size_t>> histograms;
@@ -308,9 +359,9 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   BloomFilter output_bloom_filter;              // Ignored in this test
 
   // Fill input_bloom_filter
-  BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+  auto input_bloom_filter = BloomFilter{100};
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    input_bloom_filter.insert(std::hash<int>{}(value));
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
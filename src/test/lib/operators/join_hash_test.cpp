@@ -108,6 +108,44 @@ TEST_F(OperatorsJoinHashTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillsWithSmallMemoryBudget) {
+  // Join on the first columns. For TPC-H, o_custkey != l_suppkey is used as a secondary predicate.
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto inputs =
+      std::vector<std::tuple<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>, ColumnIDPair>>{
+          {_table_tpch_orders, _table_tpch_lineitems, {ColumnID{1}, ColumnID{2}}},
+          {_table_tpch_lineitems_scanned, _table_tpch_orders_scanned, {ColumnID{2}, ColumnID{1}}},
+          {_table_with_nulls, _table_with_nulls, {ColumnID{1}, ColumnID{1}}}};
+
+  for (const auto& [left_input, right_input, secondary_column_ids] : inputs) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                            JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+      // With NULLs on the build side, AntiNullAsTrue returns an empty result before anything is spilled
+      if (mode == JoinMode::AntiNullAsTrue && right_input == _table_with_nulls) continue;
+
+      const auto predicates = mode == JoinMode::AntiNullAsTrue
+                                  ? std::vector<OperatorJoinPredicate>{}
+                                  : std::vector<OperatorJoinPredicate>{{secondary_column_ids,
+                                                                        PredicateCondition::NotEquals}};
+
+      const auto expected_join =
+          std::make_shared<JoinHash>(left_input, right_input, mode, primary_predicate, predicates, size_t{2});
+      expected_join->execute();
+
+      // The inputs are spilled while they are materialized, as the first chunk already exceeds the budget
+      const auto join =
+          std::make_shared<JoinHash>(left_input, right_input, mode, primary_predicate, predicates, size_t{2});
+      EXPECT_GT(execute_with_memory_budget(join, 64), 0);
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+
+      // Nothing is spilled if the materialized inputs and the hash tables fit into the budget
+      const auto join_within_budget =
+          std::make_shared<JoinHash>(left_input, right_input, mode, primary_predicate, predicates, size_t{2});
+      EXPECT_EQ(execute_with_memory_budget(join_within_budget, size_t{1} << 30), 0);
+    }
+  }
+}
+
 TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   // Simple cases: handle minimal inputs and very large inputs
   EXPECT_EQ(JoinHash::calculate_radix_bits<int>(1, 1), 0ul);
@@ -1,8 +1,11 @@
 #include "base_test.hpp"
 
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -14,6 +17,28 @@ class OperatorsJoinSortMergeTest : public BaseTest {
     dummy_input = std::make_shared<TableWrapper>(dummy_table);
   }
 
+  // The result of the JoinSortMerge has to match the one of the JoinNestedLoop
+  static void expect_same_result_as_nested_loop(const std::shared_ptr<const Table>& left_table,
+                                                const std::shared_ptr<const Table>& right_table,
+                                                const PredicateCondition predicate_condition) {
+    const auto left_input = std::make_shared<TableWrapper>(left_table);
+    const auto right_input = std::make_shared<TableWrapper>(right_table);
+    left_input->execute();
+    right_input->execute();
+
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::FullOuter}) {
+      if (predicate_condition == PredicateCondition::NotEquals && mode != JoinMode::Inner) continue;
+
+      const auto join_sort_merge = std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate);
+      const auto join_nested_loop = std::make_shared<JoinNestedLoop>(left_input, right_input, mode, primary_predicate);
+      join_sort_merge->execute();
+      join_nested_loop->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join_sort_merge->get_output(), join_nested_loop->get_output());
+    }
+  }
+
   std::shared_ptr<AbstractOperator> dummy_input;
 };
 
@@ -117,4 +142,72 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, IndividuallySortedInputs) {
+  // Chunks that are sorted by the join column are merged instead of being sorted again. Every other chunk is sorted in
+  // descending order. NULLs come first.
+  const auto create_sorted_table = [](const int32_t value_offset, const bool encode) {
+    auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+    for (auto chunk_id = int32_t{0}; chunk_id < 7; ++chunk_id) {
+      const auto descending = chunk_id % 2 == 1;
+      auto a_values = pmr_vector<int32_t>{0, 0};
+      auto a_nulls = pmr_vector<bool>{true, true};
+      auto b_values = pmr_vector<int32_t>{0, 1};
+      for (auto row = int32_t{2}; row < 50; ++row) {
+        a_values.emplace_back((descending ? 49 - row : row) * 3 + chunk_id + value_offset);
+        a_nulls.emplace_back(false);
+        b_values.emplace_back(row);
+      }
+
+      const auto chunk = std::make_shared<Chunk>(
+          Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values), std::move(a_nulls)),
+                   std::make_shared<ValueSegment<int32_t>>(std::move(b_values))});
+      chunk->finalize();
+      chunk->set_individually_sorted_by(
+          SortColumnDefinition(ColumnID{0}, descending ? SortMode::Descending : SortMode::Ascending));
+      chunks.emplace_back(chunk);
+    }
+
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}}, TableType::Data,
+        std::move(chunks));
+    if (encode) {
+      ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    }
+    return table;
+  };
+
+  for (const auto encode : {false, true}) {
+    const auto left_table = create_sorted_table(0, encode);
+    const auto right_table = create_sorted_table(7, encode);
+    for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan,
+                                           PredicateCondition::GreaterThanEquals, PredicateCondition::NotEquals}) {
+      expect_same_result_as_nested_loop(left_table, right_table, predicate_condition);
+      expect_same_result_as_nested_loop(to_simple_reference_table(left_table), right_table, predicate_condition);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, HistogramBasedRangeClustering) {
+  // Most values are 0, so that clusters chosen from the histograms are heavily skewed
+  const auto create_skewed_table = [](const int32_t row_count) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               ChunkOffset{40});
+    for (auto row = int32_t{0}; row < row_count; ++row) {
+      table->append({row % 4 == 0 ? row : 0});
+    }
+    table->last_chunk()->finalize();
+    table->set_table_statistics(TableStatistics::from_table(*table));
+    return table;
+  };
+
+  const auto left_table = create_skewed_table(200);
+  const auto right_table = create_skewed_table(160);
+  for (const auto predicate_condition : {PredicateCondition::LessThan, PredicateCondition::GreaterThan,
+                                         PredicateCondition::LessThanEquals, PredicateCondition::NotEquals}) {
+    expect_same_result_as_nested_loop(left_table, right_table, predicate_condition);
+    expect_same_result_as_nested_loop(to_simple_reference_table(left_table), to_simple_reference_table(right_table),
+                                      predicate_condition);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,86 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/runtime_filter.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class RuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto source_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 2);
+    source_table->append({1});
+    source_table->append({NullValue{}});
+    source_table->append({9});
+    source_table->append({5});
+    _source = std::make_shared<TableWrapper>(source_table);
+    _source->execute();
+
+    // The target has the chunks [20, 30], [1, 40], and [3, 4]
+    _target_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+    for (const auto value : {20, 30, 1, 40, 3, 4}) {
+      _target_table->append({value});
+    }
+    _target_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_target_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    generate_chunk_pruning_statistics(_target_table);
+  }
+
+  std::shared_ptr<TableWrapper> _source;
+  std::shared_ptr<Table> _target_table;
+};
+
+TEST_F(RuntimeFilterTest, Filter) {
+  auto runtime_filter = RuntimeFilter{_source, ColumnID{0}, ColumnID{0}};
+  runtime_filter.build();
+  EXPECT_EQ(runtime_filter.target_column_id(), ColumnID{0});
+
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{0, 1, 5, 7, 9, 10, 0},
+                                                               pmr_vector<bool>{false, false, false, false, false,
+                                                                                false, true});
+  auto matches = RowIDPosList{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+    matches.emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+
+  runtime_filter.filter(segment, matches);
+  const auto expected_matches = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}},
+                                             RowID{ChunkID{0}, ChunkOffset{4}}};
+  EXPECT_EQ(matches, expected_matches);
+}
+
+TEST_F(RuntimeFilterTest, CanPrune) {
+  auto runtime_filter = RuntimeFilter{_source, ColumnID{0}, ColumnID{0}};
+  runtime_filter.build();
+
+  // The first chunk is pruned based on its pruning statistics, the third one based on its dictionary
+  EXPECT_TRUE(runtime_filter.can_prune(*_target_table->get_chunk(ChunkID{0}), ColumnID{0}));
+  EXPECT_FALSE(runtime_filter.can_prune(*_target_table->get_chunk(ChunkID{1}), ColumnID{0}));
+  EXPECT_TRUE(runtime_filter.can_prune(*_target_table->get_chunk(ChunkID{2}), ColumnID{0}));
+}
+
+TEST_F(RuntimeFilterTest, SourceWithoutValues) {
+  const auto null_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 2);
+  null_table->append({NullValue{}});
+  const auto null_source = std::make_shared<TableWrapper>(null_table);
+  null_source->execute();
+
+  auto runtime_filter = RuntimeFilter{null_source, ColumnID{0}, ColumnID{0}};
+  runtime_filter.build();
+
+  EXPECT_TRUE(runtime_filter.can_prune(*_target_table->get_chunk(ChunkID{1}), ColumnID{0}));
+
+  auto matches = RowIDPosList{RowID{ChunkID{1}, ChunkOffset{0}}};
+  runtime_filter.filter(_target_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}), matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+}  // namespace opossum
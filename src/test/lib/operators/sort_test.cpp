@@ -70,6 +70,25 @@ TEST_P(SortTest, Sort) {
   }
 }
 
+TEST_P(SortTest, SortWithNormalizedKeys) {
+  const auto param = GetParam();
+  if (param.input_is_empty) return;
+
+  auto input = input_table_wrapper;
+  if (param.input_is_reference) {
+    // Sort a reference table (created by a scan that matches all rows) instead of the data table
+    input = std::make_shared<TableScan>(input, greater_than_equals_(1, 0));
+    input->execute();
+  }
+
+  auto sort = Sort{input, param.sort_columns, param.output_chunk_size, param.force_materialization,
+                   Sort::Strategy::NormalizedKeys};
+  sort.execute();
+
+  const auto expected_table = load_table(std::string{"resources/test_data/tbl/sort/"} + param.expected_filename);
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+}
+
 TEST_P(SortTest, UnchangedNullability) {
   const auto param = GetParam();
 
@@ -153,6 +172,62 @@ INSTANTIATE_TEST_SUITE_P(Variations, SortTest,
                          sort_test_formatter);
 // clang-format on
 
+TEST_F(SortTest, NormalizedKeysFallBackForLongStrings) {
+  // Keys wider than the maximum key width cannot be normalized, the operator has to sort column by column instead.
+  const auto long_string = pmr_string(200, 'x');
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data, 2);
+  table->append({long_string + "b"});
+  table->append({long_string + "a"});
+  table->append({pmr_string{"y"}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}, Chunk::DEFAULT_SIZE,
+                   Sort::ForceMaterialization::Yes, Sort::Strategy::NormalizedKeys};
+  sort.execute();
+
+  const auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data);
+  expected_table->append({long_string + "a"});
+  expected_table->append({long_string + "b"});
+  expected_table->append({pmr_string{"y"}});
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+}
+
+TEST_F(SortTest, SpillsWithSmallMemoryBudget) {
+  // The rows with equal keys have to keep their order, i.e., the spilled runs have to be merged stably
+  const auto lineitem_wrapper =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", 100));
+  lineitem_wrapper->execute();
+  const auto lineitem_scan = create_table_scan(lineitem_wrapper, ColumnID{4}, PredicateCondition::GreaterThan, 10);
+  lineitem_scan->execute();
+
+  const auto lineitem_sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{8}, SortMode::Ascending}, SortColumnDefinition{ColumnID{10}, SortMode::Descending},
+      SortColumnDefinition{ColumnID{5}, SortMode::Ascending}};
+  const auto input_sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}, SortMode::Descending}, SortColumnDefinition{ColumnID{1}, SortMode::Ascending}};
+
+  const auto inputs = std::vector<std::pair<std::shared_ptr<AbstractOperator>, std::vector<SortColumnDefinition>>>{
+      {lineitem_wrapper, lineitem_sort_definitions},
+      {lineitem_scan, lineitem_sort_definitions},
+      {input_table_wrapper, input_sort_definitions}};
+
+  for (const auto& [input, sort_definitions] : inputs) {
+    for (const auto strategy : {Sort::Strategy::ColumnByColumn, Sort::Strategy::NormalizedKeys}) {
+      auto expected_sort = Sort{input, sort_definitions, Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No};
+      expected_sort.execute();
+
+      const auto sort = std::make_shared<Sort>(input, sort_definitions, Chunk::DEFAULT_SIZE,
+                                               Sort::ForceMaterialization::No, strategy);
+      EXPECT_GT(execute_with_memory_budget(sort, 64), 0);
+      EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_sort.get_output());
+    }
+  }
+}
+
 TEST_F(SortTest, JoinProducesReferences) {
   // Even though not all columns in a join result refer to the same table, the output should use references
   const auto right_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int3.tbl"));
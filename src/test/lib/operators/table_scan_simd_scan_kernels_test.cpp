@@ -0,0 +1,92 @@
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/table_scan/simd_scan_kernels.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+template <typename T>
+class OperatorsTableScanSimdScanKernelsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_kernel = simd_scan_kernel();
+
+    // Sizes that are no multiple of 64 exercise the scalar tails of the SIMD kernels
+    _values.resize(1000);
+    for (auto index = size_t{0}; index < _values.size(); ++index) {
+      _values[index] = static_cast<T>((index * 7919) % 97);
+    }
+    _values[10] = std::numeric_limits<T>::min();
+    _values[11] = std::numeric_limits<T>::max();
+    if constexpr (std::is_floating_point_v<T>) {
+      _values[12] = std::numeric_limits<T>::quiet_NaN();
+    }
+  }
+
+  void TearDown() override { set_simd_scan_kernel(_previous_kernel); }
+
+  static bool _compare(const PredicateCondition predicate_condition, const T value, const T search_value) {
+    auto result = false;
+    with_comparator(predicate_condition, [&](auto comparator) { result = comparator(value, search_value); });
+    return result;
+  }
+
+  // Compares the bitmap and the RowIDs produced by kernel with a plain comparison for a prefix of _values
+  void _check(const SimdScanKernel kernel, const size_t size, const PredicateCondition predicate_condition,
+              const T search_value, const std::optional<T> excluded_value) {
+    set_simd_scan_kernel(kernel);
+
+    auto bitmap = std::vector<uint64_t>(simd_scan_bitmap_word_count(size));
+    scan_to_bitmap(_values.data(), size, predicate_condition, search_value, excluded_value, bitmap.data());
+
+    auto matches = RowIDPosList{};
+    matches.emplace_back(RowID{ChunkID{0}, ChunkOffset{0}});
+    append_bitmap_matches(bitmap.data(), size, ChunkID{1}, matches);
+
+    auto expected_matches = RowIDPosList{};
+    expected_matches.emplace_back(RowID{ChunkID{0}, ChunkOffset{0}});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      const auto value = _values[chunk_offset];
+      if (_compare(predicate_condition, value, search_value) && (!excluded_value || value != *excluded_value)) {
+        expected_matches.emplace_back(RowID{ChunkID{1}, chunk_offset});
+      }
+    }
+
+    EXPECT_EQ(matches, expected_matches) << "Kernel " << kernel << ", size " << size << ", " << predicate_condition;
+  }
+
+  SimdScanKernel _previous_kernel{};
+  std::vector<T> _values;
+};
+
+using SimdScanKernelTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(OperatorsTableScanSimdScanKernelsTest, SimdScanKernelTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(OperatorsTableScanSimdScanKernelsTest, MatchesScalarComparison) {
+  for (const auto kernel : {SimdScanKernel::Scalar, SimdScanKernel::AVX2, SimdScanKernel::AVX512}) {
+    if (!simd_scan_kernel_supported(kernel)) continue;
+
+    for (const auto predicate_condition :
+         {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+          PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+      for (const auto size : {size_t{0}, size_t{1}, size_t{63}, size_t{64}, size_t{130}, size_t{1000}}) {
+        for (const auto search_value : {TypeParam{0}, TypeParam{42}, std::numeric_limits<TypeParam>::max()}) {
+          this->_check(kernel, size, predicate_condition, search_value, std::nullopt);
+          this->_check(kernel, size, predicate_condition, search_value, TypeParam{96});
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(OperatorsTableScanSimdScanKernelsTest, ScalarKernelIsAlwaysSupported) {
+  EXPECT_TRUE(simd_scan_kernel_supported(SimdScanKernel::Scalar));
+  EXPECT_TRUE(simd_scan_kernel_supported(simd_scan_kernel()));
+}
+
+}  // namespace opossum
@@ -22,6 +22,7 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -890,6 +891,53 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksWithParameters) {
+  // The chunks contain [1, 2], [3, 4], and [5, 6]
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  for (const auto value : {1, 2, 3, 4, 5, 6}) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto chunks_pruned_at_runtime = [](const auto& scan) {
+    return static_cast<const TableScan::PerformanceData&>(*scan->performance_data).chunks_pruned_at_runtime;
+  };
+
+  {
+    const auto scan =
+        std::make_shared<TableScan>(table_wrapper, equals_(column, correlated_parameter_(ParameterID{0}, column)));
+    scan->set_parameters({{ParameterID{0}, AllTypeVariant{3}}});
+    scan->execute();
+    EXPECT_EQ(chunks_pruned_at_runtime(scan), 2u);
+    ASSERT_EQ(scan->get_output()->row_count(), 1u);
+    EXPECT_EQ(scan->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 3);
+  }
+
+  {
+    const auto scan = std::make_shared<TableScan>(
+        table_wrapper, between_inclusive_(column, correlated_parameter_(ParameterID{0}, column),
+                                          correlated_parameter_(ParameterID{1}, column)));
+    scan->set_parameters({{ParameterID{0}, AllTypeVariant{2}}, {ParameterID{1}, AllTypeVariant{3}}});
+    scan->execute();
+    EXPECT_EQ(chunks_pruned_at_runtime(scan), 1u);
+    EXPECT_EQ(scan->get_output()->row_count(), 2u);
+  }
+
+  {
+    // Values known when the query is optimized are left to the ChunkPruningRule
+    const auto scan = std::make_shared<TableScan>(table_wrapper, equals_(column, 3));
+    scan->execute();
+    EXPECT_EQ(chunks_pruned_at_runtime(scan), 0u);
+    EXPECT_EQ(scan->get_output()->row_count(), 1u);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
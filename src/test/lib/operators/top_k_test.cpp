@@ -0,0 +1,137 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ public:
+  static void SetUpTestCase() {
+    input_table = load_table("resources/test_data/tbl/sort/input.tbl", 20);
+    input_table_wrapper = std::make_shared<TableWrapper>(input_table);
+    input_table_wrapper->execute();
+  }
+
+ protected:
+  // TopK has to produce the same result as a (stable) Sort followed by a Limit
+  void test_top_k(const std::shared_ptr<AbstractOperator>& input,
+                  const std::vector<SortColumnDefinition>& sort_definitions, const int64_t row_count) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, to_expression(row_count));
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, to_expression(row_count));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+    EXPECT_EQ(top_k->get_output()->type(), TableType::Data);
+  }
+
+  static inline std::shared_ptr<Table> input_table;
+  static inline std::shared_ptr<AbstractOperator> input_table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, SingleColumn) {
+  for (const auto row_count : {int64_t{0}, int64_t{1}, int64_t{5}, int64_t{30}, int64_t{100}}) {
+    test_top_k(input_table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}, row_count);
+    test_top_k(input_table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}}, row_count);
+  }
+}
+
+TEST_F(OperatorsTopKTest, NullsFirst) {
+  for (const auto row_count : {int64_t{1}, int64_t{5}, int64_t{30}}) {
+    test_top_k(input_table_wrapper, {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}}, row_count);
+    test_top_k(input_table_wrapper, {SortColumnDefinition{ColumnID{1}, SortMode::Descending}}, row_count);
+  }
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumns) {
+  for (const auto row_count : {int64_t{1}, int64_t{7}, int64_t{30}}) {
+    test_top_k(input_table_wrapper,
+               {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+               row_count);
+    test_top_k(input_table_wrapper,
+               {SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                SortColumnDefinition{ColumnID{2}, SortMode::Ascending}},
+               row_count);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto column_a = get_column_expression(input_table_wrapper, ColumnID{0});
+  const auto table_scan = std::make_shared<TableScan>(input_table_wrapper, greater_than_(column_a, 10));
+  table_scan->execute();
+
+  test_top_k(table_scan,
+             {SortColumnDefinition{ColumnID{2}, SortMode::Descending},
+              SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+             10);
+}
+
+TEST_F(OperatorsTopKTest, EmptyInput) {
+  const auto empty_table_wrapper =
+      std::make_shared<TableWrapper>(Table::create_dummy_table(input_table->column_definitions()));
+  empty_table_wrapper->execute();
+
+  const auto top_k = std::make_shared<TopK>(empty_table_wrapper,
+                                            std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+                                            to_expression(int64_t{10}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), input_table->column_definitions());
+}
+
+TEST_F(OperatorsTopKTest, SkipChunksUsingPruningStatistics) {
+  // The values of the column are ascending across chunks. Once the first chunk has found two candidates, all other
+  // chunks can be skipped for an ascending TopK.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 3);
+  for (auto value = int32_t{0}; value < 12; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_k = std::make_shared<TopK>(table_wrapper,
+                                            std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+                                            to_expression(int64_t{2}));
+  top_k->execute();
+
+  const auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  expected_table->append({int32_t{0}});
+  expected_table->append({int32_t{1}});
+  EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), expected_table);
+
+  // With the ImmediateExecutionScheduler, the chunks are processed in order
+  const auto& performance_data = static_cast<const TopK::PerformanceData&>(*top_k->performance_data);
+  EXPECT_EQ(performance_data.chunks_skipped, 3);
+}
+
+TEST_F(OperatorsTopKTest, DeepCopy) {
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper,
+                                            std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+                                            to_expression(int64_t{3}));
+  const auto copy = std::dynamic_pointer_cast<TopK>(top_k->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->sort_definitions(), top_k->sort_definitions());
+  EXPECT_EQ(*copy->row_count_expression(), *top_k->row_count_expression());
+}
+
+}  // namespace opossum
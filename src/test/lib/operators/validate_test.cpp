@@ -15,6 +15,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -107,6 +108,30 @@ TEST_F(OperatorsValidateTest, ScanValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, PipelinedScanValidate) {
+  Hyrise::get().enable_pipelining = true;
+  auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+
+  std::shared_ptr<Table> expected_result =
+      load_table("resources/test_data/tbl/validate_output_validated_scanned.tbl", 2u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_test_table);
+  auto a = PQPColumnExpression::from_table(*_test_table, "a");
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 2));
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context_recursively(context);
+
+  // The TableScan is executed as part of the Validate's task
+  const auto tasks = OperatorTask::make_tasks_from_operator(validate);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_TRUE(table_scan->is_pipelined);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+  EXPECT_TRUE(table_scan->performance_data->executed);
+  EXPECT_EQ(table_scan->get_output(), nullptr);
+}
+
 TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   auto t1_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
 
@@ -8,6 +8,7 @@
 #include "logical_query_plan/union_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimator.hpp"
 #include "statistics/table_statistics.hpp"
@@ -240,4 +241,86 @@ TEST_F(DpCcpTest, UncorrelatedPredicates) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(DpCcpTest, Budgets) {
+  /**
+   * Test that no plan is returned if one of the budgets is exceeded. The triangle has six CsgCmpPairs.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  EXPECT_FALSE(DpCcp(std::nullopt, size_t{5})(join_graph, cost_estimator));
+  EXPECT_FALSE(DpCcp(std::chrono::microseconds{0})(join_graph, cost_estimator));
+
+  const auto actual_lqp = DpCcp(std::chrono::seconds{60}, size_t{6})(join_graph, cost_estimator);
+  const auto expected_lqp = DpCcp{}(join_graph, cost_estimator);  // NOLINT
+  ASSERT_TRUE(actual_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DpCcpTest, MultiThreaded) {
+  /**
+   * Test that the levels with many CsgCmpPairs, which are planned by parallel jobs, lead to a plan as cheap as the
+   * sequentially planned one. A clique of eight vertices has 490 CsgCmpPairs that join four vertices.
+   */
+
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  for (auto vertex_idx = 0; vertex_idx < 8; ++vertex_idx) {
+    const auto row_count = 100 + 37 * vertex_idx;
+    const auto node = create_mock_node_with_statistics(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count,
+        {GenericHistogram<int32_t>::with_single_bin(vertex_idx * 5, 100 + vertex_idx * 11, row_count, 20)});
+    vertices.emplace_back(node);
+    columns.emplace_back(node->get_column("a"));
+  }
+
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (auto left_idx = size_t{0}; left_idx < vertices.size(); ++left_idx) {
+    for (auto right_idx = left_idx + 1; right_idx < vertices.size(); ++right_idx) {
+      auto vertex_set = JoinGraphVertexSet{vertices.size()};
+      vertex_set.set(left_idx);
+      vertex_set.set(right_idx);
+      edges.emplace_back(vertex_set, expression_vector(equals_(columns[left_idx], columns[right_idx])));
+    }
+  }
+
+  const auto join_graph = JoinGraph(vertices, edges);
+
+  // Use the caches like the JoinOrderingRule does
+  const auto caching_cost_estimator = [&]() {
+    const auto new_cost_estimator = cost_estimator->new_instance();
+    new_cost_estimator->guarantee_bottom_up_construction();
+    new_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+    return new_cost_estimator;
+  };
+
+  const auto sequential_lqp = DpCcp{}(join_graph, caching_cost_estimator());  // NOLINT
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  const auto scheduler = Hyrise::get().scheduler();
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  const auto multi_threaded_lqp = DpCcp{}(join_graph, caching_cost_estimator());  // NOLINT
+  Hyrise::get().set_scheduler(scheduler);
+
+  ASSERT_TRUE(multi_threaded_lqp);
+  const auto sequential_cost = cost_estimator->estimate_plan_cost(sequential_lqp);
+  EXPECT_NEAR(cost_estimator->estimate_plan_cost(multi_threaded_lqp), sequential_cost, sequential_cost * 1e-4);
+
+  // The jobs built the candidates with detached inputs. The nodes of the chosen plan have to be attached.
+  visit_lqp(multi_threaded_lqp, [&](const auto& node) {
+    EXPECT_FALSE(node->has_detached_inputs());
+    for (const auto& input : {node->left_input(), node->right_input()}) {
+      if (!input) continue;
+      const auto outputs = input->outputs();
+      EXPECT_NE(std::find(outputs.begin(), outputs.end(), node), outputs.end());
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
 }  // namespace opossum
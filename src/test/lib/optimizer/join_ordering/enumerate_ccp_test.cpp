@@ -164,4 +164,26 @@ TEST_F(EnumerateCcpTest, ArbitraryVertexNumbering) {
   EXPECT_TRUE(equals(pairs[3], std::make_pair(0b101ul, 0b010ul)));
 }
 
+TEST_F(EnumerateCcpTest, MaxCsgCmpPairCount) {
+  std::vector<std::pair<size_t, size_t>> edges{{0, 1}, {1, 2}, {2, 3}};
+
+  auto enumerate_ccp_within_limit = EnumerateCcp{4, edges, 10};
+  EXPECT_EQ(enumerate_ccp_within_limit().size(), 10u);
+  EXPECT_FALSE(enumerate_ccp_within_limit.limit_exceeded());
+
+  // The enumeration is stopped early and returns a prefix of the CsgCmpPairs
+  auto enumerate_ccp_exceeding_limit = EnumerateCcp{4, edges, 5};
+  const auto pairs = enumerate_ccp_exceeding_limit();
+  EXPECT_TRUE(enumerate_ccp_exceeding_limit.limit_exceeded());
+  ASSERT_GT(pairs.size(), 5u);
+  ASSERT_LT(pairs.size(), 10u);
+
+  EXPECT_TRUE(equals(pairs[0], std::make_pair(0b0100ul, 0b1000ul)));
+  EXPECT_TRUE(equals(pairs[1], std::make_pair(0b0010ul, 0b0100ul)));
+  EXPECT_TRUE(equals(pairs[2], std::make_pair(0b0010ul, 0b1100ul)));
+  EXPECT_TRUE(equals(pairs[3], std::make_pair(0b0110ul, 0b1000ul)));
+  EXPECT_TRUE(equals(pairs[4], std::make_pair(0b0001ul, 0b0010ul)));
+  EXPECT_TRUE(equals(pairs[5], std::make_pair(0b0001ul, 0b0110ul)));
+}
+
 }  // namespace opossum
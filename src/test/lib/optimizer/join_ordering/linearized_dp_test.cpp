@@ -0,0 +1,114 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    // All columns have the same statistics, only Table row counts differ
+    const auto single_bin_histogram_a = GenericHistogram<int32_t>::with_single_bin(0, 100, 5'000, 100);
+    const auto single_bin_histogram_b = GenericHistogram<int32_t>::with_single_bin(0, 100, 1'000, 100);
+    const auto single_bin_histogram_c = GenericHistogram<int32_t>::with_single_bin(0, 100, 200, 100);
+    const auto single_bin_histogram_d = GenericHistogram<int32_t>::with_single_bin(0, 100, 500, 100);
+
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a_a"}}, 5'000,
+                                              {single_bin_histogram_a});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "b_a"}}, 1'000,
+                                              {single_bin_histogram_b});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "c_a"}}, 200,
+                                              {single_bin_histogram_c});
+    node_d = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "d_a"}}, 500,
+                                              {single_bin_histogram_d});
+
+    a_a = node_a->get_column("a_a");
+    b_a = node_b->get_column("b_a");
+    c_a = node_c->get_column("c_a");
+    d_a = node_d->get_column("d_a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a, d_a;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+};
+
+TEST_F(LinearizedDpTest, NoEdges) {
+  const auto join_graph =
+      JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a}, std::vector<JoinGraphEdge>{}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  const auto expected_lqp = node_a->deep_copy();
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LinearizedDpTest, LocalAndUncorrelatedPredicates) {
+  // Test that the predicates that do not join two vertices are placed as by DpCcp
+
+  const auto edge_uncorrelated = JoinGraphEdge{JoinGraphVertexSet{2, 0b00}, expression_vector(equals_(6, 6))};
+  const auto edge_b = JoinGraphEdge{JoinGraphVertexSet{2, 0b10}, expression_vector(greater_than_(b_a, 50))};
+  const auto edge_ab = JoinGraphEdge{JoinGraphVertexSet{2, 0b11}, expression_vector(equals_(a_a, b_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b},
+                                    std::vector<JoinGraphEdge>{edge_uncorrelated, edge_b, edge_ab}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  const auto expected_lqp = DpCcp{}(join_graph, cost_estimator);      // NOLINT
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LinearizedDpTest, ChainQuery) {
+  // The chain starts with the smallest vertex, so that the linear order follows the chain. Then, the consecutive ranges
+  // of the linear order are all connected subgraphs and LinearizedDp finds a plan as cheap as the one by DpCcp.
+
+  const auto edge_cb = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(c_a, b_a))};
+  const auto edge_ba = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(b_a, a_a))};
+  const auto edge_ad = JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(a_a, d_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b, node_c, node_d},
+                                    std::vector<JoinGraphEdge>{edge_cb, edge_ba, edge_ad}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  const auto optimal_lqp = DpCcp{}(join_graph, cost_estimator);        // NOLINT
+
+  EXPECT_FLOAT_EQ(cost_estimator->estimate_plan_cost(actual_lqp), cost_estimator->estimate_plan_cost(optimal_lqp));
+}
+
+TEST_F(LinearizedDpTest, StarQuery) {
+  // The vertices are ordered as c, a, d, b. The left-deep plan for this order, which GOO finds, is part of the search
+  // space, so that the plan is at least as cheap as GOO's plan.
+
+  const auto edge_ab = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto edge_ac = JoinGraphEdge{JoinGraphVertexSet{4, 0b0101}, expression_vector(equals_(a_a, c_a))};
+  const auto edge_ad = JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(a_a, d_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b, node_c, node_d},
+                                    std::vector<JoinGraphEdge>{edge_ab, edge_ac, edge_ad}};
+
+  const auto actual_cost = cost_estimator->estimate_plan_cost(LinearizedDp{}(join_graph, cost_estimator));  // NOLINT
+  const auto optimal_cost = cost_estimator->estimate_plan_cost(DpCcp{}(join_graph, cost_estimator));  // NOLINT
+  const auto greedy_cost =
+      cost_estimator->estimate_plan_cost(GreedyOperatorOrdering{}(join_graph, cost_estimator));  // NOLINT
+
+  EXPECT_LE(optimal_cost, actual_cost);
+  EXPECT_LE(actual_cost, greedy_cost);
+}
+
+}  // namespace opossum
@@ -59,6 +59,11 @@ class ChunkPruningRuleTest : public StrategyBaseTest {
     ChunkEncoder::encode_all_chunks(int_float4, SegmentEncodingSpec{EncodingType::Dictionary});
     storage_manager.add_table("int_float4", int_float4);
 
+    auto string_bloom_filtered_table = load_table("resources/test_data/tbl/string.tbl", 3u);
+    ChunkEncoder::encode_all_chunks(string_bloom_filtered_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    string_bloom_filtered_table->set_pruning_statistics_config(ColumnID{0}, PruningStatisticsConfig{10.0f, 0});
+    storage_manager.add_table("string_bloom_filtered", string_bloom_filtered_table);
+
     for (const auto& [name, table] : storage_manager.tables()) {
       generate_chunk_pruning_statistics(table);
     }
@@ -372,6 +377,55 @@ TEST_F(ChunkPruningRuleTest, FixedStringPruningTest) {
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, BloomFilterPruningTest) {
+  // Both chunks' value ranges ([www, yyy] and [ttt, zzz]) contain "xyz" and "www". Only the Bloom filters show that
+  // the values are not in the chunks.
+  auto stored_table_node = std::make_shared<StoredTableNode>("string_bloom_filtered");
+  auto predicate_node = PredicateNode::make(equals_(lqp_column_(stored_table_node, ColumnID{0}), "xyz"),
+                                            stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>({ChunkID{0}, ChunkID{1}}));
+
+  stored_table_node = std::make_shared<StoredTableNode>("string_bloom_filtered");
+  predicate_node = PredicateNode::make(equals_(lqp_column_(stored_table_node, ColumnID{0}), "www"), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>({ChunkID{1}}));
+
+  // Without Bloom filters, nothing can be pruned
+  stored_table_node = std::make_shared<StoredTableNode>("string_compressed");
+  predicate_node = PredicateNode::make(equals_(lqp_column_(stored_table_node, ColumnID{0}), "xyz"), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_TRUE(stored_table_node->pruned_chunk_ids().empty());
+}
+
+TEST_F(ChunkPruningRuleTest, InPruningTest) {
+  auto stored_table_node = std::make_shared<StoredTableNode>("string_compressed");
+  auto column = lqp_column_(stored_table_node, ColumnID{0});
+  auto predicate_node = PredicateNode::make(in_(column, list_("aaa", "vvv")), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>({ChunkID{0}}));
+
+  // A chunk is only pruned if none of the values is contained
+  stored_table_node = std::make_shared<StoredTableNode>("string_bloom_filtered");
+  column = lqp_column_(stored_table_node, ColumnID{0});
+  predicate_node = PredicateNode::make(in_(column, list_("www", "vvv", null_())), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>({ChunkID{1}}));
+
+  stored_table_node = std::make_shared<StoredTableNode>("string_bloom_filtered");
+  column = lqp_column_(stored_table_node, ColumnID{0});
+  predicate_node = PredicateNode::make(in_(column, list_("www", "uuu")), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_TRUE(stored_table_node->pruned_chunk_ids().empty());
+
+  // NOT IN cannot be pruned
+  stored_table_node = std::make_shared<StoredTableNode>("string_bloom_filtered");
+  column = lqp_column_(stored_table_node, ColumnID{0});
+  predicate_node = PredicateNode::make(not_in_(column, list_("xyz", "vvv")), stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+  EXPECT_TRUE(stored_table_node->pruned_chunk_ids().empty());
+}
+
 TEST_F(ChunkPruningRuleTest, PrunePastNonFilteringNodes) {
   auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
 
@@ -20,6 +20,7 @@
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/get_table.hpp"
 #include "optimizer/strategy/dips_pruning_rule.hpp"
+#include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -42,9 +43,11 @@ class DipsPruningRuleTestClass : DipsPruningRule {
     template<typename COLUMN_TYPE>
     std::set<ChunkID> calculate_pruned_chunks(
       std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> base_chunk_ranges,
-      std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> partner_chunk_ranges
+      std::map<ChunkID, std::vector<std::pair<COLUMN_TYPE, COLUMN_TYPE>>> partner_chunk_ranges,
+      const PredicateCondition predicate_condition = PredicateCondition::Equals
     ) const {
-        return DipsPruningRule::calculate_pruned_chunks<COLUMN_TYPE>(base_chunk_ranges, partner_chunk_ranges);
+        return DipsPruningRule::calculate_pruned_chunks<COLUMN_TYPE>(base_chunk_ranges, partner_chunk_ranges,
+                                                                     predicate_condition);
     }
 };
 
@@ -61,6 +64,18 @@ class DipsPruningRuleTest : public StrategyBaseTest{
     ChunkEncoder::encode_all_chunks(join_target_table, SegmentEncodingSpec{EncodingType::Dictionary});
     storage_manager.add_table("join_target", join_target_table);
 
+    auto join_other_table = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2u);
+    ChunkEncoder::encode_all_chunks(join_other_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    storage_manager.add_table("join_other", join_other_table);
+
+    auto string_table = load_table("resources/test_data/tbl/string.tbl", 2u);
+    ChunkEncoder::encode_all_chunks(string_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    storage_manager.add_table("string", string_table);
+
+    auto string_target_table = load_table("resources/test_data/tbl/string.tbl", 3u);
+    ChunkEncoder::encode_all_chunks(string_target_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    storage_manager.add_table("string_target", string_target_table);
+
     _real_rule = std::make_shared<DipsPruningRule>();
     _rule = std::make_shared<DipsPruningRuleTestClass>();
 
@@ -180,6 +195,32 @@ TEST_F(DipsPruningRuleTest, CalculatePrunedChunks) {
   EXPECT_TRUE((pruned_chunks == expected_pruned_chunk_ids));
 }
 
+TEST_F(DipsPruningRuleTest, CalculatePrunedChunksNonEqui) {
+  std::map<ChunkID, std::vector<std::pair<int32_t, int32_t>>> base_ranges{
+    {ChunkID{0}, std::vector{std::pair<int32_t, int32_t>(1, 5)}},
+    {ChunkID{1}, std::vector{std::pair<int32_t, int32_t>(8, 10)}}
+  };
+  std::map<ChunkID, std::vector<std::pair<int32_t, int32_t>>> partner_ranges{
+    {ChunkID{0}, std::vector{std::pair<int32_t, int32_t>(0, 1)}},
+    {ChunkID{1}, std::vector{std::pair<int32_t, int32_t>(6, 7)}},
+    {ChunkID{2}, std::vector{std::pair<int32_t, int32_t>(10, 16)}},
+    {ChunkID{3}, std::vector<std::pair<int32_t, int32_t>>{}}
+  };
+
+  // A chunk without ranges contains only NULLs, which never find a join partner
+  EXPECT_EQ(_rule->calculate_pruned_chunks<int32_t>(base_ranges, partner_ranges, PredicateCondition::LessThan),
+            (std::set<ChunkID>{ChunkID{2}, ChunkID{3}}));
+  EXPECT_EQ(_rule->calculate_pruned_chunks<int32_t>(base_ranges, partner_ranges, PredicateCondition::LessThanEquals),
+            (std::set<ChunkID>{ChunkID{3}}));
+  EXPECT_EQ(_rule->calculate_pruned_chunks<int32_t>(base_ranges, partner_ranges, PredicateCondition::GreaterThan),
+            (std::set<ChunkID>{ChunkID{0}, ChunkID{3}}));
+  EXPECT_EQ(_rule->calculate_pruned_chunks<int32_t>(base_ranges, partner_ranges,
+                                                    PredicateCondition::GreaterThanEquals),
+            (std::set<ChunkID>{ChunkID{3}}));
+  EXPECT_EQ(_rule->calculate_pruned_chunks<int32_t>(base_ranges, partner_ranges, PredicateCondition::NotEquals),
+            (std::set<ChunkID>{ChunkID{3}}));
+}
+
 
 TEST_F(DipsPruningRuleTest, ApplyPruningSimple) {
   // LEFT -> RIGHT
@@ -218,4 +259,144 @@ TEST_F(DipsPruningRuleTest, ApplyPruningSimple) {
     
 }
 
+TEST_F(DipsPruningRuleTest, PropagateThroughJoinGraph) {
+  // join_target (pruned to 12345) -> join -> join_other, the pruned chunks are propagated over two joins
+  const auto join_target_node = StoredTableNode::make("join_target");
+  const auto join_node = StoredTableNode::make("join");
+  const auto join_other_node = StoredTableNode::make("join_other");
+  join_target_node->set_pruned_chunk_ids({ChunkID{1}});
+
+  const auto join_target_a = join_target_node->get_column("a");
+  const auto join_a = join_node->get_column("a");
+  const auto join_other_a = join_other_node->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(join_a, join_other_a),
+    JoinNode::make(JoinMode::Inner, equals_(join_target_a, join_a),
+      join_target_node,
+      join_node),
+    join_other_node);
+  // clang-format on
+
+  StrategyBaseTest::apply_rule(_real_rule, lqp);
+
+  const auto expected_pruned_chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{2}, ChunkID{3}};
+  EXPECT_EQ(join_node->pruned_chunk_ids(), expected_pruned_chunk_ids);
+  EXPECT_EQ(join_other_node->pruned_chunk_ids(), expected_pruned_chunk_ids);
+  EXPECT_EQ(join_other_node->join_pruned_chunk_count, size_t{3});
+  EXPECT_EQ(join_other_node->description(),
+            "[StoredTable] Name: 'join_other' pruned: 3/4 chunk(s) (3 without join partners), 0/2 column(s)");
+
+  // The other way around, chunks pruned in join_other are propagated to join_target
+  const auto join_target_node_2 = StoredTableNode::make("join_target");
+  const auto join_node_2 = StoredTableNode::make("join");
+  const auto join_other_node_2 = StoredTableNode::make("join_other");
+  join_other_node_2->set_pruned_chunk_ids({ChunkID{0}, ChunkID{2}, ChunkID{3}});
+
+  // clang-format off
+  const auto lqp_2 =
+  JoinNode::make(JoinMode::Inner, equals_(join_node_2->get_column("a"), join_other_node_2->get_column("a")),
+    JoinNode::make(JoinMode::Inner, equals_(join_target_node_2->get_column("a"), join_node_2->get_column("a")),
+      join_target_node_2,
+      join_node_2),
+    join_other_node_2);
+  // clang-format on
+
+  StrategyBaseTest::apply_rule(_real_rule, lqp_2);
+
+  EXPECT_EQ(join_node_2->pruned_chunk_ids(), expected_pruned_chunk_ids);
+  EXPECT_EQ(join_target_node_2->pruned_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+}
+
+TEST_F(DipsPruningRuleTest, NonEquiJoinPredicate) {
+  const auto join_target_node = StoredTableNode::make("join_target");
+  const auto join_node = StoredTableNode::make("join");
+  join_target_node->set_pruned_chunk_ids({ChunkID{1}});
+
+  // Only rows of join with a value below 12345 can find a join partner
+  const auto lqp = JoinNode::make(JoinMode::Inner, less_than_(join_node->get_column("a"),
+                                                              join_target_node->get_column("a")),
+                                  join_node, join_target_node);
+
+  StrategyBaseTest::apply_rule(_real_rule, lqp);
+
+  EXPECT_EQ(join_node->pruned_chunk_ids(), (std::vector<ChunkID>{ChunkID{1}, ChunkID{2}, ChunkID{3}}));
+  EXPECT_EQ(join_target_node->pruned_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+}
+
+TEST_F(DipsPruningRuleTest, DoNotPrunePreservedSide) {
+  const auto join_target_node = StoredTableNode::make("join_target");
+  const auto join_node = StoredTableNode::make("join");
+  join_target_node->set_pruned_chunk_ids({ChunkID{1}});
+
+  // The rows of join are part of the result of the outer join even if they have no join partner
+  const auto lqp = JoinNode::make(JoinMode::Left,
+                                  equals_(join_node->get_column("a"), join_target_node->get_column("a")), join_node,
+                                  join_target_node);
+  StrategyBaseTest::apply_rule(_real_rule, lqp);
+  EXPECT_TRUE(join_node->pruned_chunk_ids().empty());
+
+  // If join_target has another output, its pruned chunks do not apply to the join
+  const auto join_node_2 = StoredTableNode::make("join");
+  const auto join_target_node_2 = StoredTableNode::make("join_target");
+  join_target_node_2->set_pruned_chunk_ids({ChunkID{1}});
+  const auto join_target_predicate_node = PredicateNode::make(greater_than_(join_target_node_2->get_column("a"), 0),
+                                                              join_target_node_2);
+
+  // clang-format off
+  const auto lqp_2 =
+  JoinNode::make(JoinMode::Cross,
+    JoinNode::make(JoinMode::Inner, equals_(join_node_2->get_column("a"), join_target_node_2->get_column("a")),
+      join_node_2,
+      join_target_node_2),
+    join_target_predicate_node);
+  // clang-format on
+
+  StrategyBaseTest::apply_rule(_real_rule, lqp_2);
+  EXPECT_TRUE(join_node_2->pruned_chunk_ids().empty());
+}
+
+TEST_F(DipsPruningRuleTest, PruneWithHistogramBins) {
+  // Chunk 0 of string_target contains www, xxx, and yyy, which lie within the min/max range [ttt, zzz] of the not
+  // pruned chunk of string, but not within any of its two histogram bins.
+  const auto string_node = StoredTableNode::make("string");
+  const auto string_target_node = StoredTableNode::make("string_target");
+  string_node->set_pruned_chunk_ids({ChunkID{0}, ChunkID{1}});
+
+  const auto lqp = JoinNode::make(JoinMode::Inner, equals_(string_node->get_column("a"),
+                                                           string_target_node->get_column("a")),
+                                  string_node, string_target_node);
+  StrategyBaseTest::apply_rule(_real_rule, lqp);
+  EXPECT_TRUE(string_target_node->pruned_chunk_ids().empty());
+
+  const auto string_table = Hyrise::get().storage_manager.get_table("string");
+  string_table->set_pruning_statistics_config(ColumnID{0}, PruningStatisticsConfig{0.0f, 0, 2});
+  generate_chunk_pruning_statistics(string_table);
+
+  StrategyBaseTest::apply_rule(_real_rule, lqp);
+  EXPECT_EQ(string_target_node->pruned_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+}
+
+TEST_F(DipsPruningRuleTest, NoHistogramBinsForStringsOutsideOfDomain) {
+  // Histograms only support printable ASCII characters. Segments with other characters keep only their MinMaxFilter.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data, 3);
+  table->append({pmr_string{"abc"}});
+  table->append({pmr_string{"k\xc3\xa4se"}});
+  table->append({pmr_string{"line\nbreak"}});
+  table->last_chunk()->finalize();
+  table->set_pruning_statistics_config(ColumnID{0}, PruningStatisticsConfig{0.0f, 0, 2});
+
+  EXPECT_NO_THROW(generate_chunk_pruning_statistics(table));
+
+  const auto& pruning_statistics = table->get_chunk(ChunkID{0})->pruning_statistics();
+  ASSERT_TRUE(pruning_statistics);
+  const auto segment_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<pmr_string>>(pruning_statistics->at(ColumnID{0}));
+  ASSERT_TRUE(segment_statistics);
+  EXPECT_FALSE(segment_statistics->histogram);
+  EXPECT_TRUE(segment_statistics->min_max_filter);
+}
+
 }  // namespace opossum
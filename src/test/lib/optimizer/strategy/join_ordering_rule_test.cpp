@@ -4,6 +4,7 @@
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
@@ -78,4 +79,43 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, LargeJoinGraph) {
+  // Test that JoinGraphs that are planned with a bounded effort are ordered as well. A chain of ten vertices has few
+  // candidate joins, so that DpCcp does not exceed its budget.
+
+  const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 50, 20, 10);
+
+  auto input_lqp = std::shared_ptr<AbstractLQPNode>{};
+  auto previous_column = std::shared_ptr<LQPColumnExpression>{};
+  for (auto vertex_idx = 0; vertex_idx < 10; ++vertex_idx) {
+    const auto node = create_mock_node_with_statistics({{DataType::Int, "a"}}, 20, {histogram});
+    const auto column = node->get_column("a");
+
+    if (!input_lqp) {
+      input_lqp = node;
+    } else {
+      const auto join_node = JoinNode::make(JoinMode::Cross, input_lqp, node);
+      input_lqp = PredicateNode::make(equals_(previous_column, column), join_node);
+    }
+    previous_column = column;
+  }
+  ASSERT_GE(size_t{10}, JoinOrderingRule::MIN_VERTEX_COUNT_FOR_BUDGET);
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  auto inner_join_count = size_t{0};
+  auto other_node_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join && static_cast<const JoinNode&>(*node).join_mode == JoinMode::Inner) {
+      ++inner_join_count;
+    } else if (node->type != LQPNodeType::Mock && node->type != LQPNodeType::Projection) {
+      ++other_node_count;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  EXPECT_EQ(inner_join_count, 9u);
+  EXPECT_EQ(other_node_count, 0u);
+}
+
 }  // namespace opossum
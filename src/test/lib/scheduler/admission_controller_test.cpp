@@ -0,0 +1,168 @@
+#include <atomic>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "scheduler/admission_controller.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace opossum {
+
+class AdmissionControllerTest : public BaseTest {
+ protected:
+  AdmissionController admission_controller;
+};
+
+TEST_F(AdmissionControllerTest, TracksRunningQueries) {
+  admission_controller.set_query_budget(1'000);
+  EXPECT_TRUE(admission_controller.running_queries().empty());
+
+  {
+    const auto admission = AdmissionController::Admission{admission_controller, "SELECT 1"};
+    EXPECT_EQ(admission.memory_resource()->budget(), 1'000);
+
+    const auto memory_resource_scope = MemoryResourceScope{admission.memory_resource()};
+    const auto values = pmr_vector<int32_t>(100);
+
+    const auto running_queries = admission_controller.running_queries();
+    ASSERT_EQ(running_queries.size(), 1);
+    EXPECT_EQ(running_queries[0].sql, "SELECT 1");
+    EXPECT_EQ(running_queries[0].memory_resource, admission.memory_resource());
+    EXPECT_EQ(admission_controller.allocated_bytes(), 400);
+  }
+
+  EXPECT_TRUE(admission_controller.running_queries().empty());
+  EXPECT_EQ(admission_controller.allocated_bytes(), 0);
+}
+
+TEST_F(AdmissionControllerTest, AccountsToSurroundingResource) {
+  const auto session_resource = BudgetedMemoryResource::create(100);
+  const auto session_scope = MemoryResourceScope{session_resource};
+
+  const auto admission = AdmissionController::Admission{admission_controller, "SELECT 1"};
+  EXPECT_EQ(admission.memory_resource()->parent(), session_resource);
+  EXPECT_EQ(admission.memory_resource()->available_bytes(), 100);
+
+  const auto memory_resource_scope = MemoryResourceScope{admission.memory_resource()};
+  const auto values = pmr_vector<int32_t>(10);
+  EXPECT_EQ(session_resource->allocated_bytes(), 40);
+  EXPECT_EQ(admission.memory_resource()->available_bytes(), 60);
+}
+
+TEST_F(AdmissionControllerTest, QueuesQueriesWhenBudgetIsExhausted) {
+  admission_controller.set_global_budget(1'000);
+  admission_controller.set_admission_threshold(0.5);
+
+  auto first_admission = std::make_unique<AdmissionController::Admission>(admission_controller, "SELECT 1");
+  auto values = pmr_vector<int32_t>(200, PolymorphicAllocator<int32_t>{first_admission->memory_resource().get()});
+
+  // A single statement is always admitted, even if the budget is exhausted
+  auto second_admitted = std::atomic_bool{false};
+  auto second_thread = std::thread([&]() {
+    const auto admission = AdmissionController::Admission{admission_controller, "SELECT 2"};
+    second_admitted = true;
+  });
+
+  while (admission_controller.queued_query_count() == 0) {
+    std::this_thread::yield();
+  }
+  EXPECT_FALSE(second_admitted);
+
+  // Freeing memory admits the queued statement while the first one is still running
+  values = pmr_vector<int32_t>{};
+  second_thread.join();
+  EXPECT_TRUE(second_admitted);
+  EXPECT_EQ(admission_controller.queued_query_count(), 0);
+
+  // Finishing the first statement admits queued statements, too
+  values = pmr_vector<int32_t>(200, PolymorphicAllocator<int32_t>{first_admission->memory_resource().get()});
+  auto third_thread = std::thread([&]() {
+    const auto admission = AdmissionController::Admission{admission_controller, "SELECT 3"};
+  });
+  while (admission_controller.queued_query_count() == 0) {
+    std::this_thread::yield();
+  }
+  first_admission = nullptr;
+  third_thread.join();
+  EXPECT_TRUE(admission_controller.running_queries().empty());
+}
+
+TEST_F(AdmissionControllerTest, AdmitsNestedStatements) {
+  admission_controller.set_global_budget(100);
+
+  const auto outer_admission = AdmissionController::Admission{admission_controller, "SELECT 1"};
+  const auto memory_resource_scope = MemoryResourceScope{outer_admission.memory_resource()};
+  const auto values = pmr_vector<int32_t>(100);
+
+  // The nested statement would be queued forever if it was not accounted to the outer one
+  const auto nested_admission = AdmissionController::Admission{admission_controller, "SELECT 2"};
+  EXPECT_EQ(nested_admission.memory_resource()->parent(), outer_admission.memory_resource());
+  EXPECT_EQ(admission_controller.running_queries().size(), 1);
+}
+
+TEST_F(AdmissionControllerTest, TryCreateDoesNotQueue) {
+  admission_controller.set_global_budget(100);
+  const auto session_resource = BudgetedMemoryResource::create(1'000);
+
+  auto first_admission = AdmissionController::Admission::try_create(admission_controller, "SELECT 1", session_resource);
+  ASSERT_TRUE(first_admission);
+  EXPECT_EQ(first_admission->memory_resource()->parent(), session_resource);
+  auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{first_admission->memory_resource().get()});
+
+  EXPECT_FALSE(AdmissionController::Admission::try_create(admission_controller, "SELECT 2", session_resource));
+  EXPECT_EQ(admission_controller.queued_query_count(), 0);
+  EXPECT_EQ(admission_controller.running_queries().size(), 1);
+
+  first_admission = nullptr;
+  EXPECT_TRUE(AdmissionController::Admission::try_create(admission_controller, "SELECT 2", session_resource));
+}
+
+TEST_F(AdmissionControllerTest, DoesNotQueueOnWorkers) {
+  admission_controller.set_global_budget(100);
+
+  const auto first_admission = AdmissionController::Admission{admission_controller, "SELECT 1"};
+  const auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{first_admission.memory_resource().get()});
+
+  // A queued worker could not execute the tasks of the running statements, which might be waiting for that worker
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  auto admitted_on_worker = std::atomic_bool{false};
+  const auto task = std::make_shared<JobTask>([&]() {
+    const auto admission = AdmissionController::Admission{admission_controller, "SELECT 2"};
+    admitted_on_worker = true;
+  });
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({task});
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_TRUE(admitted_on_worker);
+  EXPECT_EQ(admission_controller.queued_query_count(), 0);
+}
+
+TEST_F(AdmissionControllerTest, RegistersSessions) {
+  EXPECT_TRUE(admission_controller.sessions().empty());
+
+  {
+    const auto session = AdmissionController::SessionRegistration{admission_controller, "127.0.0.1:4242"};
+    const auto sessions = admission_controller.sessions();
+    ASSERT_EQ(sessions.size(), 1);
+    EXPECT_EQ(sessions[0].client, "127.0.0.1:4242");
+    EXPECT_EQ(sessions[0].memory_resource, session.memory_resource());
+
+    // The results of the session's statements remain accounted to the session after the statements have finished
+    auto result = pmr_vector<int32_t>{};
+    {
+      const auto admission =
+          AdmissionController::Admission::try_create(admission_controller, "SELECT 1", session.memory_resource());
+      ASSERT_TRUE(admission);
+      result = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{admission->memory_resource().get()});
+    }
+    EXPECT_TRUE(admission_controller.running_queries().empty());
+    EXPECT_EQ(session.memory_resource()->allocated_bytes(), 40);
+  }
+
+  EXPECT_TRUE(admission_controller.sessions().empty());
+}
+
+}  // namespace opossum
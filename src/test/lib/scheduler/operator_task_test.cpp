@@ -10,6 +10,7 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
@@ -82,6 +83,73 @@ TEST_F(OperatorTaskTest, DoubleDependencyTasksFromOperatorTest) {
   EXPECT_EQ(gt_b->get_output(), nullptr);
 }
 
+TEST_F(OperatorTaskTest, LinkRuntimeFilters) {
+  // table_a has the chunks [12345, 123] and [1234], only 123 is found in the source
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_b, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_(a, 0));
+  auto scan_b = std::make_shared<TableScan>(gt_b, greater_than_(b, 458.0));
+  auto join = std::make_shared<JoinHash>(
+      scan_a, scan_b, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  join->runtime_filter_source = RuntimeFilterSource::RightInput;
+
+  auto tasks = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 5u);
+  ASSERT_TRUE(scan_a->runtime_filter);
+  EXPECT_EQ(scan_a->runtime_filter, gt_a->runtime_filter);
+  EXPECT_FALSE(scan_b->runtime_filter);
+
+  // The targets wait for the source
+  const auto& scan_b_task = tasks[3];
+  ASSERT_EQ(static_cast<const OperatorTask&>(*scan_b_task).get_operator(), scan_b);
+  EXPECT_EQ(scan_b_task->successors().size(), 3u);
+  EXPECT_FALSE(tasks[0]->is_ready());
+  EXPECT_FALSE(tasks[1]->is_ready());
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  const auto expected_result = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false},
+                             {"a", DataType::Int, false}, {"b", DataType::Float, false}},
+      TableType::Data);
+  expected_result->append({123, 456.7f, 123, 458.7f});
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+
+  // The GetTable prunes the second chunk, the TableScan filters 12345
+  EXPECT_EQ(gt_a->performance_data->output_chunk_count, 1u);
+  EXPECT_EQ(gt_b->performance_data->output_chunk_count, 2u);
+  const auto& scan_performance_data = static_cast<const TableScan::PerformanceData&>(*scan_a->performance_data);
+  EXPECT_EQ(scan_performance_data.rows_filtered_at_runtime, 1u);
+
+  // Check that everything was properly cleaned up, including the runtime filters
+  EXPECT_EQ(gt_a->get_output(), nullptr);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+  EXPECT_FALSE(gt_a->runtime_filter);
+  EXPECT_FALSE(scan_a->runtime_filter);
+}
+
+TEST_F(OperatorTaskTest, DoNotLinkRuntimeFiltersToSharedOperators) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_(a, 0));
+  auto join = std::make_shared<JoinHash>(
+      scan_a, gt_b, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  join->runtime_filter_source = RuntimeFilterSource::RightInput;
+  auto union_positions = std::make_shared<UnionPositions>(scan_a, join);
+
+  OperatorTask::make_tasks_from_operator(union_positions);
+  EXPECT_FALSE(scan_a->runtime_filter);
+  EXPECT_FALSE(gt_a->runtime_filter);
+}
+
 TEST_F(OperatorTaskTest, MakeDiamondShape) {
   auto gt_a = std::make_shared<GetTable>("table_a");
   auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
@@ -126,4 +194,116 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, ExecutePipelines) {
+  Hyrise::get().enable_pipelining = true;
+
+  // table_a has the chunks [12345, 123] and [1234]
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_(a, 100));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 458.0));
+  auto scan_c = std::make_shared<TableScan>(scan_b, greater_than_(a, 200));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_c);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(static_cast<const OperatorTask&>(*tasks[0]).get_operator(), gt_a);
+  EXPECT_EQ(static_cast<const OperatorTask&>(*tasks[1]).get_operator(), scan_c);
+  EXPECT_TRUE(scan_a->is_pipelined);
+  EXPECT_TRUE(scan_b->is_pipelined);
+  EXPECT_FALSE(scan_c->is_pipelined);
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  const auto expected_result =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}},
+                              TableType::Data);
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(scan_c->get_output(), expected_result);
+
+  // The pipelined operators are marked as executed, but their output is never materialized
+  EXPECT_TRUE(scan_a->performance_data->executed);
+  EXPECT_EQ(scan_a->performance_data->output_row_count, 3u);
+  EXPECT_EQ(scan_a->performance_data->output_chunk_count, 2u);
+  EXPECT_EQ(scan_b->performance_data->output_row_count, 2u);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+
+  // Check that everything was properly cleaned up
+  EXPECT_EQ(gt_a->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, ExecutePipelinesIntoProjections) {
+  // table_a has the chunks [12345, 123] and [1234], the second chunk is entirely filtered out by scan_b
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_(a, 100));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 457.0));
+  auto projection = std::make_shared<Projection>(scan_b, expression_vector(a, add_(a, 1), b));
+
+  // Execute a copy of the plan without pipelining for comparison
+  const auto expected_projection = projection->deep_copy();
+  for (auto& task : OperatorTask::make_tasks_from_operator(expected_projection)) {
+    task->schedule();
+  }
+
+  Hyrise::get().enable_pipelining = true;
+  auto tasks = OperatorTask::make_tasks_from_operator(projection);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(static_cast<const OperatorTask&>(*tasks[1]).get_operator(), projection);
+  EXPECT_TRUE(scan_a->is_pipelined);
+  EXPECT_TRUE(scan_b->is_pipelined);
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected_projection->get_output());
+  EXPECT_EQ(projection->get_output()->chunk_count(), 1u);
+
+  // The pipelined operators are marked as executed, but their output is never materialized
+  EXPECT_TRUE(scan_b->performance_data->executed);
+  EXPECT_EQ(scan_b->performance_data->output_row_count, 1u);
+  EXPECT_EQ(scan_b->performance_data->output_chunk_count, 1u);
+  EXPECT_EQ(scan_b->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, DoNotPipelineSharedOperators) {
+  Hyrise::get().enable_pipelining = true;
+
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 1000));
+  auto scan_c = std::make_shared<TableScan>(scan_a, greater_than_(b, 2000));
+  auto scan_d = std::make_shared<TableScan>(scan_c, greater_than_(a, 0));
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_d);
+
+  // Only scan_c is pipelined into scan_d. scan_a has two consumers and scan_b is consumed by the UnionPositions.
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions);
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_FALSE(scan_a->is_pipelined);
+  EXPECT_FALSE(scan_b->is_pipelined);
+  EXPECT_TRUE(scan_c->is_pipelined);
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  const auto expected_result =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}},
+                              TableType::Data);
+  expected_result->append({12345, 458.7f});
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(union_positions->get_output(), expected_result);
+}
+
 }  // namespace opossum
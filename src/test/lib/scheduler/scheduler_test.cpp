@@ -125,6 +125,21 @@ TEST_F(SchedulerTest, BasicTest) {
   Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
 }
 
+TEST_F(SchedulerTest, BasicTestWithWorkStealingDeques) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealingDeques));
+
+  std::atomic_uint counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  ASSERT_EQ(counter, 30u);
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
 TEST_F(SchedulerTest, BasicTestWithoutScheduler) {
   std::atomic_uint counter{0};
   increment_counter_in_subtasks(counter);
@@ -203,6 +218,51 @@ TEST_F(SchedulerTest, DiamondDependenciesWithScheduler) {
   ASSERT_EQ(counter, 7u);
 }
 
+TEST_F(SchedulerTest, DependenciesWithWorkStealingDeques) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealingDeques));
+
+  std::atomic_uint linear_counter{0u};
+  std::atomic_uint multiple_counter{0u};
+  std::atomic_uint diamond_counter{0u};
+
+  stress_linear_dependencies(linear_counter);
+  stress_multiple_dependencies(multiple_counter);
+  stress_diamond_dependencies(diamond_counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  ASSERT_EQ(linear_counter, 3u);
+  ASSERT_EQ(multiple_counter, 4u);
+  ASSERT_EQ(diamond_counter, 7u);
+}
+
+TEST_F(SchedulerTest, ManySubtasksWithWorkStealingDeques) {
+  // Spawns many small jobs from within workers, so that they end up in the workers' deques and get stolen
+  Hyrise::get().topology.use_fake_numa_topology(8, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealingDeques));
+
+  constexpr auto ROOT_TASK_COUNT = size_t{8};
+  constexpr auto JOB_COUNT = size_t{1'000};
+
+  std::atomic_uint counter{0u};
+  auto root_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto root_task_id = size_t{0}; root_task_id < ROOT_TASK_COUNT; ++root_task_id) {
+    root_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto job_id = size_t{0}; job_id < JOB_COUNT; ++job_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(root_tasks);
+
+  EXPECT_EQ(counter, ROOT_TASK_COUNT * JOB_COUNT);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(SchedulerTest, LinearDependenciesWithoutScheduler) {
   std::atomic_uint counter{0u};
   stress_linear_dependencies(counter);
@@ -267,6 +327,7 @@ TEST_F(SchedulerTest, VerifyTaskQueueSetup) {
   Hyrise::get().topology.use_fake_numa_topology(4, 4);
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
   EXPECT_EQ(1, Hyrise::get().scheduler()->queues().size());
+  EXPECT_EQ(4, Hyrise::get().scheduler()->workers().size());
 
   Hyrise::get().scheduler()->finish();
 }
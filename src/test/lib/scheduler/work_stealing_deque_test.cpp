@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  const auto tasks = create_tasks(4);
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size(), 4);
+
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  const auto tasks = create_tasks(100);
+  auto deque = WorkStealingDeque{4};
+
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size(), 100);
+
+  for (auto task_id = size_t{0}; task_id < 50; ++task_id) {
+    EXPECT_EQ(deque.steal(), tasks[task_id]);
+  }
+  for (auto task_id = size_t{99}; task_id >= 50; --task_id) {
+    EXPECT_EQ(deque.pop(), tasks[task_id]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // The owner pushes and pops tasks while other threads steal them. Every task has to be taken exactly once.
+  constexpr auto TASK_COUNT = size_t{50'000};
+  constexpr auto THIEF_COUNT = size_t{3};
+
+  const auto tasks = create_tasks(TASK_COUNT);
+  auto deque = WorkStealingDeque{16};
+  auto owner_done = std::atomic_bool{false};
+
+  // One vector of taken tasks per thread, the last one belongs to the owner
+  auto taken_tasks = std::vector<std::vector<std::shared_ptr<AbstractTask>>>(THIEF_COUNT + 1);
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&, thief_id]() {
+      while (!owner_done || !deque.empty()) {
+        auto task = deque.steal();
+        if (task) taken_tasks[thief_id].emplace_back(std::move(task));
+      }
+    });
+  }
+
+  auto& owner_tasks = taken_tasks[THIEF_COUNT];
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) {
+      auto task = deque.pop();
+      if (task) owner_tasks.emplace_back(std::move(task));
+    }
+  }
+  while (auto task = deque.pop()) {
+    owner_tasks.emplace_back(std::move(task));
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  auto all_taken_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& thread_tasks : taken_tasks) {
+    all_taken_tasks.insert(all_taken_tasks.end(), thread_tasks.begin(), thread_tasks.end());
+  }
+  std::sort(all_taken_tasks.begin(), all_taken_tasks.end());
+
+  auto expected_tasks = tasks;
+  std::sort(expected_tasks.begin(), expected_tasks.end());
+
+  EXPECT_EQ(all_taken_tasks, expected_tasks);
+}
+
+}  // namespace opossum
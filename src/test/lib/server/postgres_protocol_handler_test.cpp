@@ -27,12 +27,14 @@ TEST_F(PostgresProtocolHandlerTest, ReadStartupMessage) {
 
   // SSL request contains length (8 B) and SSL request code 80877103
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\b', '\x04', '\xd2', '\x16', '\x2f'});
-  // Server will wait for new message with authentication details. Message contains length (12 B), protocol (0) and
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), std::nullopt);
+  const std::string file_content = _mocked_socket->read();
+  EXPECT_EQ(file_content.back(), 'N');
+
+  // The client sends a new message with authentication details. Message contains length (12 B), protocol (0) and
   // body (4 B). No body provided here, since we throw it away anyway.
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\f', '\0', '\0', '\0', '\0'});
   EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 4);
-  const std::string file_content = _mocked_socket->read();
-  EXPECT_EQ(file_content.back(), 'N');
 }
 
 TEST_F(PostgresProtocolHandlerTest, DiscardStartupPacketBody) {
@@ -249,6 +251,22 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>{FormatCode::Text});
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketWithBinaryResultFormat) {
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x12'});
+  // Unnamed portal and statement
+  _mocked_socket->write(std::string{"\0\0", 2});
+  // No parameter format codes and no parameters
+  _mocked_socket->write(std::string{"\0\0\0\0", 4});
+  // Two result columns, the second one in binary format
+  _mocked_socket->write(std::string{'\0', '\x02', '\0', '\0', '\0', '\x01'});
+
+  const auto& statement_information = _protocol_handler->read_bind_packet();
+  EXPECT_TRUE(statement_information.parameters.empty());
+  EXPECT_EQ(statement_information.result_format_codes,
+            (std::vector<FormatCode>{FormatCode::Text, FormatCode::Binary}));
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
@@ -258,7 +276,21 @@ TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   _mocked_socket->write(portal_name);
   _mocked_socket->write({'\0', '\0', '\0', '\0', '\0'});
 
-  EXPECT_EQ(_protocol_handler->read_execute_packet(), portal_name);
+  const auto [read_portal_name, max_rows] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(read_portal_name, portal_name);
+  EXPECT_EQ(max_rows, 0);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadExecutePacketWithRowLimit) {
+  const std::string portal_name = "some_portal";
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x14'});
+  _mocked_socket->write(portal_name);
+  // Null terminator and row limit of 300
+  _mocked_socket->write({'\0', '\0', '\0', '\x01', '\x2c'});
+
+  const auto [read_portal_name, max_rows] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(read_portal_name, portal_name);
+  EXPECT_EQ(max_rows, 300);
 }
 
 TEST_F(PostgresProtocolHandlerTest, SendErrorMessage) {
@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
+#include "lossy_cast.hpp"
 #include "server/postgres_protocol_handler.hpp"
 #include "server/result_serializer.hpp"
 
@@ -17,6 +18,31 @@ class ResultSerializerTest : public BaseTest {
         std::make_shared<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>(_mocked_socket->get_socket());
   }
 
+  // Decodes the DataRow messages in file_content
+  static std::vector<std::vector<std::optional<std::string>>> _parse_data_rows(const std::string& file_content) {
+    auto rows = std::vector<std::vector<std::optional<std::string>>>{};
+    auto position = file_content.cbegin();
+    while (position != file_content.cend()) {
+      EXPECT_EQ(static_cast<PostgresMessageType>(*position), PostgresMessageType::DataRow);
+      position += sizeof(PostgresMessageType) + sizeof(uint32_t);
+      const auto column_count = NetworkConversionHelper::get_small_int(position);
+      position += sizeof(uint16_t);
+
+      auto& row = rows.emplace_back();
+      for (auto column_id = 0; column_id < column_count; ++column_id) {
+        const auto length = static_cast<int32_t>(NetworkConversionHelper::get_message_length(position));
+        position += sizeof(uint32_t);
+        if (length == -1) {
+          row.emplace_back(std::nullopt);
+        } else {
+          row.emplace_back(std::string{position, position + length});
+          position += length;
+        }
+      }
+    }
+    return rows;
+  }
+
   std::shared_ptr<Table> _test_table;
   std::shared_ptr<MockSocket> _mocked_socket;
   std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>> _protocol_handler;
@@ -43,6 +69,106 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, QueryResponseValues) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 3);
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto rows = _parse_data_rows(_mocked_socket->read());
+
+  const auto expected_rows = table->get_rows();
+  ASSERT_EQ(rows.size(), expected_rows.size());
+  for (auto row_index = size_t{0}; row_index < rows.size(); ++row_index) {
+    ASSERT_EQ(rows[row_index].size(), table->column_count());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      // The values must be formatted the same way as by lossy_variant_cast
+      const auto expected_value = lossy_variant_cast<pmr_string>(expected_rows[row_index][column_id]);
+      const auto& value = rows[row_index][column_id];
+      ASSERT_EQ(value.has_value(), expected_value.has_value());
+      if (value) {
+        EXPECT_EQ(*value, std::string_view{*expected_value});
+      }
+    }
+  }
+}
+
+TEST_F(ResultSerializerTest, QueryResponseWithRowLimit) {
+  // _test_table has 8 rows in chunks of 2 rows
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+
+  EXPECT_EQ(ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 3), 3);
+  EXPECT_EQ(position, (RowID{ChunkID{1}, ChunkOffset{1}}));
+
+  EXPECT_EQ(ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 1), 1);
+  EXPECT_EQ(position, (RowID{ChunkID{2}, ChunkOffset{0}}));
+
+  // A limit of 0 sends all remaining rows
+  EXPECT_EQ(ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 0), 4);
+  EXPECT_EQ(position.chunk_id, _test_table->chunk_count());
+
+  EXPECT_EQ(ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 2), 0);
+
+  _protocol_handler->force_flush();
+  const auto rows = _parse_data_rows(_mocked_socket->read());
+  ASSERT_EQ(rows.size(), _test_table->row_count());
+  for (auto row_index = size_t{0}; row_index < rows.size(); ++row_index) {
+    EXPECT_EQ(rows[row_index][0], std::to_string(100 + row_index));
+  }
+}
+
+TEST_F(ResultSerializerTest, RowDescriptionWithFormatCodes) {
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // The format code is the last field of each column description
+  auto position = file_content.find(_test_table->column_name(ColumnID{0}));
+  ASSERT_NE(position, std::string::npos);
+  position += _test_table->column_name(ColumnID{0}).size() + 1 + 3 * sizeof(uint32_t) + 2 * sizeof(uint16_t);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + position),
+            static_cast<uint16_t>(FormatCode::Binary));
+
+  EXPECT_THROW(ResultSerializer::send_table_description(_test_table, _protocol_handler,
+                                                        {FormatCode::Binary, FormatCode::Text}),
+               std::logic_error);
+}
+
+TEST_F(ResultSerializerTest, QueryResponseBinary) {
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+  ResultSerializer::send_query_response(_test_table, _protocol_handler, position, 0, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const auto rows = _parse_data_rows(_mocked_socket->read());
+  ASSERT_EQ(rows.size(), _test_table->row_count());
+
+  // The first row contains 100 in all columns. Integers and floating-point numbers are sent in network byte order.
+  const auto int_bytes = std::string{'\0', '\0', '\0', 'd'};
+  const auto long_bytes = std::string{'\0', '\0', '\0', '\0', '\0', '\0', '\0', 'd'};
+  const auto float_bytes = std::string{'\x42', '\xc8', '\0', '\0'};
+  const auto double_bytes = std::string{'\x40', '\x59', '\0', '\0', '\0', '\0', '\0', '\0'};
+  const auto expected_first_row =
+      std::vector<std::optional<std::string>>{int_bytes,   int_bytes,    long_bytes, long_bytes, float_bytes,
+                                              float_bytes, double_bytes, double_bytes, "100",     "100"};
+  EXPECT_EQ(rows[0], expected_first_row);
+
+  // NULL values are represented by a length of -1 in both formats
+  for (auto column_id = size_t{1}; column_id < rows[4].size(); column_id += 2) {
+    EXPECT_FALSE(rows[4][column_id]);
+  }
+}
+
+TEST_F(ResultSerializerTest, QueryResponseMixedFormats) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl");
+  auto position = RowID{ChunkID{0}, ChunkOffset{0}};
+  ResultSerializer::send_query_response(table, _protocol_handler, position, 0, {FormatCode::Text, FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const auto rows = _parse_data_rows(_mocked_socket->read());
+
+  ASSERT_EQ(rows.size(), 4);
+  EXPECT_EQ(rows[0][0], "12345");
+  EXPECT_EQ(rows[0][1]->size(), sizeof(float));
+  EXPECT_EQ(rows[1][1], std::nullopt);
+  EXPECT_EQ(rows[2][0], std::nullopt);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -287,6 +287,22 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
+TEST_F(ServerTestRunner, TestMoreConnectionsThanThreads) {
+  // Sessions do not own a thread. Idle connections must neither block the server's I/O threads nor the scheduler.
+  const auto connection_count = 4 * (Server::DEFAULT_IO_THREAD_COUNT + Hyrise::get().scheduler()->workers().size());
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_id = size_t{0}; connection_id < connection_count; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  // Query in reverse order, so that the connections opened first are idle for the longest time
+  for (auto connection_it = connections.rbegin(); connection_it != connections.rend(); ++connection_it) {
+    pqxx::nontransaction transaction{**connection_it};
+    const auto result = transaction.exec("SELECT * FROM table_a;");
+    EXPECT_EQ(result.size(), _table_a->row_count());
+  }
+}
+
 TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
@@ -0,0 +1,103 @@
+#include <boost/asio.hpp>
+
+#include "base_test.hpp"
+
+#include "server/client_disconnect_exception.hpp"
+#include "server/postgres_protocol_handler.hpp"
+#include "server/session_stream.hpp"
+
+namespace opossum {
+
+class SessionStreamTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _stream = std::make_shared<SessionStream>();
+    _protocol_handler = std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream);
+  }
+
+  // Simulates receiving @param data with async_read_some
+  void _receive(const std::string& data) {
+    const auto buffer = _stream->prepare_receive(SERVER_BUFFER_SIZE);
+    ASSERT_LE(data.size(), buffer.size());
+    std::copy(data.begin(), data.end(), static_cast<char*>(buffer.data()));
+    _stream->commit_received(data.size());
+  }
+
+  static std::string _query_message(const std::string& query) {
+    const auto length = htonl(static_cast<uint32_t>(LENGTH_FIELD_SIZE + query.size() + 1));
+    return "Q" + std::string(reinterpret_cast<const char*>(&length), sizeof(length)) + query + '\0';
+  }
+
+  std::shared_ptr<SessionStream> _stream;
+  std::shared_ptr<PostgresProtocolHandler<SessionStream>> _protocol_handler;
+};
+
+TEST_F(SessionStreamTest, OnlyCompleteMessagesAreReadable) {
+  // Startup packet with length (8 B) and protocol version (0)
+  _receive(std::string{'\0', '\0', '\0'});
+  EXPECT_FALSE(_stream->has_readable_data());
+  _receive(std::string{'\b', '\0', '\0', '\0', '\0'});
+  EXPECT_TRUE(_stream->has_readable_data());
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 0);
+  EXPECT_FALSE(_stream->has_readable_data());
+
+  // After the startup packet, messages start with their type. A query that is longer than the protocol handler's
+  // buffer is received in multiple parts.
+  const auto query = "SELECT '" + std::string(2 * SERVER_BUFFER_SIZE, 'a') + "'";
+  const auto message = _query_message(query);
+  for (auto offset = size_t{0}; offset < message.size(); offset += SERVER_BUFFER_SIZE) {
+    EXPECT_FALSE(_stream->has_readable_data());
+    _receive(message.substr(offset, SERVER_BUFFER_SIZE));
+  }
+  EXPECT_TRUE(_stream->has_readable_data());
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
+  EXPECT_EQ(_protocol_handler->read_query_packet(), query);
+  EXPECT_FALSE(_stream->has_readable_data());
+  EXPECT_FALSE(_protocol_handler->has_buffered_input());
+
+  // Multiple messages received at once are all readable, but an incomplete message at the end is not
+  _receive(_query_message("SELECT 1") + _query_message("SELECT 2") + _query_message("SELECT 3").substr(0, 4));
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
+  EXPECT_EQ(_protocol_handler->read_query_packet(), "SELECT 1");
+  EXPECT_TRUE(_protocol_handler->has_buffered_input() || _stream->has_readable_data());
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
+  EXPECT_EQ(_protocol_handler->read_query_packet(), "SELECT 2");
+  EXPECT_FALSE(_protocol_handler->has_buffered_input() || _stream->has_readable_data());
+
+  _receive(_query_message("SELECT 3").substr(4));
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
+  EXPECT_EQ(_protocol_handler->read_query_packet(), "SELECT 3");
+}
+
+TEST_F(SessionStreamTest, SslRequest) {
+  // The client waits for the response to an SSL request before it sends the startup packet
+  _receive(std::string{'\0', '\0', '\0', '\b', '\x04', '\xd2', '\x16', '\x2f'});
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), std::nullopt);
+  EXPECT_EQ(_stream->unsent_data(), std::vector<char>{'N'});
+  _stream->clear_unsent_data();
+
+  _receive(std::string{'\0', '\0', '\0', '\b', '\0', '\0', '\0', '\0'});
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 0);
+}
+
+TEST_F(SessionStreamTest, InvalidMessageLength) {
+  _receive(std::string{'\0', '\0', '\0', '\b', '\0', '\0', '\0', '\0'});
+  EXPECT_THROW(_receive(std::string{'Q', '\0', '\0', '\0', '\0'}), ClientDisconnectException);
+}
+
+TEST_F(SessionStreamTest, CollectWrittenData) {
+  EXPECT_TRUE(_stream->unsent_data().empty());
+
+  _protocol_handler->send_ready_for_query();
+  const auto ready_for_query = std::vector<char>{'Z', '\0', '\0', '\0', '\x05', 'I'};
+  EXPECT_EQ(_stream->unsent_data(), ready_for_query);
+
+  // Data is collected until it has been sent
+  _protocol_handler->send_ready_for_query();
+  EXPECT_EQ(_stream->unsent_data().size(), 2 * ready_for_query.size());
+
+  _stream->clear_unsent_data();
+  EXPECT_TRUE(_stream->unsent_data().empty());
+}
+
+}  // namespace opossum
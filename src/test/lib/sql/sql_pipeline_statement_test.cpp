@@ -9,6 +9,7 @@
 
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "memory/budgeted_memory_resource.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
@@ -697,6 +698,27 @@ TEST_F(SQLPipelineStatementTest, MetaTableNoCaching) {
   EXPECT_FALSE(_pqp_cache->has(meta_table_query));
 }
 
+TEST_F(SQLPipelineStatementTest, AccountsMemoryToStatement) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  Hyrise::get().admission_controller->set_query_budget(1'000'000);
+
+  // The statement's memory resource is a child of the resource of the surrounding scope
+  const auto outer_resource = BudgetedMemoryResource::create(2'000'000);
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  {
+    const auto memory_resource_scope = MemoryResourceScope{outer_resource};
+    const auto [pipeline_status, table] = statement->get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+  }
+
+  // The result table is still allocated, the statement is not running anymore
+  EXPECT_GT(outer_resource->allocated_bytes(), 0);
+  EXPECT_GE(outer_resource->peak_allocated_bytes(), outer_resource->allocated_bytes());
+  EXPECT_TRUE(Hyrise::get().admission_controller->running_queries().empty());
+}
+
 TEST_F(SQLPipelineStatementTest, SQLTranslationInfo) {
   {
     auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
@@ -845,6 +845,26 @@ TEST_F(CardinalityEstimatorTest, StoredTable) {
   EXPECT_EQ(estimator.estimate_cardinality(StoredTableNode::make("t")), 3);
 }
 
+TEST_F(CardinalityEstimatorTest, AggregateWithDistinctCountSketches) {
+  // Column a of int_float4 has four distinct values in seven rows
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  table->set_pruning_statistics_config(ColumnID{0}, PruningStatisticsConfig{0.0f, 10});
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto column_a = stored_table_node->get_column("a");
+  const auto column_b = stored_table_node->get_column("b");
+
+  EXPECT_NEAR(estimator.estimate_cardinality(AggregateNode::make(expression_vector(column_a),
+                                                                 expression_vector(sum_(column_b)), stored_table_node)),
+              4.0f, 0.5f);
+
+  // Column b has no sketch, so that every input row is assumed to be a group
+  EXPECT_EQ(estimator.estimate_cardinality(
+                AggregateNode::make(expression_vector(column_a, column_b), expression_vector(), stored_table_node)),
+            7.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, Validate) {
   // Test Validate doesn't break the TableStatistics. The CardinalityEstimator is not estimating anything for Validate
   // as there are no statistics available atm to base such an estimation on.
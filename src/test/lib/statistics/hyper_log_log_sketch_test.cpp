@@ -0,0 +1,58 @@
+#include "base_test.hpp"
+
+#include "statistics/hyper_log_log_sketch.hpp"
+
+namespace opossum {
+
+class HyperLogLogSketchTest : public BaseTest {};
+
+TEST_F(HyperLogLogSketchTest, EstimateSmallCardinality) {
+  auto sketch = HyperLogLogSketch{};
+  EXPECT_FLOAT_EQ(sketch.estimate(), 0.0f);
+
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    sketch.add(value);
+    sketch.add(value);
+  }
+  EXPECT_NEAR(sketch.estimate(), 10.0f, 1.5f);
+}
+
+TEST_F(HyperLogLogSketchTest, EstimateLargeCardinality) {
+  auto sketch = HyperLogLogSketch{};
+  for (auto value = int64_t{0}; value < 200'000; ++value) {
+    sketch.add(value % 100'000);
+  }
+
+  // The standard error with the default precision is 1.6%
+  EXPECT_NEAR(sketch.estimate(), 100'000.0f, 5'000.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, EstimateStrings) {
+  auto sketch = HyperLogLogSketch{14};
+  for (auto value = 0; value < 50'000; ++value) {
+    sketch.add(pmr_string{"value_" + std::to_string(value)});
+  }
+
+  EXPECT_NEAR(sketch.estimate(), 50'000.0f, 2'500.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, Merge) {
+  auto sketch_a = HyperLogLogSketch{};
+  auto sketch_b = HyperLogLogSketch{};
+  for (auto value = 0; value < 30'000; ++value) {
+    sketch_a.add(value);
+    sketch_b.add(value + 20'000);
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_NEAR(sketch_a.estimate(), 50'000.0f, 2'500.0f);
+
+  EXPECT_THROW(sketch_a.merge(HyperLogLogSketch{10}), std::logic_error);
+}
+
+TEST_F(HyperLogLogSketchTest, InvalidPrecision) {
+  EXPECT_THROW(HyperLogLogSketch{3}, std::logic_error);
+  EXPECT_THROW(HyperLogLogSketch{19}, std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/bloom_filter_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class BloomFilterStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto value_id = 0; value_id < 1'000; ++value_id) {
+      _values.emplace_back(_value(value_id * 2));
+      _absent_values.emplace_back(_value(value_id * 2 + 1));
+    }
+  }
+
+  static T _value(const int value_id) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return pmr_string{"value_" + std::to_string(value_id)};
+    } else {
+      return static_cast<T>(value_id);
+    }
+  }
+
+  pmr_vector<T> _values;
+  pmr_vector<T> _absent_values;
+};
+
+using BloomFilterStatisticsTypes = ::testing::Types<int32_t, int64_t, float, double, pmr_string>;
+TYPED_TEST_SUITE(BloomFilterStatisticsTest, BloomFilterStatisticsTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(BloomFilterStatisticsTest, NoFalseNegatives) {
+  const auto filter = BloomFilterStatistics<TypeParam>::from_values(this->_values, 4.0f);
+
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, AllTypeVariant{value}));
+  }
+}
+
+TYPED_TEST(BloomFilterStatisticsTest, FalsePositiveRate) {
+  // 1000 values with ten bits each are rounded up to 256 words, for which the false positive rate is below 1%
+  const auto filter = BloomFilterStatistics<TypeParam>::from_values(this->_values, 10.0f);
+  EXPECT_EQ(filter->bloom_filter().word_count(), 256u);
+
+  auto false_positive_count = 0;
+  for (const auto& value : this->_absent_values) {
+    false_positive_count += filter->may_contain(value);
+  }
+  EXPECT_LE(false_positive_count, 10);
+}
+
+TYPED_TEST(BloomFilterStatisticsTest, OnlyPrunesEquals) {
+  const auto filter = BloomFilterStatistics<TypeParam>::from_values(this->_values, 10.0f);
+  auto absent_value = std::optional<TypeParam>{};
+  for (const auto& value : this->_absent_values) {
+    if (!filter->may_contain(value)) {
+      absent_value = value;
+      break;
+    }
+  }
+  ASSERT_TRUE(absent_value);
+
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, AllTypeVariant{*absent_value}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::NotEquals, AllTypeVariant{*absent_value}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::LessThan, AllTypeVariant{*absent_value}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, NULL_VALUE));
+
+  EXPECT_FALSE(filter->sliced(PredicateCondition::Equals, AllTypeVariant{*absent_value}));
+  EXPECT_TRUE(filter->sliced(PredicateCondition::Equals, AllTypeVariant{this->_values.front()}));
+  EXPECT_TRUE(filter->sliced(PredicateCondition::GreaterThan, AllTypeVariant{*absent_value}));
+}
+
+TYPED_TEST(BloomFilterStatisticsTest, EmptyFilter) {
+  // A segment without (non-NULL) values never matches an equality predicate
+  const auto filter = BloomFilterStatistics<TypeParam>::from_values(pmr_vector<TypeParam>{}, 10.0f);
+  EXPECT_EQ(filter->bloom_filter().word_count(), BloomFilter::MIN_WORD_COUNT);
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, AllTypeVariant{this->_values.front()}));
+}
+
+TYPED_TEST(BloomFilterStatisticsTest, ScaledKeepsValues) {
+  const auto filter = BloomFilterStatistics<TypeParam>::from_values(this->_values, 10.0f);
+  const auto scaled_filter = std::static_pointer_cast<BloomFilterStatistics<TypeParam>>(filter->scaled(0.5f));
+
+  // The copy shares the BloomFilter
+  EXPECT_EQ(&scaled_filter->bloom_filter(), &filter->bloom_filter());
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(scaled_filter->may_contain(value));
+  }
+}
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -43,6 +45,22 @@ TEST_F(EqualDistinctCountHistogramTest, FromColumnString) {
   EXPECT_EQ(default_domain_histogram->bin(BinID{2}), HistogramBin<pmr_string>("uuu", "xxx", 4, 3));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromDistributionMovesBounds) {
+  // With fewer distinct values than bins, the minimum and maximum of each bin are the same value
+  auto value_distribution = std::vector<std::pair<pmr_string, HistogramCountType>>{{"a", 2}, {"bb", 1}, {"ccc", 3}};
+  const auto copied_histogram = EqualDistinctCountHistogram<pmr_string>::from_distribution(value_distribution, 4u);
+  const auto moved_histogram =
+      EqualDistinctCountHistogram<pmr_string>::from_distribution(std::move(value_distribution), 4u);
+
+  ASSERT_EQ(moved_histogram->bin_count(), 3u);
+  EXPECT_EQ(moved_histogram->bin(BinID{0}), HistogramBin<pmr_string>("a", "a", 2, 1));
+  EXPECT_EQ(moved_histogram->bin(BinID{1}), HistogramBin<pmr_string>("bb", "bb", 1, 1));
+  EXPECT_EQ(moved_histogram->bin(BinID{2}), HistogramBin<pmr_string>("ccc", "ccc", 3, 1));
+  for (auto bin_id = BinID{0}; bin_id < moved_histogram->bin_count(); ++bin_id) {
+    EXPECT_EQ(moved_histogram->bin(bin_id), copied_histogram->bin(bin_id));
+  }
+}
+
 TEST_F(EqualDistinctCountHistogramTest, FromColumnInt) {
   const auto hist = EqualDistinctCountHistogram<int32_t>::from_column(*_int_float4, ColumnID{0}, 2u);
 
@@ -2,6 +2,7 @@
 
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/segment_summary.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/load_table.hpp"
@@ -41,4 +42,102 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithCompleteSamples) {
+  // With at most 20 rows per chunk, the samples contain all values and the histograms are exact
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
+
+  auto config = StatisticsGenerationConfig{};
+  config.sample_size_per_chunk = 20;
+  const auto table_statistics = TableStatistics::from_table(*table, config);
+
+  ASSERT_EQ(table_statistics->row_count, 200u);
+  ASSERT_EQ(table_statistics->segment_summaries.size(), 10u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 200 - 27);
+  EXPECT_FLOAT_EQ(histogram_a->total_distinct_count(), 10);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
+  const auto histogram_b = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_b->histogram);
+  ASSERT_TRUE(histogram_b);
+  EXPECT_FLOAT_EQ(histogram_b->total_count(), 200 - 9);
+  EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
+  EXPECT_NEAR(column_statistics_b->null_value_ratio->ratio, 9.0f / 200.0f, 1e-6f);
+}
+
+TEST_F(TableStatisticsTest, FromTableWithSamples) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1'000});
+  for (auto row = 0; row < 10'000; ++row) {
+    table->append({row % 2'000});
+  }
+
+  auto config = StatisticsGenerationConfig{};
+  config.sample_size_per_chunk = 200;
+  const auto table_statistics = TableStatistics::from_table(*table, config);
+
+  const auto column_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  const auto histogram = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics->histogram);
+  ASSERT_TRUE(histogram);
+
+  // The heights are scaled from the samples, the distinct count is estimated by the sketches
+  EXPECT_NEAR(histogram->total_count(), 10'000.0f, 1.0f);
+  EXPECT_NEAR(histogram->total_distinct_count(), 2'000.0f, 100.0f);
+  EXPECT_GE(histogram->bin_minimum(BinID{0}), 0);
+  EXPECT_LE(histogram->bin_maximum(histogram->bin_count() - 1), 1'999);
+
+  // The last chunk is still mutable, so its summaries are not kept
+  ASSERT_EQ(table_statistics->segment_summaries.size(), 10u);
+  EXPECT_EQ(table_statistics->segment_summaries[0].size(), 1u);
+  EXPECT_TRUE(table_statistics->segment_summaries[9].empty());
+
+  // The samples are drawn from the entire chunk, not only from its first rows
+  const auto segment_summary =
+      std::dynamic_pointer_cast<const SegmentSummary<int32_t>>(table_statistics->segment_summaries[0][0]);
+  ASSERT_TRUE(segment_summary);
+  ASSERT_EQ(segment_summary->sample.size(), 200u);
+  const auto [sample_minimum, sample_maximum] =
+      std::minmax_element(segment_summary->sample.cbegin(), segment_summary->sample.cend());
+  EXPECT_LT(*sample_minimum, 100);
+  EXPECT_GE(*sample_maximum, 900);
+}
+
+TEST_F(TableStatisticsTest, RefreshWithSegmentSummaries) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{100});
+  for (auto row = 0; row < 250; ++row) {
+    table->append({row});
+  }
+
+  auto config = StatisticsGenerationConfig{};
+  config.sample_size_per_chunk = 100;
+  const auto table_statistics = TableStatistics::from_table(*table, config);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 250.0f);
+
+  for (auto row = 250; row < 400; ++row) {
+    table->append({row});
+  }
+
+  const auto refreshed_statistics = TableStatistics::from_table(*table, config, table_statistics);
+  EXPECT_FLOAT_EQ(refreshed_statistics->row_count, 400.0f);
+
+  // The summaries of the chunks that were immutable before are reused, the ones of the new chunks are created
+  ASSERT_EQ(refreshed_statistics->segment_summaries.size(), 4u);
+  EXPECT_EQ(refreshed_statistics->segment_summaries[0][0], table_statistics->segment_summaries[0][0]);
+  EXPECT_EQ(refreshed_statistics->segment_summaries[1][0], table_statistics->segment_summaries[1][0]);
+  ASSERT_EQ(refreshed_statistics->segment_summaries[2].size(), 1u);
+  EXPECT_EQ(refreshed_statistics->segment_summaries[2][0]->row_count, 100u);
+
+  const auto column_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(refreshed_statistics->column_statistics.at(0));
+  const auto histogram = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics->histogram);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 400.0f);
+  EXPECT_FLOAT_EQ(histogram->total_distinct_count(), 400.0f);
+}
+
 }  // namespace opossum
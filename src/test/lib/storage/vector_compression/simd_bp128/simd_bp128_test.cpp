@@ -1,6 +1,8 @@
 #include <bitset>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <boost/hana/pair.hpp>
 
@@ -56,6 +58,9 @@ class SimdBp128Test : public BaseTest, public ::testing::WithParamInterface<uint
     return compressed_vector;
   }
 
+  uint32_t min() const { return _min; }
+  uint32_t max() const { return _max; }
+
  private:
   uint8_t _bit_size;
   uint32_t _min;
@@ -136,6 +141,27 @@ TEST_P(SimdBp128Test, DecompressSequenceUsingDecompressor) {
   }
 }
 
+TEST_P(SimdBp128Test, ScanRangeToBitmap) {
+  // Sizes that are no multiple of the block size result in a padded last block
+  const auto sequence = generate_sequence(SimdBp128Packing::meta_block_size + 420);
+  const auto compressed_sequence_base = compress(sequence);
+  const auto& compressed_sequence = dynamic_cast<const SimdBp128Vector&>(*compressed_sequence_base);
+
+  const auto middle = static_cast<uint32_t>(min() + (max() - min()) / 2u);
+  const auto ranges = std::vector<std::pair<uint32_t, uint32_t>>{
+      {0u, 0u}, {0u, min()}, {min(), middle}, {middle, middle + 1u}, {middle, max()}, {0u, max()}, {max(), max() + 1u}};
+  for (const auto& [lower_bound, upper_bound] : ranges) {
+    auto bitmap = std::vector<uint64_t>((sequence.size() + 63u) / 64u, ~uint64_t{0});
+    compressed_sequence.scan_range_to_bitmap(lower_bound, upper_bound, bitmap.data());
+
+    for (auto index = size_t{0}; index < bitmap.size() * 64u; ++index) {
+      const auto expected = index < sequence.size() && sequence[index] >= lower_bound && sequence[index] < upper_bound;
+      const auto actual = static_cast<bool>((bitmap[index / 64u] >> (index % 64u)) & 1u);
+      ASSERT_EQ(actual, expected) << "Index " << index << ", range [" << lower_bound << ", " << upper_bound << ")";
+    }
+  }
+}
+
 TEST_P(SimdBp128Test, CompressEmptySequence) {
   const auto sequence = generate_sequence(0);
   const auto compressed_sequence_base = compress(sequence);
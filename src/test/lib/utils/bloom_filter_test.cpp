@@ -0,0 +1,71 @@
+#include <functional>
+
+#include "base_test.hpp"
+
+#include "utils/bloom_filter.hpp"
+
+namespace opossum {
+
+class BloomFilterTest : public BaseTest {};
+
+TEST_F(BloomFilterTest, InactiveFilterContainsEverything) {
+  auto bloom_filter = BloomFilter{};
+  EXPECT_FALSE(bloom_filter.is_active());
+  EXPECT_TRUE(bloom_filter.contains(0));
+  EXPECT_TRUE(bloom_filter.contains(17));
+
+  bloom_filter.insert(17);
+  EXPECT_FALSE(bloom_filter.is_active());
+}
+
+TEST_F(BloomFilterTest, Sizing) {
+  const auto small_bloom_filter = BloomFilter{1};
+  EXPECT_EQ(small_bloom_filter.word_count(), BloomFilter::MIN_WORD_COUNT);
+
+  // 100'000 values with 8 bits each require 12'500 words, which are rounded up to the next power of two
+  const auto bloom_filter = BloomFilter{100'000};
+  EXPECT_EQ(bloom_filter.word_count(), 16'384);
+  EXPECT_GE(bloom_filter.bits_per_value_set(), 1);
+  EXPECT_LE(bloom_filter.bits_per_value_set(), 8);
+  EXPECT_EQ(bloom_filter.fill_ratio(), 0.0);
+
+  const auto large_bloom_filter = BloomFilter{size_t{1} << 40};
+  EXPECT_EQ(large_bloom_filter.word_count(), BloomFilter::MAX_WORD_COUNT);
+}
+
+TEST_F(BloomFilterTest, NoFalseNegativesAndFewFalsePositives) {
+  const auto value_count = 100'000;
+  auto bloom_filter = BloomFilter{value_count};
+
+  // std::hash is the identity for integers, so the filter has to work with hashes that only differ in few bits
+  const auto hash_function = std::hash<int64_t>{};
+  for (auto value = int64_t{0}; value < value_count; ++value) {
+    bloom_filter.insert(hash_function(value * 2));
+  }
+
+  for (auto value = int64_t{0}; value < value_count; ++value) {
+    EXPECT_TRUE(bloom_filter.contains(hash_function(value * 2)));
+  }
+
+  auto false_positive_count = 0;
+  for (auto value = int64_t{0}; value < value_count; ++value) {
+    false_positive_count += bloom_filter.contains(hash_function(value * 2 + 1));
+  }
+  // Theoretically, the false positive rate for 8 bits per value (before rounding up the size) is about 2.5%
+  EXPECT_LT(false_positive_count, value_count / 20);
+  EXPECT_GT(bloom_filter.fill_ratio(), 0.0);
+}
+
+TEST_F(BloomFilterTest, Move) {
+  auto bloom_filter = BloomFilter{100};
+  bloom_filter.insert(42);
+
+  auto moved_bloom_filter = std::move(bloom_filter);
+  EXPECT_TRUE(moved_bloom_filter.is_active());
+  EXPECT_TRUE(moved_bloom_filter.contains(42));
+
+  // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved) - moved-from filters are specified as inactive
+  EXPECT_FALSE(bloom_filter.is_active());
+}
+
+}  // namespace opossum
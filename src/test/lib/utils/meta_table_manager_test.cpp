@@ -10,8 +10,10 @@
 #include "utils/meta_tables/meta_columns_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_query_memory_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
+#include "utils/meta_tables/meta_session_memory_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
 #include "utils/meta_tables/meta_system_information_table.hpp"
 #include "utils/meta_tables/meta_system_utilization_table.hpp"
@@ -36,7 +38,9 @@ class MetaTableManagerTest : public BaseTest {
             std::make_shared<MetaSettingsTable>(),
             std::make_shared<MetaLogTable>(),
             std::make_shared<MetaSystemInformationTable>(),
-            std::make_shared<MetaSystemUtilizationTable>()};
+            std::make_shared<MetaSystemUtilizationTable>(),
+            std::make_shared<MetaQueryMemoryTable>(),
+            std::make_shared<MetaSessionMemoryTable>()};
   }
 
   static MetaTableNames meta_table_names() {
@@ -0,0 +1,52 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "utils/meta_tables/meta_query_memory_table.hpp"
+
+namespace opossum {
+
+class MetaQueryMemoryTest : public BaseTest {
+ protected:
+  const std::shared_ptr<Table> generate_meta_table(const std::shared_ptr<AbstractMetaTable>& table) const {
+    return table->_generate();
+  }
+};
+
+TEST_F(MetaQueryMemoryTest, ListsRunningQueries) {
+  const auto meta_query_memory_table = std::make_shared<MetaQueryMemoryTable>();
+  EXPECT_EQ(generate_meta_table(meta_query_memory_table)->row_count(), 0);
+
+  auto& admission_controller = *Hyrise::get().admission_controller;
+  admission_controller.set_query_budget(1'000);
+  const auto admission = AdmissionController::Admission{admission_controller, "SELECT * FROM foo"};
+  auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{admission.memory_resource().get()});
+  values = pmr_vector<int32_t>(10, PolymorphicAllocator<int32_t>{admission.memory_resource().get()});
+  admission.memory_resource()->add_spilled_bytes(123);
+
+  const auto query_memory = generate_meta_table(meta_query_memory_table);
+  ASSERT_EQ(query_memory->row_count(), 1);
+  const auto row = query_memory->get_row(0);
+  EXPECT_EQ(row[1], AllTypeVariant{pmr_string{"SELECT * FROM foo"}});
+  EXPECT_GE(boost::get<int64_t>(row[2]), 0);
+  EXPECT_EQ(row[3], AllTypeVariant{int64_t{40}});
+  EXPECT_EQ(row[4], AllTypeVariant{int64_t{440}});
+  EXPECT_EQ(row[5], AllTypeVariant{int64_t{123}});
+  EXPECT_EQ(row[6], AllTypeVariant{int64_t{1'000}});
+}
+
+TEST_F(MetaQueryMemoryTest, SelectFromMetaTable) {
+  // The querying statement is not listed itself, as the meta table is generated before it is admitted
+  const auto running_admission =
+      AdmissionController::Admission{*Hyrise::get().admission_controller, "SELECT * FROM foo"};
+
+  const auto sql = std::string{"SELECT sql_string, memory_budget FROM meta_query_memory"};
+  const auto [pipeline_status, result_table] = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+  ASSERT_EQ(result_table->row_count(), 1);
+  EXPECT_EQ(result_table->get_row(0)[0], AllTypeVariant{pmr_string{"SELECT * FROM foo"}});
+  EXPECT_TRUE(variant_is_null(result_table->get_row(0)[1]));
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "memory/budgeted_memory_resource.hpp"
+#include "utils/meta_tables/meta_session_memory_table.hpp"
+
+namespace opossum {
+
+class MetaSessionMemoryTest : public BaseTest {
+ protected:
+  const std::shared_ptr<Table> generate_meta_table(const std::shared_ptr<AbstractMetaTable>& table) const {
+    return table->_generate();
+  }
+};
+
+TEST_F(MetaSessionMemoryTest, ListsRegisteredSessions) {
+  const auto meta_session_memory_table = std::make_shared<MetaSessionMemoryTable>();
+  EXPECT_EQ(generate_meta_table(meta_session_memory_table)->row_count(), 0);
+
+  auto& admission_controller = *Hyrise::get().admission_controller;
+  const auto session = AdmissionController::SessionRegistration{admission_controller, "127.0.0.1:4242"};
+
+  // Memory of the session's statements is accounted to the session, even after the statement has been released
+  auto values = pmr_vector<int32_t>{};
+  {
+    const auto admission =
+        AdmissionController::Admission::try_create(admission_controller, "SELECT 1", session.memory_resource());
+    ASSERT_TRUE(admission);
+    values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{admission->memory_resource().get()});
+    admission->memory_resource()->add_spilled_bytes(123);
+  }
+
+  const auto session_memory = generate_meta_table(meta_session_memory_table);
+  ASSERT_EQ(session_memory->row_count(), 1);
+  const auto row = session_memory->get_row(0);
+  EXPECT_EQ(row[1], AllTypeVariant{pmr_string{"127.0.0.1:4242"}});
+  EXPECT_GE(boost::get<int64_t>(row[2]), 0);
+  EXPECT_EQ(row[3], AllTypeVariant{int64_t{400}});
+  EXPECT_EQ(row[4], AllTypeVariant{int64_t{400}});
+  EXPECT_EQ(row[5], AllTypeVariant{int64_t{123}});
+}
+
+}  // namespace opossum